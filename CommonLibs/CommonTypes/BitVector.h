@@ -0,0 +1,244 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstdint>
+
+#include "Vector.h"
+#include "Span.h"
+#include "./../CommonUtils/Bits.h"
+#include "./../CommonUtils/Assert.h"
+
+namespace Common
+{
+
+	/**
+	 * @brief Dynamic array of bits packed into 64-bit words.
+	 *
+	 * Takes 1 bit per flag instead of a byte of TVector<char>. Bulk
+	 * operations (AND, OR, XOR, ANDNOT, counting, search of set bits)
+	 * process a whole word per step, plain word loops are vectorized by
+	 * compiler. Words are available through GetWords() for own scans.
+	 *
+	 * Bits after Size in the last word are always 0, so words may be
+	 * compared and counted without masking.
+	 *
+	 * @see CRankSelect for rank and select queries over the bits.
+	*/
+	class CBitVector
+	{
+
+	public:
+
+		/// Returned by FindFirst() and FindNext() if there is no set bit.
+		static constexpr size_t NotFound = size_t(-1);
+
+		/// Creates empty vector (nothing is allocated).
+		CBitVector() = default;
+
+		/**
+		 * @brief Creates vector of Size equal bits.
+		 * @param Size Number of bits
+		 * @param bValue Optional. Value of all bits
+		*/
+		explicit CBitVector(size_t Size, bool bValue = false);
+
+
+		/// Value of bit at Position (must be less than size).
+		bool Test(size_t Position) const noexcept
+		{
+			ASSERT(Position < Size, "Bit vector: Out of range");
+			return (Words[Position / BitsPerWord] >> (Position % BitsPerWord)) & 1;
+		}
+
+		/// Sets bit at Position to 1.
+		void Set(size_t Position) noexcept
+		{
+			ASSERT(Position < Size, "Bit vector: Out of range");
+			Words[Position / BitsPerWord] |= uint64_t(1) << (Position % BitsPerWord);
+		}
+
+		/// Sets bit at Position to 0.
+		void Reset(size_t Position) noexcept
+		{
+			ASSERT(Position < Size, "Bit vector: Out of range");
+			Words[Position / BitsPerWord] &= ~(uint64_t(1) << (Position % BitsPerWord));
+		}
+
+		/// Inverts bit at Position.
+		void Flip(size_t Position) noexcept
+		{
+			ASSERT(Position < Size, "Bit vector: Out of range");
+			Words[Position / BitsPerWord] ^= uint64_t(1) << (Position % BitsPerWord);
+		}
+
+		/// Sets bit at Position to bValue.
+		void Assign(size_t Position, bool bValue) noexcept
+		{
+			bValue ? Set(Position) : Reset(Position);
+		}
+
+		/// Sets all bits to 1.
+		void SetAll() noexcept;
+
+		/// Sets all bits to 0.
+		void ResetAll() noexcept;
+
+
+		/// Bitwise AND with vector of the same size.
+		CBitVector& operator &= (const CBitVector& Other) noexcept;
+
+		/// Bitwise OR with vector of the same size.
+		CBitVector& operator |= (const CBitVector& Other) noexcept;
+
+		/// Bitwise XOR with vector of the same size.
+		CBitVector& operator ^= (const CBitVector& Other) noexcept;
+
+		/// Clears bits that are set in vector of the same size (this & ~Other).
+		CBitVector& AndNot(const CBitVector& Other) noexcept;
+
+		/// True if sizes and all bits are equal.
+		bool operator == (const CBitVector& Other) const noexcept;
+
+		bool operator != (const CBitVector& Other) const noexcept
+		{
+			return !(*this == Other);
+		}
+
+
+		/// Number of set bits.
+		size_t Count() const noexcept;
+
+		/// True if at least one bit is set.
+		bool Any() const noexcept;
+
+		/// Index of the first set bit or NotFound.
+		size_t FindFirst() const noexcept;
+
+		/**
+		 * @brief Finds the first set bit at Position or after it.
+		 * @param Position Index to start from (may be >= size)
+		 * @return Index of found bit or NotFound
+		*/
+		size_t FindNext(size_t Position) const noexcept;
+
+
+		/**
+		 * @brief Adds bit to the end.
+		 * @param bValue Value of new bit
+		*/
+		void Push(bool bValue);
+
+		/**
+		 * @brief Changes number of bits.
+		 * @param NewSize New number of bits
+		 * @param bValue Optional. Value of added bits
+		*/
+		void Resize(size_t NewSize, bool bValue = false);
+
+		/**
+		 * @brief Allocates words for the future bits.
+		 * @param BitCount Number of bits that fit without reallocation
+		*/
+		void Reserve(size_t BitCount);
+
+		/// Frees words that are not used.
+		void ShrinkToFit();
+
+		/// Removes all bits.
+		void Clear() noexcept;
+
+
+		/// Number of bits.
+		size_t GetSize() const noexcept
+		{
+			return Size;
+		}
+
+		/// Simple check if there are no bits.
+		bool IsEmpty() const noexcept
+		{
+			return Size == 0;
+		}
+
+		/// Words with bits, bit i is bit (i % 64) of word i / 64.
+		TSpan<const uint64_t> GetWords() const noexcept;
+
+	private:
+
+		TVector<uint64_t> Words;
+		size_t Size = 0;
+
+		// keeps bits after Size zero
+		void ClearTail() noexcept;
+
+	};
+
+
+	/**
+	 * @brief Rank and select queries over CBitVector in O(1) and
+	 *		  O(log n) time.
+	 *
+	 * Stores number of set bits before every block of 512 bits (one
+	 * 64-bit counter per 8 words: 12.5% of the bit vector). Rank adds
+	 * popcount of at most 7 words to the counter of the block. Select
+	 * finds the block by binary search over counters, then the word
+	 * and the bit in it.
+	 *
+	 * @note The index refers to the bit vector and must be rebuilt
+	 *		 with Build() after the bits are changed.
+	*/
+	class CRankSelect
+	{
+
+	public:
+
+		/// Returned by Select() if there are not enough set bits.
+		static constexpr size_t NotFound = size_t(-1);
+
+		/// Creates index over no bits.
+		CRankSelect() = default;
+
+		/**
+		 * @brief Creates index.
+		 * @param Bits Bit vector, must outlive the index
+		*/
+		explicit CRankSelect(const CBitVector& Bits);
+
+		/**
+		 * @brief Rebuilds index over the bit vector.
+		 * @param Bits Bit vector, must outlive the index
+		*/
+		void Build(const CBitVector& Bits);
+
+		/**
+		 * @brief Counts set bits before Position.
+		 * @param Position Index of bit, at most size of the bit vector
+		 * @return Number of set bits in [0; Position)
+		*/
+		size_t Rank(size_t Position) const noexcept;
+
+		/**
+		 * @brief Finds set bit by its number.
+		 * @param Rank Number of set bit, from 0
+		 * @return Index of the bit or NotFound if Rank >= GetCount()
+		*/
+		size_t Select(size_t Rank) const noexcept;
+
+		/// Number of set bits in the vector.
+		size_t GetCount() const noexcept
+		{
+			return Count;
+		}
+
+	private:
+
+		static constexpr size_t WordsPerBlock = 8;
+
+		const CBitVector* Bits = nullptr;
+		TVector<uint64_t> BlockRanks;	// set bits before every block
+		size_t Count = 0;
+
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstdint>
+
+#include "Span.h"
+#include "./../CommonUtils/Bits.h"
+#include "./../CommonUtils/Assert.h"
+
+namespace Common
+{
+
+	/**
+	 * @brief Fixed number of bits packed into 64-bit words, stored
+	 *		  inline (no allocation). Operations are the same as in
+	 *		  CBitVector, loops over words have constant length.
+	 *
+	 * Bits after N in the last word are always 0.
+	 *
+	 * @tparam N Number of bits, greater than 0
+	*/
+	template <size_t N>
+	class TBitset
+	{
+
+		static_assert(N > 0, "Bitset must have at least one bit");
+
+	public:
+
+		/// Returned by FindFirst() and FindNext() if there is no set bit.
+		static constexpr size_t NotFound = size_t(-1);
+
+		/// Creates bitset with all bits set to 0.
+		TBitset() = default;
+
+
+		/// Value of bit at Position (must be less than N).
+		bool Test(size_t Position) const noexcept
+		{
+			ASSERT(Position < N, "Bitset: Out of range");
+			return (Words[Position / BitsPerWord] >> (Position % BitsPerWord)) & 1;
+		}
+
+		/// Sets bit at Position to 1.
+		void Set(size_t Position) noexcept
+		{
+			ASSERT(Position < N, "Bitset: Out of range");
+			Words[Position / BitsPerWord] |= uint64_t(1) << (Position % BitsPerWord);
+		}
+
+		/// Sets bit at Position to 0.
+		void Reset(size_t Position) noexcept
+		{
+			ASSERT(Position < N, "Bitset: Out of range");
+			Words[Position / BitsPerWord] &= ~(uint64_t(1) << (Position % BitsPerWord));
+		}
+
+		/// Inverts bit at Position.
+		void Flip(size_t Position) noexcept
+		{
+			ASSERT(Position < N, "Bitset: Out of range");
+			Words[Position / BitsPerWord] ^= uint64_t(1) << (Position % BitsPerWord);
+		}
+
+		/// Sets bit at Position to bValue.
+		void Assign(size_t Position, bool bValue) noexcept
+		{
+			bValue ? Set(Position) : Reset(Position);
+		}
+
+		/// Sets all bits to 1.
+		void SetAll() noexcept;
+
+		/// Sets all bits to 0.
+		void ResetAll() noexcept;
+
+
+		/// Bitwise AND.
+		TBitset& operator &= (const TBitset& Other) noexcept;
+
+		/// Bitwise OR.
+		TBitset& operator |= (const TBitset& Other) noexcept;
+
+		/// Bitwise XOR.
+		TBitset& operator ^= (const TBitset& Other) noexcept;
+
+		/// Clears bits that are set in Other (this & ~Other).
+		TBitset& AndNot(const TBitset& Other) noexcept;
+
+		TBitset operator & (const TBitset& Other) const noexcept
+		{
+			return TBitset(*this) &= Other;
+		}
+
+		TBitset operator | (const TBitset& Other) const noexcept
+		{
+			return TBitset(*this) |= Other;
+		}
+
+		TBitset operator ^ (const TBitset& Other) const noexcept
+		{
+			return TBitset(*this) ^= Other;
+		}
+
+		/// True if all bits are equal.
+		bool operator == (const TBitset& Other) const noexcept;
+
+		bool operator != (const TBitset& Other) const noexcept
+		{
+			return !(*this == Other);
+		}
+
+
+		/// Number of set bits.
+		size_t Count() const noexcept;
+
+		/// True if at least one bit is set.
+		bool Any() const noexcept;
+
+		/// True if all N bits are set.
+		bool All() const noexcept;
+
+		/// Index of the first set bit or NotFound.
+		size_t FindFirst() const noexcept;
+
+		/**
+		 * @brief Finds the first set bit at Position or after it.
+		 * @param Position Index to start from (may be >= N)
+		 * @return Index of found bit or NotFound
+		*/
+		size_t FindNext(size_t Position) const noexcept;
+
+
+		/// Number of bits.
+		static constexpr size_t GetSize() noexcept
+		{
+			return N;
+		}
+
+		/// Words with bits, bit i is bit (i % 64) of word i / 64.
+		TSpan<const uint64_t> GetWords() const noexcept
+		{
+			return TSpan<const uint64_t>(Words, WordCount);
+		}
+
+	private:
+
+		static constexpr size_t WordCount = GetBitWordCount(N);
+
+		// mask of used bits in the last word
+		static constexpr uint64_t TailMask = N % BitsPerWord ?
+			~(~uint64_t(0) << (N % BitsPerWord)) : ~uint64_t(0);
+
+		uint64_t Words[WordCount] = {};
+
+	};
+
+}
+
+#include "Private/Bitset.tpp"
\ No newline at end of file
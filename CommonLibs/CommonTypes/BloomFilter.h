@@ -0,0 +1,276 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstdint>
+
+#include "Vector.h"
+#include "Serialization.h"
+#include "./../CommonUtils/Hash.h"
+#include "./../CommonUtils/Assert.h"
+
+namespace Common
+{
+
+	/**
+	 * @brief Probabilistic set: answers "definitely not present" or
+	 *		  "probably present". Never gives false negatives.
+	 *
+	 * Key is reduced to 64-bit hash, k bit positions are derived from
+	 * it by double hashing (h1 + i * h2). Number of bits is a power of
+	 * two, so the real false positive rate is at most the requested one.
+	 *
+	 * Keys are hashed with THash<T> (or given functor), raw bytes with
+	 * InsertBytes(). Precomputed 64-bit hashes may be used directly,
+	 * they must be well mixed (e.g. THash, HashBytes, MixBits).
+	 *
+	 * @note Filters may be united only if they have equal sizes. Build
+	 *		 them with equal ExpectedCount and FalsePositiveRate.
+	 * @see CBlockedBloomFilter for a faster filter (one cache miss per
+	 *		query) that needs a bit more memory.
+	*/
+	class CBloomFilter
+	{
+
+	public:
+
+		/// Upper limit of bits set per key.
+		static constexpr unsigned MaxHashCount = 30;
+
+		/// Creates empty filter that contains nothing (and no memory).
+		CBloomFilter() = default;
+
+		/**
+		 * @brief Creates empty filter sized for the expected number of keys.
+		 * @param ExpectedCount Number of keys that will be inserted
+		 * @param FalsePositiveRate Desired probability of "probably
+		 *		  present" for absent key, in (0; 1)
+		*/
+		CBloomFilter(size_t ExpectedCount, double FalsePositiveRate);
+
+
+		/// Adds key hashed with HashType.
+		template <typename T, typename HashType = THash<T>>
+		void Insert(const T& Key, const HashType& Hash = HashType())
+		{
+			InsertHash(static_cast<uint64_t>(Hash(Key)));
+		}
+
+		/// False if key was definitely not inserted.
+		template <typename T, typename HashType = THash<T>>
+		bool MayContain(const T& Key, const HashType& Hash = HashType()) const
+		{
+			return MayContainHash(static_cast<uint64_t>(Hash(Key)));
+		}
+
+		/// Adds key given as bytes (hashed with HashBytes()).
+		void InsertBytes(const void* Data, size_t Size) noexcept;
+
+		/// MayContain() for key given as bytes.
+		bool MayContainBytes(const void* Data, size_t Size) const noexcept;
+
+		/// Adds key given by its 64-bit hash.
+		void InsertHash(uint64_t Hash) noexcept;
+
+		/// MayContain() for key given by its 64-bit hash.
+		bool MayContainHash(uint64_t Hash) const noexcept;
+
+
+		/**
+		 * @brief Adds all keys of other filter (bitwise OR).
+		 * @param Other Filter with the same number of bits and hashes
+		*/
+		void Union(const CBloomFilter& Other) noexcept;
+
+		/// True if Union() with Other is possible.
+		bool IsCompatible(const CBloomFilter& Other) const noexcept;
+
+		/// Removes all keys, memory is kept.
+		void Clear() noexcept;
+
+		/**
+		 * @brief Estimates false positive rate from the share of set bits.
+		 * @return Probability of a false positive for current contents
+		*/
+		double EstimateFalsePositiveRate() const noexcept;
+
+
+		/// Number of bits (power of two or 0).
+		size_t GetBitCount() const noexcept
+		{
+			return Words.GetSize() * 64;
+		}
+
+		/// Number of bits set per key.
+		unsigned GetHashCount() const noexcept
+		{
+			return HashCount;
+		}
+
+	private:
+
+		template <typename T, typename Enable>
+		friend struct TSerializer;
+
+		TVector<uint64_t> Words;
+		unsigned HashCount = 0;
+
+	};
+
+
+	/**
+	 * @brief Bloom filter that keeps all bits of a key in one cache line.
+	 *
+	 * Filter is an array of 512-bit blocks aligned to 64 bytes. High
+	 * bits of the hash choose the block, and every of its 8 words gets
+	 * one bit chosen by the low bits (split block filter). A query
+	 * loads one cache line and tests all 8 words at once (SSE2 if
+	 * available), without branches between bits.
+	 *
+	 * For the same false positive rate it needs ~1.3-1.5x bits of
+	 * CBloomFilter; block count is rounded up to a power of two.
+	 * Interface is the same as in CBloomFilter.
+	*/
+	class CBlockedBloomFilter
+	{
+
+	public:
+
+		/// Creates empty filter that contains nothing (and no memory).
+		CBlockedBloomFilter() = default;
+
+		/**
+		 * @brief Creates empty filter sized for the expected number of keys.
+		 * @param ExpectedCount Number of keys that will be inserted
+		 * @param FalsePositiveRate Desired probability of "probably
+		 *		  present" for absent key, in (0; 1)
+		*/
+		CBlockedBloomFilter(size_t ExpectedCount, double FalsePositiveRate);
+
+		CBlockedBloomFilter(const CBlockedBloomFilter& Other);
+
+		CBlockedBloomFilter(CBlockedBloomFilter&& Other) noexcept;
+
+		~CBlockedBloomFilter();
+
+		CBlockedBloomFilter& operator = (const CBlockedBloomFilter& Other);
+
+		CBlockedBloomFilter& operator = (CBlockedBloomFilter&& Other) noexcept;
+
+
+		/// Adds key hashed with HashType.
+		template <typename T, typename HashType = THash<T>>
+		void Insert(const T& Key, const HashType& Hash = HashType())
+		{
+			InsertHash(static_cast<uint64_t>(Hash(Key)));
+		}
+
+		/// False if key was definitely not inserted.
+		template <typename T, typename HashType = THash<T>>
+		bool MayContain(const T& Key, const HashType& Hash = HashType()) const
+		{
+			return MayContainHash(static_cast<uint64_t>(Hash(Key)));
+		}
+
+		/// Adds key given as bytes (hashed with HashBytes()).
+		void InsertBytes(const void* Data, size_t Size) noexcept;
+
+		/// MayContain() for key given as bytes.
+		bool MayContainBytes(const void* Data, size_t Size) const noexcept;
+
+		/// Adds key given by its 64-bit hash.
+		void InsertHash(uint64_t Hash) noexcept;
+
+		/// MayContain() for key given by its 64-bit hash.
+		bool MayContainHash(uint64_t Hash) const noexcept;
+
+
+		/**
+		 * @brief Adds all keys of other filter (bitwise OR).
+		 * @param Other Filter with the same number of blocks
+		*/
+		void Union(const CBlockedBloomFilter& Other) noexcept;
+
+		/// True if Union() with Other is possible.
+		bool IsCompatible(const CBlockedBloomFilter& Other) const noexcept;
+
+		/// Removes all keys, memory is kept.
+		void Clear() noexcept;
+
+		/// Estimates false positive rate from the share of set bits.
+		double EstimateFalsePositiveRate() const noexcept;
+
+		/**
+		 * @brief Swaps two filters internally without deep copy.
+		 * @param Other Object to swap resources with
+		*/
+		void Swap(CBlockedBloomFilter& Other) noexcept;
+
+
+		/// Number of bits (multiple of 512).
+		size_t GetBitCount() const noexcept
+		{
+			return BlockCount * 512;
+		}
+
+		/// Number of 512-bit blocks (power of two or 0).
+		size_t GetBlockCount() const noexcept
+		{
+			return BlockCount;
+		}
+
+	private:
+
+		template <typename T, typename Enable>
+		friend struct TSerializer;
+
+		static constexpr size_t WordsPerBlock = 8;
+
+		uint64_t* Buffer = nullptr;	// allocated words, Blocks inside
+		uint64_t* Blocks = nullptr;	// aligned to cache line
+		size_t BlockCount = 0;
+
+		// allocates zeroed blocks, old ones are freed
+		void AllocateBlocks(size_t Count);
+		void FreeBlocks() noexcept;
+
+	};
+
+
+	/*
+	 * Format of filters:
+	 *	- CBloomFilter: hash count (LEB128), then words as TVector
+	 *	- CBlockedBloomFilter: block count (LEB128), then 8 words
+	 *	  (little-endian) per block
+	*/
+
+	template <>
+	struct TSerializer<CBloomFilter>
+	{
+		static constexpr bool bBitwise = false;
+
+		template <typename WriterType>
+		static void Write(WriterType& Writer, const CBloomFilter& Value);
+
+		/// Throws CBadFormat if sizes are not valid.
+		template <typename ReaderType>
+		static void Read(ReaderType& Reader, CBloomFilter& OutValue);
+	};
+
+	template <>
+	struct TSerializer<CBlockedBloomFilter>
+	{
+		static constexpr bool bBitwise = false;
+
+		template <typename WriterType>
+		static void Write(WriterType& Writer,
+			const CBlockedBloomFilter& Value);
+
+		/// Throws CBadFormat if sizes are not valid.
+		template <typename ReaderType>
+		static void Read(ReaderType& Reader, CBlockedBloomFilter& OutValue);
+	};
+
+}
+
+#include "Private/BloomFilter.tpp"
\ No newline at end of file
@@ -0,0 +1,279 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstdint>
+
+#include "Vector.h"
+#include "HashMap.h"
+#include "IntrusiveList.h"
+#include "./../CommonUtils/Assert.h"
+
+namespace Common
+{
+
+	/// Counters of cache accesses.
+	struct CCacheStats
+	{
+		uint64_t Hits = 0;			// Get() found the key
+		uint64_t Misses = 0;		// Get() did not find the key
+		uint64_t Evictions = 0;		// entries removed to free space
+	};
+
+
+	/// Default eviction callback of caches: does nothing.
+	struct CIgnoreEviction
+	{
+		template <typename K, typename V>
+		void operator () (const K&, V&) const noexcept {}
+	};
+
+
+	/**
+	 * @brief Cache of at most Capacity entries that evicts the least
+	 *		  recently used one. All operations are O(1).
+	 *
+	 * Entries live in a node pool (TVector reserved to Capacity, so
+	 * nodes never move), recency order is TIntrusiveList over the
+	 * nodes, THashMap maps keys to nodes. After the pool is full an
+	 * insertion reuses the node of evicted entry, so a warm cache does
+	 * not allocate.
+	 *
+	 * Get() and Put() make an entry the most recent, Peek() does not.
+	 * Get() updates hit and miss counters.
+	 *
+	 * @note Erased entries keep their key and value until the node is
+	 *		 reused or the cache is destroyed.
+	 * @tparam K Type of key, copyable and hashable with HashType
+	 * @tparam V Type of value, copyable
+	 * @tparam HashType Hash functor of keys
+	 * @tparam EvictionType Functor void(const K&, V&) called after an
+	 *		   entry is evicted (not when erased explicitly). The entry
+	 *		   is already out of the cache: if the callback throws, the
+	 *		   new entry is not inserted, but capacity is not lost.
+	*/
+	template <typename K, typename V, typename HashType = THash<K>,
+		typename EvictionType = CIgnoreEviction>
+	class TLruCache
+	{
+
+	public:
+
+		/**
+		 * @brief Creates empty cache. Memory for all nodes is reserved.
+		 * @param Capacity Max number of entries, must not be 0
+		 * @param OnEviction Optional. Eviction callback
+		*/
+		explicit TLruCache(size_t Capacity,
+			const EvictionType& OnEviction = EvictionType());
+
+		TLruCache(const TLruCache&) = delete;
+		TLruCache& operator = (const TLruCache&) = delete;
+
+
+		/**
+		 * @brief Finds value and makes the entry most recently used.
+		 * @param Key Key to look for
+		 * @return Pointer to the value, nullptr on miss
+		*/
+		V* Get(const K& Key);
+
+		/**
+		 * @brief Finds value without changing order and counters.
+		 * @param Key Key to look for
+		 * @return Pointer to the value, nullptr if there is no such key
+		*/
+		const V* Peek(const K& Key) const;
+
+		/**
+		 * @brief Adds entry or replaces value of existing one, and makes
+		 *		  it most recently used. Evicts the least recently used
+		 *		  entry if cache is full.
+		 * @param Key Key of entry
+		 * @param Value Value of entry
+		 * @return Reference to the stored value
+		*/
+		V& Put(const K& Key, const V& Value);
+
+		/**
+		 * @brief Removes entry (eviction callback is not called).
+		 * @param Key Key of entry
+		 * @return False if there was no such key
+		*/
+		bool Erase(const K& Key);
+
+		/// Removes all entries, counters are kept.
+		void Clear();
+
+
+		/// Number of entries.
+		size_t GetSize() const noexcept;
+
+		/// Max number of entries.
+		size_t GetCapacity() const noexcept;
+
+		/// Simple check if there are no entries.
+		bool IsEmpty() const noexcept;
+
+		/// Hit, miss and eviction counters.
+		const CCacheStats& GetStats() const noexcept;
+
+		/// Sets all counters to 0.
+		void ResetStats() noexcept;
+
+	private:
+
+		struct CNode
+		{
+			K Key;
+			V Value;
+			CIntrusiveListHook Hook;
+		};
+
+		typedef TIntrusiveList<CNode, &CNode::Hook> CNodeList;
+
+		// declared first: lists unlink nodes before the pool is freed
+		TVector<CNode> Nodes;
+		CNodeList Order;		// front is the least recently used
+		CNodeList FreeNodes;	// erased nodes, ready for reuse
+		THashMap<K, CNode*, HashType> Index;
+		size_t Capacity;
+		CCacheStats Stats;
+		EvictionType OnEviction;
+
+		// node for a new entry: free, new or evicted one
+		CNode& AcquireNode(const K& Key, const V& Value);
+
+	};
+
+
+	/**
+	 * @brief Cache of at most Capacity entries that evicts the least
+	 *		  frequently used one (of those, the least recently used).
+	 *		  All operations are O(1).
+	 *
+	 * Storage is the same as in TLruCache. Nodes are kept in one
+	 * intrusive list sorted by access count, entries with the same
+	 * count form a run ordered by recency. A second THashMap points
+	 * to the last node of every run, so an access moves the node to the
+	 * end of the next run in O(1), and the victim is always the front.
+	 *
+	 * Get() and Put() increment access count of an entry, new entry
+	 * starts with count 1. Peek() does not change anything.
+	 *
+	 * @note Template parameters and notes are the same as in TLruCache.
+	*/
+	template <typename K, typename V, typename HashType = THash<K>,
+		typename EvictionType = CIgnoreEviction>
+	class TLfuCache
+	{
+
+	public:
+
+		/**
+		 * @brief Creates empty cache. Memory for all nodes is reserved.
+		 * @param Capacity Max number of entries, must not be 0
+		 * @param OnEviction Optional. Eviction callback
+		*/
+		explicit TLfuCache(size_t Capacity,
+			const EvictionType& OnEviction = EvictionType());
+
+		TLfuCache(const TLfuCache&) = delete;
+		TLfuCache& operator = (const TLfuCache&) = delete;
+
+
+		/**
+		 * @brief Finds value and increments access count of the entry.
+		 * @param Key Key to look for
+		 * @return Pointer to the value, nullptr on miss
+		*/
+		V* Get(const K& Key);
+
+		/**
+		 * @brief Finds value without changing order and counters.
+		 * @param Key Key to look for
+		 * @return Pointer to the value, nullptr if there is no such key
+		*/
+		const V* Peek(const K& Key) const;
+
+		/**
+		 * @brief Adds entry or replaces value of existing one (then
+		 *		  its access count is incremented). Evicts the least
+		 *		  frequently used entry if cache is full.
+		 * @param Key Key of entry
+		 * @param Value Value of entry
+		 * @return Reference to the stored value
+		*/
+		V& Put(const K& Key, const V& Value);
+
+		/**
+		 * @brief Removes entry (eviction callback is not called).
+		 * @param Key Key of entry
+		 * @return False if there was no such key
+		*/
+		bool Erase(const K& Key);
+
+		/// Removes all entries, counters are kept.
+		void Clear();
+
+		/**
+		 * @brief Number of accesses of the entry.
+		 * @param Key Key of entry
+		 * @return Access count, 0 if there is no such key
+		*/
+		uint64_t GetFrequency(const K& Key) const;
+
+
+		/// Number of entries.
+		size_t GetSize() const noexcept;
+
+		/// Max number of entries.
+		size_t GetCapacity() const noexcept;
+
+		/// Simple check if there are no entries.
+		bool IsEmpty() const noexcept;
+
+		/// Hit, miss and eviction counters.
+		const CCacheStats& GetStats() const noexcept;
+
+		/// Sets all counters to 0.
+		void ResetStats() noexcept;
+
+	private:
+
+		struct CNode
+		{
+			K Key;
+			V Value;
+			uint64_t Frequency;
+			CIntrusiveListHook Hook;
+		};
+
+		typedef TIntrusiveList<CNode, &CNode::Hook> CNodeList;
+
+		// declared first: lists unlink nodes before the pool is freed
+		TVector<CNode> Nodes;
+		CNodeList Order;		// by frequency, then by recency
+		CNodeList FreeNodes;	// erased nodes, ready for reuse
+		THashMap<K, CNode*, HashType> Index;
+		THashMap<uint64_t, CNode*> RunTails;	// frequency - last node
+		size_t Capacity;
+		CCacheStats Stats;
+		EvictionType OnEviction;
+
+		CNode& AcquireNode(const K& Key, const V& Value);
+
+		// moves node to the end of the run of the next frequency
+		void Touch(CNode& Node);
+
+		// moves tail of the node run to the previous node if needed
+		void LeaveRun(CNode& Node);
+
+		// LeaveRun() and unlinks node from Order
+		void Detach(CNode& Node);
+
+	};
+
+}
+
+#include "Private/Cache.tpp"
\ No newline at end of file
@@ -0,0 +1,219 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Common
+{
+
+	/// Defines how extra Capacity is reserved by containers.
+	enum class EReservedCapacityRule : uint8_t
+	{
+		/**
+		 * [ADD] allocates (NewSize-1)*2 if capacity
+		 * exceed and vector is not small enough <br>
+		 * [DEL] allocates 2*Size if Capacity > 4 * Size
+		 * and vector is not small enough
+		*/
+		Exponential,
+
+		/**
+		 * [ADD] allocates NewSize + 3 + 32 / sizeof(T) if
+		 * capacity exceed <br>
+		 * [DEL] allocates Size + 4 + 32 / sizeof(T) if size
+		 * exceeds capacity by more than 2*(8 + 64 / sizeof(T))
+		*/
+		Linear,
+
+		/**
+		 * [ADD, DEL] memory is never reserved automatically;
+		 * Decrease of vector size causes ShrinkToFit() immediately
+		*/
+		NeverReserve
+	};
+
+
+	/// Allocators whose size classes are known to TSizeClassGrowth.
+	enum class EAllocatorSizeClasses : uint8_t
+	{
+		/// glibc malloc: 2 * sizeof(size_t) steps, pages for mmap chunks
+		Glibc,
+
+		/// jemalloc: 16 byte steps, then 4 classes per power of two
+		Jemalloc
+	};
+
+	/**
+	 * @brief Rounds requested allocation size up to the size that
+	 *		  allocator actually reserves for it.
+	 * @param Bytes Requested allocation size
+	 * @param SizeClasses Allocator which rounding is reproduced
+	 * @return Usable size of the block, not less than Bytes
+	*/
+	size_t RoundUpToSizeClass(size_t Bytes,
+		EAllocatorSizeClasses SizeClasses);
+
+
+	/*
+	 * Capacity policies are types with one static function, passed to
+	 * containers as template parameters, so calls are resolved (and
+	 * usually inlined) at compile time. Policies are consulted only for
+	 * Exponential and Linear rules; NeverReserve is handled by the
+	 * container itself. Custom policies may ignore the rule.
+	 *
+	 * Growth policy:
+	 *	static size_t CalcExtendedCapacity(size_t RequiredSize,
+	 *		size_t ElementSize, EReservedCapacityRule Rule) noexcept;
+	 *	Returns capacity to allocate, at least RequiredSize.
+	 *
+	 * Shrink policy:
+	 *	static size_t CalcShrinkedCapacity(size_t Size, size_t Capacity,
+	 *		size_t ElementSize, EReservedCapacityRule Rule) noexcept;
+	 *	Returns new capacity (at least Size), or Capacity to keep memory.
+	*/
+
+
+	/// Growth presets described in EReservedCapacityRule (default).
+	struct CRuleGrowth
+	{
+		static size_t CalcExtendedCapacity(const size_t RequiredSize,
+			const size_t ElementSize,
+			const EReservedCapacityRule Rule) noexcept
+		{
+			if (Rule == EReservedCapacityRule::Exponential)
+			{	// Capacity is never calculated for size==0; omitting that
+				return RequiredSize >= 2 ? (RequiredSize - 1) * 2 : 2;
+			}
+			return RequiredSize + 3 + 32 / ElementSize;
+		}
+	};
+
+
+	/// Shrink presets described in EReservedCapacityRule (default).
+	struct CRuleShrink
+	{
+		static size_t CalcShrinkedCapacity(const size_t Size,
+			const size_t Capacity, const size_t ElementSize,
+			const EReservedCapacityRule Rule) noexcept
+		{
+			if (Rule == EReservedCapacityRule::Exponential)
+			{
+				// if capacity exceeds 4*size and is
+				// not small, dealloc half of it.
+				if (Capacity >= 4 * Size &&
+					Capacity >= 2 + 16 / ElementSize)
+				{
+					return Size * 2;
+				}
+				return Capacity;
+			}
+
+			// if capacity exceeds size by > 2 chunks,
+			// leave one empty chunk
+			if (Capacity - Size >= 8 + 64 / ElementSize)
+			{
+				return Size + 4 + 32 / ElementSize;
+			}
+			return Capacity;
+		}
+	};
+
+
+	/**
+	 * @brief Multiplies required size by Numerator / Denominator.
+	 *
+	 * Factors below 2 (e.g. TFactorGrowth<3, 2>) let allocator reuse
+	 * memory freed by previous reallocations of the same container,
+	 * and waste less memory on average.
+	 *
+	 * @tparam Numerator Growth factor numerator
+	 * @tparam Denominator Growth factor denominator
+	*/
+	template <size_t Numerator, size_t Denominator = 1>
+	struct TFactorGrowth
+	{
+		static_assert(Numerator > Denominator && Denominator > 0,
+			"Growth factor must be greater than 1");
+
+		static size_t CalcExtendedCapacity(const size_t RequiredSize,
+			const size_t ElementSize, EReservedCapacityRule) noexcept
+		{
+			const size_t MinCapacity = ElementSize >= 16 ? 1 : 16 / ElementSize;
+			const size_t Extended = RequiredSize
+				+ RequiredSize / Denominator * (Numerator - Denominator)
+				+ RequiredSize % Denominator * (Numerator - Denominator)
+				/ Denominator;
+			return Extended > MinCapacity ? Extended : MinCapacity;
+		}
+	};
+
+	/// Grows capacity by 1.5 times.
+	typedef TFactorGrowth<3, 2> COneAndHalfGrowth;
+
+
+	/**
+	 * @brief Extends capacity calculated by BaseGrowth to fill the whole
+	 *		  block that allocator reserves anyway.
+	 *
+	 * Allocators round requests up to fixed size classes, so the slack
+	 * at the end of the block is free to use.
+	 *
+	 * @tparam BaseGrowth Growth policy that gives minimal capacity
+	 * @tparam SizeClasses Allocator which rounding is reproduced
+	*/
+	template <typename BaseGrowth = COneAndHalfGrowth,
+		EAllocatorSizeClasses SizeClasses = EAllocatorSizeClasses::Glibc>
+	struct TSizeClassGrowth
+	{
+		static size_t CalcExtendedCapacity(const size_t RequiredSize,
+			const size_t ElementSize,
+			const EReservedCapacityRule Rule) noexcept
+		{
+			const size_t Capacity = BaseGrowth::CalcExtendedCapacity(
+				RequiredSize, ElementSize, Rule);
+			return RoundUpToSizeClass(Capacity * ElementSize, SizeClasses)
+				/ ElementSize;
+		}
+	};
+
+
+	/**
+	 * @brief Shrinks when Capacity > ShrinkAt * Size, down to
+	 *		  ShrinkTo * Size.
+	 *
+	 * The gap between thresholds is the hysteresis: after a shrink,
+	 * size has to grow ShrinkTo times before the next reallocation,
+	 * or drop ShrinkAt / ShrinkTo times before the next shrink, so
+	 * alternating Push/Pop near a threshold cannot reallocate on every
+	 * call. Blocks smaller than MinBytes are never shrinked.
+	 *
+	 * @tparam ShrinkAt Capacity / Size ratio that triggers shrink
+	 * @tparam ShrinkTo Capacity / Size ratio after shrink
+	 * @tparam MinBytes Capacity in bytes that is always kept
+	*/
+	template <size_t ShrinkAt = 4, size_t ShrinkTo = 2,
+		size_t MinBytes = 256>
+	struct THysteresisShrink
+	{
+		static_assert(ShrinkAt > ShrinkTo && ShrinkTo > 1,
+			"Thresholds must not overlap");
+
+		static size_t CalcShrinkedCapacity(const size_t Size,
+			const size_t Capacity, const size_t ElementSize,
+			EReservedCapacityRule) noexcept
+		{
+			if (Capacity * ElementSize <= MinBytes
+				|| Capacity / ShrinkAt <= Size)
+			{
+				return Capacity;
+			}
+
+			const size_t MinCapacity = MinBytes / ElementSize;
+			const size_t Shrinked = Size * ShrinkTo;
+			return Shrinked > MinCapacity ? Shrinked : MinCapacity;
+		}
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,173 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>			// unique_lock
+#include <shared_mutex>
+
+#include "HashMap.h"
+#include "./../CommonUtils/Intrinsics.h"		// CacheLineSize
+#include "./../CommonUtils/BlockAllocation.h"
+
+namespace Common
+{
+
+	/**
+	 * @brief Hash map that may be used from many threads at once.
+	 *
+	 * Keys are split between shards by hash, every shard is a THashMap
+	 * with its own reader-writer lock. Threads that work with different
+	 * shards do not wait for each other, readers of one shard do not
+	 * wait for each other either. Shards are padded so that their locks
+	 * do not share cache lines.
+	 *
+	 * References to values are never returned: they would outlive the
+	 * lock. Values are read and modified by functions called under the
+	 * lock of the shard (FindAndApply(), FindAndUpdate()).
+	 *
+	 * @note Functions passed to the map must not call the map itself:
+	 *		 locks are not recursive.
+	 * @note GetSize(), ForEach() and EraseIf() lock shards one by one,
+	 *		 so they do not see one consistent state of the whole map
+	 *		 under concurrent modifications.
+	 * @tparam K Type of key, must be equality comparable
+	 * @tparam V Type of value
+	 * @tparam HashType Functor size_t(const K&), THash<K> by default
+	*/
+	template <typename K, typename V, typename HashType = THash<K>>
+	class TConcurrentHashMap
+	{
+
+	public:
+
+		static constexpr size_t MaxShardCount = 4096;
+
+		/**
+		 * @brief Creates empty map.
+		 * @param ShardCount Optional. Rounded up to a power of two,
+		 *		  at most MaxShardCount. 0 picks default for this
+		 *		  machine: 4 shards per hardware thread
+		 * @param Hash Optional. Hash functor
+		*/
+		explicit TConcurrentHashMap(size_t ShardCount = 0,
+			const HashType& Hash = HashType());
+
+		TConcurrentHashMap(const TConcurrentHashMap&) = delete;
+		TConcurrentHashMap& operator = (const TConcurrentHashMap&) = delete;
+
+		~TConcurrentHashMap();
+
+
+		/**
+		 * @brief Adds an entry if the key is not in the map yet.
+		 * @param Key Key of new entry
+		 * @param Value Value of new entry
+		 * @return True if inserted, false if key exists (value is kept)
+		*/
+		bool Insert(const K& Key, const V& Value);
+
+		/**
+		 * @brief Adds an entry or replaces value of existing one.
+		 * @param Key Key of entry
+		 * @param Value New value
+		 * @return True if entry was added, false if replaced
+		*/
+		bool Upsert(const K& Key, const V& Value);
+
+		/**
+		 * @brief Calls function for the value under shared (read) lock.
+		 * @tparam FunctionType void(const V&)
+		 * @param Key Key to look for
+		 * @param Function Function to call if key is found
+		 * @return False if there is no such key
+		*/
+		template <typename FunctionType>
+		bool FindAndApply(const K& Key, FunctionType Function) const;
+
+		/**
+		 * @brief Calls function for the value under exclusive lock.
+		 * @tparam FunctionType void(V&)
+		 * @param Key Key to look for
+		 * @param Function Function to call if key is found
+		 * @return False if there is no such key
+		*/
+		template <typename FunctionType>
+		bool FindAndUpdate(const K& Key, FunctionType Function);
+
+		/// Checks if key is in the map.
+		bool Contains(const K& Key) const;
+
+		/**
+		 * @brief Removes entry with the key.
+		 * @param Key Key of entry
+		 * @return False if there was no such key
+		*/
+		bool Erase(const K& Key);
+
+		/**
+		 * @brief Removes all entries that satisfy predicate, shard by
+		 *		  shard (one exclusive lock at a time).
+		 * @tparam FunctionType bool(const K&, V&)
+		 * @param Predicate Returns true for entries to remove. May be
+		 *		  called more than once for a kept entry
+		 * @return Number of removed entries
+		*/
+		template <typename FunctionType>
+		size_t EraseIf(FunctionType Predicate);
+
+		/**
+		 * @brief Calls function for every entry, shard by shard under
+		 *		  shared lock, in no specific order.
+		 * @tparam FunctionType void(const K&, const V&)
+		 * @param Function Function to call
+		*/
+		template <typename FunctionType>
+		void ForEach(FunctionType Function) const;
+
+
+		/**
+		 * @brief Allocates slots for the future entries in all shards.
+		 * @param Count Expected number of entries in the whole map
+		*/
+		void Reserve(size_t Count);
+
+		/// Removes all entries and frees memory of shards.
+		void Clear();
+
+
+		/// Number of entries (sum over shards, see notes of the class).
+		size_t GetSize() const;
+
+		/// Simple check if there are no entries.
+		bool IsEmpty() const;
+
+		/// Number of independently locked parts.
+		size_t GetShardCount() const noexcept;
+
+		/// Shard count used by default: 4 per hardware thread, power of two.
+		static size_t GetDefaultShardCount() noexcept;
+
+	private:
+
+		struct CShard
+		{
+			mutable std::shared_mutex Lock;
+			THashMap<K, V, HashType> Map;
+			// buffers have no alignment of cache lines, so padding
+			// separates hot fields of neighbours instead of alignas
+			unsigned char Padding[CacheLineSize];
+		};
+
+		CShard* Shards = nullptr;
+		size_t ShardCount = 0;
+		unsigned ShardShift = 0;	// shard is taken from high hash bits
+		HashType Hasher;
+
+		CShard& ShardOf(const K& Key) const;
+
+	};
+
+}
+
+#include "Private/ConcurrentHashMap.tpp"
\ No newline at end of file
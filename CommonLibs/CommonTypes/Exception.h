@@ -2,11 +2,53 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "Pair.h"
 #include "../CommonUtils/RawString.h"
 
+// Library builds without exceptions (-fno-exceptions, /EHs-c-).
+// Then errors that would throw print the message and abort, and
+// Try* methods are the way to handle them.
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+	#define COMMON_EXCEPTIONS 1
+#else
+	#define COMMON_EXCEPTIONS 0
+#endif
+
+#if COMMON_EXCEPTIONS
+
+	#define COMMON_TRY try
+	#define COMMON_CATCH_ALL catch (...)
+	#define COMMON_RETHROW throw
+	#define COMMON_THROW(Exception) throw Exception
+
+#else
+
+	#include <cstdio>	// fputs
+	#include <cstdlib>	// abort
+
+	// catch block becomes dead else-branch of the try block
+	#define COMMON_TRY if (true)
+	#define COMMON_CATCH_ALL else
+	#define COMMON_RETHROW std::abort()
+	#define COMMON_THROW(Exception) ::Common::TerminateWith(Exception)
+
+#endif
+
 namespace Common {
 
+	/// Result of Try* methods, that never throw by themselves.
+	enum class EStatus : uint8_t
+	{
+		Ok,
+		OutOfRange,		// same cases as COutOfRange
+		BadAlloc,		// same cases as CBadAlloc
+		DoesNotExist,	// same cases as CDoesNotExist
+		IOError,		// same cases as CIOError
+		BadFormat		// same cases as CBadFormat
+	};
+
 	/// Basic exception class. C-style message is required.
 	class CException
 	{
@@ -161,4 +203,72 @@ namespace Common {
 
 	};
 
+
+
+	/// Represents failed file operation (open, map, read, write).
+	class CIOError : public CException
+	{
+
+	public:
+
+		/**
+		 * @brief Pass only message, if other properties cannot be specified.
+		 * @param Message Description. Will be copied to the inner buffer
+		 * @note If length of message > 47, first 47 symbols will be saved.
+		*/
+		CIOError(const char* Message) noexcept
+			: CException(Message) {};
+
+	};
+
+
+
+	/// Represents data that does not match the expected format.
+	class CBadFormat : public CException
+	{
+
+	public:
+
+		/**
+		 * @brief Pass only message, if other properties cannot be specified.
+		 * @param Message Description. Will be copied to the inner buffer
+		 * @note If length of message > 47, first 47 symbols will be saved.
+		*/
+		CBadFormat(const char* Message) noexcept
+			: CException(Message) {};
+
+	};
+
+
+
+	/// Represents use of iterator after its container has been changed.
+	class CInvalidIterator : public CException
+	{
+
+	public:
+
+		/**
+		 * @brief Pass only message, if other properties cannot be specified.
+		 * @param Message Description. Will be copied to the inner buffer
+		 * @note If length of message > 47, first 47 symbols will be saved.
+		*/
+		CInvalidIterator(const char* Message) noexcept
+			: CException(Message) {};
+
+	};
+
+
+
+#if !COMMON_EXCEPTIONS
+
+	/// Replaces throw when exceptions are disabled.
+	[[noreturn]] inline void TerminateWith(const CException& Exception) noexcept
+	{
+		std::fputs(Exception.GetMessage(), stderr);
+		std::fputs("\n", stderr);
+		std::abort();
+	}
+
+#endif
+
 }
\ No newline at end of file
@@ -0,0 +1,242 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+// Suppress uninitialized allocated memory warning
+#pragma warning(push)
+#pragma warning(disable: 26495)
+
+#include <new>	// placement new language feature
+#include <type_traits>
+
+#include "Exception.h"
+#include "./../CommonUtils/TypeOperations.h"	// Move, Forward
+
+namespace Common
+{
+
+	/**
+	 * @brief Wrapper that marks value as an error for TExpected.
+	 * @see MakeUnexpected() to deduce error type
+	*/
+	template <typename E>
+	struct TUnexpected
+	{
+		E Error;
+	};
+
+	/**
+	 * @brief Creates error to be returned as TExpected.
+	 * @param Error Error value
+	 * @return TUnexpected that is convertible to any TExpected<T, E>
+	*/
+	template <typename E>
+	TUnexpected<E> MakeUnexpected(E Error);
+
+
+	/// Aligned buffer for value or error. Used by TExpected only.
+	template <typename T, typename E>
+	class TExpectedBuffer
+	{
+	protected:
+
+		static constexpr size_t BufferSize =
+			sizeof(T) > sizeof(E) ? sizeof(T) : sizeof(E);
+
+		alignas(T) alignas(E) unsigned char Buffer[BufferSize];
+		bool bHasValue = false;
+
+		// low level memory management
+		template <typename ValueType>
+		inline void ConstructValue(ValueType&& Value);
+		template <typename ErrorType>
+		inline void ConstructError(ErrorType&& Error);
+		inline void ConstructFrom(const TExpectedBuffer& Other);
+		inline void ConstructFrom(TExpectedBuffer&& Other);
+		inline void Destruct() noexcept;
+
+		inline T& Value() noexcept;
+		inline const T& Value() const noexcept;
+		inline E& Error() noexcept;
+		inline const E& Error() const noexcept;
+
+	};
+
+	/**
+	 * @brief Copy and destruction of TExpected's buffer.
+	 *
+	 * Compiler generates them when T and E are trivially copyable, so
+	 * TExpected is trivially copyable too. Small TExpected (e.g.
+	 * int + EStatus) is then passed and returned in registers.
+	*/
+	template <typename T, typename E, bool bTrivial =
+		std::is_trivially_copyable<T>::value &&
+		std::is_trivially_copyable<E>::value>
+	class TExpectedStorage : public TExpectedBuffer<T, E>
+	{
+	};
+
+	/// TExpectedStorage for types with user-defined copy or destructor.
+	template <typename T, typename E>
+	class TExpectedStorage<T, E, false> : public TExpectedBuffer<T, E>
+	{
+	public:
+
+		TExpectedStorage() = default;
+		TExpectedStorage(const TExpectedStorage& Other);
+		TExpectedStorage(TExpectedStorage&& Other) noexcept(
+			std::is_nothrow_move_constructible<T>::value &&
+			std::is_nothrow_move_constructible<E>::value);
+		~TExpectedStorage();
+
+		TExpectedStorage& operator = (const TExpectedStorage& Other);
+		TExpectedStorage& operator = (TExpectedStorage&& Other) noexcept(
+			std::is_nothrow_move_constructible<T>::value &&
+			std::is_nothrow_move_constructible<E>::value);
+
+	private:
+
+		// true after a failed assignment: buffer holds no object
+		bool bValueless = false;
+
+		// destructs current object, then moves Other's one in
+		void Reconstruct(TExpectedStorage&& Other);
+
+	};
+
+
+	/**
+	 * @brief Contains either value or error that describes why
+	 *		  value could not be produced.
+	 *
+	 * Lightweight alternative to exceptions: no unwinding tables, no
+	 * heap allocation, and the error is a part of function signature.
+	 * Both value and error live in the same aligned buffer, like in
+	 * TOptional.
+	 *
+	 * Chain calls with AndThen(), Transform() and OrElse(): the first
+	 * error is propagated through the chain without calling functions.
+	 *
+	 * @note Assignment gives strong guarantee if T and E are nothrow
+	 *		 movable. Otherwise, if it throws, expected is left without
+	 *		 value and error: it may only be assigned to or destroyed.
+	 * @tparam T Value type
+	 * @tparam E Error type, EStatus by default
+	*/
+	template <typename T, typename E = EStatus>
+	class TExpected : private TExpectedStorage<T, E>
+	{
+
+	public:
+
+		typedef T ValueType;
+		typedef E ErrorType;
+
+		/**
+		 * @brief Initialize with value (copy).
+		 * @param Value Object to create copy from
+		*/
+		TExpected(const T& Value);
+
+		/**
+		 * @brief Initialize with value (move).
+		 * @param Value Temporary object to get data from
+		*/
+		TExpected(T&& Value);
+
+		/**
+		 * @brief Initialize with error.
+		 * @tparam OtherE Type that E can be constructed from
+		 * @param Unexpected Result of MakeUnexpected()
+		*/
+		template <typename OtherE>
+		TExpected(TUnexpected<OtherE> Unexpected);
+
+
+		/**
+		 * @brief Check if expected contains value.
+		 * @return True if value exists, false if it is an error
+		*/
+		bool HasValue() const noexcept;
+
+		/**
+		 * @brief Gets value or throws an exception.
+		 * @return Reference to the value
+		*/
+		T& GetValue();
+
+		/// GetValue() for const expected.
+		const T& GetValue() const
+		{
+			return const_cast<TExpected*>(this)->GetValue();
+		}
+
+		/**
+		 * @brief GetValue() without exceptions.
+		 * @return Pointer to the value or nullptr if it is an error
+		*/
+		const T* TryGetValue() const noexcept;
+
+		/**
+		 * @brief Get value or passed value (if it is an error).
+		 * @param OtherVariant Returned if expected contains error
+		 * @return Internal value or provided value
+		*/
+		const T& GetValueOr(const T& OtherVariant) const noexcept;
+
+		/**
+		 * @brief Gets error or throws an exception.
+		 * @return Reference to the error
+		*/
+		const E& GetError() const;
+
+		/**
+		 * @brief GetError() without exceptions.
+		 * @return Pointer to the error or nullptr if there is a value
+		*/
+		const E* TryGetError() const noexcept;
+
+
+		/**
+		 * @brief Calls function that may fail on the value.
+		 * @param Function Takes T, returns TExpected<U, E>
+		 * @return Result of Function or this error
+		*/
+		template <typename FunctionType>
+		auto AndThen(FunctionType&& Function) const&;
+
+		/// AndThen() that moves the value into Function.
+		template <typename FunctionType>
+		auto AndThen(FunctionType&& Function) &&;
+
+		/**
+		 * @brief Calls function that can not fail on the value.
+		 * @param Function Takes T, returns U (not void)
+		 * @return TExpected<U, E> with Function result or this error
+		*/
+		template <typename FunctionType>
+		auto Transform(FunctionType&& Function) const&;
+
+		/// Transform() that moves the value into Function.
+		template <typename FunctionType>
+		auto Transform(FunctionType&& Function) &&;
+
+		/**
+		 * @brief Calls function on the error to recover from it.
+		 * @param Function Takes E, returns TExpected<T, E2>
+		 * @return Result of Function or this value
+		*/
+		template <typename FunctionType>
+		auto OrElse(FunctionType&& Function) const&;
+
+		/// OrElse() that moves the error into Function.
+		template <typename FunctionType>
+		auto OrElse(FunctionType&& Function) &&;
+
+	};
+
+}
+
+#include "Private/Expected.tpp"
+
+#pragma warning(pop)
\ No newline at end of file
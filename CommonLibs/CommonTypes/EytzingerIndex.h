@@ -0,0 +1,102 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include "Vector.h"
+#include "./../CommonUtils/Intrinsics.h"	// Prefetch, CountTrailingZeros
+
+namespace Common
+{
+
+	/**
+	 * @brief Read-only search index that stores sorted values in
+	 *		  Eytzinger (BFS) order.
+	 *
+	 * Element K has children 2K and 2K+1, so the first levels of the
+	 * implicit tree share a few cache lines, and descendants of a node
+	 * that are several levels below are stored next to each other and
+	 * can be prefetched. On large arrays this is faster than binary
+	 * search over the sorted TVector itself.
+	 *
+	 * Index does not track the source vector; call Rebuild() after
+	 * the source has changed.
+	 *
+	 * @note Underlying object must be copy constructible and implement
+	 *		 operator < (or a comparator must be passed).
+	*/
+	template <typename T>
+	class TEytzingerIndex
+	{
+
+	public:
+
+		/// Creates empty index.
+		TEytzingerIndex() = default;
+
+		/**
+		 * @brief Creates index from the sorted vector (copy).
+		 * @param Sorted Vector sorted in ascending order
+		*/
+		explicit TEytzingerIndex(const TVector<T>& Sorted);
+
+
+		/**
+		 * @brief Replaces contents of the index with values from
+		 *		  the sorted vector (copy).
+		 * @param Sorted Vector sorted in ascending order
+		*/
+		void Rebuild(const TVector<T>& Sorted);
+
+
+		/**
+		 * @brief Finds the first element that is not less than Value.
+		 * @param Value Value to search for
+		 * @param Comparator Returns true if first argument goes before
+		 *		  second. Must be the order the source was sorted with
+		 * @return Pointer to the found element or nullptr
+		*/
+		template <typename FunctionType>
+		const T* LowerBound(const T& Value, FunctionType Comparator) const;
+
+		/// LowerBound() that compares elements with operator <.
+		const T* LowerBound(const T& Value) const;
+
+		/**
+		 * @brief Checks if index contains element equal to Value.
+		 * @param Value Value to search for
+		 * @return True if element was found, false otherwise
+		*/
+		bool Contains(const T& Value) const;
+
+
+		/**
+		 * @brief Number of indexed elements
+		 * @return Size of index
+		*/
+		size_t GetSize() const noexcept;
+
+		/**
+		 * @brief Simple check if size of this index equals 0.
+		 * @return True if empty, false if not
+		*/
+		bool IsEmpty() const noexcept;
+
+	private:
+
+		// Layout[0] is unused, so the root is 1 and index
+		// arithmetic does not need extra additions
+		TVector<T> Layout;
+
+		// number of elements that fit into one cache line; descendants
+		// of K on the same depth below start at K * PrefetchStride
+		static constexpr size_t PrefetchStride =
+			sizeof(T) >= 64 ? 1 : 64 / sizeof(T);
+
+		size_t BuildSubtree(const T* Sorted, size_t SortedPosition,
+			size_t Node);
+
+	};
+
+}
+
+#include "Private/EytzingerIndex.tpp"
\ No newline at end of file
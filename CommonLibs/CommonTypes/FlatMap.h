@@ -0,0 +1,284 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include "Pair.h"
+#include "Span.h"
+#include "Vector.h"
+#include "./../CommonUtils/Assert.h"
+#include "./../CommonUtils/Search.h"	// BranchlessLowerBound
+#include "./../CommonUtils/Sort.h"		// QuickSort
+
+namespace Common
+{
+
+	/**
+	 * @brief Ordered map stored as two sorted arrays: keys and values.
+	 *
+	 * Lookup is a binary search over contiguous keys, iteration is a
+	 * walk over arrays; no node per entry. Single insertion and erase
+	 * shift the tail, so they are O(n): the map suits small and
+	 * read-mostly data. Many entries should be added with bulk
+	 * Insert(Begin, End): it appends them, sorts the batch and merges
+	 * it into place in one pass.
+	 *
+	 * GetKeys() gives the keys as one array, e.g. to scan them with
+	 * SIMD or to build TEytzingerIndex.
+	 *
+	 * @note Any insertion or erase may move entries: pointers and spans
+	 *		 are valid until the next Insert, Upsert, [], Erase, Reserve,
+	 *		 ShrinkToFit or Clear.
+	 * @tparam K Type of key, must be comparable with operator <
+	 * @tparam V Type of value
+	*/
+	template <typename K, typename V>
+	class TFlatMap
+	{
+
+	public:
+
+		typedef TPair<K, V> CEntry;
+
+		/// Returned by FindIndex() if there is no such key.
+		static constexpr size_t NotFound = size_t(-1);
+
+		/// Creates empty map (nothing is allocated).
+		TFlatMap() = default;
+
+
+		/**
+		 * @brief Finds value by key.
+		 * @param Key Key to look for
+		 * @return Pointer to the value, nullptr if there is no such key
+		*/
+		V* Find(const K& Key);
+
+		/// Find() for const maps.
+		const V* Find(const K& Key) const
+		{
+			return const_cast<TFlatMap*>(this)->Find(Key);
+		}
+
+		/// Checks if key is in the map.
+		bool Contains(const K& Key) const;
+
+		/**
+		 * @brief Finds position of the key.
+		 * @param Key Key to look for
+		 * @return Index in GetKeys() and GetValues(), or NotFound
+		*/
+		size_t FindIndex(const K& Key) const;
+
+		/// Index of the first key that is not less than Key (or size).
+		size_t LowerBound(const K& Key) const;
+
+		/// Index of the first key that is greater than Key (or size).
+		size_t UpperBound(const K& Key) const;
+
+
+		/**
+		 * @brief Adds an entry if the key is not in the map yet.
+		 * @param Key Key of new entry
+		 * @param Value Value of new entry
+		 * @return True if inserted, false if key exists (value is kept)
+		*/
+		bool Insert(const K& Key, const V& Value);
+
+		/**
+		 * @brief Adds entries with keys that are not in the map yet.
+		 * @tparam IteratorType Iterator over CEntry
+		 * @param Begin Iterator referring to the first entry
+		 * @param End Iterator referring to the entry after last one
+		 * @return Number of inserted entries
+		 * @note Entries do not have to be sorted. If batch has equal
+		 *		 keys, the first of them (in batch order) is inserted;
+		 *		 keys that are in the map already keep their values.
+		 * @note K and V should be nothrow movable, otherwise map may be
+		 *		 left unordered if moving throws.
+		*/
+		template <typename IteratorType>
+		size_t Insert(IteratorType Begin, IteratorType End);
+
+		/**
+		 * @brief Adds an entry or replaces value of existing one.
+		 * @param Key Key of entry
+		 * @param Value New value
+		 * @return Reference to the stored value
+		*/
+		V& Upsert(const K& Key, const V& Value);
+
+		/**
+		 * @brief Provides access to the value, inserts value-initialized
+		 *		  one if key is not in the map.
+		 * @param Key Key of entry
+		 * @return Reference to the stored value
+		*/
+		V& operator [] (const K& Key);
+
+		/**
+		 * @brief Removes entry with the key.
+		 * @param Key Key of entry
+		 * @return False if there was no such key
+		*/
+		bool Erase(const K& Key);
+
+		/**
+		 * @brief Calls function for every entry in key order.
+		 * @tparam FunctionType void(const K&, V&)
+		 * @param Function Function to call, must not modify the map
+		*/
+		template <typename FunctionType>
+		void ForEach(FunctionType Function);
+
+		/// ForEach() for const maps, FunctionType is void(const K&, const V&).
+		template <typename FunctionType>
+		void ForEach(FunctionType Function) const;
+
+
+		/// All keys in ascending order.
+		TSpan<const K> GetKeys() const noexcept;
+
+		/// Values in order of their keys.
+		TSpan<V> GetValues() noexcept;
+
+		/// GetValues() for const maps.
+		TSpan<const V> GetValues() const noexcept;
+
+
+		/**
+		 * @brief Allocates memory for the future entries.
+		 * @param Count Number of entries that fit without reallocation
+		*/
+		void Reserve(size_t Count);
+
+		/// Frees memory that is not used by entries.
+		void ShrinkToFit();
+
+		/// Removes all entries.
+		void Clear();
+
+		/**
+		 * @brief Swaps two maps internally without deep copy.
+		 * @param Other Object to swap resources with
+		*/
+		void Swap(TFlatMap& Other) noexcept;
+
+
+		/// Number of entries.
+		size_t GetSize() const noexcept;
+
+		/// Number of entries that fit without reallocation.
+		size_t GetCapacity() const noexcept;
+
+		/// Simple check if size of this map equals 0.
+		bool IsEmpty() const noexcept;
+
+	private:
+
+		TVector<K> Keys;
+		TVector<V> Values;
+
+		// inserts entry at the position given by LowerBound()
+		void InsertAt(size_t Index, const K& Key, const V& Value);
+
+	};
+
+
+	/**
+	 * @brief Ordered set stored as sorted array of keys.
+	 * @see TFlatMap for details, interface is the same without values.
+	 * @tparam K Type of key, must be comparable with operator <
+	*/
+	template <typename K>
+	class TFlatSet
+	{
+
+	public:
+
+		/// Returned by FindIndex() if there is no such key.
+		static constexpr size_t NotFound = size_t(-1);
+
+		/// Creates empty set (nothing is allocated).
+		TFlatSet() = default;
+
+
+		/// Checks if key is in the set.
+		bool Contains(const K& Key) const;
+
+		/// Index of the key in GetKeys(), or NotFound.
+		size_t FindIndex(const K& Key) const;
+
+		/// Index of the first key that is not less than Key (or size).
+		size_t LowerBound(const K& Key) const;
+
+		/// Index of the first key that is greater than Key (or size).
+		size_t UpperBound(const K& Key) const;
+
+
+		/**
+		 * @brief Adds a key.
+		 * @param Key Key to add
+		 * @return False if key is already in the set
+		*/
+		bool Insert(const K& Key);
+
+		/**
+		 * @brief Adds keys that are not in the set yet.
+		 * @tparam IteratorType Iterator over K
+		 * @param Begin Iterator referring to the first key
+		 * @param End Iterator referring to the key after last one
+		 * @return Number of inserted keys
+		 * @see TFlatMap::Insert(Begin, End)
+		*/
+		template <typename IteratorType>
+		size_t Insert(IteratorType Begin, IteratorType End);
+
+		/**
+		 * @brief Removes the key.
+		 * @param Key Key to remove
+		 * @return False if there was no such key
+		*/
+		bool Erase(const K& Key);
+
+
+		/// All keys in ascending order.
+		TSpan<const K> GetKeys() const noexcept;
+
+
+		/**
+		 * @brief Allocates memory for the future keys.
+		 * @param Count Number of keys that fit without reallocation
+		*/
+		void Reserve(size_t Count);
+
+		/// Frees memory that is not used by keys.
+		void ShrinkToFit();
+
+		/// Removes all keys.
+		void Clear();
+
+		/**
+		 * @brief Swaps two sets internally without deep copy.
+		 * @param Other Object to swap resources with
+		*/
+		void Swap(TFlatSet& Other) noexcept;
+
+
+		/// Number of keys.
+		size_t GetSize() const noexcept;
+
+		/// Number of keys that fit without reallocation.
+		size_t GetCapacity() const noexcept;
+
+		/// Simple check if size of this set equals 0.
+		bool IsEmpty() const noexcept;
+
+	private:
+
+		TVector<K> Keys;
+
+	};
+
+}
+
+#include "Private/FlatMap.tpp"
\ No newline at end of file
@@ -0,0 +1,193 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstdint>
+
+#include "Pair.h"
+#include "./../CommonUtils/Hash.h"
+#include "./../CommonUtils/TypeOperations.h"	// Move, Swap
+#include "./../CommonUtils/BlockAllocation.h"	// Allocate, construct, ...
+
+namespace Common
+{
+
+	/**
+	 * @brief Unordered map with open addressing and linear probing.
+	 *
+	 * Entries TPair<K, V> are stored in one array (no node per entry),
+	 * next to it is an array of one-byte states: 0 for an empty slot,
+	 * otherwise 7 high bits of the hash of the key. Lookup compares the
+	 * byte first, so keys are compared almost only on a real match.
+	 * Erase shifts following entries back instead of leaving
+	 * tombstones, so probe sequences do not degrade over time.
+	 *
+	 * Capacity (number of slots) is a power of two, table grows twice
+	 * when it becomes 3/4 full.
+	 *
+	 * @note Any insertion may move entries: pointers returned by
+	 *		 Find() and others are valid until the next Insert, Upsert,
+	 *		 [], Erase, EraseIf or Reserve.
+	 * @tparam K Type of key, must be equality comparable
+	 * @tparam V Type of value
+	 * @tparam HashType Functor size_t(const K&), THash<K> by default
+	*/
+	template <typename K, typename V, typename HashType = THash<K>>
+	class THashMap
+	{
+
+	public:
+
+		typedef TPair<K, V> CEntry;
+
+		/**
+		 * @brief Creates empty map (nothing is allocated).
+		 * @param Hash Optional. Hash functor
+		*/
+		explicit THashMap(const HashType& Hash = HashType());
+
+		/**
+		 * @brief Copy constructor (deep copy).
+		 * @param Other Map to create copy from
+		*/
+		THashMap(const THashMap& Other);
+
+		/**
+		 * @brief Move constructor.
+		 * @param Other Temporary object to get data from
+		*/
+		THashMap(THashMap&& Other) noexcept;
+
+		~THashMap();
+
+		/// Assignment operator (deep copy).
+		THashMap& operator = (const THashMap& Other);
+
+		/// Move assignment operator.
+		THashMap& operator = (THashMap&& Other) noexcept;
+
+
+		/**
+		 * @brief Finds value by key.
+		 * @param Key Key to look for
+		 * @return Pointer to the value, nullptr if there is no such key
+		*/
+		V* Find(const K& Key);
+
+		/// Find() for const maps.
+		const V* Find(const K& Key) const
+		{
+			return const_cast<THashMap*>(this)->Find(Key);
+		}
+
+		/// Checks if key is in the map.
+		bool Contains(const K& Key) const;
+
+		/**
+		 * @brief Adds an entry if the key is not in the map yet.
+		 * @param Key Key of new entry
+		 * @param Value Value of new entry
+		 * @return True if inserted, false if key exists (value is kept)
+		*/
+		bool Insert(const K& Key, const V& Value);
+
+		/**
+		 * @brief Adds an entry or replaces value of existing one.
+		 * @param Key Key of entry
+		 * @param Value New value
+		 * @return Reference to the stored value
+		*/
+		V& Upsert(const K& Key, const V& Value);
+
+		/**
+		 * @brief Provides access to the value, inserts value-initialized
+		 *		  one if key is not in the map.
+		 * @param Key Key of entry
+		 * @return Reference to the stored value
+		*/
+		V& operator [] (const K& Key);
+
+		/**
+		 * @brief Removes entry with the key.
+		 * @param Key Key of entry
+		 * @return False if there was no such key
+		*/
+		bool Erase(const K& Key);
+
+		/**
+		 * @brief Removes all entries that satisfy predicate.
+		 * @tparam FunctionType bool(const K&, V&)
+		 * @param Predicate Returns true for entries to remove. May be
+		 *		  called more than once for a kept entry
+		 * @return Number of removed entries
+		*/
+		template <typename FunctionType>
+		size_t EraseIf(FunctionType Predicate);
+
+		/**
+		 * @brief Calls function for every entry, in no specific order.
+		 * @tparam FunctionType void(const K&, V&)
+		 * @param Function Function to call, must not modify the map
+		*/
+		template <typename FunctionType>
+		void ForEach(FunctionType Function);
+
+		/// ForEach() for const maps, FunctionType is void(const K&, const V&).
+		template <typename FunctionType>
+		void ForEach(FunctionType Function) const;
+
+
+		/**
+		 * @brief Allocates slots for the future entries.
+		 * @param Count Number of entries that fit without rehashing
+		*/
+		void Reserve(size_t Count);
+
+		/// Removes all entries and frees memory.
+		void Clear() noexcept;
+
+		/**
+		 * @brief Swaps two maps internally without deep copy.
+		 * @param Other Object to swap resources with
+		*/
+		void Swap(THashMap& Other) noexcept;
+
+
+		/// Number of entries.
+		size_t GetSize() const noexcept;
+
+		/// Number of slots (entries fit without rehashing: 3/4 of it).
+		size_t GetCapacity() const noexcept;
+
+		/// Simple check if size of this map equals 0.
+		bool IsEmpty() const noexcept;
+
+	private:
+
+		static constexpr size_t MinCapacity = 8;
+		static constexpr uint8_t EmptySlot = 0;
+
+		CEntry* Entries = nullptr;
+		uint8_t* States = nullptr;	// EmptySlot or tag of the hash
+		size_t Capacity = 0;		// power of two or 0
+		size_t Size = 0;
+		HashType Hasher;
+
+		size_t HashOf(const K& Key) const;
+		static uint8_t TagOf(size_t Hash) noexcept;
+
+		// slot with the key or empty slot where the key would be inserted
+		size_t FindSlot(const K& Key, size_t Hash, bool& bOutFound) const;
+
+		// slot for the new entry, grows table if needed
+		size_t PrepareInsert(const K& Key, size_t Hash, bool& bOutFound);
+
+		void EraseSlot(size_t Slot);
+		void Rehash(size_t NewCapacity);
+		void FreeTable() noexcept;
+
+	};
+
+}
+
+#include "Private/HashMap.tpp"
\ No newline at end of file
@@ -0,0 +1,319 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include "Iterators/Intrusive.h"
+#include "./../CommonUtils/Assert.h"
+#include "./../CommonUtils/TypeOperations.h"	// Move
+
+namespace Common
+{
+
+	class CIntrusiveListHook;
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	class TIntrusiveList;
+
+
+	/**
+	 * @brief Links of an element of TIntrusiveList. Embed it into the
+	 *		  element as a member; one hook per list the element can
+	 *		  belong to at the same time.
+	 *
+	 * Copying an element does not copy its membership: copy of a hook
+	 * is unlinked, assignment leaves both hooks as they are. Destroyed
+	 * hook unlinks itself, so elements can be freed in any order.
+	*/
+	class CIntrusiveListHook
+	{
+
+	public:
+
+		CIntrusiveListHook() noexcept = default;
+
+		CIntrusiveListHook(const CIntrusiveListHook&) noexcept {}
+
+		CIntrusiveListHook& operator = (const CIntrusiveListHook&) noexcept
+		{
+			return *this;
+		}
+
+		~CIntrusiveListHook()
+		{
+			Unlink();
+		}
+
+		/// True if element is in some list.
+		bool IsLinked() const noexcept
+		{
+			return Next != nullptr;
+		}
+
+		/// Removes element from its list in O(1). No-op if not linked.
+		void Unlink() noexcept
+		{
+			if (Next)
+			{
+				Previous->Next = Next;
+				Next->Previous = Previous;
+				Next = nullptr;
+				Previous = nullptr;
+			}
+		}
+
+	private:
+
+		template <typename T, CIntrusiveListHook T::* HookMember>
+		friend class TIntrusiveList;
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		friend class Iterators::TIntrusiveIterator;
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		friend class Iterators::TReverseIntrusiveIterator;
+
+		CIntrusiveListHook* Next = nullptr;
+		CIntrusiveListHook* Previous = nullptr;
+
+		/// Inserts this (unlinked) hook before Position.
+		void LinkBefore(CIntrusiveListHook* Position) noexcept
+		{
+			Next = Position;
+			Previous = Position->Previous;
+			Previous->Next = this;
+			Position->Previous = this;
+		}
+
+	};
+
+
+	/**
+	 * @brief Doubly linked list of elements that are not owned by it.
+	 *
+	 * Links live in the elements (CIntrusiveListHook member given by
+	 * HookMember), so inserting and removing never allocates, one
+	 * object can be in several lists through several hooks, and an
+	 * element is removed in O(1) through its hook without knowing the
+	 * list. Use it for LRU orders, timer wheels and other indices over
+	 * objects that are stored elsewhere (e.g. in TVector or a pool).
+	 *
+	 * List is a ring around a sentinel hook, so there are no null
+	 * checks on insertion and removal, and End() is the sentinel.
+	 *
+	 * Example:
+	 *	struct CEntry { int Key; CIntrusiveListHook Hook; };
+	 *	TIntrusiveList<CEntry, &CEntry::Hook> Order;
+	 *
+	 * @note List does not manage lifetime: elements must outlive their
+	 *		 membership or be unlinked before destruction (destroyed
+	 *		 hook unlinks itself). Destroying the list unlinks all.
+	 * @note Since elements leave the list without notifying it, size
+	 *		 is not cached and GetSize() is O(n).
+	 * @note Iterators are not checked: removing the element an
+	 *		 iterator points to invalidates that iterator only.
+	 * @tparam T Type of elements
+	 * @tparam HookMember Pointer to the hook member of T
+	*/
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	class TIntrusiveList
+	{
+
+	public:
+
+		typedef T value_type;	// Follow convention
+
+		/// Iterator. Implemented op-s: ++, +=, +, --, -=, -, ==, !=.
+		typedef Iterators::TIntrusiveIterator<CIntrusiveListHook*, T&,
+			TIntrusiveList> CIterator;
+		/// Version of CIterator for const values.
+		typedef Iterators::TIntrusiveIterator<const CIntrusiveListHook*,
+			const T&, TIntrusiveList> CConstIterator;
+		/// Reverse iterator. Increment is actually decrement, etc.
+		typedef Iterators::TReverseIntrusiveIterator<CIntrusiveListHook*,
+			T&, TIntrusiveList> CReverseIterator;
+		/// Version of CReverseIterator for const values.
+		typedef Iterators::TReverseIntrusiveIterator<
+			const CIntrusiveListHook*, const T&, TIntrusiveList>
+			CConstReverseIterator;
+
+
+		/// Creates empty list.
+		TIntrusiveList() noexcept;
+
+		TIntrusiveList(const TIntrusiveList&) = delete;
+		TIntrusiveList& operator = (const TIntrusiveList&) = delete;
+
+		/**
+		 * @brief Move constructor. Elements are relinked to this list.
+		 * @param Other List to take elements from, becomes empty
+		*/
+		TIntrusiveList(TIntrusiveList&& Other) noexcept;
+
+		/// Move assignment. Unlinks own elements first.
+		TIntrusiveList& operator = (TIntrusiveList&& Other) noexcept;
+
+		/// Unlinks all elements.
+		~TIntrusiveList();
+
+
+		/**
+		 * @brief Links element to the end of list.
+		 * @param Element Element that is not in a list by this hook
+		*/
+		void Push(T& Element) noexcept;
+
+		/**
+		 * @brief Links element to the beginning of list.
+		 * @param Element Element that is not in a list by this hook
+		*/
+		void Unshift(T& Element) noexcept;
+
+		/**
+		 * @brief Links element before the specified position.
+		 * @param Position Iterator to an element or End()
+		 * @param Element Element that is not in a list by this hook
+		*/
+		void Insert(CIterator Position, T& Element) noexcept;
+
+		/**
+		 * @brief Unlinks one element from the end of list.
+		 * @note List must not be empty.
+		*/
+		void Pop() noexcept;
+
+		/**
+		 * @brief Unlinks one element from the beginning of list.
+		 * @note List must not be empty.
+		*/
+		void Shift() noexcept;
+
+		/**
+		 * @brief Unlinks element from this list in O(1).
+		 * @param Element Element of this list
+		*/
+		void Erase(T& Element) noexcept;
+
+		/**
+		 * @brief Moves element of this list to its end in O(1).
+		 *		  Typical "touch" of LRU order.
+		 * @param Element Element of this list
+		*/
+		void MoveToBack(T& Element) noexcept;
+
+		/// Unlinks all elements. O(n), as hooks are reset one by one.
+		void Clear() noexcept;
+
+		/**
+		 * @brief Swaps elements of two lists.
+		 * @param Other List to swap elements with
+		*/
+		void Swap(TIntrusiveList& Other) noexcept;
+
+
+		/// Number of elements. O(n), see class notes.
+		size_t GetSize() const noexcept;
+
+		/// Simple check if list has no elements. O(1).
+		bool IsEmpty() const noexcept;
+
+
+		/**
+		 * @brief Provides access to the first element.
+		 * @note List must not be empty.
+		*/
+		T& Front() noexcept;
+
+		/// Front() for const lists.
+		const T& Front() const noexcept
+		{
+			return const_cast<TIntrusiveList*>(this)->Front();
+		}
+
+		/// Front() that returns nullptr for empty list.
+		T* TryFront() noexcept;
+
+		/**
+		 * @brief Provides access to the last element.
+		 * @note List must not be empty.
+		*/
+		T& Back() noexcept;
+
+		/// Back() for const lists.
+		const T& Back() const noexcept
+		{
+			return const_cast<TIntrusiveList*>(this)->Back();
+		}
+
+		/// Back() that returns nullptr for empty list.
+		T* TryBack() noexcept;
+
+
+		/**
+		 * @brief Element that contains the hook.
+		 * @param Hook HookMember of some element
+		 * @return Reference to that element
+		*/
+		static T& ElementOf(CIntrusiveListHook& Hook) noexcept;
+
+		/// ElementOf() for const hooks.
+		static const T& ElementOf(const CIntrusiveListHook& Hook) noexcept;
+
+		/**
+		 * @brief Iterator pointing to the element, found in O(1).
+		 * @param Element Element of this list
+		*/
+		static CIterator IteratorOf(T& Element) noexcept;
+
+
+		/// Iterator pointing to the first element.
+		CIterator Begin() noexcept;
+
+		/// Iterator pointing to the element after last (sentinel).
+		CIterator End() noexcept;
+
+		/// Const iterator pointing to the first element.
+		CConstIterator ConstBegin() const noexcept;
+
+		/// Const iterator pointing to the element after last.
+		CConstIterator ConstEnd() const noexcept;
+
+		/// Reverse iterator pointing to the last element.
+		CReverseIterator ReverseBegin() noexcept;
+
+		/// Reverse iterator pointing to the element before first.
+		CReverseIterator ReverseEnd() noexcept;
+
+		/// Const reverse iterator pointing to the last element.
+		CConstReverseIterator ConstReverseBegin() const noexcept;
+
+		/// Const reverse iterator pointing to the element before first.
+		CConstReverseIterator ConstReverseEnd() const noexcept;
+
+
+		/// Begin() alias (for compatibity)
+		CIterator begin() { return Begin(); }
+		/// ConstBegin() alias (overloaded, for compatibity)
+		CConstIterator begin() const { return ConstBegin(); }
+		/// End() alias (for compatibity)
+		CIterator end() { return End(); }
+		/// ConstEnd() alias (overloaded, for compatibity)
+		CConstIterator end() const { return ConstEnd(); }
+		/// ReverseBegin() alias (for compatibity)
+		CReverseIterator rbegin() { return ReverseBegin(); }
+		/// ReverseEnd() alias (for compatibity)
+		CReverseIterator rend() { return ReverseEnd(); }
+
+	private:
+
+		CIntrusiveListHook Root;	// sentinel, Next is first, Previous is last
+
+		static size_t HookOffset() noexcept;
+
+		// takes elements of Other, this list must be empty
+		void TakeRing(TIntrusiveList& Other) noexcept;
+
+	};
+
+}
+
+#include "Private/IntrusiveList.tpp"
\ No newline at end of file
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "./../Exception.h"
+#include "Generation.h"
 
 namespace Common
 {
@@ -11,13 +12,15 @@ namespace Common
 	{
 
 		template <typename PtrType, typename RefType>
-		class TBlockIterator
+		class TBlockIterator : private CGenerationCheck
 		{
 
 		public:
 
 			TBlockIterator();
 			TBlockIterator(PtrType InitialPosition);
+			TBlockIterator(PtrType InitialPosition,
+				const CGenerationCheck& Check);
 
 			const TBlockIterator& operator ++ ();
 			TBlockIterator operator + (size_t Offset);
@@ -25,6 +28,7 @@ namespace Common
 			const TBlockIterator& operator -- ();
 			TBlockIterator operator - (size_t Offset);
 			const TBlockIterator& operator -= (size_t Offset);
+			size_t operator - (const TBlockIterator& Other) const;
 			bool operator == (const TBlockIterator& Other);
 			bool operator != (const TBlockIterator& Other);
 
@@ -38,13 +42,15 @@ namespace Common
 
 
 		template <typename PtrType, typename RefType>
-		class TReverseBlockIterator
+		class TReverseBlockIterator : private CGenerationCheck
 		{
 
 		public:
 
 			TReverseBlockIterator();
 			TReverseBlockIterator(PtrType InitialPosition);
+			TReverseBlockIterator(PtrType InitialPosition,
+				const CGenerationCheck& Check);
 
 			const TReverseBlockIterator& operator ++ ();
 			TReverseBlockIterator operator + (size_t Offset);
@@ -52,6 +58,7 @@ namespace Common
 			const TReverseBlockIterator& operator -- ();
 			TReverseBlockIterator operator - (size_t Offset);
 			const TReverseBlockIterator& operator -= (size_t Offset);
+			size_t operator - (const TReverseBlockIterator& Other) const;
 			bool operator == (const TReverseBlockIterator& Other);
 			bool operator != (const TReverseBlockIterator& Other);
 
@@ -64,12 +71,21 @@ namespace Common
 		};
 
 
-		template <typename PtrType, typename RefType, typename ContType>
-		class TSafeBlockIterator {
+		/**
+		 * @brief Iterator that checks bounds and throws COutOfRange.
+		 *
+		 * Bounds are the range of container at the moment iterator was
+		 * created, so steps do not read the container. Modification of
+		 * container invalidates iterator, checked mode detects it.
+		*/
+		template <typename PtrType, typename RefType>
+		class TSafeBlockIterator : private CGenerationCheck
+		{
 
 		public:
 
-			TSafeBlockIterator(PtrType InitialPosition, const ContType Owner);
+			TSafeBlockIterator(PtrType InitialPosition, PtrType Begin,
+				PtrType End, const CGenerationCheck& Check = {});
 
 			const TSafeBlockIterator& operator ++ ();
 			TSafeBlockIterator operator + (size_t Offset);
@@ -77,6 +93,7 @@ namespace Common
 			const TSafeBlockIterator& operator -- ();
 			TSafeBlockIterator operator - (size_t Offset);
 			const TSafeBlockIterator& operator -= (size_t Offset);
+			size_t operator - (const TSafeBlockIterator& Other) const;
 			bool operator == (const TSafeBlockIterator& Other);
 			bool operator != (const TSafeBlockIterator& Other);
 
@@ -85,17 +102,21 @@ namespace Common
 		private:
 
 			PtrType InternalPointer;
-			const ContType Owner;
+			PtrType Begin;
+			PtrType End;
 
 		};
 
 
-		template <typename PtrType, typename RefType, class ContType>
-		class TSafeReverseBlockIterator {
+		/// Reverse version of TSafeBlockIterator.
+		template <typename PtrType, typename RefType>
+		class TSafeReverseBlockIterator : private CGenerationCheck
+		{
 
 		public:
 
-			TSafeReverseBlockIterator(PtrType InitialPosition, const ContType Owner);
+			TSafeReverseBlockIterator(PtrType InitialPosition, PtrType Begin,
+				PtrType End, const CGenerationCheck& Check = {});
 
 			const TSafeReverseBlockIterator& operator ++ ();
 			TSafeReverseBlockIterator operator + (size_t Offset);
@@ -103,6 +124,7 @@ namespace Common
 			const TSafeReverseBlockIterator& operator -- ();
 			TSafeReverseBlockIterator operator - (size_t Offset);
 			const TSafeReverseBlockIterator& operator -= (size_t Offset);
+			size_t operator - (const TSafeReverseBlockIterator& Other) const;
 			bool operator == (const TSafeReverseBlockIterator& Other);
 			bool operator != (const TSafeReverseBlockIterator& Other);
 
@@ -110,8 +132,9 @@ namespace Common
 
 		private:
 
-			PtrType InternalPointer;
-			const ContType Owner;
+			PtrType InternalPointer;	// element before Position
+			PtrType Begin;
+			PtrType End;
 
 		};
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "./../Exception.h"
+#include "Generation.h"
 
 namespace Common
 {
@@ -11,13 +12,15 @@ namespace Common
 	{
 
 		template <typename NdPtrType, typename ValRefType>
-		class TDoublyLinkedIterator
+		class TDoublyLinkedIterator : private CGenerationCheck
 		{
 
 		public:
 
 			TDoublyLinkedIterator();
 			TDoublyLinkedIterator(NdPtrType InitialPosition);
+			TDoublyLinkedIterator(NdPtrType InitialPosition,
+				const CGenerationCheck& Check);
 
 			const TDoublyLinkedIterator& operator ++ ();
 			TDoublyLinkedIterator operator + (size_t Offset);
@@ -38,13 +41,15 @@ namespace Common
 
 
 		template <typename NdPtrType, typename ValRefType>
-		class TReverseDoublyLinkedIterator
+		class TReverseDoublyLinkedIterator : private CGenerationCheck
 		{
 
 		public:
 
 			TReverseDoublyLinkedIterator();
 			TReverseDoublyLinkedIterator(NdPtrType InitialPosition);
+			TReverseDoublyLinkedIterator(NdPtrType InitialPosition,
+				const CGenerationCheck& Check);
 
 			const TReverseDoublyLinkedIterator& operator ++ ();
 			TReverseDoublyLinkedIterator operator + (size_t Offset);
@@ -65,12 +70,14 @@ namespace Common
 
 
 		template <typename NdPtrType, typename ValRefType>
-		class TSafeDoublyLinkedIterator {
+		class TSafeDoublyLinkedIterator : private CGenerationCheck {
 
 		public:
 
 			TSafeDoublyLinkedIterator();
 			TSafeDoublyLinkedIterator(NdPtrType InitialPosition);
+			TSafeDoublyLinkedIterator(NdPtrType InitialPosition,
+				const CGenerationCheck& Check);
 
 			const TSafeDoublyLinkedIterator& operator ++ ();
 			TSafeDoublyLinkedIterator operator + (size_t Offset);
@@ -91,12 +98,14 @@ namespace Common
 
 
 		template <class NdPtrType, typename ValRefType>
-		class TSafeReverseDoublyLinkedIterator {
+		class TSafeReverseDoublyLinkedIterator : private CGenerationCheck {
 
 		public:
 
 			TSafeReverseDoublyLinkedIterator();
 			TSafeReverseDoublyLinkedIterator(NdPtrType InitialPosition);
+			TSafeReverseDoublyLinkedIterator(NdPtrType InitialPosition,
+				const CGenerationCheck& Check);
 
 			const TSafeReverseDoublyLinkedIterator& operator ++ ();
 			TSafeReverseDoublyLinkedIterator operator + (size_t Offset);
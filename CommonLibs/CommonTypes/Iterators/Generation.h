@@ -0,0 +1,120 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstddef>
+
+#include "./../Exception.h"
+
+// Checked iterators: containers count modifications that invalidate
+// iterators, iterators remember the count and throw CInvalidIterator
+// if it changed. Off by default, define as 1 to enable (Debug
+// configurations of the solution do). Without checks plain iterators
+// are just pointers.
+// The setting changes layout of TVector, TList and their iterators,
+// so all code linked with CommonLibs must be built with the same
+// value. MSVC rejects mismatched objects at link time.
+#if !defined(COMMONLIBS_CHECKED_ITERATORS)
+	#define COMMONLIBS_CHECKED_ITERATORS 0
+#endif
+
+#if defined(_MSC_VER)
+	#if COMMONLIBS_CHECKED_ITERATORS
+		#pragma detect_mismatch("COMMONLIBS_CHECKED_ITERATORS", "1")
+	#else
+		#pragma detect_mismatch("COMMONLIBS_CHECKED_ITERATORS", "0")
+	#endif
+#endif
+
+namespace Common
+{
+
+	namespace Iterators
+	{
+
+		/**
+		 * @brief Base of iterators that detects invalidation. Holds
+		 *		  pointer to the counter of container and its value
+		 *		  at the moment iterator was created.
+		 * @note Empty without COMMONLIBS_CHECKED_ITERATORS.
+		*/
+		class CGenerationCheck
+		{
+
+		public:
+
+			CGenerationCheck() noexcept = default;
+
+#if COMMONLIBS_CHECKED_ITERATORS
+
+			explicit CGenerationCheck(const size_t* Generation) noexcept
+				: Generation(Generation), Expected(*Generation) {}
+
+			/// Throws CInvalidIterator if container has been modified.
+			void VerifyGeneration() const
+			{
+				if (Generation && *Generation != Expected)
+				{
+					COMMON_THROW(CInvalidIterator(
+						"Iterator is used after container change"));
+				}
+			}
+
+		private:
+
+			const size_t* Generation = nullptr;
+			size_t Expected = 0;
+
+#else
+
+			void VerifyGeneration() const noexcept {}
+
+#endif
+
+		};
+
+
+		/**
+		 * @brief Base of containers: counter of modifications that
+		 *		  invalidate iterators.
+		 * @note Empty without COMMONLIBS_CHECKED_ITERATORS.
+		*/
+		class CGenerationCounter
+		{
+
+		protected:
+
+#if COMMONLIBS_CHECKED_ITERATORS
+
+			/// Makes all iterators created before invalid.
+			void InvalidateIterators() noexcept
+			{
+				++Generation;
+			}
+
+			/// Check for a new iterator.
+			CGenerationCheck GetGenerationCheck() const noexcept
+			{
+				return CGenerationCheck(&Generation);
+			}
+
+		private:
+
+			size_t Generation = 0;
+
+#else
+
+			void InvalidateIterators() noexcept {}
+
+			CGenerationCheck GetGenerationCheck() const noexcept
+			{
+				return CGenerationCheck();
+			}
+
+#endif
+
+		};
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstddef>
+
+namespace Common
+{
+
+	namespace Iterators
+	{
+
+		/**
+		 * @brief Iterator over TIntrusiveList. Stores pointer to the hook
+		 *		  of element, ListType::ElementOf() converts it to element.
+		 * @tparam HookPtrType Pointer to (maybe const) CIntrusiveListHook
+		 * @tparam ValRefType Reference to (maybe const) element
+		 * @tparam ListType TIntrusiveList that owns the hooks
+		*/
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		class TIntrusiveIterator
+		{
+
+		public:
+
+			TIntrusiveIterator();
+			TIntrusiveIterator(HookPtrType InitialPosition);
+
+			const TIntrusiveIterator& operator ++ ();
+			TIntrusiveIterator operator + (size_t Offset);
+			const TIntrusiveIterator& operator += (size_t Offset);
+			const TIntrusiveIterator& operator -- ();
+			TIntrusiveIterator operator - (size_t Offset);
+			const TIntrusiveIterator& operator -= (size_t Offset);
+			bool operator == (const TIntrusiveIterator& Other) const;
+			bool operator != (const TIntrusiveIterator& Other) const;
+
+			ValRefType operator * () const;
+
+			HookPtrType HookPointer;
+
+		};
+
+
+		/// TIntrusiveIterator that moves from the last element to the first.
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		class TReverseIntrusiveIterator
+		{
+
+		public:
+
+			TReverseIntrusiveIterator();
+			TReverseIntrusiveIterator(HookPtrType InitialPosition);
+
+			const TReverseIntrusiveIterator& operator ++ ();
+			TReverseIntrusiveIterator operator + (size_t Offset);
+			const TReverseIntrusiveIterator& operator += (size_t Offset);
+			const TReverseIntrusiveIterator& operator -- ();
+			TReverseIntrusiveIterator operator - (size_t Offset);
+			const TReverseIntrusiveIterator& operator -= (size_t Offset);
+			bool operator == (const TReverseIntrusiveIterator& Other) const;
+			bool operator != (const TReverseIntrusiveIterator& Other) const;
+
+			ValRefType operator * () const;
+
+			HookPtrType HookPointer;
+
+		};
+
+	}
+
+}
+
+#include "../Private/Iterators/Intrusive.tpp"
\ No newline at end of file
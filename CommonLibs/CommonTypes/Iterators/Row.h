@@ -0,0 +1,52 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstddef>
+
+namespace Common
+{
+
+	namespace Iterators
+	{
+
+		/**
+		 * @brief Iterator over rows of a container that has no object
+		 *		  for a row, e.g. TSoAVector. Stores owner and row index,
+		 *		  dereferencing creates proxy reference RefType.
+		 * @tparam OwnerPointer Pointer to (maybe const) container
+		 * @tparam RefType Proxy constructible from (OwnerPointer, size_t)
+		*/
+		template <typename OwnerPointer, typename RefType>
+		class TRowIterator
+		{
+
+		public:
+
+			TRowIterator();
+			TRowIterator(OwnerPointer Owner, size_t Row);
+
+			const TRowIterator& operator ++ ();
+			TRowIterator operator + (size_t Offset) const;
+			const TRowIterator& operator += (size_t Offset);
+			const TRowIterator& operator -- ();
+			TRowIterator operator - (size_t Offset) const;
+			const TRowIterator& operator -= (size_t Offset);
+			size_t operator - (const TRowIterator& Other) const;
+			bool operator == (const TRowIterator& Other) const;
+			bool operator != (const TRowIterator& Other) const;
+
+			RefType operator * () const;
+
+		private:
+
+			OwnerPointer Owner;
+			size_t Row;
+
+		};
+
+	}
+
+}
+
+#include "../Private/Iterators/Row.tpp"
\ No newline at end of file
@@ -3,17 +3,21 @@
 #pragma once
 
 #include <initializer_list>
+#include <new>	// nothrow
 
+#include "Exception.h"	// EStatus
 #include "Iterators/DoublyLinked.h"
 #include "./../CommonUtils/TypeOperations.h"
+#include "./../CommonUtils/AllocationStats.h"	// node hooks
 
 namespace Common
 {
 	/**
 	 * @brief Container representing Doubly linked list.
 	 * 
-	 * @warning Work in progress. Sentinel node is not implemented yet, so
-	 *			iterators do not work properly. There may be other bugs
+	 * @warning Work in progress. There is no sentinel node: End() and
+	 *			ReverseEnd() are null iterators, so they can be compared
+	 *			with, but not decremented. There may be other bugs
 	 * 
 	 * Iterating over elements is slow, so you should use iterators that 
 	 * store position. 
@@ -38,10 +42,14 @@ namespace Common
 	 * @todo Implement SFINAE to support types without nonparam ctor
 	 *		 and types without overloaded == operator
 	 * 
-	 * @bug Safe iterators do not track element removal
+	 * @note With COMMONLIBS_CHECKED_ITERATORS (on in Debug configurations)
+	 *		 removal of any element invalidates all iterators of list,
+	 *		 using them throws CInvalidIterator. Release iterators do
+	 *		 not track removal. Splice() and Merge() count as removal
+	 *		 from the list nodes are taken from.
 	*/
 	template <typename T>
-	class TList
+	class TList : private Iterators::CGenerationCounter
 	{
 
 	private:
@@ -141,6 +149,13 @@ namespace Common
 		*/
 		void Push(const T& Value);
 
+		/**
+		 * @brief Push() that reports failures instead of throwing.
+		 * @param Value Element to add
+		 * @return EStatus::BadAlloc if node could not be allocated
+		*/
+		EStatus TryPush(const T& Value);
+
 		/**
 		 * @brief Adds multiple elements to the end via iterators.
 		 * @tparam IteratorType Iterator with implemented ++, != and *
@@ -156,6 +171,9 @@ namespace Common
 		*/
 		void Unshift(const T& Value);
 
+		/// Unshift() that returns EStatus::BadAlloc instead of throwing
+		EStatus TryUnshift(const T& Value);
+
 		/**
 		 * @brief Adds multiple elements to the beginning via iterators.
 		 * @tparam IteratorType Iterator with implemented ++, != and *
@@ -166,10 +184,9 @@ namespace Common
 		void Unshift(IteratorType Begin, IteratorType End);
 
 		/**
-		 * @brief Inserts one element to the specified position
-		 * @param Position Iterator pointing to insertion place
+		 * @brief Inserts one element before the specified position
+		 * @param Position Iterator of this list or End()
 		 * @param Value Value to insert
-		 * @note Position must be iterator to a valid node
 		*/
 		template <typename IteratorType>
 		void Insert(IteratorType Position, const T& Value);
@@ -193,16 +210,80 @@ namespace Common
 		*/
 		void Pop() noexcept;
 
+		/// Pop() that returns EStatus::OutOfRange for empty list
+		EStatus TryPop() noexcept;
+
 		/**
 		 * @brief Removes one element from the beginning of list.
 		 * @note List must not be empty.
 		*/
 		void Shift() noexcept;
 
+		/// Shift() that returns EStatus::OutOfRange for empty list
+		EStatus TryShift() noexcept;
+
+		/**
+		 * @brief Removes one element.
+		 * @param Position Iterator to a node of this list (not End())
+		*/
 		template <typename IteratorType>
 		void Erase(IteratorType Position) noexcept;
 
 
+		/**
+		 * @brief Moves all nodes of another list before Position in
+		 *		  O(1). Nothing is allocated or copied.
+		 * @param Position Iterator of this list or End()
+		 * @param Other List to take nodes from, becomes empty
+		*/
+		void Splice(CIterator Position, TList<T>& Other) noexcept;
+
+		/**
+		 * @brief Moves nodes [First, Last) of a list before Position.
+		 *		  Relinking is O(1), counting moved nodes is O(Last -
+		 *		  First) (not done if Other is this list).
+		 * @param Position Iterator of this list or End()
+		 * @param Other List that owns the range, may be this list
+		 * @param First Iterator to the first node to move
+		 * @param Last Iterator to the node after last one, or End()
+		 * @note Position must not be inside [First, Last).
+		*/
+		void Splice(CIterator Position, TList<T>& Other, CIterator First,
+			CIterator Last) noexcept;
+
+		/**
+		 * @brief Merges sorted list into this sorted list by relinking
+		 *		  nodes. Stable: of equal elements, ones of this list go
+		 *		  first.
+		 * @tparam FunctionType bool(const T&, const T&), "less"
+		 * @param Other Sorted list, becomes empty
+		 * @param Comparator Order that both lists are sorted by
+		 * @note If Comparator throws, merged nodes stay in this list
+		 *		 and the rest stay in Other (both sorted and valid).
+		*/
+		template <typename FunctionType>
+		void Merge(TList<T>& Other, FunctionType Comparator);
+
+		/// Merge() with operator <.
+		void Merge(TList<T>& Other);
+
+		/// Reverses order of elements in O(n) by relinking nodes.
+		void Reverse() noexcept;
+
+		/**
+		 * @brief Removes elements equal to their predecessor, leaving
+		 *		  the first one of every group of consecutive equals.
+		 * @tparam FunctionType bool(const T&, const T&)
+		 * @param AreEqual Equality of two elements
+		 * @return Number of removed elements
+		*/
+		template <typename FunctionType>
+		size_t Unique(FunctionType AreEqual);
+
+		/// Unique() with operator ==.
+		size_t Unique();
+
+
 		/**
 		 * @brief Swaps two lists internally without deep copy.
 		 * @param Other Object to swap resources with
@@ -236,6 +317,15 @@ namespace Common
 		*/
 		T& Front();
 
+		/// Front() that returns nullptr for empty list.
+		T* TryFront() noexcept;
+
+		/// TryFront() for const lists.
+		const T* TryFront() const noexcept
+		{
+			return const_cast<TList<T>*>(this)->TryFront();
+		}
+
 		/**
 		 * @brief Provides access to the last element.
 		 * @return Reference to the last element
@@ -249,6 +339,15 @@ namespace Common
 			return const_cast<TList<T>*>(this)->Back();
 		}
 
+		/// Back() that returns nullptr for empty list.
+		T* TryBack() noexcept;
+
+		/// TryBack() for const lists.
+		const T* TryBack() const noexcept
+		{
+			return const_cast<TList<T>*>(this)->TryBack();
+		}
+
 
 		/**
 		 * @brief Iterator pointing to the first elem.
@@ -378,6 +477,17 @@ namespace Common
 		Node* Head = nullptr;
 		Node* Tail = nullptr;
 
+		void LinkBack(Node* NewNode) noexcept;
+		void LinkFront(Node* NewNode) noexcept;
+
+		// links chain First..Last before Position (nullptr - to the end),
+		// Size is not changed
+		void LinkChainBefore(Node* Position, Node* First, Node* Last)
+			noexcept;
+
+		// detaches chain First..Last of this list, Size is not changed
+		void UnlinkChain(Node* First, Node* Last) noexcept;
+
 	};
 
 	template<typename T>
@@ -385,8 +495,14 @@ namespace Common
 	{
 	public:
 
+		// nodes are always created with new, so hooks count allocations
 		Node(T Value, Node* Previous = nullptr, Node* Next = nullptr)
-			: Buffer(Value), Previous(Previous), Next(Next) {};
+			: Buffer(Value), Previous(Previous), Next(Next)
+		{
+			RecordNodeAllocation<T>();
+		}
+
+		~Node() { RecordNodeDeallocation<T>(); }
 
 		T Buffer;
 		Node* Next;
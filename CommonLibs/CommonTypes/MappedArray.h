@@ -0,0 +1,202 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "Exception.h"
+#include "Span.h"
+#include "Iterators/Block.h"
+#include "../CommonUtils/Assert.h"
+#include "./../CommonUtils/MappedFile.h"
+#include "./../CommonUtils/TypeOperations.h"	// Move
+
+namespace Common
+{
+
+	/// Version of TMappedArray file format that is written and accepted.
+	constexpr uint32_t MappedArrayFormatVersion = 1;
+
+
+	/**
+	 * @brief Header at the beginning of TMappedArray files.
+	 *
+	 * Elements start at DataOffset, which is a multiple of element
+	 * alignment. Values are stored in the byte order of the writer;
+	 * ByteOrderMark detects files from machines with other order.
+	*/
+	struct CMappedArrayHeader
+	{
+		char Magic[8];
+		uint32_t Version;
+		uint32_t ByteOrderMark;
+		uint32_t ElementSize;
+		uint32_t ElementAlignment;
+		uint64_t Count;
+		uint64_t DataOffset;
+	};
+
+
+	/**
+	 * @brief Validates header of mapped array file.
+	 * @param File Mapped file
+	 * @param ElementSize Expected sizeof(T)
+	 * @param ElementAlignment Expected alignof(T)
+	 * @param OutCount Receives number of elements
+	 * @param OutDataOffset Receives offset of the first element
+	 * @return Ok or BadFormat (no changes then)
+	*/
+	EStatus CheckMappedArrayHeader(const CMappedFile& File,
+		size_t ElementSize, size_t ElementAlignment,
+		size_t& OutCount, size_t& OutDataOffset) noexcept;
+
+	/**
+	 * @brief Writes header and elements to the file (overwrites it).
+	 * @param Path Path to the file
+	 * @param Data Pointer to the first element
+	 * @param Count Number of elements
+	 * @param ElementSize sizeof(T)
+	 * @param ElementAlignment alignof(T)
+	 * @return Ok or IOError
+	*/
+	EStatus TryWriteMappedArrayFile(const char* Path, const void* Data,
+		size_t Count, size_t ElementSize, size_t ElementAlignment) noexcept;
+
+
+	/**
+	 * @brief Read-only array of POD records stored in a file.
+	 *
+	 * File is memory-mapped instead of being read element by element:
+	 * opening does not depend on file size, pages are loaded on first
+	 * access and shared with the OS page cache (no second copy in
+	 * memory). Interface follows read-only part of TVector.
+	 *
+	 * Files are created with WriteMappedArray(). Header is checked on
+	 * open: version, element size and alignment must match T.
+	 *
+	 * @note Move-only. References are valid until Close().
+	 * @tparam T Trivially copyable element type
+	*/
+	template <typename T>
+	class TMappedArray
+	{
+		static_assert(std::is_trivially_copyable<T>::value,
+			"Mapped array elements must be trivially copyable");
+
+	public:
+
+		typedef T value_type;	// Follow convention
+
+		/// Iterator. Implemented op-s: ++, +=, +, --, -=, -, ==, !=, =.
+		typedef Iterators::TBlockIterator<const T*, const T&> CIterator;
+
+
+		/// Creates empty array without file.
+		TMappedArray() = default;
+
+		/**
+		 * @brief Opens array file.
+		 * @param Path Path to the file
+		 * @note Throws CIOError or CBadFormat.
+		*/
+		explicit TMappedArray(const char* Path);
+
+		TMappedArray(TMappedArray&& Other) noexcept;
+		TMappedArray& operator = (TMappedArray&& Other) noexcept;
+
+
+		/**
+		 * @brief Opens array file. Closes current file.
+		 * @param Path Path to the file
+		 * @note Throws CIOError or CBadFormat; array is empty then.
+		*/
+		void Open(const char* Path);
+
+		/**
+		 * @brief Open() that returns error instead of throwing.
+		 * @param Path Path to the file
+		 * @return Ok, IOError or BadFormat
+		*/
+		EStatus TryOpen(const char* Path) noexcept;
+
+		/// Unmaps the file, array becomes empty.
+		void Close() noexcept;
+
+		/**
+		 * @brief Passes access pattern to the OS.
+		 * @param Hint Sequential, Random, WillNeed, HugePage, ...
+		 * @return false if hint is not supported and was ignored
+		*/
+		bool Advise(EAccessHint Hint) const noexcept;
+
+
+		/**
+		 * @brief Provides access to the element.
+		 * @param Index aka offset value
+		 * @return Const reference to the element
+		 * @note Index must be less than Size.
+		*/
+		const T& operator [] (size_t Index) const;
+
+		/// Access to the element with range check (COutOfRange).
+		const T& SafeAt(size_t Index) const;
+
+		/// Access to the element that returns nullptr if out of range.
+		const T* TryAt(size_t Index) const noexcept;
+
+		/// Pointer to the first element.
+		const T* RawData() const noexcept;
+
+		/// Number of elements.
+		size_t GetSize() const noexcept;
+
+		/// Simple check if size equals 0.
+		bool IsEmpty() const noexcept;
+
+		/// Span over all elements.
+		TSpan<const T> GetSpan() const noexcept;
+
+		/// GetSpan() as conversion.
+		operator TSpan<const T>() const noexcept { return GetSpan(); }
+
+
+		/// Iterator pointing to the first elem.
+		CIterator Begin() const noexcept;
+
+		/// Iterator pointing to the elem after last.
+		CIterator End() const noexcept;
+
+		/// Begin() alias (for compatibity)
+		const T* begin() const noexcept { return Data; }
+		/// End() alias (for compatibity)
+		const T* end() const noexcept { return Data + Size; }
+
+	private:
+
+		CMappedFile File;
+		const T* Data = nullptr;
+		size_t Size = 0;
+
+	};
+
+
+
+	/**
+	 * @brief Writes elements to the file that TMappedArray can open.
+	 * @param Path Path to the file, overwritten if exists
+	 * @param Data Pointer to the first element
+	 * @param Count Number of elements
+	 * @note Throws CIOError.
+	*/
+	template <typename T>
+	void WriteMappedArray(const char* Path, const T* Data, size_t Count);
+
+	/// WriteMappedArray() that returns error instead of throwing.
+	template <typename T>
+	EStatus TryWriteMappedArray(const char* Path, const T* Data,
+		size_t Count) noexcept;
+
+}
+
+#include "Private/MappedArray.tpp"
\ No newline at end of file
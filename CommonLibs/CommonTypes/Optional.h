@@ -7,20 +7,139 @@
 #pragma warning(disable: 26495)
 
 #include <new>	// placement new language feature
+#include <type_traits>
 
 #include "Exception.h"
-#include "./../CommonUtils/TypeOperations.h"	// Move, Swap
+#include "./../CommonUtils/TypeOperations.h"	// Move, Forward, Swap
 
 namespace Common
 {
 
+	/// Tag for constructors that create value in place.
+	struct CInPlace {};
+	constexpr CInPlace InPlace{};
+
+
+	/**
+	 * @brief Niche is a value of T that optional never stores.
+	 *
+	 * Optional with niche has no existence flag: it is empty when its
+	 * value equals EmptyValue, so it has the same size as T. Pass niche
+	 * as the second parameter of TOptional or specialize TDefaultNiche.
+	*/
+	template <typename T>
+	struct TNoNiche
+	{
+		static constexpr bool bHasNiche = false;
+	};
+
+	/// Niche that uses Sentinel (e.g. -1 for indices) as empty state.
+	template <typename T, T Sentinel>
+	struct TSentinelNiche
+	{
+		static constexpr bool bHasNiche = true;
+		static constexpr T EmptyValue = Sentinel;
+	};
+
+	/**
+	 * @brief Niche used by default: none, so any value of T can be stored.
+	 *
+	 * Null pointer is a valid value too. Pointer that is never null
+	 * can opt in: TOptional<T*, TSentinelNiche<T*, nullptr>>.
+	*/
+	template <typename T>
+	struct TDefaultNiche : TNoNiche<T> {};
+
+
+	/// Aligned buffer with existence flag. Used by TOptional only.
+	template <typename T>
+	class TOptionalBuffer
+	{
+	protected:
+
+		alignas(T) unsigned char Buffer[sizeof(T)];
+		bool bExists = false;
+
+		// low level memory management
+		inline bool Exists() const noexcept;
+		template <typename... ArgTypes>
+		inline void Construct(ArgTypes&&... Args);
+		inline void Reset() noexcept;
+		inline T& Get() noexcept;
+		inline const T& Get() const noexcept;
+
+	};
+
+	/// Value that is empty when it equals niche. Used by TOptional only.
+	template <typename T, typename NicheType>
+	class TOptionalNicheBuffer
+	{
+	protected:
+
+		T Value = NicheType::EmptyValue;
+
+		inline bool Exists() const noexcept;
+		template <typename... ArgTypes>
+		inline void Construct(ArgTypes&&... Args) noexcept;
+		inline void Reset() noexcept;
+		inline T& Get() noexcept;
+		inline const T& Get() const noexcept;
+
+	};
+
+	/**
+	 * @brief Copy and destruction of TOptional's buffer.
+	 *
+	 * Compiler generates them when T is trivially copyable, so
+	 * TOptional is trivially copyable too: arrays of optionals are
+	 * copied with memcpy and small optionals are passed in registers.
+	*/
+	template <typename T, typename NicheType, bool bTrivial =
+		std::is_trivially_copyable<T>::value>
+	class TOptionalStorage : public std::conditional<NicheType::bHasNiche,
+		TOptionalNicheBuffer<T, NicheType>, TOptionalBuffer<T>>::type
+	{
+	};
+
+	/// TOptionalStorage for types with user-defined copy or destructor.
+	template <typename T, typename NicheType>
+	class TOptionalStorage<T, NicheType, false> : public TOptionalBuffer<T>
+	{
+		static_assert(!NicheType::bHasNiche,
+			"Niche requires trivially copyable type");
+
+	public:
+
+		TOptionalStorage() = default;
+		TOptionalStorage(const TOptionalStorage& Other);
+		TOptionalStorage(TOptionalStorage&& Other) noexcept(
+			std::is_nothrow_move_constructible<T>::value);
+		~TOptionalStorage();
+
+		TOptionalStorage& operator = (const TOptionalStorage& Other);
+		TOptionalStorage& operator = (TOptionalStorage&& Other) noexcept(
+			std::is_nothrow_move_constructible<T>::value);
+
+	};
+
+
 	/**
 	 * @brief Represents object that may not exist.
+	 *
+	 * Copy, move and destruction are trivial when T is trivially
+	 * copyable. With TSentinelNiche<T*, nullptr> optional pointer is
+	 * as small as T*, but can not hold nullptr.
+	 *
+	 * Values can be constructed in place with Emplace() or InPlace
+	 * constructor, and moved out with TakeValue(), so move-only types
+	 * are supported. TOptional<T&> stores a pointer to external object.
 	 * 
+	 * @tparam T Value type
+	 * @tparam NicheType TNoNiche, TSentinelNiche or your own niche
 	 * @todo SFINAE for == operator
 	*/
-	template <typename T>
-	class TOptional
+	template <typename T, typename NicheType = TDefaultNiche<T>>
+	class TOptional : private TOptionalStorage<T, NicheType>
 	{
 
 	public:
@@ -35,26 +154,39 @@ namespace Common
 		TOptional(const T& Value);
 
 		/**
-		 * @brief Initialize by copying another TOptional.
-		 * @param Other Optional to create copy from
+		 * @brief Initialize optional with existing value (move).
+		 * @param Value Temporary object to get data from
 		*/
-		TOptional(const TOptional<T>& Other);
+		TOptional(T&& Value);
 
 		/**
-		 * @brief Move constructor.
-		 * @param Other Temporary object to get data from
+		 * @brief Construct value in place, without copies.
+		 * @param Args Arguments passed to T's constructor
 		*/
-		TOptional(TOptional<T>&& Other) noexcept;
+		template <typename... ArgTypes>
+		explicit TOptional(CInPlace, ArgTypes&&... Args);
 
-		~TOptional();
+		// copy, move and destructor are provided by TOptionalStorage
 
 
 		/**
 		 * @brief Set value to optional (copy).
 		 * @param Value Object to create copy from
+		 * @note Setting niche value makes optional empty.
 		*/
 		void SetValue(const T& Value);
 
+		/// SetValue() that moves Value into optional.
+		void SetValue(T&& Value);
+
+		/**
+		 * @brief Destroys current value and constructs new one in place.
+		 * @param Args Arguments passed to T's constructor
+		 * @return Reference to the new value
+		*/
+		template <typename... ArgTypes>
+		T& Emplace(ArgTypes&&... Args);
+
 		/**
 		 * @brief Remove value from optional.
 		 * @note This will call destructor on internal object.
@@ -66,27 +198,16 @@ namespace Common
 		 * @param Value Object to create copy from
 		 * @return Reference to this optional
 		*/
-		TOptional<T>& operator = (const T& Value);
-
-		/**
-		 * @brief Assign from another optional (copy).
-		 * @param Other Optional to create copy from
-		 * @return Reference to this optional
-		*/
-		TOptional<T>& operator = (const TOptional<T>& Other);
+		TOptional& operator = (const T& Value);
 
-		/**
-		 * @brief Move assignment.
-		 * @param Other Temporary object to get data from
-		 * @return Reference to this optional
-		*/
-		TOptional<T>& operator = (TOptional<T>&& Other) noexcept;
+		/// Assign value to the optional (move).
+		TOptional& operator = (T&& Value);
 
 		/**
 		 * @brief Swaps two optionals without reconstructing values.
 		 * @param Other Object to swap resources with
 		*/
-		void Swap(TOptional<T>& Other);
+		void Swap(TOptional& Other);
 
 
 		/**
@@ -95,7 +216,7 @@ namespace Common
 		 * @return True if sizes and values are equal, false otherwise
 		 * @note Containing element must implement == operator.
 		*/
-		bool operator == (const TOptional<T>& Other);
+		bool operator == (const TOptional& Other);
 
 
 		/**
@@ -108,7 +229,31 @@ namespace Common
 		 * @brief Gets value if it exists or throws an exception.
 		 * @return Optional's value
 		*/
-		const T& GetValue() const;
+		T& GetValue();
+
+		/// GetValue() for const optionals.
+		const T& GetValue() const
+		{
+			return const_cast<TOptional*>(this)->GetValue();
+		}
+
+		/**
+		 * @brief GetValue() without exceptions.
+		 * @return Pointer to optional's value or nullptr if it is empty
+		*/
+		T* TryGetValue() noexcept;
+
+		/// TryGetValue() for const optionals.
+		const T* TryGetValue() const noexcept
+		{
+			return const_cast<TOptional*>(this)->TryGetValue();
+		}
+
+		/**
+		 * @brief Moves value out of optional, optional becomes empty.
+		 * @return Value that was stored, throws if optional is empty
+		*/
+		T TakeValue();
 
 		/**
 		 * @brief Get value or passed value (if not possible).
@@ -117,15 +262,70 @@ namespace Common
 		*/
 		const T& GetValueOr(const T& OtherVariant) const noexcept;
 
+	};
+
+
+	/**
+	 * @brief Optional reference to an object that is stored elsewhere.
+	 *
+	 * Contains only a pointer. SetValue() rebinds the reference, it
+	 * never assigns to the referenced object.
+	*/
+	template <typename T, typename NicheType>
+	class TOptional<T&, NicheType>
+	{
+
+	public:
+
+		/// No object by default.
+		TOptional() = default;
+
+		/**
+		 * @brief Initialize optional with reference to Value.
+		 * @param Value Object that optional will refer to
+		*/
+		TOptional(T& Value) noexcept;
+
+		/**
+		 * @brief Make optional refer to another object.
+		 * @param Value Object that optional will refer to
+		*/
+		void SetValue(T& Value) noexcept;
+
+		/// SetValue() alias, for generic code.
+		T& Emplace(T& Value) noexcept;
+
+		/// Makes optional empty. Referenced object is not changed.
+		void Clear() noexcept;
+
+		/**
+		 * @brief Check if optional refers to an object.
+		 * @return True if value exists, false otherwise
+		*/
+		bool DoesValueExist() const noexcept;
+
+		/**
+		 * @brief Gets referenced object or throws an exception.
+		 * @return Reference passed to optional
+		*/
+		T& GetValue() const;
+
+		/**
+		 * @brief GetValue() without exceptions.
+		 * @return Pointer to the object or nullptr if optional is empty
+		*/
+		T* TryGetValue() const noexcept;
+
+		/**
+		 * @brief Get reference or passed reference (if not possible).
+		 * @param OtherVariant Returned if optional is empty
+		 * @return Referenced object or provided object
+		*/
+		T& GetValueOr(T& OtherVariant) const noexcept;
+
 	private:
 
-		alignas(T) unsigned char Buffer[sizeof(T)];
-		bool bExists = false;
-		
-		// low level memory management
-		inline void Construct(const T& Value);
-		inline void DestructIfExists() noexcept;
-		inline const T& Get() const noexcept;
+		T* Pointer = nullptr;
 
 	};
 
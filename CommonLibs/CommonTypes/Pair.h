@@ -2,14 +2,19 @@
 
 #pragma once
 
+#include <type_traits>
+
+#include "./../CommonUtils/TypeOperations.h"	// Forward
+
 namespace Common
 {
 
 	/**
 	 * @brief Container that represents a pair of objects.
-	 * 
-	 * @todo Placement new
-	 *		 
+	 *
+	 * Members are not initialized with T{} by default constructor, so
+	 * pair of trivial types is trivial itself: it can be copied with
+	 * memcpy by containers. Use TPair<T1, T2>() to get zeroed pair.
 	*/
 	template <typename T1, typename T2>
 	class TPair
@@ -17,7 +22,7 @@ namespace Common
 
 	public:
 
-		/// Initialize pair with type default values.
+		/// Default-initialize both values (trivial for trivial types).
 		TPair() = default;
 
 		/**
@@ -25,7 +30,7 @@ namespace Common
 		 * @param First First value in pair
 		 * @param Second Second value in pair
 		*/
-		TPair(const T1& First, const T2& Second) noexcept
+		constexpr TPair(const T1& First, const T2& Second)
 			: First(First), Second(Second) {};
 
 
@@ -34,7 +39,7 @@ namespace Common
 		 * @param First First value in pair
 		 * @param Second Second value in pair
 		*/
-		void MakePair(T1 First, T2 Second) noexcept
+		void MakePair(const T1& First, const T2& Second)
 		{
 			this->First = First;
 			this->Second = Second;
@@ -42,19 +47,111 @@ namespace Common
 
 
 		/// First value in pair.
-		T1 First = T1{};
+		T1 First;
 		/// Second value in pair.
-		T2 Second = T2{};
+		T2 Second;
 
 	};
 
 
 
 	template <typename T1, typename T2>
-	inline TPair<T1, T2> MakePair(const T1& First,
-		const T2& Second) noexcept
+	inline constexpr TPair<T1, T2> MakePair(const T1& First,
+		const T2& Second)
 	{
 		return TPair<T1, T2>(First, Second);
 	}
 
+
+
+	/**
+	 * @brief One element of TCompressedPair or TTuple.
+	 *
+	 * Empty classes (comparators, hashers, allocators) are inherited
+	 * instead of stored, so they take no space (empty base optimization).
+	 * Index makes bases unique when types are repeated.
+	*/
+	template <typename T, size_t Index, bool bEmptyBase =
+		std::is_empty<T>::value && !std::is_final<T>::value>
+	class TCompressedElement
+	{
+
+	public:
+
+		TCompressedElement() = default;
+
+		template <typename ArgType>
+		constexpr explicit TCompressedElement(ArgType&& Value)
+			: Value(Forward<ArgType>(Value)) {}
+
+		T& Get() noexcept { return Value; }
+		const T& Get() const noexcept { return Value; }
+
+	private:
+
+		T Value;
+
+	};
+
+	template <typename T, size_t Index>
+	class TCompressedElement<T, Index, true> : private T
+	{
+
+	public:
+
+		TCompressedElement() = default;
+
+		template <typename ArgType>
+		constexpr explicit TCompressedElement(ArgType&& Value)
+			: T(Forward<ArgType>(Value)) {}
+
+		T& Get() noexcept { return *this; }
+		const T& Get() const noexcept { return *this; }
+
+	};
+
+
+	/**
+	 * @brief Pair for container internals, where one value is often
+	 *		  an empty functor or allocator.
+	 *
+	 * Empty T1 or T2 takes no space: sizeof(TCompressedPair<CLess,
+	 * int*>) == sizeof(int*). Trivially copyable if both types are.
+	*/
+	template <typename T1, typename T2>
+	class TCompressedPair
+		: private TCompressedElement<T1, 0>, private TCompressedElement<T2, 1>
+	{
+
+		typedef TCompressedElement<T1, 0> CFirstBase;
+		typedef TCompressedElement<T2, 1> CSecondBase;
+
+	public:
+
+		/// Default-initialize both values.
+		TCompressedPair() = default;
+
+		/**
+		 * @brief Creates a pair from two values (copied or moved).
+		 * @param First Value to create first element from
+		 * @param Second Value to create second element from
+		*/
+		template <typename FirstArgType, typename SecondArgType>
+		constexpr TCompressedPair(FirstArgType&& First,
+			SecondArgType&& Second)
+			: CFirstBase(Forward<FirstArgType>(First)),
+			CSecondBase(Forward<SecondArgType>(Second)) {}
+
+		/// Reference to first value.
+		T1& GetFirst() noexcept { return CFirstBase::Get(); }
+		/// Const reference to first value.
+		const T1& GetFirst() const noexcept { return CFirstBase::Get(); }
+
+		/// Reference to second value.
+		T2& GetSecond() noexcept { return CSecondBase::Get(); }
+		/// Const reference to second value.
+		const T2& GetSecond() const noexcept { return CSecondBase::Get(); }
+
+	};
+
 }
\ No newline at end of file
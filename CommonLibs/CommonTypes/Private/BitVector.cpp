@@ -0,0 +1,285 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#include "../BitVector.h"
+
+#include <cstring>	// memcmp
+
+namespace Common
+{
+
+	CBitVector::CBitVector(const size_t Size, const bool bValue)
+		: Words(GetBitWordCount(Size), bValue ? ~uint64_t(0) : 0), Size(Size)
+	{
+		ClearTail();
+	}
+
+
+
+	void CBitVector::SetAll() noexcept
+	{
+		for (size_t i = 0; i < Words.GetSize(); ++i)
+		{
+			Words[i] = ~uint64_t(0);
+		}
+		ClearTail();
+	}
+
+
+	void CBitVector::ResetAll() noexcept
+	{
+		for (size_t i = 0; i < Words.GetSize(); ++i)
+		{
+			Words[i] = 0;
+		}
+	}
+
+
+
+	CBitVector& CBitVector::operator &= (const CBitVector& Other) noexcept
+	{
+		ASSERT(Size == Other.Size, "Bit vector: Sizes differ");
+		uint64_t* const Data = Words.RawData();
+		const uint64_t* const OtherData = Other.Words.RawData();
+		for (size_t i = 0; i < Words.GetSize(); ++i)
+		{
+			Data[i] &= OtherData[i];
+		}
+		return *this;
+	}
+
+
+	CBitVector& CBitVector::operator |= (const CBitVector& Other) noexcept
+	{
+		ASSERT(Size == Other.Size, "Bit vector: Sizes differ");
+		uint64_t* const Data = Words.RawData();
+		const uint64_t* const OtherData = Other.Words.RawData();
+		for (size_t i = 0; i < Words.GetSize(); ++i)
+		{
+			Data[i] |= OtherData[i];
+		}
+		return *this;
+	}
+
+
+	CBitVector& CBitVector::operator ^= (const CBitVector& Other) noexcept
+	{
+		ASSERT(Size == Other.Size, "Bit vector: Sizes differ");
+		uint64_t* const Data = Words.RawData();
+		const uint64_t* const OtherData = Other.Words.RawData();
+		for (size_t i = 0; i < Words.GetSize(); ++i)
+		{
+			Data[i] ^= OtherData[i];
+		}
+		return *this;
+	}
+
+
+	CBitVector& CBitVector::AndNot(const CBitVector& Other) noexcept
+	{
+		ASSERT(Size == Other.Size, "Bit vector: Sizes differ");
+		uint64_t* const Data = Words.RawData();
+		const uint64_t* const OtherData = Other.Words.RawData();
+		for (size_t i = 0; i < Words.GetSize(); ++i)
+		{
+			Data[i] &= ~OtherData[i];
+		}
+		return *this;
+	}
+
+
+	bool CBitVector::operator == (const CBitVector& Other) const noexcept
+	{
+		return Size == Other.Size && (Size == 0 ||
+			memcmp(Words.RawData(), Other.Words.RawData(),
+				Words.GetSize() * sizeof(uint64_t)) == 0);
+	}
+
+
+
+	size_t CBitVector::Count() const noexcept
+	{
+		return CountBits(Words.RawData(), Words.GetSize());
+	}
+
+
+	bool CBitVector::Any() const noexcept
+	{
+		for (size_t i = 0; i < Words.GetSize(); ++i)
+		{
+			if (Words[i])
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+
+	size_t CBitVector::FindFirst() const noexcept
+	{
+		return FindNext(0);
+	}
+
+
+	size_t CBitVector::FindNext(const size_t Position) const noexcept
+	{
+		// tail bits are 0, so found bit is always less than Size
+		const size_t Found = FindNextBit(Words.RawData(), Words.GetSize(),
+			Position);
+		return Found < Size ? Found : NotFound;
+	}
+
+
+
+	void CBitVector::Push(const bool bValue)
+	{
+		if (Size % BitsPerWord == 0)
+		{
+			Words.Push(0);
+		}
+		++Size;
+		if (bValue)
+		{
+			Set(Size - 1);
+		}
+	}
+
+
+	void CBitVector::Resize(const size_t NewSize, const bool bValue)
+	{
+		if (NewSize > Size && bValue && Size % BitsPerWord)
+		{
+			// fill the rest of the current last word
+			Words[Words.GetSize() - 1] |= ~uint64_t(0) << (Size % BitsPerWord);
+		}
+		Words.Resize(GetBitWordCount(NewSize), bValue ? ~uint64_t(0) : 0);
+		Size = NewSize;
+		ClearTail();
+	}
+
+
+	void CBitVector::Reserve(const size_t BitCount)
+	{
+		Words.Reserve(GetBitWordCount(BitCount));
+	}
+
+
+	void CBitVector::ShrinkToFit()
+	{
+		Words.ShrinkToFit();
+	}
+
+
+	void CBitVector::Clear() noexcept
+	{
+		Words.Clear();
+		Size = 0;
+	}
+
+
+
+	TSpan<const uint64_t> CBitVector::GetWords() const noexcept
+	{
+		return TSpan<const uint64_t>(Words.RawData(), Words.GetSize());
+	}
+
+
+	void CBitVector::ClearTail() noexcept
+	{
+		if (Size % BitsPerWord)
+		{
+			Words[Words.GetSize() - 1] &=
+				~(~uint64_t(0) << (Size % BitsPerWord));
+		}
+	}
+
+
+
+	CRankSelect::CRankSelect(const CBitVector& Bits)
+	{
+		Build(Bits);
+	}
+
+
+	void CRankSelect::Build(const CBitVector& Bits)
+	{
+		this->Bits = &Bits;
+		const TSpan<const uint64_t> Words = Bits.GetWords();
+		const size_t WordCount = Words.GetSize();
+
+		BlockRanks.Clear();
+		BlockRanks.Reserve(WordCount / WordsPerBlock + 1);
+		Count = 0;
+		for (size_t Block = 0; Block < WordCount; Block += WordsPerBlock)
+		{
+			BlockRanks.Push(Count);
+			const size_t BlockWords = WordCount - Block < WordsPerBlock ?
+				WordCount - Block : WordsPerBlock;
+			Count += CountBits(Words.RawData() + Block, BlockWords);
+		}
+	}
+
+
+	size_t CRankSelect::Rank(const size_t Position) const noexcept
+	{
+		ASSERT(Bits && Position <= Bits->GetSize(),
+			"Rank select: Out of range");
+		const uint64_t* const Words = Bits->GetWords().RawData();
+		const size_t Word = Position / BitsPerWord;
+		const size_t Block = Word / WordsPerBlock;
+		if (Block == BlockRanks.GetSize())	// Position is size, at block start
+		{
+			return Count;
+		}
+
+		size_t Result = BlockRanks[Block];
+		Result += CountBits(Words + Block * WordsPerBlock,
+			Word - Block * WordsPerBlock);
+		if (Position % BitsPerWord)
+		{
+			Result += PopCount(Words[Word] &
+				~(~uint64_t(0) << (Position % BitsPerWord)));
+		}
+		return Result;
+	}
+
+
+	size_t CRankSelect::Select(size_t Rank) const noexcept
+	{
+		if (Rank >= Count)
+		{
+			return NotFound;
+		}
+		// last block that has at most Rank bits before it
+		size_t Low = 0;
+		size_t High = BlockRanks.GetSize();
+		while (High - Low > 1)
+		{
+			const size_t Middle = Low + (High - Low) / 2;
+			if (BlockRanks[Middle] <= Rank)
+			{
+				Low = Middle;
+			}
+			else
+			{
+				High = Middle;
+			}
+		}
+		Rank -= BlockRanks[Low];
+
+		const uint64_t* const Words = Bits->GetWords().RawData();
+		size_t Word = Low * WordsPerBlock;
+		for (;;)
+		{
+			const size_t WordCount = PopCount(Words[Word]);
+			if (Rank < WordCount)
+			{
+				return Word * BitsPerWord +
+					SelectBit(Words[Word], static_cast<unsigned>(Rank));
+			}
+			Rank -= WordCount;
+			++Word;
+		}
+	}
+
+}
\ No newline at end of file
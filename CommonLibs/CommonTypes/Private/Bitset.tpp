@@ -0,0 +1,136 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	template <size_t N>
+	void TBitset<N>::SetAll() noexcept
+	{
+		for (size_t i = 0; i < WordCount; ++i)
+		{
+			Words[i] = ~uint64_t(0);
+		}
+		Words[WordCount - 1] &= TailMask;
+	}
+
+
+	template <size_t N>
+	void TBitset<N>::ResetAll() noexcept
+	{
+		for (size_t i = 0; i < WordCount; ++i)
+		{
+			Words[i] = 0;
+		}
+	}
+
+
+
+	template <size_t N>
+	TBitset<N>& TBitset<N>::operator &= (const TBitset& Other) noexcept
+	{
+		for (size_t i = 0; i < WordCount; ++i)
+		{
+			Words[i] &= Other.Words[i];
+		}
+		return *this;
+	}
+
+
+	template <size_t N>
+	TBitset<N>& TBitset<N>::operator |= (const TBitset& Other) noexcept
+	{
+		for (size_t i = 0; i < WordCount; ++i)
+		{
+			Words[i] |= Other.Words[i];
+		}
+		return *this;
+	}
+
+
+	template <size_t N>
+	TBitset<N>& TBitset<N>::operator ^= (const TBitset& Other) noexcept
+	{
+		for (size_t i = 0; i < WordCount; ++i)
+		{
+			Words[i] ^= Other.Words[i];
+		}
+		return *this;
+	}
+
+
+	template <size_t N>
+	TBitset<N>& TBitset<N>::AndNot(const TBitset& Other) noexcept
+	{
+		for (size_t i = 0; i < WordCount; ++i)
+		{
+			Words[i] &= ~Other.Words[i];
+		}
+		return *this;
+	}
+
+
+	template <size_t N>
+	bool TBitset<N>::operator == (const TBitset& Other) const noexcept
+	{
+		for (size_t i = 0; i < WordCount; ++i)
+		{
+			if (Words[i] != Other.Words[i])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+
+
+	template <size_t N>
+	size_t TBitset<N>::Count() const noexcept
+	{
+		return CountBits(Words, WordCount);
+	}
+
+
+	template <size_t N>
+	bool TBitset<N>::Any() const noexcept
+	{
+		for (size_t i = 0; i < WordCount; ++i)
+		{
+			if (Words[i])
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+
+	template <size_t N>
+	bool TBitset<N>::All() const noexcept
+	{
+		for (size_t i = 0; i + 1 < WordCount; ++i)
+		{
+			if (~Words[i])
+			{
+				return false;
+			}
+		}
+		return Words[WordCount - 1] == TailMask;
+	}
+
+
+	template <size_t N>
+	size_t TBitset<N>::FindFirst() const noexcept
+	{
+		return FindNext(0);
+	}
+
+
+	template <size_t N>
+	size_t TBitset<N>::FindNext(const size_t Position) const noexcept
+	{
+		const size_t Found = FindNextBit(Words, WordCount, Position);
+		return Found < N ? Found : NotFound;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,363 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#include "../BloomFilter.h"
+
+#include <cmath>	// log, exp, pow
+#include <cstring>	// memset, memcpy
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+	(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define COMMON_SSE2 1
+	#include <emmintrin.h>
+#else
+	#define COMMON_SSE2 0
+#endif
+
+#include "./../../CommonUtils/Bits.h"	// CountBits
+
+namespace Common
+{
+
+	// odd constants that spread 32-bit hash into 8 positions (6 bits)
+	static constexpr uint32_t BlockSalts[8] = {
+		0x47B6137Bu, 0x44974D91u, 0x8824AD5Bu, 0xA2B7289Du,
+		0x705495C7u, 0x2DF1424Bu, 0x9EFC4947u, 0x5C6BFB31u
+	};
+
+
+	static size_t RoundUpToPowerOfTwo(const size_t Value) noexcept
+	{
+		size_t Result = 1;
+		while (Result < Value)
+		{
+			Result *= 2;
+		}
+		return Result;
+	}
+
+
+	// bit of every word of the block for the hash
+	static void MakeBlockMask(const uint64_t Hash, uint64_t* const OutMask)
+		noexcept
+	{
+		const uint32_t Low = static_cast<uint32_t>(Hash);
+		for (size_t i = 0; i < 8; ++i)
+		{
+			OutMask[i] = uint64_t(1) << ((Low * BlockSalts[i]) >> 26);
+		}
+	}
+
+
+
+	CBloomFilter::CBloomFilter(const size_t ExpectedCount,
+		const double FalsePositiveRate)
+	{
+		ASSERT(FalsePositiveRate > 0 && FalsePositiveRate < 1,
+			"Bloom filter: Bad false positive rate");
+		const double Keys = ExpectedCount ? static_cast<double>(ExpectedCount) : 1;
+		const double Ln2 = std::log(2.0);
+		// optimal size: -n ln(p) / ln(2)^2
+		const double OptimalBits = -Keys * std::log(FalsePositiveRate) /
+			(Ln2 * Ln2);
+		const size_t BitCount = RoundUpToPowerOfTwo(
+			static_cast<size_t>(OptimalBits) > 64 ?
+			static_cast<size_t>(OptimalBits) : 64);
+		Words.Resize(BitCount / 64, 0);
+
+		// optimal hash count for the real size: m / n ln(2)
+		const double OptimalHashes = static_cast<double>(BitCount) / Keys * Ln2;
+		HashCount = OptimalHashes < 1 ? 1 : OptimalHashes > MaxHashCount ?
+			MaxHashCount : static_cast<unsigned>(OptimalHashes + 0.5);
+	}
+
+
+
+	void CBloomFilter::InsertBytes(const void* const Data,
+		const size_t Size) noexcept
+	{
+		InsertHash(HashBytes(Data, Size));
+	}
+
+
+	bool CBloomFilter::MayContainBytes(const void* const Data,
+		const size_t Size) const noexcept
+	{
+		return MayContainHash(HashBytes(Data, Size));
+	}
+
+
+	void CBloomFilter::InsertHash(const uint64_t Hash) noexcept
+	{
+		ASSERT(HashCount, "Bloom filter: Filter has no bits");
+		const uint64_t Mask = Words.GetSize() * 64 - 1;
+		const uint64_t Step = (Hash >> 32) | 1;	// odd: visits all bits
+		uint64_t Position = Hash;
+		for (unsigned i = 0; i < HashCount; ++i)
+		{
+			const uint64_t Bit = Position & Mask;
+			Words[Bit / 64] |= uint64_t(1) << (Bit % 64);
+			Position += Step;
+		}
+	}
+
+
+	bool CBloomFilter::MayContainHash(const uint64_t Hash) const noexcept
+	{
+		if (!HashCount)
+		{
+			return false;
+		}
+		const uint64_t Mask = Words.GetSize() * 64 - 1;
+		const uint64_t Step = (Hash >> 32) | 1;
+		uint64_t Position = Hash;
+		for (unsigned i = 0; i < HashCount; ++i)
+		{
+			const uint64_t Bit = Position & Mask;
+			if (!((Words[Bit / 64] >> (Bit % 64)) & 1))
+			{
+				return false;
+			}
+			Position += Step;
+		}
+		return true;
+	}
+
+
+
+	void CBloomFilter::Union(const CBloomFilter& Other) noexcept
+	{
+		ASSERT(IsCompatible(Other), "Bloom filter: Filters differ");
+		uint64_t* const Data = Words.RawData();
+		const uint64_t* const OtherData = Other.Words.RawData();
+		for (size_t i = 0; i < Words.GetSize(); ++i)
+		{
+			Data[i] |= OtherData[i];
+		}
+	}
+
+
+	bool CBloomFilter::IsCompatible(const CBloomFilter& Other) const noexcept
+	{
+		return Words.GetSize() == Other.Words.GetSize() &&
+			HashCount == Other.HashCount;
+	}
+
+
+	void CBloomFilter::Clear() noexcept
+	{
+		for (size_t i = 0; i < Words.GetSize(); ++i)
+		{
+			Words[i] = 0;
+		}
+	}
+
+
+	double CBloomFilter::EstimateFalsePositiveRate() const noexcept
+	{
+		if (Words.IsEmpty())
+		{
+			return 1;
+		}
+		const double Filled = static_cast<double>(
+			CountBits(Words.RawData(), Words.GetSize())) / GetBitCount();
+		return std::pow(Filled, HashCount);
+	}
+
+
+
+	CBlockedBloomFilter::CBlockedBloomFilter(const size_t ExpectedCount,
+		const double FalsePositiveRate)
+	{
+		ASSERT(FalsePositiveRate > 0 && FalsePositiveRate < 1,
+			"Bloom filter: Bad false positive rate");
+		const double Keys = ExpectedCount ? static_cast<double>(ExpectedCount) : 1;
+		// k = 8: p = (1 - e^(-8n/m))^8, so m = -8n / ln(1 - p^(1/8));
+		// blocks get uneven load, so some room is added
+		const double Bits = -8 * Keys /
+			std::log(1 - std::pow(FalsePositiveRate, 1.0 / 8)) * 1.2;
+		const size_t Count = static_cast<size_t>(Bits / 512) + 1;
+		AllocateBlocks(RoundUpToPowerOfTwo(Count));
+	}
+
+
+	CBlockedBloomFilter::CBlockedBloomFilter(const CBlockedBloomFilter& Other)
+	{
+		if (Other.BlockCount)
+		{
+			AllocateBlocks(Other.BlockCount);
+			memcpy(Blocks, Other.Blocks,
+				BlockCount * WordsPerBlock * sizeof(uint64_t));
+		}
+	}
+
+
+	CBlockedBloomFilter::CBlockedBloomFilter(
+		CBlockedBloomFilter&& Other) noexcept
+	{
+		Swap(Other);
+	}
+
+
+	CBlockedBloomFilter::~CBlockedBloomFilter()
+	{
+		FreeBlocks();
+	}
+
+
+	CBlockedBloomFilter& CBlockedBloomFilter::operator = (
+		const CBlockedBloomFilter& Other)
+	{
+		if (this != &Other)
+		{
+			CBlockedBloomFilter Copy(Other);
+			Swap(Copy);
+		}
+		return *this;
+	}
+
+
+	CBlockedBloomFilter& CBlockedBloomFilter::operator = (
+		CBlockedBloomFilter&& Other) noexcept
+	{
+		Swap(Other);
+		return *this;
+	}
+
+
+
+	void CBlockedBloomFilter::InsertBytes(const void* const Data,
+		const size_t Size) noexcept
+	{
+		InsertHash(HashBytes(Data, Size));
+	}
+
+
+	bool CBlockedBloomFilter::MayContainBytes(const void* const Data,
+		const size_t Size) const noexcept
+	{
+		return MayContainHash(HashBytes(Data, Size));
+	}
+
+
+	void CBlockedBloomFilter::InsertHash(const uint64_t Hash) noexcept
+	{
+		ASSERT(BlockCount, "Bloom filter: Filter has no bits");
+		uint64_t* const Block = Blocks +
+			((Hash >> 32) & (BlockCount - 1)) * WordsPerBlock;
+		uint64_t Mask[8];
+		MakeBlockMask(Hash, Mask);
+		for (size_t i = 0; i < WordsPerBlock; ++i)
+		{
+			Block[i] |= Mask[i];
+		}
+	}
+
+
+	bool CBlockedBloomFilter::MayContainHash(const uint64_t Hash) const noexcept
+	{
+		if (!BlockCount)
+		{
+			return false;
+		}
+		const uint64_t* const Block = Blocks +
+			((Hash >> 32) & (BlockCount - 1)) * WordsPerBlock;
+		alignas(16) uint64_t Mask[8];
+		MakeBlockMask(Hash, Mask);
+
+#if COMMON_SSE2
+		// bits of the mask that are missing in the block, all 8 words
+		__m128i Missing = _mm_setzero_si128();
+		for (size_t i = 0; i < WordsPerBlock; i += 2)
+		{
+			const __m128i Bits = _mm_load_si128(
+				reinterpret_cast<const __m128i*>(Block + i));
+			const __m128i Wanted = _mm_load_si128(
+				reinterpret_cast<const __m128i*>(Mask + i));
+			Missing = _mm_or_si128(Missing, _mm_andnot_si128(Bits, Wanted));
+		}
+		return _mm_movemask_epi8(_mm_cmpeq_epi8(Missing,
+			_mm_setzero_si128())) == 0xFFFF;
+#else
+		uint64_t Missing = 0;
+		for (size_t i = 0; i < WordsPerBlock; ++i)
+		{
+			Missing |= Mask[i] & ~Block[i];
+		}
+		return Missing == 0;
+#endif
+	}
+
+
+
+	void CBlockedBloomFilter::Union(const CBlockedBloomFilter& Other) noexcept
+	{
+		ASSERT(IsCompatible(Other), "Bloom filter: Filters differ");
+		for (size_t i = 0; i < BlockCount * WordsPerBlock; ++i)
+		{
+			Blocks[i] |= Other.Blocks[i];
+		}
+	}
+
+
+	bool CBlockedBloomFilter::IsCompatible(
+		const CBlockedBloomFilter& Other) const noexcept
+	{
+		return BlockCount == Other.BlockCount;
+	}
+
+
+	void CBlockedBloomFilter::Clear() noexcept
+	{
+		if (BlockCount)
+		{
+			memset(Blocks, 0, BlockCount * WordsPerBlock * sizeof(uint64_t));
+		}
+	}
+
+
+	double CBlockedBloomFilter::EstimateFalsePositiveRate() const noexcept
+	{
+		if (!BlockCount)
+		{
+			return 1;
+		}
+		// words are filled evenly, one bit of every word is tested
+		const double Filled = static_cast<double>(
+			CountBits(Blocks, BlockCount * WordsPerBlock)) / GetBitCount();
+		return std::pow(Filled, 8);
+	}
+
+
+	void CBlockedBloomFilter::Swap(CBlockedBloomFilter& Other) noexcept
+	{
+		Common::Swap(Buffer, Other.Buffer);
+		Common::Swap(Blocks, Other.Blocks);
+		Common::Swap(BlockCount, Other.BlockCount);
+	}
+
+
+
+	void CBlockedBloomFilter::AllocateBlocks(const size_t Count)
+	{
+		constexpr size_t WordsPerLine = CacheLineSize / sizeof(uint64_t);
+		uint64_t* NewBuffer;
+		// extra line to align the first block
+		Allocate(Count * WordsPerBlock + WordsPerLine - 1, NewBuffer);
+		FreeBlocks();
+		Buffer = NewBuffer;
+		const uintptr_t Address = reinterpret_cast<uintptr_t>(Buffer);
+		Blocks = reinterpret_cast<uint64_t*>(
+			(Address + CacheLineSize - 1) / CacheLineSize * CacheLineSize);
+		BlockCount = Count;
+		memset(Blocks, 0, Count * WordsPerBlock * sizeof(uint64_t));
+	}
+
+
+	void CBlockedBloomFilter::FreeBlocks() noexcept
+	{
+		Common::Deallocate(Buffer);
+		Blocks = nullptr;
+		BlockCount = 0;
+	}
+
+}
\ No newline at end of file
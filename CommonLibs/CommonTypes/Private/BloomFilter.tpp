@@ -0,0 +1,91 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	template <typename WriterType>
+	void TSerializer<CBloomFilter>::Write(WriterType& Writer,
+		const CBloomFilter& Value)
+	{
+		WriteVarUInt(Writer, Value.HashCount);
+		Serialize(Writer, Value.Words);
+	}
+
+
+	template <typename ReaderType>
+	void TSerializer<CBloomFilter>::Read(ReaderType& Reader,
+		CBloomFilter& OutValue)
+	{
+		const uint64_t HashCount = ReadVarUInt(Reader);
+		COMMON_TRY
+		{
+			Deserialize(Reader, OutValue.Words);
+		}
+		COMMON_CATCH_ALL
+		{
+			OutValue = CBloomFilter();
+			COMMON_RETHROW;
+		}
+		const size_t WordCount = OutValue.Words.GetSize();
+		const bool bEmpty = HashCount == 0 && WordCount == 0;
+		if (!bEmpty && (HashCount == 0 ||
+			HashCount > CBloomFilter::MaxHashCount || WordCount == 0 ||
+			(WordCount & (WordCount - 1)) != 0))
+		{
+			OutValue = CBloomFilter();
+			COMMON_THROW(CBadFormat("Bloom filter: Bad sizes"));
+		}
+		OutValue.HashCount = static_cast<unsigned>(HashCount);
+	}
+
+
+
+	template <typename WriterType>
+	void TSerializer<CBlockedBloomFilter>::Write(WriterType& Writer,
+		const CBlockedBloomFilter& Value)
+	{
+		WriteVarUInt(Writer, Value.BlockCount);
+		const size_t WordCount =
+			Value.BlockCount * CBlockedBloomFilter::WordsPerBlock;
+		for (size_t i = 0; i < WordCount; ++i)
+		{
+			Serialize(Writer, Value.Blocks[i]);
+		}
+	}
+
+
+	template <typename ReaderType>
+	void TSerializer<CBlockedBloomFilter>::Read(ReaderType& Reader,
+		CBlockedBloomFilter& OutValue)
+	{
+		const uint64_t BlockCount = ReadVarUInt(Reader);
+		if ((BlockCount & (BlockCount - 1)) != 0 ||
+			BlockCount > static_cast<size_t>(-1) / 512)
+		{
+			OutValue = CBlockedBloomFilter();
+			COMMON_THROW(CBadFormat("Bloom filter: Bad sizes"));
+		}
+		if (BlockCount == 0)
+		{
+			OutValue = CBlockedBloomFilter();
+			return;
+		}
+		OutValue.AllocateBlocks(static_cast<size_t>(BlockCount));
+		const size_t WordCount = OutValue.BlockCount *
+			CBlockedBloomFilter::WordsPerBlock;
+		COMMON_TRY
+		{
+			for (size_t i = 0; i < WordCount; ++i)
+			{
+				Deserialize(Reader, OutValue.Blocks[i]);
+			}
+		}
+		COMMON_CATCH_ALL
+		{
+			// truncated input must not leave a half-filled filter
+			OutValue = CBlockedBloomFilter();
+			COMMON_RETHROW;
+		}
+	}
+
+}
\ No newline at end of file
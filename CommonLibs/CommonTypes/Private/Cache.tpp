@@ -0,0 +1,393 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	TLruCache<K, V, HashType, EvictionType>::TLruCache(const size_t Capacity,
+		const EvictionType& OnEviction)
+		: Capacity(Capacity), OnEviction(OnEviction)
+	{
+		ASSERT(Capacity > 0, "Cache capacity must not be 0");
+		// pool never reallocates: nodes are referenced by address
+		Nodes.Reserve(Capacity);
+		Index.Reserve(Capacity);
+	}
+
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	V* TLruCache<K, V, HashType, EvictionType>::Get(const K& Key)
+	{
+		CNode** const Found = Index.Find(Key);
+		if (!Found)
+		{
+			++Stats.Misses;
+			return nullptr;
+		}
+		++Stats.Hits;
+		Order.MoveToBack(**Found);
+		return &(*Found)->Value;
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	const V* TLruCache<K, V, HashType, EvictionType>::Peek(const K& Key) const
+	{
+		CNode* const* const Found = Index.Find(Key);
+		return Found ? &(*Found)->Value : nullptr;
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	V& TLruCache<K, V, HashType, EvictionType>::Put(const K& Key,
+		const V& Value)
+	{
+		CNode** const Found = Index.Find(Key);
+		if (Found)
+		{
+			CNode& Node = **Found;
+			Node.Value = Value;
+			Order.MoveToBack(Node);
+			return Node.Value;
+		}
+		CNode& Node = AcquireNode(Key, Value);
+		Order.Push(Node);
+		Index.Insert(Key, &Node);
+		return Node.Value;
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	bool TLruCache<K, V, HashType, EvictionType>::Erase(const K& Key)
+	{
+		CNode** const Found = Index.Find(Key);
+		if (!Found)
+		{
+			return false;
+		}
+		CNode& Node = **Found;
+		Index.Erase(Key);
+		Order.Erase(Node);
+		FreeNodes.Push(Node);
+		return true;
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	void TLruCache<K, V, HashType, EvictionType>::Clear()
+	{
+		while (!Order.IsEmpty())
+		{
+			CNode& Node = Order.Front();
+			Order.Shift();
+			FreeNodes.Push(Node);
+		}
+		Index.Clear();
+		Index.Reserve(Capacity);
+	}
+
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	size_t TLruCache<K, V, HashType, EvictionType>::GetSize() const noexcept
+	{
+		return Index.GetSize();
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	size_t TLruCache<K, V, HashType, EvictionType>::GetCapacity() const noexcept
+	{
+		return Capacity;
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	bool TLruCache<K, V, HashType, EvictionType>::IsEmpty() const noexcept
+	{
+		return Index.IsEmpty();
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	const CCacheStats& TLruCache<K, V, HashType, EvictionType>::GetStats()
+		const noexcept
+	{
+		return Stats;
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	void TLruCache<K, V, HashType, EvictionType>::ResetStats() noexcept
+	{
+		Stats = CCacheStats();
+	}
+
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	typename TLruCache<K, V, HashType, EvictionType>::CNode&
+		TLruCache<K, V, HashType, EvictionType>::AcquireNode(const K& Key,
+			const V& Value)
+	{
+		if (FreeNodes.IsEmpty())
+		{
+			if (Nodes.GetSize() < Capacity)
+			{
+				Nodes.Push(CNode{ Key, Value, CIntrusiveListHook() });
+				return Nodes[Nodes.GetSize() - 1];
+			}
+
+			CNode& Victim = Order.Front();
+			Order.Shift();
+			Index.Erase(Victim.Key);
+			// victim is freed before the callback: if it throws, the
+			// slot is not lost, the next insertion reuses it
+			FreeNodes.Push(Victim);
+			++Stats.Evictions;
+			OnEviction(static_cast<const K&>(Victim.Key), Victim.Value);
+		}
+
+		// node leaves the free list only when it is filled
+		CNode& Node = FreeNodes.Front();
+		Node.Key = Key;
+		Node.Value = Value;
+		FreeNodes.Shift();
+		return Node;
+	}
+
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	TLfuCache<K, V, HashType, EvictionType>::TLfuCache(const size_t Capacity,
+		const EvictionType& OnEviction)
+		: Capacity(Capacity), OnEviction(OnEviction)
+	{
+		ASSERT(Capacity > 0, "Cache capacity must not be 0");
+		Nodes.Reserve(Capacity);
+		Index.Reserve(Capacity);
+	}
+
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	V* TLfuCache<K, V, HashType, EvictionType>::Get(const K& Key)
+	{
+		CNode** const Found = Index.Find(Key);
+		if (!Found)
+		{
+			++Stats.Misses;
+			return nullptr;
+		}
+		++Stats.Hits;
+		CNode& Node = **Found;
+		Touch(Node);
+		return &Node.Value;
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	const V* TLfuCache<K, V, HashType, EvictionType>::Peek(const K& Key) const
+	{
+		CNode* const* const Found = Index.Find(Key);
+		return Found ? &(*Found)->Value : nullptr;
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	V& TLfuCache<K, V, HashType, EvictionType>::Put(const K& Key,
+		const V& Value)
+	{
+		CNode** const Found = Index.Find(Key);
+		if (Found)
+		{
+			CNode& Node = **Found;
+			Node.Value = Value;
+			Touch(Node);
+			return Node.Value;
+		}
+
+		CNode& Node = AcquireNode(Key, Value);
+		Node.Frequency = 1;
+		// new entry is the most recent one of the first run
+		CNode** const Tail = RunTails.Find(1);
+		if (Tail)
+		{
+			Order.Insert(CNodeList::IteratorOf(**Tail) + 1, Node);
+		}
+		else
+		{
+			Order.Unshift(Node);
+		}
+		RunTails.Upsert(1, &Node);
+		Index.Insert(Key, &Node);
+		return Node.Value;
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	bool TLfuCache<K, V, HashType, EvictionType>::Erase(const K& Key)
+	{
+		CNode** const Found = Index.Find(Key);
+		if (!Found)
+		{
+			return false;
+		}
+		CNode& Node = **Found;
+		Index.Erase(Key);
+		Detach(Node);
+		FreeNodes.Push(Node);
+		return true;
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	void TLfuCache<K, V, HashType, EvictionType>::Clear()
+	{
+		while (!Order.IsEmpty())
+		{
+			CNode& Node = Order.Front();
+			Order.Shift();
+			FreeNodes.Push(Node);
+		}
+		RunTails.Clear();
+		Index.Clear();
+		Index.Reserve(Capacity);
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	uint64_t TLfuCache<K, V, HashType, EvictionType>::GetFrequency(
+		const K& Key) const
+	{
+		CNode* const* const Found = Index.Find(Key);
+		return Found ? (*Found)->Frequency : 0;
+	}
+
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	size_t TLfuCache<K, V, HashType, EvictionType>::GetSize() const noexcept
+	{
+		return Index.GetSize();
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	size_t TLfuCache<K, V, HashType, EvictionType>::GetCapacity() const noexcept
+	{
+		return Capacity;
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	bool TLfuCache<K, V, HashType, EvictionType>::IsEmpty() const noexcept
+	{
+		return Index.IsEmpty();
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	const CCacheStats& TLfuCache<K, V, HashType, EvictionType>::GetStats()
+		const noexcept
+	{
+		return Stats;
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	void TLfuCache<K, V, HashType, EvictionType>::ResetStats() noexcept
+	{
+		Stats = CCacheStats();
+	}
+
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	typename TLfuCache<K, V, HashType, EvictionType>::CNode&
+		TLfuCache<K, V, HashType, EvictionType>::AcquireNode(const K& Key,
+			const V& Value)
+	{
+		if (FreeNodes.IsEmpty())
+		{
+			if (Nodes.GetSize() < Capacity)
+			{
+				Nodes.Push(CNode{ Key, Value, 0, CIntrusiveListHook() });
+				return Nodes[Nodes.GetSize() - 1];
+			}
+
+			// front: least frequently used, the oldest of them
+			CNode& Victim = Order.Front();
+			Detach(Victim);
+			Index.Erase(Victim.Key);
+			// victim is freed before the callback: if it throws, the
+			// slot is not lost, the next insertion reuses it
+			FreeNodes.Push(Victim);
+			++Stats.Evictions;
+			OnEviction(static_cast<const K&>(Victim.Key), Victim.Value);
+		}
+
+		// node leaves the free list only when it is filled
+		CNode& Node = FreeNodes.Front();
+		Node.Key = Key;
+		Node.Value = Value;
+		FreeNodes.Shift();
+		return Node;
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	void TLfuCache<K, V, HashType, EvictionType>::Touch(CNode& Node)
+	{
+		// pointers into RunTails are not kept across its modification
+		const uint64_t Frequency = Node.Frequency;
+		CNode** const Found = RunTails.Find(Frequency + 1);
+		CNode* const NextTail = Found ? *Found : nullptr;
+		CNode* const Tail = *RunTails.Find(Frequency);
+
+		if (!NextTail && Tail == &Node)
+		{
+			// already at the place of the new run
+			LeaveRun(Node);
+		}
+		else
+		{
+			CNode& After = NextTail ? *NextTail : *Tail;	// not Node
+			Detach(Node);
+			Order.Insert(CNodeList::IteratorOf(After) + 1, Node);
+		}
+		Node.Frequency = Frequency + 1;
+		RunTails.Upsert(Frequency + 1, &Node);
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	void TLfuCache<K, V, HashType, EvictionType>::LeaveRun(CNode& Node)
+	{
+		CNode** const Tail = RunTails.Find(Node.Frequency);
+		if (*Tail != &Node)
+		{
+			return;
+		}
+		typename CNodeList::CIterator Previous = CNodeList::IteratorOf(Node);
+		--Previous;
+		if (Previous != Order.End() && (*Previous).Frequency == Node.Frequency)
+		{
+			*Tail = &*Previous;
+		}
+		else
+		{
+			RunTails.Erase(Node.Frequency);
+		}
+	}
+
+
+	template <typename K, typename V, typename HashType, typename EvictionType>
+	void TLfuCache<K, V, HashType, EvictionType>::Detach(CNode& Node)
+	{
+		LeaveRun(Node);
+		Order.Erase(Node);
+	}
+
+}
\ No newline at end of file
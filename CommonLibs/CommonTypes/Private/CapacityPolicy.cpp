@@ -0,0 +1,50 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#include "../CapacityPolicy.h"
+
+namespace Common
+{
+
+	static size_t RoundUp(const size_t Value, const size_t Alignment)
+	{
+		return (Value + Alignment - 1) / Alignment * Alignment;
+	}
+
+
+	size_t RoundUpToSizeClass(const size_t Bytes,
+		const EAllocatorSizeClasses SizeClasses)
+	{
+		if (SizeClasses == EAllocatorSizeClasses::Glibc)
+		{
+			// chunks above mmap threshold take whole pages and
+			// keep two headers; others keep one size header
+			// and are aligned to two words
+			const size_t Header = sizeof(size_t);
+			if (Bytes >= 128 * 1024)
+			{
+				return RoundUp(Bytes + 2 * Header, 4096) - 2 * Header;
+			}
+			const size_t Usable = RoundUp(Bytes + Header, 2 * Header) - Header;
+			return Usable > 3 * Header ? Usable : 3 * Header;
+		}
+
+		// jemalloc
+		if (Bytes <= 8)
+		{
+			return 8;
+		}
+		if (Bytes <= 128)
+		{
+			return RoundUp(Bytes, 16);
+		}
+
+		// 4 classes between neighbour powers of two
+		size_t Power = 0;
+		for (size_t Value = Bytes - 1; Value > 1; Value >>= 1)
+		{
+			++Power;
+		}
+		return RoundUp(Bytes, size_t(1) << (Power - 2));
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,231 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#include <thread>	// hardware_concurrency
+
+namespace Common
+{
+
+	template <typename K, typename V, typename HashType>
+	TConcurrentHashMap<K, V, HashType>::TConcurrentHashMap(
+		const size_t ShardCount, const HashType& Hash)
+		: Hasher(Hash)
+	{
+		const size_t Requested = ShardCount ? ShardCount
+			: GetDefaultShardCount();
+		unsigned ShardBits = 0;
+		while ((size_t(1) << ShardBits) < Requested &&
+			(size_t(1) << ShardBits) < MaxShardCount)
+		{
+			++ShardBits;
+		}
+		this->ShardCount = size_t(1) << ShardBits;
+		// bits right below the 7 bits of THashMap tag: shards keep
+		// tags distinct, and low bits that choose slots are not used
+		ShardShift = sizeof(size_t) * 8 - 7 - ShardBits;
+
+		Allocate(this->ShardCount, Shards);
+		COMMON_TRY
+		{
+			SafeDefaultConstruct(0, this->ShardCount, Shards);
+		}
+		COMMON_CATCH_ALL
+		{
+			Common::Deallocate(Shards);
+			COMMON_RETHROW;
+		}
+		for (size_t i = 0; i < this->ShardCount; ++i)
+		{
+			Shards[i].Map = THashMap<K, V, HashType>(Hash);
+		}
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	TConcurrentHashMap<K, V, HashType>::~TConcurrentHashMap()
+	{
+		DestructAll(ShardCount, Shards);
+		Common::Deallocate(Shards);
+	}
+
+
+
+	template <typename K, typename V, typename HashType>
+	bool TConcurrentHashMap<K, V, HashType>::Insert(const K& Key,
+		const V& Value)
+	{
+		CShard& Shard = ShardOf(Key);
+		std::unique_lock<std::shared_mutex> Lock(Shard.Lock);
+		return Shard.Map.Insert(Key, Value);
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	bool TConcurrentHashMap<K, V, HashType>::Upsert(const K& Key,
+		const V& Value)
+	{
+		CShard& Shard = ShardOf(Key);
+		std::unique_lock<std::shared_mutex> Lock(Shard.Lock);
+		const size_t SizeBefore = Shard.Map.GetSize();
+		Shard.Map.Upsert(Key, Value);
+		return Shard.Map.GetSize() != SizeBefore;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	template <typename FunctionType>
+	bool TConcurrentHashMap<K, V, HashType>::FindAndApply(const K& Key,
+		FunctionType Function) const
+	{
+		const CShard& Shard = ShardOf(Key);
+		std::shared_lock<std::shared_mutex> Lock(Shard.Lock);
+		const V* const Value = Shard.Map.Find(Key);
+		if (!Value)
+		{
+			return false;
+		}
+		Function(*Value);
+		return true;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	template <typename FunctionType>
+	bool TConcurrentHashMap<K, V, HashType>::FindAndUpdate(const K& Key,
+		FunctionType Function)
+	{
+		CShard& Shard = ShardOf(Key);
+		std::unique_lock<std::shared_mutex> Lock(Shard.Lock);
+		V* const Value = Shard.Map.Find(Key);
+		if (!Value)
+		{
+			return false;
+		}
+		Function(*Value);
+		return true;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	bool TConcurrentHashMap<K, V, HashType>::Contains(const K& Key) const
+	{
+		const CShard& Shard = ShardOf(Key);
+		std::shared_lock<std::shared_mutex> Lock(Shard.Lock);
+		return Shard.Map.Contains(Key);
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	bool TConcurrentHashMap<K, V, HashType>::Erase(const K& Key)
+	{
+		CShard& Shard = ShardOf(Key);
+		std::unique_lock<std::shared_mutex> Lock(Shard.Lock);
+		return Shard.Map.Erase(Key);
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	template <typename FunctionType>
+	size_t TConcurrentHashMap<K, V, HashType>::EraseIf(
+		FunctionType Predicate)
+	{
+		size_t Removed = 0;
+		for (size_t i = 0; i < ShardCount; ++i)
+		{
+			std::unique_lock<std::shared_mutex> Lock(Shards[i].Lock);
+			Removed += Shards[i].Map.EraseIf(Predicate);
+		}
+		return Removed;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	template <typename FunctionType>
+	void TConcurrentHashMap<K, V, HashType>::ForEach(
+		FunctionType Function) const
+	{
+		for (size_t i = 0; i < ShardCount; ++i)
+		{
+			std::shared_lock<std::shared_mutex> Lock(Shards[i].Lock);
+			static_cast<const THashMap<K, V, HashType>&>(
+				Shards[i].Map).ForEach(Function);
+		}
+	}
+
+
+
+	template <typename K, typename V, typename HashType>
+	void TConcurrentHashMap<K, V, HashType>::Reserve(const size_t Count)
+	{
+		// hash spreads keys evenly, leave some room for deviation
+		const size_t PerShard = Count / ShardCount + Count / ShardCount / 8 + 1;
+		for (size_t i = 0; i < ShardCount; ++i)
+		{
+			std::unique_lock<std::shared_mutex> Lock(Shards[i].Lock);
+			Shards[i].Map.Reserve(PerShard);
+		}
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	void TConcurrentHashMap<K, V, HashType>::Clear()
+	{
+		for (size_t i = 0; i < ShardCount; ++i)
+		{
+			std::unique_lock<std::shared_mutex> Lock(Shards[i].Lock);
+			Shards[i].Map.Clear();
+		}
+	}
+
+
+
+	template <typename K, typename V, typename HashType>
+	size_t TConcurrentHashMap<K, V, HashType>::GetSize() const
+	{
+		size_t Size = 0;
+		for (size_t i = 0; i < ShardCount; ++i)
+		{
+			std::shared_lock<std::shared_mutex> Lock(Shards[i].Lock);
+			Size += Shards[i].Map.GetSize();
+		}
+		return Size;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	bool TConcurrentHashMap<K, V, HashType>::IsEmpty() const
+	{
+		return GetSize() == 0;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	size_t TConcurrentHashMap<K, V, HashType>::GetShardCount() const noexcept
+	{
+		return ShardCount;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	size_t TConcurrentHashMap<K, V, HashType>::GetDefaultShardCount()
+		noexcept
+	{
+		const size_t Threads = std::thread::hardware_concurrency();	// 0 if unknown
+		size_t Count = 1;
+		while (Count < Threads * 4 && Count < MaxShardCount)
+		{
+			Count *= 2;
+		}
+		return Count;
+	}
+
+
+
+	template <typename K, typename V, typename HashType>
+	typename TConcurrentHashMap<K, V, HashType>::CShard&
+		TConcurrentHashMap<K, V, HashType>::ShardOf(const K& Key) const
+	{
+		const size_t Hash = Hasher(Key);
+		return Shards[(Hash >> ShardShift) & (ShardCount - 1)];
+	}
+
+}
\ No newline at end of file
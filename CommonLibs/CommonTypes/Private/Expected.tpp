@@ -0,0 +1,338 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	template <typename E>
+	TUnexpected<E> MakeUnexpected(E Error)
+	{
+		return TUnexpected<E>{ Move(Error) };
+	}
+
+
+
+	template <typename T, typename E>
+	template <typename ValueType>
+	void TExpectedBuffer<T, E>::ConstructValue(ValueType&& Value)
+	{
+		new (Buffer) T(Forward<ValueType>(Value));
+		bHasValue = true;
+	}
+
+
+	template <typename T, typename E>
+	template <typename ErrorType>
+	void TExpectedBuffer<T, E>::ConstructError(ErrorType&& Error)
+	{
+		new (Buffer) E(Forward<ErrorType>(Error));
+		bHasValue = false;
+	}
+
+
+	template <typename T, typename E>
+	void TExpectedBuffer<T, E>::ConstructFrom(const TExpectedBuffer& Other)
+	{
+		if (Other.bHasValue)
+		{
+			ConstructValue(Other.Value());
+		}
+		else
+		{
+			ConstructError(Other.Error());
+		}
+	}
+
+
+	template <typename T, typename E>
+	void TExpectedBuffer<T, E>::ConstructFrom(TExpectedBuffer&& Other)
+	{
+		if (Other.bHasValue)
+		{
+			ConstructValue(Move(Other.Value()));
+		}
+		else
+		{
+			ConstructError(Move(Other.Error()));
+		}
+	}
+
+
+	template <typename T, typename E>
+	void TExpectedBuffer<T, E>::Destruct() noexcept
+	{
+		if (bHasValue)
+		{
+			Value().~T();
+		}
+		else
+		{
+			Error().~E();
+		}
+	}
+
+
+	template <typename T, typename E>
+	T& TExpectedBuffer<T, E>::Value() noexcept
+	{
+		return *reinterpret_cast<T*>(Buffer);
+	}
+
+
+	template <typename T, typename E>
+	const T& TExpectedBuffer<T, E>::Value() const noexcept
+	{
+		return *reinterpret_cast<const T*>(Buffer);
+	}
+
+
+	template <typename T, typename E>
+	E& TExpectedBuffer<T, E>::Error() noexcept
+	{
+		return *reinterpret_cast<E*>(Buffer);
+	}
+
+
+	template <typename T, typename E>
+	const E& TExpectedBuffer<T, E>::Error() const noexcept
+	{
+		return *reinterpret_cast<const E*>(Buffer);
+	}
+
+
+
+	template <typename T, typename E>
+	TExpectedStorage<T, E, false>::TExpectedStorage(
+		const TExpectedStorage& Other) : bValueless(Other.bValueless)
+	{
+		if (!bValueless)
+		{
+			this->ConstructFrom(Other);
+		}
+	}
+
+
+	template <typename T, typename E>
+	TExpectedStorage<T, E, false>::TExpectedStorage(
+		TExpectedStorage&& Other) noexcept(
+		std::is_nothrow_move_constructible<T>::value &&
+		std::is_nothrow_move_constructible<E>::value) :
+		bValueless(Other.bValueless)
+	{
+		if (!bValueless)
+		{
+			this->ConstructFrom(Move(Other));
+		}
+	}
+
+
+	template <typename T, typename E>
+	TExpectedStorage<T, E, false>::~TExpectedStorage()
+	{
+		if (!bValueless)
+		{
+			this->Destruct();
+		}
+	}
+
+
+	template <typename T, typename E>
+	TExpectedStorage<T, E, false>&
+	TExpectedStorage<T, E, false>::operator = (const TExpectedStorage& Other)
+	{
+		if (this != &Other)
+		{
+			// copy may throw, so it is made before this is destructed
+			TExpectedStorage Temp(Other);
+			Reconstruct(Move(Temp));
+		}
+		return *this;
+	}
+
+
+	template <typename T, typename E>
+	TExpectedStorage<T, E, false>&
+	TExpectedStorage<T, E, false>::operator = (TExpectedStorage&& Other)
+		noexcept(std::is_nothrow_move_constructible<T>::value &&
+		std::is_nothrow_move_constructible<E>::value)
+	{
+		if (this != &Other)
+		{
+			Reconstruct(Move(Other));
+		}
+		return *this;
+	}
+
+
+	template <typename T, typename E>
+	void TExpectedStorage<T, E, false>::Reconstruct(TExpectedStorage&& Other)
+	{
+		if (!bValueless)
+		{
+			this->Destruct();
+		}
+		// if the move throws, destructor must not run on the buffer
+		bValueless = true;
+		this->bHasValue = false;
+		if (!Other.bValueless)
+		{
+			this->ConstructFrom(Move(Other));
+			bValueless = false;
+		}
+	}
+
+
+
+	template <typename T, typename E>
+	TExpected<T, E>::TExpected(const T& Value)
+	{
+		this->ConstructValue(Value);
+	}
+
+
+	template <typename T, typename E>
+	TExpected<T, E>::TExpected(T&& Value)
+	{
+		this->ConstructValue(Move(Value));
+	}
+
+
+	template <typename T, typename E>
+	template <typename OtherE>
+	TExpected<T, E>::TExpected(TUnexpected<OtherE> Unexpected)
+	{
+		this->ConstructError(Move(Unexpected.Error));
+	}
+
+
+
+	template <typename T, typename E>
+	bool TExpected<T, E>::HasValue() const noexcept
+	{
+		return this->bHasValue;
+	}
+
+
+	template <typename T, typename E>
+	T& TExpected<T, E>::GetValue()
+	{
+		if (!this->bHasValue)
+		{
+			COMMON_THROW(CDoesNotExist("Expected contains error"));
+		}
+		return this->Value();
+	}
+
+
+	template <typename T, typename E>
+	const T* TExpected<T, E>::TryGetValue() const noexcept
+	{
+		return this->bHasValue ? &this->Value() : nullptr;
+	}
+
+
+	template <typename T, typename E>
+	const T& TExpected<T, E>::GetValueOr(const T& OtherVariant) const noexcept
+	{
+		return this->bHasValue ? this->Value() : OtherVariant;
+	}
+
+
+	template <typename T, typename E>
+	const E& TExpected<T, E>::GetError() const
+	{
+		if (this->bHasValue)
+		{
+			COMMON_THROW(CDoesNotExist("Expected contains value"));
+		}
+		return this->Error();
+	}
+
+
+	template <typename T, typename E>
+	const E* TExpected<T, E>::TryGetError() const noexcept
+	{
+		return this->bHasValue ? nullptr : &this->Error();
+	}
+
+
+
+	template <typename T, typename E>
+	template <typename FunctionType>
+	auto TExpected<T, E>::AndThen(FunctionType&& Function) const&
+	{
+		typedef decltype(Function(this->Value())) ResultType;
+		if (this->bHasValue)
+		{
+			return Function(this->Value());
+		}
+		return ResultType(MakeUnexpected(this->Error()));
+	}
+
+
+	template <typename T, typename E>
+	template <typename FunctionType>
+	auto TExpected<T, E>::AndThen(FunctionType&& Function) &&
+	{
+		typedef decltype(Function(Move(this->Value()))) ResultType;
+		if (this->bHasValue)
+		{
+			return Function(Move(this->Value()));
+		}
+		return ResultType(MakeUnexpected(Move(this->Error())));
+	}
+
+
+	template <typename T, typename E>
+	template <typename FunctionType>
+	auto TExpected<T, E>::Transform(FunctionType&& Function) const&
+	{
+		typedef TExpected<typename std::decay<
+			decltype(Function(this->Value()))>::type, E> ResultType;
+		if (this->bHasValue)
+		{
+			return ResultType(Function(this->Value()));
+		}
+		return ResultType(MakeUnexpected(this->Error()));
+	}
+
+
+	template <typename T, typename E>
+	template <typename FunctionType>
+	auto TExpected<T, E>::Transform(FunctionType&& Function) &&
+	{
+		typedef TExpected<typename std::decay<
+			decltype(Function(Move(this->Value())))>::type, E> ResultType;
+		if (this->bHasValue)
+		{
+			return ResultType(Function(Move(this->Value())));
+		}
+		return ResultType(MakeUnexpected(Move(this->Error())));
+	}
+
+
+	template <typename T, typename E>
+	template <typename FunctionType>
+	auto TExpected<T, E>::OrElse(FunctionType&& Function) const&
+	{
+		typedef decltype(Function(this->Error())) ResultType;
+		if (this->bHasValue)
+		{
+			return ResultType(this->Value());
+		}
+		return Function(this->Error());
+	}
+
+
+	template <typename T, typename E>
+	template <typename FunctionType>
+	auto TExpected<T, E>::OrElse(FunctionType&& Function) &&
+	{
+		typedef decltype(Function(Move(this->Error()))) ResultType;
+		if (this->bHasValue)
+		{
+			return ResultType(Move(this->Value()));
+		}
+		return Function(Move(this->Error()));
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	template<typename T>
+	TEytzingerIndex<T>::TEytzingerIndex(const TVector<T>& Sorted)
+	{
+		Rebuild(Sorted);
+	}
+
+
+
+	template<typename T>
+	void TEytzingerIndex<T>::Rebuild(const TVector<T>& Sorted)
+	{
+		if (Sorted.IsEmpty())
+		{
+			Layout.Clear(TVector<T>::EShrinkBehavior::Require);
+			return;
+		}
+
+		// placeholders are overwritten by in-order traversal below
+		TVector<T> NewLayout(Sorted.GetSize() + 1, Sorted[0],
+			TVector<T>::EReservedCapacityRule::NeverReserve);
+		Layout.Swap(NewLayout);
+		BuildSubtree(Sorted.RawData(), 0, 1);
+	}
+
+
+
+	template<typename T>
+	template<typename FunctionType>
+	const T* TEytzingerIndex<T>::LowerBound(const T& Value,
+		FunctionType Comparator) const
+	{
+		if (Layout.IsEmpty())
+		{
+			return nullptr;
+		}
+
+		const T* const Data = Layout.RawData();
+		const size_t Size = Layout.GetSize() - 1;
+		size_t Node = 1;
+		while (Node <= Size)
+		{
+			if (Node * PrefetchStride <= Size)
+			{
+				Prefetch(Data + Node * PrefetchStride);
+			}
+			Node = 2 * Node + (Comparator(Data[Node], Value) ? 1 : 0);
+		}
+
+		// Node went right on every "less" and left once on the answer;
+		// drop trailing right turns and that last left turn
+		Node >>= CountTrailingZeros(~static_cast<uint64_t>(Node)) + 1;
+		return Node ? Data + Node : nullptr;
+	}
+
+
+	template<typename T>
+	const T* TEytzingerIndex<T>::LowerBound(const T& Value) const
+	{
+		return LowerBound(Value,
+			[](const T& First, const T& Second)
+			{ return First < Second; });
+	}
+
+
+	template<typename T>
+	bool TEytzingerIndex<T>::Contains(const T& Value) const
+	{
+		const T* Found = LowerBound(Value);
+		return Found && !(Value < *Found);
+	}
+
+
+
+	template<typename T>
+	size_t TEytzingerIndex<T>::GetSize() const noexcept
+	{
+		return Layout.IsEmpty() ? 0 : Layout.GetSize() - 1;
+	}
+
+
+	template<typename T>
+	bool TEytzingerIndex<T>::IsEmpty() const noexcept
+	{
+		return Layout.IsEmpty();
+	}
+
+
+
+	template<typename T>
+	size_t TEytzingerIndex<T>::BuildSubtree(const T* const Sorted,
+		size_t SortedPosition, const size_t Node)
+	{
+		// recursion depth is log2(Size)
+		if (Node < Layout.GetSize())
+		{
+			SortedPosition = BuildSubtree(Sorted, SortedPosition, 2 * Node);
+			Layout[Node] = Sorted[SortedPosition++];
+			SortedPosition = BuildSubtree(Sorted, SortedPosition, 2 * Node + 1);
+		}
+		return SortedPosition;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,558 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	template <typename K, typename V>
+	V* TFlatMap<K, V>::Find(const K& Key)
+	{
+		const size_t Index = FindIndex(Key);
+		return Index != NotFound ? &Values[Index] : nullptr;
+	}
+
+
+	template <typename K, typename V>
+	bool TFlatMap<K, V>::Contains(const K& Key) const
+	{
+		return FindIndex(Key) != NotFound;
+	}
+
+
+	template <typename K, typename V>
+	size_t TFlatMap<K, V>::FindIndex(const K& Key) const
+	{
+		const size_t Index = LowerBound(Key);
+		return Index < Keys.GetSize() && !(Key < Keys[Index]) ?
+			Index : NotFound;
+	}
+
+
+	template <typename K, typename V>
+	size_t TFlatMap<K, V>::LowerBound(const K& Key) const
+	{
+		const K* const Data = Keys.RawData();
+		return BranchlessLowerBound(Data, Data + Keys.GetSize(), Key) - Data;
+	}
+
+
+	template <typename K, typename V>
+	size_t TFlatMap<K, V>::UpperBound(const K& Key) const
+	{
+		const K* const Data = Keys.RawData();
+		return BranchlessUpperBound(Data, Data + Keys.GetSize(), Key) - Data;
+	}
+
+
+
+	template <typename K, typename V>
+	bool TFlatMap<K, V>::Insert(const K& Key, const V& Value)
+	{
+		const size_t Index = LowerBound(Key);
+		if (Index < Keys.GetSize() && !(Key < Keys[Index]))
+		{
+			return false;
+		}
+		InsertAt(Index, Key, Value);
+		return true;
+	}
+
+
+	template <typename K, typename V>
+	template <typename IteratorType>
+	size_t TFlatMap<K, V>::Insert(const IteratorType Begin,
+		const IteratorType End)
+	{
+		TVector<CEntry> Batch(Begin, End);
+		const size_t BatchSize = Batch.GetSize();
+		if (!BatchSize)
+		{
+			return 0;
+		}
+
+		// sort the batch unless it is sorted already (usual for loading)
+		CEntry* const Entries = Batch.RawData();
+		const auto KeyLess = [](const CEntry& First, const CEntry& Second)
+		{
+			return First.First < Second.First;
+		};
+		size_t SortedCount = 1;
+		while (SortedCount < BatchSize &&
+			!KeyLess(Entries[SortedCount], Entries[SortedCount - 1]))
+		{
+			++SortedCount;
+		}
+		if (SortedCount < BatchSize)
+		{
+			// QuickSort is not stable: positions are sorted instead, with
+			// batch order between equal keys, so the first of them wins
+			TVector<size_t> Order;
+			Order.Reserve(BatchSize);
+			for (size_t i = 0; i < BatchSize; ++i)
+			{
+				Order.Push(i);
+			}
+			QuickSort(Order.RawData(), Order.RawData() + BatchSize,
+				[Entries](const size_t First, const size_t Second)
+				{
+					return Entries[First].First < Entries[Second].First ||
+						(!(Entries[Second].First < Entries[First].First) &&
+							First < Second);
+				});
+
+			// entry Order[i] goes to i, every cycle is walked by swaps
+			for (size_t i = 0; i < BatchSize; ++i)
+			{
+				size_t Current = i;
+				while (Order[Current] != i)
+				{
+					const size_t Next = Order[Current];
+					Common::Swap(Entries[Current], Entries[Next]);
+					Order[Current] = Current;
+					Current = Next;
+				}
+				Order[Current] = Current;
+			}
+		}
+
+		// keep only new keys (first of equal ones), in front of the batch
+		const size_t OldSize = Keys.GetSize();
+		const K* const OldKeys = Keys.RawData();
+		size_t Old = LowerBound(Entries[0].First);
+		size_t Added = 0;
+		for (size_t i = 0; i < BatchSize; ++i)
+		{
+			const K& Key = Entries[i].First;
+			if (Added && !(Entries[Added - 1].First < Key))
+			{
+				continue;
+			}
+			while (Old < OldSize && OldKeys[Old] < Key)
+			{
+				++Old;
+			}
+			if (Old < OldSize && !(Key < OldKeys[Old]))
+			{
+				continue;
+			}
+			if (Added != i)
+			{
+				Entries[Added] = Move(Entries[i]);
+			}
+			++Added;
+		}
+		if (!Added)
+		{
+			return 0;
+		}
+
+		// append new entries
+		Keys.Reserve(OldSize + Added);
+		Values.Reserve(OldSize + Added);
+		COMMON_TRY
+		{
+			for (size_t i = 0; i < Added; ++i)
+			{
+				Keys.Push(Entries[i].First);
+				Values.Push(Entries[i].Second);
+			}
+		}
+		COMMON_CATCH_ALL
+		{
+			Keys.PopMultiple(Keys.GetSize() - OldSize);
+			Values.PopMultiple(Values.GetSize() - OldSize);
+			COMMON_RETHROW;
+		}
+		if (!OldSize || Keys[OldSize - 1] < Entries[0].First)
+		{
+			return Added;
+		}
+
+		// merge from the back: appended copies are overwritten
+		K* const KeyData = Keys.RawData();
+		V* const ValueData = Values.RawData();
+		size_t Left = OldSize;
+		size_t Right = Added;
+		size_t Write = OldSize + Added;
+		while (Right)
+		{
+			--Write;
+			if (Left && Entries[Right - 1].First < KeyData[Left - 1])
+			{
+				--Left;
+				KeyData[Write] = Move(KeyData[Left]);
+				ValueData[Write] = Move(ValueData[Left]);
+			}
+			else
+			{
+				--Right;
+				KeyData[Write] = Move(Entries[Right].First);
+				ValueData[Write] = Move(Entries[Right].Second);
+			}
+		}
+		return Added;
+	}
+
+
+	template <typename K, typename V>
+	V& TFlatMap<K, V>::Upsert(const K& Key, const V& Value)
+	{
+		const size_t Index = LowerBound(Key);
+		if (Index < Keys.GetSize() && !(Key < Keys[Index]))
+		{
+			Values[Index] = Value;
+		}
+		else
+		{
+			InsertAt(Index, Key, Value);
+		}
+		return Values[Index];
+	}
+
+
+	template <typename K, typename V>
+	V& TFlatMap<K, V>::operator [] (const K& Key)
+	{
+		const size_t Index = LowerBound(Key);
+		if (Index == Keys.GetSize() || Key < Keys[Index])
+		{
+			InsertAt(Index, Key, V());
+		}
+		return Values[Index];
+	}
+
+
+	template <typename K, typename V>
+	bool TFlatMap<K, V>::Erase(const K& Key)
+	{
+		const size_t Index = FindIndex(Key);
+		if (Index == NotFound)
+		{
+			return false;
+		}
+		Keys.Erase(Index);
+		Values.Erase(Index);
+		return true;
+	}
+
+
+	template <typename K, typename V>
+	template <typename FunctionType>
+	void TFlatMap<K, V>::ForEach(FunctionType Function)
+	{
+		for (size_t i = 0; i < Keys.GetSize(); ++i)
+		{
+			Function(Keys[i], Values[i]);
+		}
+	}
+
+
+	template <typename K, typename V>
+	template <typename FunctionType>
+	void TFlatMap<K, V>::ForEach(FunctionType Function) const
+	{
+		for (size_t i = 0; i < Keys.GetSize(); ++i)
+		{
+			Function(Keys[i], Values[i]);
+		}
+	}
+
+
+
+	template <typename K, typename V>
+	TSpan<const K> TFlatMap<K, V>::GetKeys() const noexcept
+	{
+		return TSpan<const K>(Keys.RawData(), Keys.GetSize());
+	}
+
+
+	template <typename K, typename V>
+	TSpan<V> TFlatMap<K, V>::GetValues() noexcept
+	{
+		return TSpan<V>(Values.RawData(), Values.GetSize());
+	}
+
+
+	template <typename K, typename V>
+	TSpan<const V> TFlatMap<K, V>::GetValues() const noexcept
+	{
+		return TSpan<const V>(Values.RawData(), Values.GetSize());
+	}
+
+
+
+	template <typename K, typename V>
+	void TFlatMap<K, V>::Reserve(const size_t Count)
+	{
+		Keys.Reserve(Count);
+		Values.Reserve(Count);
+	}
+
+
+	template <typename K, typename V>
+	void TFlatMap<K, V>::ShrinkToFit()
+	{
+		Keys.ShrinkToFit();
+		Values.ShrinkToFit();
+	}
+
+
+	template <typename K, typename V>
+	void TFlatMap<K, V>::Clear()
+	{
+		Keys.Clear();
+		Values.Clear();
+	}
+
+
+	template <typename K, typename V>
+	void TFlatMap<K, V>::Swap(TFlatMap& Other) noexcept
+	{
+		Keys.Swap(Other.Keys);
+		Values.Swap(Other.Values);
+	}
+
+
+
+	template <typename K, typename V>
+	size_t TFlatMap<K, V>::GetSize() const noexcept
+	{
+		return Keys.GetSize();
+	}
+
+
+	template <typename K, typename V>
+	size_t TFlatMap<K, V>::GetCapacity() const noexcept
+	{
+		return Keys.GetCapacity();
+	}
+
+
+	template <typename K, typename V>
+	bool TFlatMap<K, V>::IsEmpty() const noexcept
+	{
+		return Keys.IsEmpty();
+	}
+
+
+
+	template <typename K, typename V>
+	void TFlatMap<K, V>::InsertAt(const size_t Index, const K& Key,
+		const V& Value)
+	{
+		Keys.Insert(Index, Key);
+		COMMON_TRY
+		{
+			Values.Insert(Index, Value);
+		}
+		COMMON_CATCH_ALL
+		{
+			Keys.Erase(Index);
+			COMMON_RETHROW;
+		}
+	}
+
+
+
+	template <typename K>
+	bool TFlatSet<K>::Contains(const K& Key) const
+	{
+		return FindIndex(Key) != NotFound;
+	}
+
+
+	template <typename K>
+	size_t TFlatSet<K>::FindIndex(const K& Key) const
+	{
+		const size_t Index = LowerBound(Key);
+		return Index < Keys.GetSize() && !(Key < Keys[Index]) ?
+			Index : NotFound;
+	}
+
+
+	template <typename K>
+	size_t TFlatSet<K>::LowerBound(const K& Key) const
+	{
+		const K* const Data = Keys.RawData();
+		return BranchlessLowerBound(Data, Data + Keys.GetSize(), Key) - Data;
+	}
+
+
+	template <typename K>
+	size_t TFlatSet<K>::UpperBound(const K& Key) const
+	{
+		const K* const Data = Keys.RawData();
+		return BranchlessUpperBound(Data, Data + Keys.GetSize(), Key) - Data;
+	}
+
+
+
+	template <typename K>
+	bool TFlatSet<K>::Insert(const K& Key)
+	{
+		const size_t Index = LowerBound(Key);
+		if (Index < Keys.GetSize() && !(Key < Keys[Index]))
+		{
+			return false;
+		}
+		Keys.Insert(Index, Key);
+		return true;
+	}
+
+
+	template <typename K>
+	template <typename IteratorType>
+	size_t TFlatSet<K>::Insert(const IteratorType Begin,
+		const IteratorType End)
+	{
+		TVector<K> Batch(Begin, End);
+		const size_t BatchSize = Batch.GetSize();
+		if (!BatchSize)
+		{
+			return 0;
+		}
+
+		// sort the batch unless it is sorted already (usual for loading)
+		K* const New = Batch.RawData();
+		size_t SortedCount = 1;
+		while (SortedCount < BatchSize &&
+			!(New[SortedCount] < New[SortedCount - 1]))
+		{
+			++SortedCount;
+		}
+		if (SortedCount < BatchSize)
+		{
+			QuickSort(New, New + BatchSize,
+				[](const K& First, const K& Second)
+				{ return First < Second; });
+		}
+
+		// keep only new keys, in front of the batch
+		const size_t OldSize = Keys.GetSize();
+		const K* const OldKeys = Keys.RawData();
+		size_t Old = LowerBound(New[0]);
+		size_t Added = 0;
+		for (size_t i = 0; i < BatchSize; ++i)
+		{
+			if (Added && !(New[Added - 1] < New[i]))
+			{
+				continue;
+			}
+			while (Old < OldSize && OldKeys[Old] < New[i])
+			{
+				++Old;
+			}
+			if (Old < OldSize && !(New[i] < OldKeys[Old]))
+			{
+				continue;
+			}
+			if (Added != i)
+			{
+				New[Added] = Move(New[i]);
+			}
+			++Added;
+		}
+		if (!Added)
+		{
+			return 0;
+		}
+
+		// append new keys
+		Keys.Push(New, New + Added);
+		if (!OldSize || Keys[OldSize - 1] < New[0])
+		{
+			return Added;
+		}
+
+		// merge from the back: appended copies are overwritten
+		K* const Data = Keys.RawData();
+		size_t Left = OldSize;
+		size_t Right = Added;
+		size_t Write = OldSize + Added;
+		while (Right)
+		{
+			--Write;
+			if (Left && New[Right - 1] < Data[Left - 1])
+			{
+				Data[Write] = Move(Data[--Left]);
+			}
+			else
+			{
+				Data[Write] = Move(New[--Right]);
+			}
+		}
+		return Added;
+	}
+
+
+	template <typename K>
+	bool TFlatSet<K>::Erase(const K& Key)
+	{
+		const size_t Index = FindIndex(Key);
+		if (Index == NotFound)
+		{
+			return false;
+		}
+		Keys.Erase(Index);
+		return true;
+	}
+
+
+
+	template <typename K>
+	TSpan<const K> TFlatSet<K>::GetKeys() const noexcept
+	{
+		return TSpan<const K>(Keys.RawData(), Keys.GetSize());
+	}
+
+
+
+	template <typename K>
+	void TFlatSet<K>::Reserve(const size_t Count)
+	{
+		Keys.Reserve(Count);
+	}
+
+
+	template <typename K>
+	void TFlatSet<K>::ShrinkToFit()
+	{
+		Keys.ShrinkToFit();
+	}
+
+
+	template <typename K>
+	void TFlatSet<K>::Clear()
+	{
+		Keys.Clear();
+	}
+
+
+	template <typename K>
+	void TFlatSet<K>::Swap(TFlatSet& Other) noexcept
+	{
+		Keys.Swap(Other.Keys);
+	}
+
+
+
+	template <typename K>
+	size_t TFlatSet<K>::GetSize() const noexcept
+	{
+		return Keys.GetSize();
+	}
+
+
+	template <typename K>
+	size_t TFlatSet<K>::GetCapacity() const noexcept
+	{
+		return Keys.GetCapacity();
+	}
+
+
+	template <typename K>
+	bool TFlatSet<K>::IsEmpty() const noexcept
+	{
+		return Keys.IsEmpty();
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,418 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#include <cstring>	// memset
+
+namespace Common
+{
+
+	template <typename K, typename V, typename HashType>
+	THashMap<K, V, HashType>::THashMap(const HashType& Hash)
+		: Hasher(Hash) {}
+
+
+	template <typename K, typename V, typename HashType>
+	THashMap<K, V, HashType>::THashMap(const THashMap& Other)
+		: Hasher(Other.Hasher)
+	{
+		if (Other.Size == 0)
+		{
+			return;
+		}
+		Rehash(Other.Capacity);
+		COMMON_TRY
+		{
+			Other.ForEach([this](const K& Key, const V& Value)
+				{
+					Insert(Key, Value);
+				});
+		}
+		COMMON_CATCH_ALL
+		{
+			// destructor is not called for partially constructed map
+			FreeTable();
+			COMMON_RETHROW;
+		}
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	THashMap<K, V, HashType>::THashMap(THashMap&& Other) noexcept
+		: Hasher(Other.Hasher)
+	{
+		Swap(Other);
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	THashMap<K, V, HashType>::~THashMap()
+	{
+		FreeTable();
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	THashMap<K, V, HashType>& THashMap<K, V, HashType>::operator = (
+		const THashMap& Other)
+	{
+		if (this != &Other)
+		{
+			THashMap Copy(Other);
+			Swap(Copy);
+		}
+		return *this;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	THashMap<K, V, HashType>& THashMap<K, V, HashType>::operator = (
+		THashMap&& Other) noexcept
+	{
+		Swap(Other);
+		return *this;
+	}
+
+
+
+	template <typename K, typename V, typename HashType>
+	V* THashMap<K, V, HashType>::Find(const K& Key)
+	{
+		if (Size == 0)
+		{
+			return nullptr;
+		}
+		bool bFound;
+		const size_t Slot = FindSlot(Key, HashOf(Key), bFound);
+		return bFound ? &Entries[Slot].Second : nullptr;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	bool THashMap<K, V, HashType>::Contains(const K& Key) const
+	{
+		return Find(Key) != nullptr;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	bool THashMap<K, V, HashType>::Insert(const K& Key, const V& Value)
+	{
+		const size_t Hash = HashOf(Key);
+		bool bFound;
+		const size_t Slot = PrepareInsert(Key, Hash, bFound);
+		if (bFound)
+		{
+			return false;
+		}
+		Construct(Slot, Entries, CEntry(Key, Value));
+		States[Slot] = TagOf(Hash);
+		++Size;
+		return true;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	V& THashMap<K, V, HashType>::Upsert(const K& Key, const V& Value)
+	{
+		const size_t Hash = HashOf(Key);
+		bool bFound;
+		const size_t Slot = PrepareInsert(Key, Hash, bFound);
+		if (bFound)
+		{
+			Entries[Slot].Second = Value;
+		}
+		else
+		{
+			Construct(Slot, Entries, CEntry(Key, Value));
+			States[Slot] = TagOf(Hash);
+			++Size;
+		}
+		return Entries[Slot].Second;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	V& THashMap<K, V, HashType>::operator [] (const K& Key)
+	{
+		const size_t Hash = HashOf(Key);
+		bool bFound;
+		const size_t Slot = PrepareInsert(Key, Hash, bFound);
+		if (!bFound)
+		{
+			Construct(Slot, Entries, CEntry(Key, V()));
+			States[Slot] = TagOf(Hash);
+			++Size;
+		}
+		return Entries[Slot].Second;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	bool THashMap<K, V, HashType>::Erase(const K& Key)
+	{
+		if (Size == 0)
+		{
+			return false;
+		}
+		bool bFound;
+		const size_t Slot = FindSlot(Key, HashOf(Key), bFound);
+		if (!bFound)
+		{
+			return false;
+		}
+		EraseSlot(Slot);
+		return true;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	template <typename FunctionType>
+	size_t THashMap<K, V, HashType>::EraseIf(FunctionType Predicate)
+	{
+		// backward shift moves unvisited entries only to the current
+		// slot or after it, so the slot is checked again after erasure;
+		// entries that wrap over the end may be visited twice
+		size_t Removed = 0;
+		size_t Slot = 0;
+		while (Slot < Capacity)
+		{
+			if (States[Slot] != EmptySlot &&
+				Predicate(static_cast<const K&>(Entries[Slot].First),
+					Entries[Slot].Second))
+			{
+				EraseSlot(Slot);
+				++Removed;
+			}
+			else
+			{
+				++Slot;
+			}
+		}
+		return Removed;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	template <typename FunctionType>
+	void THashMap<K, V, HashType>::ForEach(FunctionType Function)
+	{
+		for (size_t Slot = 0; Slot < Capacity; ++Slot)
+		{
+			if (States[Slot] != EmptySlot)
+			{
+				Function(static_cast<const K&>(Entries[Slot].First),
+					Entries[Slot].Second);
+			}
+		}
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	template <typename FunctionType>
+	void THashMap<K, V, HashType>::ForEach(FunctionType Function) const
+	{
+		for (size_t Slot = 0; Slot < Capacity; ++Slot)
+		{
+			if (States[Slot] != EmptySlot)
+			{
+				Function(static_cast<const K&>(Entries[Slot].First),
+					static_cast<const V&>(Entries[Slot].Second));
+			}
+		}
+	}
+
+
+
+	template <typename K, typename V, typename HashType>
+	void THashMap<K, V, HashType>::Reserve(const size_t Count)
+	{
+		size_t NewCapacity = Capacity ? Capacity : MinCapacity;
+		while (NewCapacity / 4 * 3 < Count)
+		{
+			NewCapacity *= 2;
+		}
+		if (NewCapacity > Capacity)
+		{
+			Rehash(NewCapacity);
+		}
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	void THashMap<K, V, HashType>::Clear() noexcept
+	{
+		FreeTable();
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	void THashMap<K, V, HashType>::Swap(THashMap& Other) noexcept
+	{
+		Common::Swap(Entries, Other.Entries);
+		Common::Swap(States, Other.States);
+		Common::Swap(Capacity, Other.Capacity);
+		Common::Swap(Size, Other.Size);
+		Common::Swap(Hasher, Other.Hasher);
+	}
+
+
+
+	template <typename K, typename V, typename HashType>
+	size_t THashMap<K, V, HashType>::GetSize() const noexcept
+	{
+		return Size;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	size_t THashMap<K, V, HashType>::GetCapacity() const noexcept
+	{
+		return Capacity;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	bool THashMap<K, V, HashType>::IsEmpty() const noexcept
+	{
+		return Size == 0;
+	}
+
+
+
+	template <typename K, typename V, typename HashType>
+	size_t THashMap<K, V, HashType>::HashOf(const K& Key) const
+	{
+		return Hasher(Key);
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	uint8_t THashMap<K, V, HashType>::TagOf(const size_t Hash) noexcept
+	{
+		// high bits: low ones already chose the slot
+		return static_cast<uint8_t>((Hash >> (sizeof(size_t) * 8 - 7)) | 0x80);
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	size_t THashMap<K, V, HashType>::FindSlot(const K& Key,
+		const size_t Hash, bool& bOutFound) const
+	{
+		const size_t Mask = Capacity - 1;
+		const uint8_t Tag = TagOf(Hash);
+		size_t Slot = Hash & Mask;
+		while (States[Slot] != EmptySlot)	// table is never full
+		{
+			if (States[Slot] == Tag && Entries[Slot].First == Key)
+			{
+				bOutFound = true;
+				return Slot;
+			}
+			Slot = (Slot + 1) & Mask;
+		}
+		bOutFound = false;
+		return Slot;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	size_t THashMap<K, V, HashType>::PrepareInsert(const K& Key,
+		const size_t Hash, bool& bOutFound)
+	{
+		if (Capacity == 0)
+		{
+			Rehash(MinCapacity);
+		}
+		size_t Slot = FindSlot(Key, Hash, bOutFound);
+		if (!bOutFound && (Size + 1) > Capacity / 4 * 3)
+		{
+			Rehash(Capacity * 2);
+			Slot = FindSlot(Key, Hash, bOutFound);
+		}
+		return Slot;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	void THashMap<K, V, HashType>::EraseSlot(size_t Slot)
+	{
+		// backward shift: entries after the hole that may be placed into
+		// it are moved, so that every probe sequence stays contiguous
+		const size_t Mask = Capacity - 1;
+		Destruct(Slot, Entries);
+		States[Slot] = EmptySlot;
+		--Size;
+
+		size_t Next = (Slot + 1) & Mask;
+		while (States[Next] != EmptySlot)
+		{
+			const size_t Desired = HashOf(Entries[Next].First) & Mask;
+			// move if the hole lies on the way from Desired to Next
+			if (((Next - Desired) & Mask) >= ((Next - Slot) & Mask))
+			{
+				Construct(Slot, Entries, Move(Entries[Next]));
+				States[Slot] = States[Next];
+				Destruct(Next, Entries);
+				States[Next] = EmptySlot;
+				Slot = Next;
+			}
+			Next = (Next + 1) & Mask;
+		}
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	void THashMap<K, V, HashType>::Rehash(const size_t NewCapacity)
+	{
+		CEntry* NewEntries;
+		uint8_t* NewStates;
+		Allocate(NewCapacity, NewEntries);
+		if (!TryAllocate(NewCapacity, NewStates))
+		{
+			Common::Deallocate(NewEntries);
+			COMMON_THROW(CBadAlloc("Hash map: Failed to allocate",
+				NewCapacity));
+		}
+		memset(NewStates, EmptySlot, NewCapacity);
+
+		const size_t NewMask = NewCapacity - 1;
+		for (size_t Slot = 0; Slot < Capacity; ++Slot)
+		{
+			if (States[Slot] == EmptySlot)
+			{
+				continue;
+			}
+			size_t NewSlot = HashOf(Entries[Slot].First) & NewMask;
+			while (NewStates[NewSlot] != EmptySlot)
+			{
+				NewSlot = (NewSlot + 1) & NewMask;
+			}
+			Construct(NewSlot, NewEntries, Move(Entries[Slot]));
+			NewStates[NewSlot] = States[Slot];
+			Destruct(Slot, Entries);
+		}
+
+		Common::Deallocate(Entries);
+		Common::Deallocate(States);
+		Entries = NewEntries;
+		States = NewStates;
+		Capacity = NewCapacity;
+	}
+
+
+	template <typename K, typename V, typename HashType>
+	void THashMap<K, V, HashType>::FreeTable() noexcept
+	{
+		for (size_t Slot = 0; Slot < Capacity; ++Slot)
+		{
+			if (States[Slot] != EmptySlot)
+			{
+				Destruct(Slot, Entries);
+			}
+		}
+		Common::Deallocate(Entries);
+		Common::Deallocate(States);
+		Capacity = 0;
+		Size = 0;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,313 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	TIntrusiveList<T, HookMember>::TIntrusiveList() noexcept
+	{
+		Root.Next = &Root;
+		Root.Previous = &Root;
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	TIntrusiveList<T, HookMember>::TIntrusiveList(
+		TIntrusiveList&& Other) noexcept
+	{
+		Root.Next = &Root;
+		Root.Previous = &Root;
+		TakeRing(Other);
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	TIntrusiveList<T, HookMember>& TIntrusiveList<T, HookMember>::operator = (
+		TIntrusiveList&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			Clear();
+			TakeRing(Other);
+		}
+		return *this;
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	TIntrusiveList<T, HookMember>::~TIntrusiveList()
+	{
+		Clear();
+		Root.Next = nullptr;	// so that the hook destructor does nothing
+	}
+
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	void TIntrusiveList<T, HookMember>::Push(T& Element) noexcept
+	{
+		ASSERT(!(Element.*HookMember).IsLinked(),
+			"Intrusive list: element is already linked");
+		(Element.*HookMember).LinkBefore(&Root);
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	void TIntrusiveList<T, HookMember>::Unshift(T& Element) noexcept
+	{
+		ASSERT(!(Element.*HookMember).IsLinked(),
+			"Intrusive list: element is already linked");
+		(Element.*HookMember).LinkBefore(Root.Next);
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	void TIntrusiveList<T, HookMember>::Insert(CIterator Position,
+		T& Element) noexcept
+	{
+		ASSERT(!(Element.*HookMember).IsLinked(),
+			"Intrusive list: element is already linked");
+		(Element.*HookMember).LinkBefore(Position.HookPointer);
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	void TIntrusiveList<T, HookMember>::Pop() noexcept
+	{
+		ASSERT(!IsEmpty(), "Pop() operation on empty intrusive list");
+		Root.Previous->Unlink();
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	void TIntrusiveList<T, HookMember>::Shift() noexcept
+	{
+		ASSERT(!IsEmpty(), "Shift() operation on empty intrusive list");
+		Root.Next->Unlink();
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	void TIntrusiveList<T, HookMember>::Erase(T& Element) noexcept
+	{
+		(Element.*HookMember).Unlink();
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	void TIntrusiveList<T, HookMember>::MoveToBack(T& Element) noexcept
+	{
+		CIntrusiveListHook& Hook = Element.*HookMember;
+		if (Root.Previous != &Hook)
+		{
+			Hook.Unlink();
+			Hook.LinkBefore(&Root);
+		}
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	void TIntrusiveList<T, HookMember>::Clear() noexcept
+	{
+		CIntrusiveListHook* Current = Root.Next;
+		while (Current != &Root)
+		{
+			CIntrusiveListHook* Next = Current->Next;
+			Current->Next = nullptr;
+			Current->Previous = nullptr;
+			Current = Next;
+		}
+		Root.Next = &Root;
+		Root.Previous = &Root;
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	void TIntrusiveList<T, HookMember>::Swap(TIntrusiveList& Other) noexcept
+	{
+		TIntrusiveList Temp(Move(Other));
+		Other.TakeRing(*this);
+		TakeRing(Temp);
+	}
+
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	size_t TIntrusiveList<T, HookMember>::GetSize() const noexcept
+	{
+		size_t Size = 0;
+		for (const CIntrusiveListHook* Current = Root.Next; Current != &Root;
+			Current = Current->Next)
+		{
+			++Size;
+		}
+		return Size;
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	bool TIntrusiveList<T, HookMember>::IsEmpty() const noexcept
+	{
+		return Root.Next == &Root;
+	}
+
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	T& TIntrusiveList<T, HookMember>::Front() noexcept
+	{
+		ASSERT(!IsEmpty(), "Front() on empty intrusive list");
+		return ElementOf(*Root.Next);
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	T* TIntrusiveList<T, HookMember>::TryFront() noexcept
+	{
+		return IsEmpty() ? nullptr : &ElementOf(*Root.Next);
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	T& TIntrusiveList<T, HookMember>::Back() noexcept
+	{
+		ASSERT(!IsEmpty(), "Back() on empty intrusive list");
+		return ElementOf(*Root.Previous);
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	T* TIntrusiveList<T, HookMember>::TryBack() noexcept
+	{
+		return IsEmpty() ? nullptr : &ElementOf(*Root.Previous);
+	}
+
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	size_t TIntrusiveList<T, HookMember>::HookOffset() noexcept
+	{
+		// Storage of T without constructing T, only the address of the
+		// member is taken. Compiler folds it to a constant.
+		union CProbe
+		{
+			CProbe() {}
+			~CProbe() {}
+			char Byte;
+			T Object;
+		};
+		CProbe Probe;
+		return static_cast<size_t>(
+			reinterpret_cast<const char*>(&(Probe.Object.*HookMember)) -
+			reinterpret_cast<const char*>(&Probe.Object));
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	T& TIntrusiveList<T, HookMember>::ElementOf(
+		CIntrusiveListHook& Hook) noexcept
+	{
+		return *reinterpret_cast<T*>(
+			reinterpret_cast<char*>(&Hook) - HookOffset());
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	const T& TIntrusiveList<T, HookMember>::ElementOf(
+		const CIntrusiveListHook& Hook) noexcept
+	{
+		return *reinterpret_cast<const T*>(
+			reinterpret_cast<const char*>(&Hook) - HookOffset());
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	typename TIntrusiveList<T, HookMember>::CIterator
+		TIntrusiveList<T, HookMember>::IteratorOf(T& Element) noexcept
+	{
+		return CIterator(&(Element.*HookMember));
+	}
+
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	typename TIntrusiveList<T, HookMember>::CIterator
+		TIntrusiveList<T, HookMember>::Begin() noexcept
+	{
+		return CIterator(Root.Next);
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	typename TIntrusiveList<T, HookMember>::CIterator
+		TIntrusiveList<T, HookMember>::End() noexcept
+	{
+		return CIterator(&Root);
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	typename TIntrusiveList<T, HookMember>::CConstIterator
+		TIntrusiveList<T, HookMember>::ConstBegin() const noexcept
+	{
+		return CConstIterator(Root.Next);
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	typename TIntrusiveList<T, HookMember>::CConstIterator
+		TIntrusiveList<T, HookMember>::ConstEnd() const noexcept
+	{
+		return CConstIterator(&Root);
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	typename TIntrusiveList<T, HookMember>::CReverseIterator
+		TIntrusiveList<T, HookMember>::ReverseBegin() noexcept
+	{
+		return CReverseIterator(Root.Previous);
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	typename TIntrusiveList<T, HookMember>::CReverseIterator
+		TIntrusiveList<T, HookMember>::ReverseEnd() noexcept
+	{
+		return CReverseIterator(&Root);
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	typename TIntrusiveList<T, HookMember>::CConstReverseIterator
+		TIntrusiveList<T, HookMember>::ConstReverseBegin() const noexcept
+	{
+		return CConstReverseIterator(Root.Previous);
+	}
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	typename TIntrusiveList<T, HookMember>::CConstReverseIterator
+		TIntrusiveList<T, HookMember>::ConstReverseEnd() const noexcept
+	{
+		return CConstReverseIterator(&Root);
+	}
+
+
+
+	template <typename T, CIntrusiveListHook T::* HookMember>
+	void TIntrusiveList<T, HookMember>::TakeRing(TIntrusiveList& Other) noexcept
+	{
+		if (Other.IsEmpty())
+		{
+			return;
+		}
+		Root.Next = Other.Root.Next;
+		Root.Previous = Other.Root.Previous;
+		Root.Next->Previous = &Root;
+		Root.Previous->Next = &Root;
+		Other.Root.Next = &Other.Root;
+		Other.Root.Previous = &Other.Root;
+	}
+
+}
\ No newline at end of file
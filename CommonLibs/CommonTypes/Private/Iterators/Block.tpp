@@ -15,10 +15,16 @@ namespace Common
 		TBlockIterator<PtrType, RefType>::TBlockIterator(PtrType InitialPosition)
 			: InternalPointer(InitialPosition) {}
 
+		template <typename PtrType, typename RefType>
+		TBlockIterator<PtrType, RefType>::TBlockIterator(PtrType InitialPosition,
+			const CGenerationCheck& Check)
+			: CGenerationCheck(Check), InternalPointer(InitialPosition) {}
+
 		template <typename PtrType, typename RefType>
 		const TBlockIterator<PtrType, RefType>& TBlockIterator<PtrType, RefType>
 			::operator ++ ()
 		{
+			VerifyGeneration();
 			++InternalPointer;
 			return *this;
 		}
@@ -27,13 +33,16 @@ namespace Common
 		TBlockIterator<PtrType, RefType> TBlockIterator<PtrType, RefType>
 			::operator + (size_t Offset)
 		{
-			return TBlockIterator(InternalPointer + Offset);
+			TBlockIterator NewIterator = *this;
+			NewIterator += Offset;
+			return NewIterator;
 		}
 
 		template <typename PtrType, typename RefType>
 		const TBlockIterator<PtrType, RefType>& TBlockIterator<PtrType, RefType>
 			::operator += (size_t Offset)
 		{
+			VerifyGeneration();
 			InternalPointer += Offset;
 			return *this;
 		}
@@ -42,6 +51,7 @@ namespace Common
 		const TBlockIterator<PtrType, RefType>& TBlockIterator<PtrType, RefType>
 			::operator -- ()
 		{
+			VerifyGeneration();
 			--InternalPointer;
 			return *this;
 		}
@@ -50,17 +60,27 @@ namespace Common
 		TBlockIterator<PtrType, RefType> TBlockIterator<PtrType, RefType>
 			::operator - (size_t Offset)
 		{
-			return TBlockIterator(InternalPointer - Offset);
+			TBlockIterator NewIterator = *this;
+			NewIterator -= Offset;
+			return NewIterator;
 		}
 
 		template <typename PtrType, typename RefType>
 		const TBlockIterator<PtrType, RefType>& TBlockIterator<PtrType, RefType>
 			::operator -= (size_t Offset)
 		{
+			VerifyGeneration();
 			InternalPointer -= Offset;
 			return *this;
 		}
 
+		template <typename PtrType, typename RefType>
+		size_t TBlockIterator<PtrType, RefType>
+			::operator - (const TBlockIterator& Other) const
+		{
+			return static_cast<size_t>(InternalPointer - Other.InternalPointer);
+		}
+
 		template <typename PtrType, typename RefType>
 		bool TBlockIterator<PtrType, RefType>
 			::operator == (const TBlockIterator& Other)
@@ -78,6 +98,7 @@ namespace Common
 		template <typename PtrType, typename RefType>
 		RefType TBlockIterator<PtrType, RefType>::operator * ()
 		{
+			VerifyGeneration();
 			return *InternalPointer;
 		}
 
@@ -93,10 +114,17 @@ namespace Common
 			::TReverseBlockIterator(PtrType InitialPosition)
 			: InternalPointer(InitialPosition - 1) {};
 
+		template <typename PtrType, typename RefType>
+		TReverseBlockIterator<PtrType, RefType>
+			::TReverseBlockIterator(PtrType InitialPosition,
+			const CGenerationCheck& Check)
+			: CGenerationCheck(Check), InternalPointer(InitialPosition - 1) {};
+
 		template <typename PtrType, typename RefType>
 		const TReverseBlockIterator<PtrType, RefType>&
 			TReverseBlockIterator<PtrType, RefType>::operator ++ ()
 		{
+			VerifyGeneration();
 			--InternalPointer;
 			return *this;
 		}
@@ -105,13 +133,16 @@ namespace Common
 		TReverseBlockIterator<PtrType, RefType>
 			TReverseBlockIterator<PtrType, RefType>::operator + (size_t Offset)
 		{
-			return TReverseBlockIterator(InternalPointer - Offset);
+			TReverseBlockIterator NewIterator = *this;
+			NewIterator += Offset;
+			return NewIterator;
 		}
 
 		template <typename PtrType, typename RefType>
 		const TReverseBlockIterator<PtrType, RefType>&
 			TReverseBlockIterator<PtrType, RefType>::operator += (size_t Offset)
 		{
+			VerifyGeneration();
 			InternalPointer -= Offset;
 			return *this;
 		}
@@ -120,6 +151,7 @@ namespace Common
 		const TReverseBlockIterator<PtrType, RefType>&
 			TReverseBlockIterator<PtrType, RefType>::operator -- ()
 		{
+			VerifyGeneration();
 			++InternalPointer;
 			return *this;
 		}
@@ -128,17 +160,27 @@ namespace Common
 		TReverseBlockIterator<PtrType, RefType>
 			TReverseBlockIterator<PtrType, RefType>::operator - (size_t Offset)
 		{
-			return TReverseBlockIterator(InternalPointer + Offset);
+			TReverseBlockIterator NewIterator = *this;
+			NewIterator -= Offset;
+			return NewIterator;
 		}
 
 		template <typename PtrType, typename RefType>
 		const TReverseBlockIterator<PtrType, RefType>&
 			TReverseBlockIterator<PtrType, RefType>::operator -= (size_t Offset)
 		{
+			VerifyGeneration();
 			InternalPointer += Offset;
 			return *this;
 		}
 
+		template <typename PtrType, typename RefType>
+		size_t TReverseBlockIterator<PtrType, RefType>
+			::operator - (const TReverseBlockIterator& Other) const
+		{
+			return static_cast<size_t>(Other.InternalPointer - InternalPointer);
+		}
+
 		template <typename PtrType, typename RefType>
 		bool TReverseBlockIterator<PtrType, RefType>
 			::operator == (const TReverseBlockIterator& Other)
@@ -156,240 +198,285 @@ namespace Common
 		template <typename PtrType, typename RefType>
 		RefType TReverseBlockIterator<PtrType, RefType>::operator * ()
 		{
+			VerifyGeneration();
 			return *InternalPointer;
 		}
 
 
 		// ================ TSafeBlockIterator ================= //
 
-		template <typename PtrType, typename RefType, typename ContType>
-		TSafeBlockIterator<PtrType, RefType, ContType>::
-			TSafeBlockIterator(PtrType InitialPosition, const ContType Owner)
-			: InternalPointer(InitialPosition), Owner(Owner) {};
-			
-		template <typename PtrType, typename RefType, typename ContType>
-		const TSafeBlockIterator<PtrType, RefType, ContType>&
-			TSafeBlockIterator<PtrType, RefType, ContType>::operator ++ ()
+		template <typename PtrType, typename RefType>
+		TSafeBlockIterator<PtrType, RefType>::TSafeBlockIterator(
+			PtrType InitialPosition, PtrType Begin, PtrType End,
+			const CGenerationCheck& Check)
+			: CGenerationCheck(Check), InternalPointer(InitialPosition),
+			Begin(Begin), End(End) {};
+
+		template <typename PtrType, typename RefType>
+		const TSafeBlockIterator<PtrType, RefType>&
+			TSafeBlockIterator<PtrType, RefType>::operator ++ ()
 		{
-			if (InternalPointer == Owner->Buffer + Owner->Size)
+			VerifyGeneration();
+			if (InternalPointer == End)
 			{
-				throw COutOfRange("Out of range: BlockIterator ++",
-					static_cast<int>(InternalPointer - Owner->Buffer),
-					TPair<size_t, size_t>(0, Owner->Size));
+				COMMON_THROW(COutOfRange("Out of range: BlockIterator ++",
+					static_cast<int>(InternalPointer - Begin),
+					TPair<size_t, size_t>(0, End - Begin)));
 			}
 			++InternalPointer;
 			return *this;
 		}
 
-		template <typename PtrType, typename RefType, typename ContType>
-		TSafeBlockIterator<PtrType, RefType, ContType>
-			TSafeBlockIterator<PtrType, RefType, ContType>::operator + (size_t Offset)
+		template <typename PtrType, typename RefType>
+		TSafeBlockIterator<PtrType, RefType>
+			TSafeBlockIterator<PtrType, RefType>::operator + (size_t Offset)
 		{
-			if (InternalPointer + Offset > Owner->Buffer + Owner->Size)
+			VerifyGeneration();
+			if (Offset > static_cast<size_t>(End - InternalPointer))
 			{
-				throw COutOfRange("Out of range: BlockIterator +",
-					static_cast<int>(InternalPointer - 1 - Owner->Buffer)
+				COMMON_THROW(COutOfRange("Out of range: BlockIterator +",
+					static_cast<int>(InternalPointer - 1 - Begin)
 					+ static_cast<int>(Offset),
-					TPair<size_t, size_t>(0, Owner->Size));
+					TPair<size_t, size_t>(0, End - Begin)));
 			}
-			return TSafeBlockIterator(InternalPointer + Offset, Owner);
+			TSafeBlockIterator NewIterator = *this;
+			NewIterator.InternalPointer += Offset;
+			return NewIterator;
 		}
 
-		template <typename PtrType, typename RefType, typename ContType>
-		const TSafeBlockIterator<PtrType, RefType, ContType>&
-			TSafeBlockIterator<PtrType, RefType, ContType>::operator += (size_t Offset)
+		template <typename PtrType, typename RefType>
+		const TSafeBlockIterator<PtrType, RefType>&
+			TSafeBlockIterator<PtrType, RefType>::operator += (size_t Offset)
 		{
-			if (InternalPointer + Offset > Owner->Buffer + Owner->Size)
+			VerifyGeneration();
+			if (Offset > static_cast<size_t>(End - InternalPointer))
 			{
-				throw COutOfRange("Out of range: BlockIterator +=",
-					static_cast<int>(InternalPointer - 1 - Owner->Buffer)
+				COMMON_THROW(COutOfRange("Out of range: BlockIterator +=",
+					static_cast<int>(InternalPointer - 1 - Begin)
 					+ static_cast<int>(Offset),
-					TPair<size_t, size_t>(0, Owner->Size));
+					TPair<size_t, size_t>(0, End - Begin)));
 			}
 			InternalPointer += Offset;
 			return *this;
 		}
 
-		template <typename PtrType, typename RefType, typename ContType>
-		const TSafeBlockIterator<PtrType, RefType, ContType>&
-			TSafeBlockIterator<PtrType, RefType, ContType>::operator -- ()
+		template <typename PtrType, typename RefType>
+		const TSafeBlockIterator<PtrType, RefType>&
+			TSafeBlockIterator<PtrType, RefType>::operator -- ()
 		{
-			if (InternalPointer == Owner->Buffer)
+			VerifyGeneration();
+			if (InternalPointer == Begin)
 			{
-				throw COutOfRange("Out of range: BlockIterator --",
-					static_cast<int>(InternalPointer - 1 - Owner->Buffer),
-					TPair<size_t, size_t>(0, Owner->Size));
+				COMMON_THROW(COutOfRange("Out of range: BlockIterator --",
+					static_cast<int>(InternalPointer - 1 - Begin),
+					TPair<size_t, size_t>(0, End - Begin)));
 			}
 			--InternalPointer;
 			return *this;
 		}
 
-		template <typename PtrType, typename RefType, typename ContType>
-		TSafeBlockIterator<PtrType, RefType, ContType>
-			TSafeBlockIterator<PtrType, RefType, ContType>::operator - (size_t Offset)
+		template <typename PtrType, typename RefType>
+		TSafeBlockIterator<PtrType, RefType>
+			TSafeBlockIterator<PtrType, RefType>::operator - (size_t Offset)
 		{
-			if (InternalPointer - Offset < Owner->Buffer)
+			VerifyGeneration();
+			if (Offset > static_cast<size_t>(InternalPointer - Begin))
 			{
-				throw COutOfRange("Out of range: BlockIterator -",
-					static_cast<int>(InternalPointer - Owner->Buffer)
+				COMMON_THROW(COutOfRange("Out of range: BlockIterator -",
+					static_cast<int>(InternalPointer - Begin)
 					- static_cast<int>(Offset),
-					TPair<size_t, size_t>(0, Owner->Size));
+					TPair<size_t, size_t>(0, End - Begin)));
 			}
-			return TSafeBlockIterator(InternalPointer - Offset, Owner);
+			TSafeBlockIterator NewIterator = *this;
+			NewIterator.InternalPointer -= Offset;
+			return NewIterator;
 		}
 
-		template <typename PtrType, typename RefType, typename ContType>
-		const TSafeBlockIterator<PtrType, RefType, ContType>&
-			TSafeBlockIterator<PtrType, RefType, ContType>::operator -= (size_t Offset)
+		template <typename PtrType, typename RefType>
+		const TSafeBlockIterator<PtrType, RefType>&
+			TSafeBlockIterator<PtrType, RefType>::operator -= (size_t Offset)
 		{
-			if (InternalPointer - Offset < Owner->Buffer)
+			VerifyGeneration();
+			if (Offset > static_cast<size_t>(InternalPointer - Begin))
 			{
-				throw COutOfRange("Out of range: BlockIterator -=",
-					static_cast<int>(InternalPointer - Owner->Buffer)
+				COMMON_THROW(COutOfRange("Out of range: BlockIterator -=",
+					static_cast<int>(InternalPointer - Begin)
 					- static_cast<int>(Offset),
-					TPair<size_t, size_t>(0, Owner->Size));
+					TPair<size_t, size_t>(0, End - Begin)));
 			}
 			InternalPointer -= Offset;
 			return *this;
 		}
 
-		template <typename PtrType, typename RefType, typename ContType>
-		bool TSafeBlockIterator<PtrType, RefType, ContType>
+		template <typename PtrType, typename RefType>
+		size_t TSafeBlockIterator<PtrType, RefType>
+			::operator - (const TSafeBlockIterator& Other) const
+		{
+			return static_cast<size_t>(InternalPointer - Other.InternalPointer);
+		}
+
+		template <typename PtrType, typename RefType>
+		bool TSafeBlockIterator<PtrType, RefType>
 			::operator == (const TSafeBlockIterator& Other)
 		{
 			return InternalPointer == Other.InternalPointer;
 		}
 
-		template <typename PtrType, typename RefType, typename ContType>
-		bool TSafeBlockIterator<PtrType, RefType, ContType>
+		template <typename PtrType, typename RefType>
+		bool TSafeBlockIterator<PtrType, RefType>
 			::operator != (const TSafeBlockIterator& Other)
 		{
 			return InternalPointer != Other.InternalPointer;
 		}
 
-		template <typename PtrType, typename RefType, typename ContType>
-		RefType TSafeBlockIterator<PtrType, RefType, ContType>::operator * ()
+		template <typename PtrType, typename RefType>
+		RefType TSafeBlockIterator<PtrType, RefType>::operator * ()
 		{
+			VerifyGeneration();
+			if (InternalPointer == End)
+			{
+				COMMON_THROW(COutOfRange("Out of range: BlockIterator *",
+					static_cast<int>(End - Begin), TPair<size_t, size_t>(0, End - Begin)));
+			}
 			return *InternalPointer;
 		}
 
 
 		// ================ TSafeReverseBlockIterator ================= //
 
-		template <typename PtrType, typename RefType, class ContType>
-		TSafeReverseBlockIterator<PtrType, RefType, ContType>
-			::TSafeReverseBlockIterator(PtrType InitialPosition, const ContType Owner)
-			: InternalPointer(InitialPosition - 1), Owner(Owner) {};
+		template <typename PtrType, typename RefType>
+		TSafeReverseBlockIterator<PtrType, RefType>::TSafeReverseBlockIterator(
+			PtrType InitialPosition, PtrType Begin, PtrType End,
+			const CGenerationCheck& Check)
+			: CGenerationCheck(Check), InternalPointer(InitialPosition - 1),
+			Begin(Begin), End(End) {};
 
-		template <typename PtrType, typename RefType, class ContType>
-		const TSafeReverseBlockIterator<PtrType, RefType, ContType>&
-			TSafeReverseBlockIterator<PtrType, RefType, ContType>
-			::operator ++ ()
+		template <typename PtrType, typename RefType>
+		const TSafeReverseBlockIterator<PtrType, RefType>&
+			TSafeReverseBlockIterator<PtrType, RefType>::operator ++ ()
 		{
-			if (InternalPointer + 1 == Owner->Buffer)
+			VerifyGeneration();
+			if (InternalPointer + 1 == Begin)
 			{
-				throw COutOfRange("Out of range: rev. BlockIterator ++",
-					static_cast<int>(InternalPointer - Owner->Buffer),
-					TPair<size_t, size_t>(0, Owner->Size));
+				COMMON_THROW(COutOfRange("Out of range: rev. BlockIterator ++",
+					static_cast<int>(InternalPointer - Begin),
+					TPair<size_t, size_t>(0, End - Begin)));
 			}
 			--InternalPointer;
 			return *this;
 		}
 
-		template <typename PtrType, typename RefType, class ContType>
-		TSafeReverseBlockIterator<PtrType, RefType, ContType>
-			TSafeReverseBlockIterator<PtrType, RefType, ContType>
-			::operator + (size_t Offset)
+		template <typename PtrType, typename RefType>
+		TSafeReverseBlockIterator<PtrType, RefType>
+			TSafeReverseBlockIterator<PtrType, RefType>::operator + (size_t Offset)
 		{
-			if (InternalPointer + 1 - Offset < Owner->Buffer)
+			VerifyGeneration();
+			if (Offset > static_cast<size_t>(InternalPointer + 1 - Begin))
 			{
-				throw COutOfRange("Out of range: rev. BlockIterator +",
-					static_cast<int>(InternalPointer + 1 - Owner->Buffer)
+				COMMON_THROW(COutOfRange("Out of range: rev. BlockIterator +",
+					static_cast<int>(InternalPointer + 1 - Begin)
 					- static_cast<int>(Offset),
-					TPair<size_t, size_t>(0, Owner->Size));
+					TPair<size_t, size_t>(0, End - Begin)));
 			}
-			return TSafeReverseBlockIterator(InternalPointer - Offset, Owner);
+			TSafeReverseBlockIterator NewIterator = *this;
+			NewIterator.InternalPointer -= Offset;
+			return NewIterator;
 		}
 
-		template <typename PtrType, typename RefType, class ContType>
-		const TSafeReverseBlockIterator<PtrType, RefType, ContType>&
-			TSafeReverseBlockIterator<PtrType, RefType, ContType>
-			::operator += (size_t Offset)
+		template <typename PtrType, typename RefType>
+		const TSafeReverseBlockIterator<PtrType, RefType>&
+			TSafeReverseBlockIterator<PtrType, RefType>::operator += (size_t Offset)
 		{
-			if (InternalPointer + 1 - Offset < Owner->Buffer)
+			VerifyGeneration();
+			if (Offset > static_cast<size_t>(InternalPointer + 1 - Begin))
 			{
-				throw COutOfRange("Out of range: rev. BlockIterator +=",
-					static_cast<int>(InternalPointer + 1 - Owner->Buffer)
+				COMMON_THROW(COutOfRange("Out of range: rev. BlockIterator +=",
+					static_cast<int>(InternalPointer + 1 - Begin)
 					- static_cast<int>(Offset),
-					TPair<size_t, size_t>(0, Owner->Size));
+					TPair<size_t, size_t>(0, End - Begin)));
 			}
 			InternalPointer -= Offset;
 			return *this;
 		}
 
-		template <typename PtrType, typename RefType, class ContType>
-		const TSafeReverseBlockIterator<PtrType, RefType, ContType>&
-			TSafeReverseBlockIterator<PtrType, RefType, ContType>
-			::operator -- ()
+		template <typename PtrType, typename RefType>
+		const TSafeReverseBlockIterator<PtrType, RefType>&
+			TSafeReverseBlockIterator<PtrType, RefType>::operator -- ()
 		{
-			if (InternalPointer + 1 == Owner->Buffer + Owner->Size)
+			VerifyGeneration();
+			if (InternalPointer + 1 == End)
 			{
-				throw COutOfRange("Out of range: rev. BlockIterator --",
-					static_cast<int>(InternalPointer + 1 - Owner->Buffer),
-					TPair<size_t, size_t>(0, Owner->Size));
+				COMMON_THROW(COutOfRange("Out of range: rev. BlockIterator --",
+					static_cast<int>(InternalPointer + 1 - Begin),
+					TPair<size_t, size_t>(0, End - Begin)));
 			}
 			++InternalPointer;
 			return *this;
 		}
 
-		template <typename PtrType, typename RefType, class ContType>
-		TSafeReverseBlockIterator<PtrType, RefType, ContType>
-			TSafeReverseBlockIterator<PtrType, RefType, ContType>
-			::operator - (size_t Offset)
+		template <typename PtrType, typename RefType>
+		TSafeReverseBlockIterator<PtrType, RefType>
+			TSafeReverseBlockIterator<PtrType, RefType>::operator - (size_t Offset)
 		{
-			if (InternalPointer + 1 + Offset > Owner->Buffer + Owner->Size)
+			VerifyGeneration();
+			if (Offset > static_cast<size_t>(End - (InternalPointer + 1)))
 			{
-				throw COutOfRange("Out of range: rev. BlockIterator -",
-					static_cast<int>(InternalPointer - Owner->Buffer)
+				COMMON_THROW(COutOfRange("Out of range: rev. BlockIterator -",
+					static_cast<int>(InternalPointer - Begin)
 					+ static_cast<int>(Offset),
-					TPair<size_t, size_t>(0, Owner->Size));
+					TPair<size_t, size_t>(0, End - Begin)));
 			}
-			return TSafeReverseBlockIterator(InternalPointer + Offset, Owner);
+			TSafeReverseBlockIterator NewIterator = *this;
+			NewIterator.InternalPointer += Offset;
+			return NewIterator;
 		}
 
-		template <typename PtrType, typename RefType, class ContType>
-		const TSafeReverseBlockIterator<PtrType, RefType, ContType>&
-			TSafeReverseBlockIterator<PtrType, RefType, ContType>
-			::operator -= (size_t Offset)
+		template <typename PtrType, typename RefType>
+		const TSafeReverseBlockIterator<PtrType, RefType>&
+			TSafeReverseBlockIterator<PtrType, RefType>::operator -= (size_t Offset)
 		{
-			if (InternalPointer + 1 + Offset > Owner->Buffer + Owner->Size)
+			VerifyGeneration();
+			if (Offset > static_cast<size_t>(End - (InternalPointer + 1)))
 			{
-				throw COutOfRange("Out of range: rev. BlockIterator -=",
-					static_cast<int>(InternalPointer - Owner->Buffer)
+				COMMON_THROW(COutOfRange("Out of range: rev. BlockIterator -=",
+					static_cast<int>(InternalPointer - Begin)
 					+ static_cast<int>(Offset),
-					TPair<size_t, size_t>(0, Owner->Size));
+					TPair<size_t, size_t>(0, End - Begin)));
 			}
 			InternalPointer += Offset;
 			return *this;
 		}
 
-		template <typename PtrType, typename RefType, class ContType>
-		bool TSafeReverseBlockIterator<PtrType, RefType, ContType>
+		template <typename PtrType, typename RefType>
+		size_t TSafeReverseBlockIterator<PtrType, RefType>
+			::operator - (const TSafeReverseBlockIterator& Other) const
+		{
+			return static_cast<size_t>(Other.InternalPointer - InternalPointer);
+		}
+
+		template <typename PtrType, typename RefType>
+		bool TSafeReverseBlockIterator<PtrType, RefType>
 			::operator == (const TSafeReverseBlockIterator& Other)
 		{
 			return InternalPointer == Other.InternalPointer;
 		}
 
-		template <typename PtrType, typename RefType, class ContType>
-		bool TSafeReverseBlockIterator<PtrType, RefType, ContType>
+		template <typename PtrType, typename RefType>
+		bool TSafeReverseBlockIterator<PtrType, RefType>
 			::operator != (const TSafeReverseBlockIterator& Other)
 		{
 			return InternalPointer != Other.InternalPointer;
 		}
 
-		template <typename PtrType, typename RefType, class ContType>
-		RefType TSafeReverseBlockIterator<PtrType, RefType, ContType>::operator * ()
+		template <typename PtrType, typename RefType>
+		RefType TSafeReverseBlockIterator<PtrType, RefType>::operator * ()
 		{
+			VerifyGeneration();
+			if (InternalPointer + 1 == Begin)
+			{
+				COMMON_THROW(COutOfRange("Out of range: rev. BlockIterator *",
+					-1, TPair<size_t, size_t>(0, End - Begin)));
+			}
 			return *InternalPointer;
 		}
 
@@ -15,10 +15,16 @@ namespace Common
 		TDoublyLinkedIterator<NdPtrType, ValRefType>::TDoublyLinkedIterator(NdPtrType InitialPosition)
 			: NodePointer(InitialPosition) {}
 
+		template <class NdPtrType, typename ValRefType>
+		TDoublyLinkedIterator<NdPtrType, ValRefType>::TDoublyLinkedIterator(
+			NdPtrType InitialPosition, const CGenerationCheck& Check)
+			: CGenerationCheck(Check), NodePointer(InitialPosition) {}
+
 		template <class NdPtrType, typename ValRefType>
 		const TDoublyLinkedIterator<NdPtrType, ValRefType>& TDoublyLinkedIterator<NdPtrType, ValRefType>
 			::operator ++ ()
 		{
+			VerifyGeneration();
 			NodePointer = NodePointer->Next;
 			return *this;
 		}
@@ -36,6 +42,7 @@ namespace Common
 		const TDoublyLinkedIterator<NdPtrType, ValRefType>& TDoublyLinkedIterator<NdPtrType, ValRefType>
 			::operator += (size_t Offset)
 		{
+			VerifyGeneration();
 			for (size_t i = 0; i < Offset; ++i)
 			{
 				NodePointer = NodePointer->Next;
@@ -47,6 +54,7 @@ namespace Common
 		const TDoublyLinkedIterator<NdPtrType, ValRefType>& TDoublyLinkedIterator<NdPtrType, ValRefType>
 			::operator -- ()
 		{
+			VerifyGeneration();
 			NodePointer = NodePointer->Previous;
 			return *this;
 		}
@@ -64,6 +72,7 @@ namespace Common
 		const TDoublyLinkedIterator<NdPtrType, ValRefType>& TDoublyLinkedIterator<NdPtrType, ValRefType>
 			::operator -= (size_t Offset)
 		{
+			VerifyGeneration();
 			for (size_t i = 0; i < Offset; ++i)
 			{
 				NodePointer = NodePointer->Previous;
@@ -88,6 +97,7 @@ namespace Common
 		template <class NdPtrType, typename ValRefType>
 		ValRefType TDoublyLinkedIterator<NdPtrType, ValRefType>::operator * ()
 		{
+			VerifyGeneration();
 			return NodePointer->Buffer;
 		}
 
@@ -102,10 +112,16 @@ namespace Common
 		TReverseDoublyLinkedIterator<NdPtrType, ValRefType>::TReverseDoublyLinkedIterator
 			(NdPtrType InitialPosition): NodePointer(InitialPosition) {}
 
+		template <class NdPtrType, typename ValRefType>
+		TReverseDoublyLinkedIterator<NdPtrType, ValRefType>::TReverseDoublyLinkedIterator(
+			NdPtrType InitialPosition, const CGenerationCheck& Check)
+			: CGenerationCheck(Check), NodePointer(InitialPosition) {}
+
 		template <class NdPtrType, typename ValRefType>
 		const TReverseDoublyLinkedIterator<NdPtrType, ValRefType>&
 			TReverseDoublyLinkedIterator<NdPtrType, ValRefType>::operator ++ ()
 		{
+			VerifyGeneration();
 			NodePointer = NodePointer->Previous;
 			return *this;
 		}
@@ -123,6 +139,7 @@ namespace Common
 		const TReverseDoublyLinkedIterator<NdPtrType, ValRefType>& TReverseDoublyLinkedIterator<NdPtrType, ValRefType>
 			::operator += (size_t Offset)
 		{
+			VerifyGeneration();
 			for (size_t i = 0; i < Offset; ++i)
 			{
 				NodePointer = NodePointer->Previous;
@@ -134,6 +151,7 @@ namespace Common
 		const TReverseDoublyLinkedIterator<NdPtrType, ValRefType>& TReverseDoublyLinkedIterator<NdPtrType, ValRefType>
 			::operator -- ()
 		{
+			VerifyGeneration();
 			NodePointer = NodePointer->Next;
 			return *this;
 		}
@@ -151,6 +169,7 @@ namespace Common
 		const TReverseDoublyLinkedIterator<NdPtrType, ValRefType>& TReverseDoublyLinkedIterator<NdPtrType, ValRefType>
 			::operator -= (size_t Offset)
 		{
+			VerifyGeneration();
 			for (size_t i = 0; i < Offset; ++i)
 			{
 				NodePointer = NodePointer->Next;
@@ -175,6 +194,7 @@ namespace Common
 		template <class NdPtrType, typename ValRefType>
 		ValRefType TReverseDoublyLinkedIterator<NdPtrType, ValRefType>::operator * ()
 		{
+			VerifyGeneration();
 			return NodePointer->Buffer;
 		}
 
@@ -190,13 +210,19 @@ namespace Common
 		TSafeDoublyLinkedIterator<NdPtrType, ValRefType>::TSafeDoublyLinkedIterator(NdPtrType InitialPosition)
 			: NodePointer(InitialPosition) {}
 
+		template <class NdPtrType, typename ValRefType>
+		TSafeDoublyLinkedIterator<NdPtrType, ValRefType>::TSafeDoublyLinkedIterator(
+			NdPtrType InitialPosition, const CGenerationCheck& Check)
+			: CGenerationCheck(Check), NodePointer(InitialPosition) {}
+
 		template <class NdPtrType, typename ValRefType>
 		const TSafeDoublyLinkedIterator<NdPtrType, ValRefType>& TSafeDoublyLinkedIterator<NdPtrType, ValRefType>
 			::operator ++ ()
 		{
-			if (NodePointer->Next == nullptr)
+			VerifyGeneration();
+			if (NodePointer == nullptr)
 			{
-				throw COutOfRange("Out of range : DoublyLinkedIterator ++");
+				COMMON_THROW(COutOfRange("Out of range : DoublyLinkedIterator ++"));
 			}
 			NodePointer = NodePointer->Next;
 			return *this;
@@ -215,11 +241,13 @@ namespace Common
 		const TSafeDoublyLinkedIterator<NdPtrType, ValRefType>& TSafeDoublyLinkedIterator<NdPtrType, ValRefType>
 			::operator += (size_t Offset)
 		{
+			VerifyGeneration();
 			for (size_t i = 0; i < Offset; ++i)
 			{
-				if (NodePointer->Next == nullptr)
+				if (NodePointer == nullptr)
 				{
-					throw COutOfRange("Out of range : DoublyLinkedIterator +=");
+					COMMON_THROW(COutOfRange(
+						"Out of range : DoublyLinkedIterator +="));
 				}
 				NodePointer = NodePointer->Next;
 			}
@@ -230,9 +258,10 @@ namespace Common
 		const TSafeDoublyLinkedIterator<NdPtrType, ValRefType>& TSafeDoublyLinkedIterator<NdPtrType, ValRefType>
 			::operator -- ()
 		{
-			if (NodePointer->Previous == nullptr)
+			VerifyGeneration();
+			if (NodePointer == nullptr || NodePointer->Previous == nullptr)
 			{
-				throw COutOfRange("Out of range : DoublyLinkedIterator --");
+				COMMON_THROW(COutOfRange("Out of range : DoublyLinkedIterator --"));
 			}
 			NodePointer = NodePointer->Previous;
 			return *this;
@@ -251,11 +280,13 @@ namespace Common
 		const TSafeDoublyLinkedIterator<NdPtrType, ValRefType>& TSafeDoublyLinkedIterator<NdPtrType, ValRefType>
 			::operator -= (size_t Offset)
 		{
+			VerifyGeneration();
 			for (size_t i = 0; i < Offset; ++i)
 			{
-				if (NodePointer->Previous == nullptr)
+				if (NodePointer == nullptr || NodePointer->Previous == nullptr)
 				{
-					throw COutOfRange("Out of range : DoublyLinkedIterator -=");
+					COMMON_THROW(COutOfRange(
+						"Out of range : DoublyLinkedIterator -="));
 				}
 				NodePointer = NodePointer->Previous;
 			}
@@ -279,6 +310,11 @@ namespace Common
 		template <class NdPtrType, typename ValRefType>
 		ValRefType TSafeDoublyLinkedIterator<NdPtrType, ValRefType>::operator * ()
 		{
+			VerifyGeneration();
+			if (NodePointer == nullptr)
+			{
+				COMMON_THROW(COutOfRange("Out of range : DoublyLinkedIterator *"));
+			}
 			return NodePointer->Buffer;
 		}
 
@@ -293,13 +329,20 @@ namespace Common
 		TSafeReverseDoublyLinkedIterator<NdPtrType, ValRefType>::TSafeReverseDoublyLinkedIterator
 		(NdPtrType InitialPosition) : NodePointer(InitialPosition) {}
 
+		template <class NdPtrType, typename ValRefType>
+		TSafeReverseDoublyLinkedIterator<NdPtrType, ValRefType>::TSafeReverseDoublyLinkedIterator(
+			NdPtrType InitialPosition, const CGenerationCheck& Check)
+			: CGenerationCheck(Check), NodePointer(InitialPosition) {}
+
 		template <class NdPtrType, typename ValRefType>
 		const TSafeReverseDoublyLinkedIterator<NdPtrType, ValRefType>&
 			TSafeReverseDoublyLinkedIterator<NdPtrType, ValRefType>::operator ++ ()
 		{
-			if (NodePointer->Previous == nullptr)
+			VerifyGeneration();
+			if (NodePointer == nullptr)
 			{
-				throw COutOfRange("Out of range : rev. DoublyLinkedIterator ++");
+				COMMON_THROW(COutOfRange(
+					"Out of range : rev. DoublyLinkedIterator ++"));
 			}
 			NodePointer = NodePointer->Previous;
 			return *this;
@@ -319,11 +362,13 @@ namespace Common
 			TSafeReverseDoublyLinkedIterator<NdPtrType, ValRefType>
 			::operator += (size_t Offset)
 		{
+			VerifyGeneration();
 			for (size_t i = 0; i < Offset; ++i)
 			{
-				if (NodePointer->Previous == nullptr)
+				if (NodePointer == nullptr)
 				{
-					throw COutOfRange("Out of range : rev. DoublyLinkedIterator +=");
+					COMMON_THROW(COutOfRange(
+						"Out of range : rev. DoublyLinkedIterator +="));
 				}
 				NodePointer = NodePointer->Previous;
 			}
@@ -335,9 +380,11 @@ namespace Common
 			TSafeReverseDoublyLinkedIterator<NdPtrType, ValRefType>
 			::operator -- ()
 		{
-			if (NodePointer->Next == nullptr)
+			VerifyGeneration();
+			if (NodePointer == nullptr || NodePointer->Next == nullptr)
 			{
-				throw COutOfRange("Out of range : rev. DoublyLinkedIterator --");
+				COMMON_THROW(COutOfRange(
+					"Out of range : rev. DoublyLinkedIterator --"));
 			}
 			NodePointer = NodePointer->Next;
 			return *this;
@@ -356,11 +403,13 @@ namespace Common
 		const TSafeReverseDoublyLinkedIterator<NdPtrType, ValRefType>& TSafeReverseDoublyLinkedIterator<NdPtrType, ValRefType>
 			::operator -= (size_t Offset)
 		{
+			VerifyGeneration();
 			for (size_t i = 0; i < Offset; ++i)
 			{
-				if (NodePointer->Next == nullptr)
+				if (NodePointer == nullptr || NodePointer->Next == nullptr)
 				{
-					throw COutOfRange("Out of range : rev. DoublyLinkedIterator -=");
+					COMMON_THROW(COutOfRange(
+						"Out of range : rev. DoublyLinkedIterator -="));
 				}
 				NodePointer = NodePointer->Next;
 			}
@@ -384,6 +433,12 @@ namespace Common
 		template <class NdPtrType, typename ValRefType>
 		ValRefType TSafeReverseDoublyLinkedIterator<NdPtrType, ValRefType>::operator * ()
 		{
+			VerifyGeneration();
+			if (NodePointer == nullptr)
+			{
+				COMMON_THROW(COutOfRange(
+					"Out of range : rev. DoublyLinkedIterator *"));
+			}
 			return NodePointer->Buffer;
 		}
 
@@ -0,0 +1,196 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	namespace Iterators {
+
+		// ================ TIntrusiveIterator =================
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		TIntrusiveIterator<HookPtrType, ValRefType, ListType>::TIntrusiveIterator()
+			: HookPointer(nullptr) {}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		TIntrusiveIterator<HookPtrType, ValRefType, ListType>::TIntrusiveIterator(
+			HookPtrType InitialPosition) : HookPointer(InitialPosition) {}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		const TIntrusiveIterator<HookPtrType, ValRefType, ListType>&
+			TIntrusiveIterator<HookPtrType, ValRefType, ListType>::operator ++ ()
+		{
+			HookPointer = HookPointer->Next;
+			return *this;
+		}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		TIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			TIntrusiveIterator<HookPtrType, ValRefType, ListType>::operator + (
+			size_t Offset)
+		{
+			TIntrusiveIterator NewIterator = *this;
+			NewIterator += Offset;
+			return NewIterator;
+		}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		const TIntrusiveIterator<HookPtrType, ValRefType, ListType>&
+			TIntrusiveIterator<HookPtrType, ValRefType, ListType>::operator += (
+			size_t Offset)
+		{
+			for (size_t i = 0; i < Offset; ++i)
+			{
+				HookPointer = HookPointer->Next;
+			}
+			return *this;
+		}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		const TIntrusiveIterator<HookPtrType, ValRefType, ListType>&
+			TIntrusiveIterator<HookPtrType, ValRefType, ListType>::operator -- ()
+		{
+			HookPointer = HookPointer->Previous;
+			return *this;
+		}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		TIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			TIntrusiveIterator<HookPtrType, ValRefType, ListType>::operator - (
+			size_t Offset)
+		{
+			TIntrusiveIterator NewIterator = *this;
+			NewIterator -= Offset;
+			return NewIterator;
+		}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		const TIntrusiveIterator<HookPtrType, ValRefType, ListType>&
+			TIntrusiveIterator<HookPtrType, ValRefType, ListType>::operator -= (
+			size_t Offset)
+		{
+			for (size_t i = 0; i < Offset; ++i)
+			{
+				HookPointer = HookPointer->Previous;
+			}
+			return *this;
+		}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		bool TIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			::operator == (const TIntrusiveIterator& Other) const
+		{
+			return HookPointer == Other.HookPointer;
+		}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		bool TIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			::operator != (const TIntrusiveIterator& Other) const
+		{
+			return !operator==(Other);
+		}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		ValRefType TIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			::operator * () const
+		{
+			return ListType::ElementOf(*HookPointer);
+		}
+
+
+		// ================ TReverseIntrusiveIterator =================
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		TReverseIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			::TReverseIntrusiveIterator() : HookPointer(nullptr) {}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		TReverseIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			::TReverseIntrusiveIterator(HookPtrType InitialPosition)
+			: HookPointer(InitialPosition) {}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		const TReverseIntrusiveIterator<HookPtrType, ValRefType, ListType>&
+			TReverseIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			::operator ++ ()
+		{
+			HookPointer = HookPointer->Previous;
+			return *this;
+		}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		TReverseIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			TReverseIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			::operator + (size_t Offset)
+		{
+			TReverseIntrusiveIterator NewIterator = *this;
+			NewIterator += Offset;
+			return NewIterator;
+		}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		const TReverseIntrusiveIterator<HookPtrType, ValRefType, ListType>&
+			TReverseIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			::operator += (size_t Offset)
+		{
+			for (size_t i = 0; i < Offset; ++i)
+			{
+				HookPointer = HookPointer->Previous;
+			}
+			return *this;
+		}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		const TReverseIntrusiveIterator<HookPtrType, ValRefType, ListType>&
+			TReverseIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			::operator -- ()
+		{
+			HookPointer = HookPointer->Next;
+			return *this;
+		}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		TReverseIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			TReverseIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			::operator - (size_t Offset)
+		{
+			TReverseIntrusiveIterator NewIterator = *this;
+			NewIterator -= Offset;
+			return NewIterator;
+		}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		const TReverseIntrusiveIterator<HookPtrType, ValRefType, ListType>&
+			TReverseIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			::operator -= (size_t Offset)
+		{
+			for (size_t i = 0; i < Offset; ++i)
+			{
+				HookPointer = HookPointer->Next;
+			}
+			return *this;
+		}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		bool TReverseIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			::operator == (const TReverseIntrusiveIterator& Other) const
+		{
+			return HookPointer == Other.HookPointer;
+		}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		bool TReverseIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			::operator != (const TReverseIntrusiveIterator& Other) const
+		{
+			return !operator==(Other);
+		}
+
+		template <typename HookPtrType, typename ValRefType, typename ListType>
+		ValRefType TReverseIntrusiveIterator<HookPtrType, ValRefType, ListType>
+			::operator * () const
+		{
+			return ListType::ElementOf(*HookPointer);
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	namespace Iterators {
+
+		template <typename OwnerPointer, typename RefType>
+		TRowIterator<OwnerPointer, RefType>::TRowIterator()
+			: Owner(nullptr), Row(0) {}
+
+		template <typename OwnerPointer, typename RefType>
+		TRowIterator<OwnerPointer, RefType>::TRowIterator(
+			const OwnerPointer Owner, const size_t Row)
+			: Owner(Owner), Row(Row) {}
+
+		template <typename OwnerPointer, typename RefType>
+		const TRowIterator<OwnerPointer, RefType>&
+			TRowIterator<OwnerPointer, RefType>::operator ++ ()
+		{
+			++Row;
+			return *this;
+		}
+
+		template <typename OwnerPointer, typename RefType>
+		TRowIterator<OwnerPointer, RefType>
+			TRowIterator<OwnerPointer, RefType>::operator + (
+			const size_t Offset) const
+		{
+			return TRowIterator(Owner, Row + Offset);
+		}
+
+		template <typename OwnerPointer, typename RefType>
+		const TRowIterator<OwnerPointer, RefType>&
+			TRowIterator<OwnerPointer, RefType>::operator += (
+			const size_t Offset)
+		{
+			Row += Offset;
+			return *this;
+		}
+
+		template <typename OwnerPointer, typename RefType>
+		const TRowIterator<OwnerPointer, RefType>&
+			TRowIterator<OwnerPointer, RefType>::operator -- ()
+		{
+			--Row;
+			return *this;
+		}
+
+		template <typename OwnerPointer, typename RefType>
+		TRowIterator<OwnerPointer, RefType>
+			TRowIterator<OwnerPointer, RefType>::operator - (
+			const size_t Offset) const
+		{
+			return TRowIterator(Owner, Row - Offset);
+		}
+
+		template <typename OwnerPointer, typename RefType>
+		const TRowIterator<OwnerPointer, RefType>&
+			TRowIterator<OwnerPointer, RefType>::operator -= (
+			const size_t Offset)
+		{
+			Row -= Offset;
+			return *this;
+		}
+
+		template <typename OwnerPointer, typename RefType>
+		size_t TRowIterator<OwnerPointer, RefType>::operator - (
+			const TRowIterator& Other) const
+		{
+			return Row - Other.Row;
+		}
+
+		template <typename OwnerPointer, typename RefType>
+		bool TRowIterator<OwnerPointer, RefType>::operator == (
+			const TRowIterator& Other) const
+		{
+			return Row == Other.Row && Owner == Other.Owner;
+		}
+
+		template <typename OwnerPointer, typename RefType>
+		bool TRowIterator<OwnerPointer, RefType>::operator != (
+			const TRowIterator& Other) const
+		{
+			return !(*this == Other);
+		}
+
+		template <typename OwnerPointer, typename RefType>
+		RefType TRowIterator<OwnerPointer, RefType>::operator * () const
+		{
+			return RefType(Owner, Row);
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -8,106 +8,106 @@ namespace Common
 	template<typename T>
 	typename TList<T>::CIterator TList<T>::Begin()
 	{
-		return CIterator(Head);
+		return CIterator(Head, GetGenerationCheck());
 	}
 
 
 	template<typename T>
 	typename TList<T>::CConstIterator TList<T>::ConstBegin() const
 	{
-		return CConstIterator(Head);
+		return CConstIterator(Head, GetGenerationCheck());
 	}
 
 	template<typename T>
 	typename TList<T>::CReverseIterator TList<T>::ReverseBegin()
 	{
-		return CReverseIterator(Tail);
+		return CReverseIterator(Tail, GetGenerationCheck());
 	}
 
 	template<typename T>
 	typename TList<T>::CConstReverseIterator
 		TList<T>::ConstReverseBegin() const
 	{
-		return CConstReverseIterator(Tail);
+		return CConstReverseIterator(Tail, GetGenerationCheck());
 	}
 
 	template<typename T>
 	typename TList<T>::CSafeIterator TList<T>::SafeBegin()
 	{
-		return CSafeIterator(Head);
+		return CSafeIterator(Head, GetGenerationCheck());
 	}
 
 	template<typename T>
 	typename TList<T>::CSafeConstIterator
 		TList<T>::SafeConstBegin() const
 	{
-		return CSafeConstIterator(Head);
+		return CSafeConstIterator(Head, GetGenerationCheck());
 	}
 
 	template<typename T>
 	typename TList<T>::CSafeReverseIterator
 		TList<T>::SafeReverseBegin()
 	{
-		return CSafeReverseIterator(Tail);
+		return CSafeReverseIterator(Tail, GetGenerationCheck());
 	}
 
 	template<typename T>
 	typename TList<T>::CSafeConstReverseIterator
 		TList<T>::SafeConstReverseBegin() const
 	{
-		return CSafeConstReverseIterator(Tail);
+		return CSafeConstReverseIterator(Tail, GetGenerationCheck());
 	}
 
 	template<typename T>
 	typename TList<T>::CIterator TList<T>::End()
 	{
-		return CIterator(Tail);
+		return CIterator(nullptr, GetGenerationCheck());
 	}
 
 	template<typename T>
 	typename TList<T>::CConstIterator TList<T>::ConstEnd() const
 	{
-		return CConstIterator(Tail);
+		return CConstIterator(nullptr, GetGenerationCheck());
 	}
 
 	template<typename T>
 	typename TList<T>::CReverseIterator TList<T>::ReverseEnd()
 	{
-		return CReverseIterator(Head);
+		return CReverseIterator(nullptr, GetGenerationCheck());
 	}
 
 	template<typename T>
 	typename TList<T>::CConstReverseIterator
 		TList<T>::ConstReverseEnd() const
 	{
-		return CConstReverseIterator(Head);
+		return CConstReverseIterator(nullptr, GetGenerationCheck());
 	}
 
 	template<typename T>
 	typename TList<T>::CSafeIterator TList<T>::SafeEnd()
 	{
-		return CSafeIterator(Tail);
+		return CSafeIterator(nullptr, GetGenerationCheck());
 	}
 
 	template<typename T>
 	typename TList<T>::CSafeConstIterator
 		TList<T>::SafeConstEnd() const
 	{
-		return CSafeConstIterator(Tail);
+		return CSafeConstIterator(nullptr, GetGenerationCheck());
 	}
 
 	template<typename T>
 	typename TList<T>::CSafeReverseIterator
 		TList<T>::SafeReverseEnd()
 	{
-		return CSafeReverseIterator(Head);
+		return CSafeReverseIterator(nullptr, GetGenerationCheck());
 	}
 
 	template<typename T>
 	typename TList<T>::CSafeConstReverseIterator
 		TList<T>::SafeConstReverseEnd() const
 	{
-		return CSafeConstReverseIterator(Head);
+		return CSafeConstReverseIterator(nullptr, GetGenerationCheck());
 	}
 
 }
\ No newline at end of file
@@ -16,7 +16,7 @@ namespace Common
 
 		Head = new Node(DefaultValue);
 		Node* Current = Head;
-		for (int i = 1; i < Size; ++i)
+		for (size_t i = 1; i < Size; ++i)
 		{
 			Current->Next = new Node(DefaultValue, Current);
 			Current = Current->Next;
@@ -57,13 +57,7 @@ namespace Common
 
 	template<typename T>
 	TList<T>::TList(const TList<T>& Other)
-		:TList(Other.cbegin(), Other.cend())
-	{
-		if (Other.Size)
-		{
-			Push(Other.Back());	// hack - iterators are broken due to non circularity
-		}						// todo: fix
-	};
+		:TList(Other.cbegin(), Other.cend()) {};
 
 
 	template<typename T>
@@ -104,7 +98,7 @@ namespace Common
 
 		Clear();
 
-		Swap(Head, TempHead);
+		Common::Swap(Head, TempHead);
 		Size = TempSize;
 		Tail = Current;
 	}
@@ -138,17 +132,20 @@ namespace Common
 	template<typename T>
 	void TList<T>::Push(const T& Value)
 	{
-		Node* Temp = new Node(Value, Tail, nullptr);
-		if (Tail == nullptr)
-		{
-			Head = Temp;
-		}
-		else
+		LinkBack(new Node(Value, Tail, nullptr));
+	}
+
+
+	template<typename T>
+	EStatus TList<T>::TryPush(const T& Value)
+	{
+		Node* Temp = new (std::nothrow) Node(Value, Tail, nullptr);
+		if (Temp == nullptr)
 		{
-			Tail->Next = Temp;
+			return EStatus::BadAlloc;
 		}
-		Tail = Temp;
-		++Size;
+		LinkBack(Temp);
+		return EStatus::Ok;
 	}
 
 
@@ -182,17 +179,20 @@ namespace Common
 	template<typename T>
 	void TList<T>::Unshift(const T& Value)
 	{
-		Node* Temp = new Node(Value, nullptr, Head);
-		if (Head == nullptr)
-		{
-			Tail = Temp;
-		}
-		else
+		LinkFront(new Node(Value, nullptr, Head));
+	}
+
+
+	template<typename T>
+	EStatus TList<T>::TryUnshift(const T& Value)
+	{
+		Node* Temp = new (std::nothrow) Node(Value, nullptr, Head);
+		if (Temp == nullptr)
 		{
-			Head->Previous = Temp;
+			return EStatus::BadAlloc;
 		}
-		Head = Temp;
-		++Size;
+		LinkFront(Temp);
+		return EStatus::Ok;
 	}
 
 
@@ -226,15 +226,10 @@ namespace Common
 	template<typename IteratorType>
 	void TList<T>::Insert(IteratorType Position, const T& Value)
 	{
-		if (Position == nullptr)
-		{
-			return;
-		}
-		if (Position.NodePointer->Previous == nullptr)
-		{
-			Unshift(Value);
-			++Size;
-		}
+		Node* const NewNode = new Node(Value);
+		LinkChainBefore(const_cast<Node*>(Position.NodePointer), NewNode,
+			NewNode);
+		++Size;
 	}
 
 
@@ -271,6 +266,7 @@ namespace Common
 	template<typename T>
 	void TList<T>::Pop() noexcept
 	{
+		InvalidateIterators();
 		if (Head == nullptr)
 		{
 			return;
@@ -292,9 +288,22 @@ namespace Common
 	}
 
 
+	template<typename T>
+	EStatus TList<T>::TryPop() noexcept
+	{
+		if (Head == nullptr)
+		{
+			return EStatus::OutOfRange;
+		}
+		Pop();
+		return EStatus::Ok;
+	}
+
+
 	template<typename T>
 	void TList<T>::Shift() noexcept
 	{
+		InvalidateIterators();
 		if (Head == nullptr)
 		{
 			return;
@@ -316,25 +325,189 @@ namespace Common
 	}
 
 
+	template<typename T>
+	EStatus TList<T>::TryShift() noexcept
+	{
+		if (Head == nullptr)
+		{
+			return EStatus::OutOfRange;
+		}
+		Shift();
+		return EStatus::Ok;
+	}
+
+
 	template<typename T>
 	template<typename IteratorType>
 	void TList<T>::Erase(IteratorType Position) noexcept
 	{
-		if (Position->Previous == nullptr)
+		InvalidateIterators();
+		Node* const Target = const_cast<Node*>(Position.NodePointer);
+		UnlinkChain(Target, Target);
+		delete Target;
+		--Size;
+	}
+
+
+
+	template<typename T>
+	void TList<T>::Splice(CIterator Position, TList<T>& Other) noexcept
+	{
+		if (this == &Other || Other.Head == nullptr)
+		{
+			return;
+		}
+		Other.InvalidateIterators();
+		LinkChainBefore(Position.NodePointer, Other.Head, Other.Tail);
+		Size += Other.Size;
+		Other.Head = nullptr;
+		Other.Tail = nullptr;
+		Other.Size = 0;
+	}
+
+
+	template<typename T>
+	void TList<T>::Splice(CIterator Position, TList<T>& Other,
+		CIterator First, CIterator Last) noexcept
+	{
+		if (First.NodePointer == Last.NodePointer)
 		{
-			Shift();
+			return;
 		}
-		else if (Position->Next == nullptr)
+
+		Node* const FirstNode = First.NodePointer;
+		Node* LastNode = FirstNode;
+		size_t Count = 1;
+		while (LastNode->Next != Last.NodePointer)
 		{
-			Pop();
+			LastNode = LastNode->Next;
+			++Count;
 		}
-		else
+
+		Other.InvalidateIterators();
+		Other.UnlinkChain(FirstNode, LastNode);
+		LinkChainBefore(Position.NodePointer, FirstNode, LastNode);
+		if (this != &Other)
 		{
-			Position->Previous = Position->Next;
-			Position->Next = Position->Previous;
-			delete Position;
+			Other.Size -= Count;
+			Size += Count;
 		}
-		--Size;
+	}
+
+
+	template<typename T>
+	template<typename FunctionType>
+	void TList<T>::Merge(TList<T>& Other, FunctionType Comparator)
+	{
+		if (this == &Other || Other.Head == nullptr)
+		{
+			return;
+		}
+		Other.InvalidateIterators();
+
+		// Other's chain is detached first: if Comparator throws, nodes
+		// that are not merged yet go back to Other, none is owned twice
+		Node* Incoming = Other.Head;
+		Node* const IncomingTail = Other.Tail;
+		size_t IncomingCount = Other.Size;
+		Other.Head = nullptr;
+		Other.Tail = nullptr;
+		Other.Size = 0;
+
+		Node* Current = Head;
+		COMMON_TRY
+		{
+			while (Incoming != nullptr)
+			{
+				if (Current == nullptr)
+				{
+					LinkChainBefore(nullptr, Incoming, IncomingTail);
+					Size += IncomingCount;
+					break;
+				}
+				if (Comparator(Incoming->Buffer, Current->Buffer))
+				{
+					Node* const Next = Incoming->Next;
+					LinkChainBefore(Current, Incoming, Incoming);
+					Incoming = Next;
+					++Size;
+					--IncomingCount;
+				}
+				else
+				{
+					Current = Current->Next;
+				}
+			}
+		}
+		COMMON_CATCH_ALL
+		{
+			Incoming->Previous = nullptr;
+			Other.Head = Incoming;
+			Other.Tail = IncomingTail;
+			Other.Size = IncomingCount;
+			COMMON_RETHROW;
+		}
+	}
+
+
+	template<typename T>
+	void TList<T>::Merge(TList<T>& Other)
+	{
+		Merge(Other, [](const T& First, const T& Second)
+			{ return First < Second; });
+	}
+
+
+	template<typename T>
+	void TList<T>::Reverse() noexcept
+	{
+		Node* Current = Head;
+		while (Current != nullptr)
+		{
+			Common::Swap(Current->Next, Current->Previous);
+			Current = Current->Previous;	// former Next
+		}
+		Common::Swap(Head, Tail);
+	}
+
+
+	template<typename T>
+	template<typename FunctionType>
+	size_t TList<T>::Unique(FunctionType AreEqual)
+	{
+		if (Head == nullptr)
+		{
+			return 0;
+		}
+
+		size_t Removed = 0;
+		Node* Current = Head;
+		while (Current->Next != nullptr)
+		{
+			Node* const Next = Current->Next;
+			if (AreEqual(Current->Buffer, Next->Buffer))
+			{
+				// list is consistent after every removal: AreEqual may throw
+				InvalidateIterators();
+				UnlinkChain(Next, Next);
+				delete Next;
+				--Size;
+				++Removed;
+			}
+			else
+			{
+				Current = Next;
+			}
+		}
+		return Removed;
+	}
+
+
+	template<typename T>
+	size_t TList<T>::Unique()
+	{
+		return Unique([](const T& First, const T& Second)
+			{ return First == Second; });
 	}
 
 
@@ -342,6 +515,8 @@ namespace Common
 	template<typename T>
 	void TList<T>::Swap(TList<T>& Other) noexcept
 	{
+		InvalidateIterators();
+		Other.InvalidateIterators();
 		Common::Swap(Other.Head, this->Head);
 		Common::Swap(Other.Tail, this->Tail);
 		Common::Swap(Other.Size, this->Size);
@@ -350,6 +525,7 @@ namespace Common
 	template<typename T>
 	void TList<T>::Clear() noexcept
 	{
+		InvalidateIterators();
 		Node* Next = Head;
 		Node* Current = nullptr;
 		while (Next != nullptr) {
@@ -357,6 +533,8 @@ namespace Common
 			Next = Current->Next;
 			delete Current;
 		}
+		Head = nullptr;
+		Tail = nullptr;
 		Size = 0;
 	}
 
@@ -384,4 +562,98 @@ namespace Common
 		return Tail->Buffer;
 	}
 
+	template<typename T>
+	T* TList<T>::TryFront() noexcept
+	{
+		return Head ? &Head->Buffer : nullptr;
+	}
+
+	template<typename T>
+	T* TList<T>::TryBack() noexcept
+	{
+		return Tail ? &Tail->Buffer : nullptr;
+	}
+
+
+	template<typename T>
+	void TList<T>::LinkBack(Node* const NewNode) noexcept
+	{
+		if (Tail == nullptr)
+		{
+			Head = NewNode;
+		}
+		else
+		{
+			Tail->Next = NewNode;
+		}
+		Tail = NewNode;
+		++Size;
+	}
+
+
+	template<typename T>
+	void TList<T>::LinkFront(Node* const NewNode) noexcept
+	{
+		if (Head == nullptr)
+		{
+			Tail = NewNode;
+		}
+		else
+		{
+			Head->Previous = NewNode;
+		}
+		Head = NewNode;
+		++Size;
+	}
+
+
+	template<typename T>
+	void TList<T>::LinkChainBefore(Node* const Position, Node* const First,
+		Node* const Last) noexcept
+	{
+		Node* const Before = Position ? Position->Previous : Tail;
+		First->Previous = Before;
+		Last->Next = Position;
+		if (Before)
+		{
+			Before->Next = First;
+		}
+		else
+		{
+			Head = First;
+		}
+		if (Position)
+		{
+			Position->Previous = Last;
+		}
+		else
+		{
+			Tail = Last;
+		}
+	}
+
+
+	template<typename T>
+	void TList<T>::UnlinkChain(Node* const First, Node* const Last) noexcept
+	{
+		if (First->Previous)
+		{
+			First->Previous->Next = Last->Next;
+		}
+		else
+		{
+			Head = Last->Next;
+		}
+		if (Last->Next)
+		{
+			Last->Next->Previous = First->Previous;
+		}
+		else
+		{
+			Tail = First->Previous;
+		}
+		First->Previous = nullptr;
+		Last->Next = nullptr;
+	}
+
 }
\ No newline at end of file
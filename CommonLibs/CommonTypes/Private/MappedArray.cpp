@@ -0,0 +1,115 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#include "../MappedArray.h"
+
+#include <cstdio>	// fopen, fwrite
+#include <cstring>	// memcmp, memcpy
+
+namespace Common
+{
+
+	static const char MappedArrayMagic[8] = {'C', 'L', 'M', 'A', 'R', 'R', 'A', 'Y'};
+	static const uint32_t MappedArrayByteOrderMark = 0x01020304;
+
+
+	static size_t CalcDataOffset(const size_t ElementAlignment)
+	{
+		const size_t HeaderSize = sizeof(CMappedArrayHeader);
+		return (HeaderSize + ElementAlignment - 1) / ElementAlignment *
+			ElementAlignment;
+	}
+
+
+	EStatus CheckMappedArrayHeader(const CMappedFile& File,
+		const size_t ElementSize, const size_t ElementAlignment,
+		size_t& OutCount, size_t& OutDataOffset) noexcept
+	{
+		if (File.GetSize() < sizeof(CMappedArrayHeader))
+		{
+			return EStatus::BadFormat;
+		}
+
+		CMappedArrayHeader Header;	// mapping may be unaligned for it
+		std::memcpy(&Header, File.GetData(), sizeof(Header));
+		if (std::memcmp(Header.Magic, MappedArrayMagic, sizeof(Header.Magic))
+			|| Header.Version != MappedArrayFormatVersion
+			|| Header.ByteOrderMark != MappedArrayByteOrderMark
+			|| Header.ElementSize != ElementSize
+			|| Header.ElementAlignment != ElementAlignment
+			|| Header.DataOffset != CalcDataOffset(ElementAlignment))
+		{
+			return EStatus::BadFormat;
+		}
+
+		// file must hold all elements, without overflow of Count * Size
+		if (Header.DataOffset > File.GetSize() || Header.Count >
+			(File.GetSize() - Header.DataOffset) / ElementSize)
+		{
+			return EStatus::BadFormat;
+		}
+
+		// mappings are page-aligned, except for huge alignments
+		const uintptr_t Address = reinterpret_cast<uintptr_t>(
+			File.GetData()) + Header.DataOffset;
+		if (Address % ElementAlignment)
+		{
+			return EStatus::BadFormat;
+		}
+
+		OutCount = static_cast<size_t>(Header.Count);
+		OutDataOffset = static_cast<size_t>(Header.DataOffset);
+		return EStatus::Ok;
+	}
+
+
+	EStatus TryWriteMappedArrayFile(const char* const Path,
+		const void* const Data, const size_t Count, const size_t ElementSize,
+		const size_t ElementAlignment) noexcept
+	{
+		CMappedArrayHeader Header = {};
+		std::memcpy(Header.Magic, MappedArrayMagic, sizeof(Header.Magic));
+		Header.Version = MappedArrayFormatVersion;
+		Header.ByteOrderMark = MappedArrayByteOrderMark;
+		Header.ElementSize = static_cast<uint32_t>(ElementSize);
+		Header.ElementAlignment = static_cast<uint32_t>(ElementAlignment);
+		Header.Count = Count;
+		Header.DataOffset = CalcDataOffset(ElementAlignment);
+
+		std::FILE* File = nullptr;
+#if defined(_MSC_VER)
+		if (fopen_s(&File, Path, "wb") != 0)
+		{
+			File = nullptr;
+		}
+#else
+		File = std::fopen(Path, "wb");
+#endif
+		if (!File)
+		{
+			return EStatus::IOError;
+		}
+
+		static const char Padding[64] = {};
+		size_t PaddingSize = Header.DataOffset - sizeof(Header);
+		bool bWritten = std::fwrite(&Header, sizeof(Header), 1, File) == 1;
+		while (bWritten && PaddingSize)
+		{
+			const size_t Chunk = PaddingSize < sizeof(Padding) ?
+				PaddingSize : sizeof(Padding);
+			bWritten = std::fwrite(Padding, 1, Chunk, File) == Chunk;
+			PaddingSize -= Chunk;
+		}
+		if (bWritten && Count)
+		{
+			bWritten = std::fwrite(Data, ElementSize, Count, File) == Count;
+		}
+
+		// fclose flushes buffer, so its error is a write error too
+		if (std::fclose(File) != 0 || !bWritten)
+		{
+			return EStatus::IOError;
+		}
+		return EStatus::Ok;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	template <typename T>
+	TMappedArray<T>::TMappedArray(const char* const Path)
+	{
+		Open(Path);
+	}
+
+
+	template <typename T>
+	TMappedArray<T>::TMappedArray(TMappedArray&& Other) noexcept
+		: File(Move(Other.File)), Data(Other.Data), Size(Other.Size)
+	{
+		Other.Data = nullptr;
+		Other.Size = 0;
+	}
+
+
+	template <typename T>
+	TMappedArray<T>& TMappedArray<T>::operator = (
+		TMappedArray&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			File = Move(Other.File);
+			Data = Other.Data;
+			Size = Other.Size;
+			Other.Data = nullptr;
+			Other.Size = 0;
+		}
+		return *this;
+	}
+
+
+
+	template <typename T>
+	void TMappedArray<T>::Open(const char* const Path)
+	{
+		const EStatus Status = TryOpen(Path);
+		if (Status == EStatus::IOError)
+		{
+			COMMON_THROW(CIOError("Mapped array: Failed to map file"));
+		}
+		if (Status == EStatus::BadFormat)
+		{
+			COMMON_THROW(CBadFormat("Mapped array: Header does not match"));
+		}
+	}
+
+
+	template <typename T>
+	EStatus TMappedArray<T>::TryOpen(const char* const Path) noexcept
+	{
+		Close();
+
+		const EStatus OpenStatus = File.TryOpen(Path);
+		if (OpenStatus != EStatus::Ok)
+		{
+			return OpenStatus;
+		}
+
+		size_t Count;
+		size_t DataOffset;
+		if (CheckMappedArrayHeader(File, sizeof(T), alignof(T),
+			Count, DataOffset) != EStatus::Ok)
+		{
+			File.Close();
+			return EStatus::BadFormat;
+		}
+
+		Data = reinterpret_cast<const T*>(
+			static_cast<const char*>(File.GetData()) + DataOffset);
+		Size = Count;
+		return EStatus::Ok;
+	}
+
+
+	template <typename T>
+	void TMappedArray<T>::Close() noexcept
+	{
+		File.Close();
+		Data = nullptr;
+		Size = 0;
+	}
+
+
+	template <typename T>
+	bool TMappedArray<T>::Advise(const EAccessHint Hint) const noexcept
+	{
+		return File.Advise(Hint);
+	}
+
+
+
+	template <typename T>
+	const T& TMappedArray<T>::operator [] (const size_t Index) const
+	{
+		ASSERT(Index < Size, "Mapped array index out of range");
+
+		return Data[Index];
+	}
+
+
+	template <typename T>
+	const T& TMappedArray<T>::SafeAt(const size_t Index) const
+	{
+		if (Index >= Size)
+		{
+			COMMON_THROW(COutOfRange("Mapped array index out of range",
+				static_cast<int>(Index), TPair<size_t, size_t>(0, Size)));
+		}
+		return Data[Index];
+	}
+
+
+	template <typename T>
+	const T* TMappedArray<T>::TryAt(const size_t Index) const noexcept
+	{
+		return Index < Size ? Data + Index : nullptr;
+	}
+
+
+	template <typename T>
+	const T* TMappedArray<T>::RawData() const noexcept
+	{
+		return Data;
+	}
+
+
+	template <typename T>
+	size_t TMappedArray<T>::GetSize() const noexcept
+	{
+		return Size;
+	}
+
+
+	template <typename T>
+	bool TMappedArray<T>::IsEmpty() const noexcept
+	{
+		return Size == 0;
+	}
+
+
+	template <typename T>
+	TSpan<const T> TMappedArray<T>::GetSpan() const noexcept
+	{
+		return TSpan<const T>(Data, Size);
+	}
+
+
+
+	template <typename T>
+	typename TMappedArray<T>::CIterator
+	TMappedArray<T>::Begin() const noexcept
+	{
+		return CIterator(Data);
+	}
+
+
+	template <typename T>
+	typename TMappedArray<T>::CIterator
+	TMappedArray<T>::End() const noexcept
+	{
+		return CIterator(Data + Size);
+	}
+
+
+
+	template <typename T>
+	void WriteMappedArray(const char* const Path, const T* const Data,
+		const size_t Count)
+	{
+		if (TryWriteMappedArray(Path, Data, Count) != EStatus::Ok)
+		{
+			COMMON_THROW(CIOError("Mapped array: Failed to write file"));
+		}
+	}
+
+
+	template <typename T>
+	EStatus TryWriteMappedArray(const char* const Path, const T* const Data,
+		const size_t Count) noexcept
+	{
+		static_assert(std::is_trivially_copyable<T>::value,
+			"Mapped array elements must be trivially copyable");
+
+		return TryWriteMappedArrayFile(Path, Data, Count,
+			sizeof(T), alignof(T));
+	}
+
+}
\ No newline at end of file
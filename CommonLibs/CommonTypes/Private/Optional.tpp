@@ -3,146 +3,294 @@
 namespace Common
 {
 
-	template<typename T>
-	TOptional<T>::TOptional(const T& Value)
-		: bExists(true)
+	template <typename T>
+	bool TOptionalBuffer<T>::Exists() const noexcept
 	{
-		Construct(Value);
+		return bExists;
 	}
 
 
-	template<typename T>
-	TOptional<T>::TOptional(const TOptional<T>& Other)
+	template <typename T>
+	template <typename... ArgTypes>
+	void TOptionalBuffer<T>::Construct(ArgTypes&&... Args)
 	{
-		bExists = Other.bExists;
-		if (bExists)
-		{
-			Construct(Other.Get());
-		}
+		new (Buffer) T(Forward<ArgTypes>(Args)...);
+		bExists = true;
 	}
 
 
-	template<typename T>
-	TOptional<T>::TOptional(TOptional<T>&& Other) noexcept
+	template <typename T>
+	void TOptionalBuffer<T>::Reset() noexcept
 	{
-		bExists = Other.bExists;
 		if (bExists)
 		{
-			Construct(Move(Other.Get()));
+			Get().~T();
+			bExists = false;
 		}
 	}
 
 
-	template<typename T>
-	TOptional<T>::~TOptional()
+	template <typename T>
+	T& TOptionalBuffer<T>::Get() noexcept
+	{
+		return *reinterpret_cast<T*>(Buffer);
+	}
+
+
+	template <typename T>
+	const T& TOptionalBuffer<T>::Get() const noexcept
+	{
+		return *reinterpret_cast<const T*>(Buffer);
+	}
+
+
+
+	template <typename T, typename NicheType>
+	bool TOptionalNicheBuffer<T, NicheType>::Exists() const noexcept
 	{
-		DestructIfExists();
+		return !(Value == NicheType::EmptyValue);
 	}
 
 
+	template <typename T, typename NicheType>
+	template <typename... ArgTypes>
+	void TOptionalNicheBuffer<T, NicheType>::Construct(ArgTypes&&... Args)
+		noexcept
+	{
+		Value = T(Forward<ArgTypes>(Args)...);
+	}
+
 
-	template<typename T>
-	void TOptional<T>::SetValue(const T& Value)
+	template <typename T, typename NicheType>
+	void TOptionalNicheBuffer<T, NicheType>::Reset() noexcept
 	{
-		DestructIfExists();
-		Construct(Value);
-		bExists = true;
+		Value = NicheType::EmptyValue;
 	}
 
 
-	template<typename T>
-	void TOptional<T>::Clear() noexcept
+	template <typename T, typename NicheType>
+	T& TOptionalNicheBuffer<T, NicheType>::Get() noexcept
 	{
-		DestructIfExists();
-		bExists = false;
+		return Value;
 	}
 
 
-	template<typename T>
-	TOptional<T>& TOptional<T>::operator = (const T& Value)
+	template <typename T, typename NicheType>
+	const T& TOptionalNicheBuffer<T, NicheType>::Get() const noexcept
 	{
-		SetValue(Value);
-		return *this;
+		return Value;
 	}
 
 
-	template<typename T>
-	TOptional<T>& TOptional<T>::operator = (const TOptional<T>& Other)
+
+	template <typename T, typename NicheType>
+	TOptionalStorage<T, NicheType, false>::TOptionalStorage(
+		const TOptionalStorage& Other)
 	{
-		DestructIfExists();
 		if (Other.bExists)
 		{
-			Construct(Other.Get());
+			this->Construct(Other.Get());
 		}
-		bExists = Other.bExists;
-		return *this;
 	}
 
 
-	template<typename T>
-	TOptional<T>& TOptional<T>::operator = (TOptional<T>&& Other) noexcept
+	template <typename T, typename NicheType>
+	TOptionalStorage<T, NicheType, false>::TOptionalStorage(
+		TOptionalStorage&& Other) noexcept(
+		std::is_nothrow_move_constructible<T>::value)
 	{
-		DestructIfExists();
 		if (Other.bExists)
 		{
-			Construct(Move(Other.Get()));
+			this->Construct(Move(Other.Get()));
 		}
-		bExists = Other.bExists;
+	}
+
+
+	template <typename T, typename NicheType>
+	TOptionalStorage<T, NicheType, false>::~TOptionalStorage()
+	{
+		this->Reset();
+	}
+
+
+	template <typename T, typename NicheType>
+	TOptionalStorage<T, NicheType, false>&
+	TOptionalStorage<T, NicheType, false>::operator = (
+		const TOptionalStorage& Other)
+	{
+		if (this != &Other)
+		{
+			this->Reset();
+			if (Other.bExists)
+			{
+				this->Construct(Other.Get());
+			}
+		}
+		return *this;
+	}
+
+
+	template <typename T, typename NicheType>
+	TOptionalStorage<T, NicheType, false>&
+	TOptionalStorage<T, NicheType, false>::operator = (
+		TOptionalStorage&& Other)
+		noexcept(std::is_nothrow_move_constructible<T>::value)
+	{
+		if (this != &Other)
+		{
+			this->Reset();
+			if (Other.bExists)
+			{
+				this->Construct(Move(Other.Get()));
+			}
+		}
+		return *this;
+	}
+
+
+
+	template <typename T, typename NicheType>
+	TOptional<T, NicheType>::TOptional(const T& Value)
+	{
+		this->Construct(Value);
+	}
+
+
+	template <typename T, typename NicheType>
+	TOptional<T, NicheType>::TOptional(T&& Value)
+	{
+		this->Construct(Move(Value));
+	}
+
+
+	template <typename T, typename NicheType>
+	template <typename... ArgTypes>
+	TOptional<T, NicheType>::TOptional(CInPlace, ArgTypes&&... Args)
+	{
+		this->Construct(Forward<ArgTypes>(Args)...);
+	}
+
+
+
+	template <typename T, typename NicheType>
+	void TOptional<T, NicheType>::SetValue(const T& Value)
+	{
+		this->Reset();
+		this->Construct(Value);
+	}
+
+
+	template <typename T, typename NicheType>
+	void TOptional<T, NicheType>::SetValue(T&& Value)
+	{
+		this->Reset();
+		this->Construct(Move(Value));
+	}
+
+
+	template <typename T, typename NicheType>
+	template <typename... ArgTypes>
+	T& TOptional<T, NicheType>::Emplace(ArgTypes&&... Args)
+	{
+		this->Reset();
+		this->Construct(Forward<ArgTypes>(Args)...);
+		return this->Get();
+	}
+
+
+	template <typename T, typename NicheType>
+	void TOptional<T, NicheType>::Clear() noexcept
+	{
+		this->Reset();
+	}
+
+
+	template <typename T, typename NicheType>
+	TOptional<T, NicheType>&
+	TOptional<T, NicheType>::operator = (const T& Value)
+	{
+		SetValue(Value);
 		return *this;
 	}
 
 
-	template<typename T>
-	void TOptional<T>::Swap(TOptional<T>& Other)
+	template <typename T, typename NicheType>
+	TOptional<T, NicheType>&
+	TOptional<T, NicheType>::operator = (T&& Value)
+	{
+		SetValue(Move(Value));
+		return *this;
+	}
+
+
+	template <typename T, typename NicheType>
+	void TOptional<T, NicheType>::Swap(TOptional& Other)
 	{
 		Common::Swap(Other, *this);
 	}
 
 
 
-	template<typename T>
-	bool TOptional<T>::operator == (const TOptional<T>& Other)
+	template <typename T, typename NicheType>
+	bool TOptional<T, NicheType>::operator == (const TOptional& Other)
 	{
-		if (bExists != Other.bExists)
+		if (this->Exists() != Other.Exists())
 		{
 			return false;
 		}
-		else if (!bExists)	// no need to call compare on internal type
-		{					// bExists are surely equal there
+		else if (!this->Exists())	// no need to call compare on internal type
+		{							// existence flags are surely equal there
 			return true;
 		}
 		else
 		{
-			return Get() == Other.Get();
+			return this->Get() == Other.Get();
 		}
 	}
 
 
 
-	template<typename T>
-	bool TOptional<T>::DoesValueExist() const noexcept
+	template <typename T, typename NicheType>
+	bool TOptional<T, NicheType>::DoesValueExist() const noexcept
 	{
-		return bExists;
+		return this->Exists();
 	}
 
 
-	template<typename T>
-	const T& TOptional<T>::GetValue() const
+	template <typename T, typename NicheType>
+	T& TOptional<T, NicheType>::GetValue()
 	{
-		if (!bExists)
+		if (!this->Exists())
 		{
-			throw CDoesNotExist("Optional does not contain value");
+			COMMON_THROW(CDoesNotExist("Optional does not contain value"));
 		}
-		return Get();
+		return this->Get();
 	}
 
 
-	template<typename T>
-	const T& TOptional<T>::GetValueOr(const T& OtherVariant) const noexcept
+	template <typename T, typename NicheType>
+	T* TOptional<T, NicheType>::TryGetValue() noexcept
 	{
-		if (bExists)
+		return this->Exists() ? &this->Get() : nullptr;
+	}
+
+
+	template <typename T, typename NicheType>
+	T TOptional<T, NicheType>::TakeValue()
+	{
+		T Value(Move(GetValue()));
+		this->Reset();
+		return Value;
+	}
+
+
+	template <typename T, typename NicheType>
+	const T& TOptional<T, NicheType>::GetValueOr(const T& OtherVariant)
+		const noexcept
+	{
+		if (this->Exists())
 		{
-			return Get();
+			return this->Get();
 		}
 		else
 		{
@@ -152,27 +300,62 @@ namespace Common
 
 
 
-	template <typename T>
-	void TOptional<T>::Construct(const T& Value)
+	template <typename T, typename NicheType>
+	TOptional<T&, NicheType>::TOptional(T& Value) noexcept
+		: Pointer(&Value) {}
+
+
+	template <typename T, typename NicheType>
+	void TOptional<T&, NicheType>::SetValue(T& Value) noexcept
 	{
-		new (Buffer) T(Value);
+		Pointer = &Value;
 	}
 
 
-	template <typename T>
-	void TOptional<T>::DestructIfExists() noexcept
+	template <typename T, typename NicheType>
+	T& TOptional<T&, NicheType>::Emplace(T& Value) noexcept
 	{
-		if (bExists)
+		Pointer = &Value;
+		return Value;
+	}
+
+
+	template <typename T, typename NicheType>
+	void TOptional<T&, NicheType>::Clear() noexcept
+	{
+		Pointer = nullptr;
+	}
+
+
+	template <typename T, typename NicheType>
+	bool TOptional<T&, NicheType>::DoesValueExist() const noexcept
+	{
+		return Pointer != nullptr;
+	}
+
+
+	template <typename T, typename NicheType>
+	T& TOptional<T&, NicheType>::GetValue() const
+	{
+		if (!Pointer)
 		{
-			reinterpret_cast<T*>(Buffer)->~T();
+			COMMON_THROW(CDoesNotExist("Optional does not contain value"));
 		}
+		return *Pointer;
 	}
 
 
-	template<typename T>
-	inline const T& TOptional<T>::Get() const noexcept
+	template <typename T, typename NicheType>
+	T* TOptional<T&, NicheType>::TryGetValue() const noexcept
 	{
-		return *reinterpret_cast<const T*>(Buffer);
+		return Pointer;
+	}
+
+
+	template <typename T, typename NicheType>
+	T& TOptional<T&, NicheType>::GetValueOr(T& OtherVariant) const noexcept
+	{
+		return Pointer ? *Pointer : OtherVariant;
 	}
 
 }
\ No newline at end of file
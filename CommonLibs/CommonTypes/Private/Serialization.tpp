@@ -0,0 +1,274 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	template <typename WriterType, typename T>
+	void Serialize(WriterType& Writer, const T& Value)
+	{
+		TSerializer<T>::Write(Writer, Value);
+	}
+
+
+	template <typename ReaderType, typename T>
+	void Deserialize(ReaderType& Reader, T& OutValue)
+	{
+		TSerializer<T>::Read(Reader, OutValue);
+	}
+
+
+
+	template <typename WriterType>
+	void WriteVarUInt(WriterType& Writer, uint64_t Value)
+	{
+		uint8_t Bytes[10];
+		size_t Size = 0;
+		while (Value >= 0x80)
+		{
+			Bytes[Size++] = static_cast<uint8_t>(Value | 0x80);
+			Value >>= 7;
+		}
+		Bytes[Size++] = static_cast<uint8_t>(Value);
+		Writer.Write(Bytes, Size);
+	}
+
+
+	template <typename ReaderType>
+	uint64_t ReadVarUInt(ReaderType& Reader)
+	{
+		uint64_t Value = 0;
+		for (unsigned Shift = 0; Shift < 64; Shift += 7)
+		{
+			uint8_t Byte;
+			Reader.Read(&Byte, 1);
+			// 10th byte may hold only the highest bit
+			if (Shift == 63 && Byte > 1)
+			{
+				break;
+			}
+			Value |= static_cast<uint64_t>(Byte & 0x7F) << Shift;
+			if (!(Byte & 0x80))
+			{
+				return Value;
+			}
+		}
+		COMMON_THROW(CBadFormat("Serialization: Length is too big"));
+	}
+
+
+	// length of container that must fit into memory
+	template <typename ReaderType>
+	size_t ReadContainerLength(ReaderType& Reader, const size_t ElementSize)
+	{
+		const uint64_t Length = ReadVarUInt(Reader);
+		if (Length > size_t(-1) / ElementSize)
+		{
+			COMMON_THROW(CBadFormat("Serialization: Length is too big"));
+		}
+		return static_cast<size_t>(Length);
+	}
+
+
+
+	template <typename T>
+	template <typename WriterType>
+	void TBitwiseSerializer<T>::Write(WriterType& Writer, const T& Value)
+	{
+		Writer.Write(&Value, sizeof(T));
+	}
+
+
+	template <typename T>
+	template <typename ReaderType>
+	void TBitwiseSerializer<T>::Read(ReaderType& Reader, T& OutValue)
+	{
+		Reader.Read(&OutValue, sizeof(T));
+	}
+
+
+
+	template <typename T>
+	template <typename WriterType>
+	void TSerializer<T, typename std::enable_if<(std::is_arithmetic<T>::value
+		|| std::is_enum<T>::value) && !std::is_same<T, bool>::value>::type>::
+		Write(WriterType& Writer, const T& Value)
+	{
+		uint8_t Bytes[sizeof(T)];
+		std::memcpy(Bytes, &Value, sizeof(T));
+#if !COMMON_LITTLE_ENDIAN
+		for (size_t i = 0; i < sizeof(T) / 2; ++i)
+		{
+			Swap(Bytes[i], Bytes[sizeof(T) - 1 - i]);
+		}
+#endif
+		Writer.Write(Bytes, sizeof(T));
+	}
+
+
+	template <typename T>
+	template <typename ReaderType>
+	void TSerializer<T, typename std::enable_if<(std::is_arithmetic<T>::value
+		|| std::is_enum<T>::value) && !std::is_same<T, bool>::value>::type>::
+		Read(ReaderType& Reader, T& OutValue)
+	{
+		uint8_t Bytes[sizeof(T)];
+		Reader.Read(Bytes, sizeof(T));
+#if !COMMON_LITTLE_ENDIAN
+		for (size_t i = 0; i < sizeof(T) / 2; ++i)
+		{
+			Swap(Bytes[i], Bytes[sizeof(T) - 1 - i]);
+		}
+#endif
+		std::memcpy(&OutValue, Bytes, sizeof(T));
+	}
+
+
+
+	template <typename WriterType>
+	void TSerializer<bool>::Write(WriterType& Writer, const bool Value)
+	{
+		const uint8_t Byte = Value ? 1 : 0;
+		Writer.Write(&Byte, 1);
+	}
+
+
+	template <typename ReaderType>
+	void TSerializer<bool>::Read(ReaderType& Reader, bool& OutValue)
+	{
+		uint8_t Byte;
+		Reader.Read(&Byte, 1);
+		if (Byte > 1)
+		{
+			COMMON_THROW(CBadFormat("Serialization: Bad bool value"));
+		}
+		OutValue = Byte == 1;
+	}
+
+
+
+	template <typename T1, typename T2>
+	template <typename WriterType>
+	void TSerializer<TPair<T1, T2>>::Write(WriterType& Writer,
+		const TPair<T1, T2>& Value)
+	{
+		Serialize(Writer, Value.First);
+		Serialize(Writer, Value.Second);
+	}
+
+
+	template <typename T1, typename T2>
+	template <typename ReaderType>
+	void TSerializer<TPair<T1, T2>>::Read(ReaderType& Reader,
+		TPair<T1, T2>& OutValue)
+	{
+		Deserialize(Reader, OutValue.First);
+		Deserialize(Reader, OutValue.Second);
+	}
+
+
+
+	template <typename T, typename NicheType>
+	template <typename WriterType>
+	void TSerializer<TOptional<T, NicheType>>::Write(WriterType& Writer,
+		const TOptional<T, NicheType>& Value)
+	{
+		const T* const Stored = Value.TryGetValue();
+		Serialize(Writer, Stored != nullptr);
+		if (Stored)
+		{
+			Serialize(Writer, *Stored);
+		}
+	}
+
+
+	template <typename T, typename NicheType>
+	template <typename ReaderType>
+	void TSerializer<TOptional<T, NicheType>>::Read(ReaderType& Reader,
+		TOptional<T, NicheType>& OutValue)
+	{
+		bool bExists;
+		Deserialize(Reader, bExists);
+		if (bExists)
+		{
+			Deserialize(Reader, OutValue.Emplace());
+		}
+		else
+		{
+			OutValue.Clear();
+		}
+	}
+
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	template <typename WriterType>
+	void TSerializer<TVector<T, GrowthType, ShrinkType>>::Write(
+		WriterType& Writer, const TVector<T, GrowthType, ShrinkType>& Value)
+	{
+		WriteVarUInt(Writer, Value.GetSize());
+		if constexpr (TSerializer<T>::bBitwise)
+		{
+			Writer.Write(Value.RawData(), sizeof(T) * Value.GetSize());
+		}
+		else
+		{
+			for (const T& Element : Value)
+			{
+				Serialize(Writer, Element);
+			}
+		}
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	template <typename ReaderType>
+	void TSerializer<TVector<T, GrowthType, ShrinkType>>::Read(
+		ReaderType& Reader, TVector<T, GrowthType, ShrinkType>& OutValue)
+	{
+		const size_t Size = ReadContainerLength(Reader, sizeof(T));
+		OutValue.Clear();
+		OutValue.Reserve(Size);
+		OutValue.ResizeDefaultInit(Size);	// trivial types are not zeroed
+		if constexpr (TSerializer<T>::bBitwise)
+		{
+			Reader.Read(OutValue.RawData(), sizeof(T) * Size);
+		}
+		else
+		{
+			for (T& Element : OutValue)
+			{
+				Deserialize(Reader, Element);
+			}
+		}
+	}
+
+
+
+	template <typename T>
+	template <typename WriterType>
+	void TSerializer<TList<T>>::Write(WriterType& Writer,
+		const TList<T>& Value)
+	{
+		WriteVarUInt(Writer, Value.GetSize());
+		typename TList<T>::CConstIterator Iterator = Value.ConstBegin();
+		for (size_t i = 0; i < Value.GetSize(); ++i, ++Iterator)
+		{
+			Serialize(Writer, *Iterator);
+		}
+	}
+
+
+	template <typename T>
+	template <typename ReaderType>
+	void TSerializer<TList<T>>::Read(ReaderType& Reader, TList<T>& OutValue)
+	{
+		const size_t Size = ReadContainerLength(Reader, 1);
+		OutValue.Clear();
+		for (size_t i = 0; i < Size; ++i)
+		{
+			OutValue.Push(T());
+			Deserialize(Reader, OutValue.Back());
+		}
+	}
+
+}
\ No newline at end of file
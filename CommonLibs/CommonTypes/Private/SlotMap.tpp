@@ -0,0 +1,236 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	template <typename T>
+	CSlotHandle TSlotMap<T>::Insert(const T& Value)
+	{
+		if (FreeHead == NoSlot)
+		{
+			if (Slots.GetSize() >= NoSlot)
+			{
+				COMMON_THROW(CBadAlloc("Slot map: Too many slots"));
+			}
+			// new slot joins the free list, so it stays valid on failure
+			Slots.Push(CSlot{ NoSlot, 0 });
+			FreeHead = static_cast<uint32_t>(Slots.GetSize() - 1);
+		}
+
+		const uint32_t Index = FreeHead;
+		Values.Push(Value);
+		COMMON_TRY
+		{
+			Owners.Push(Index);
+		}
+		COMMON_CATCH_ALL
+		{
+			Values.Pop();
+			COMMON_RETHROW;
+		}
+
+		CSlot& Slot = Slots[Index];
+		FreeHead = Slot.Position;
+		Slot.Position = static_cast<uint32_t>(Values.GetSize() - 1);
+		++Slot.Version;
+		return CSlotHandle{ Index, Slot.Version };
+	}
+
+
+	template <typename T>
+	bool TSlotMap<T>::Erase(const CSlotHandle Handle)
+	{
+		if (!Contains(Handle))
+		{
+			return false;
+		}
+
+		const uint32_t Position = Slots[Handle.Index].Position;
+		COMMON_TRY
+		{
+			Values.EraseUnordered(Position, TVector<T>::EShrinkBehavior::Deny);
+		}
+		COMMON_CATCH_ALL
+		{
+			// vector is cleared if moving the last value failed
+			ReleaseAll();
+			Owners.Clear(TVector<uint32_t>::EShrinkBehavior::Deny);
+			COMMON_RETHROW;
+		}
+		Owners.EraseUnordered(Position,
+			TVector<uint32_t>::EShrinkBehavior::Deny);
+		if (Position < Owners.GetSize())
+		{
+			Slots[Owners[Position]].Position = Position;
+		}
+		ReleaseSlot(Handle.Index);
+		return true;
+	}
+
+
+	template <typename T>
+	T* TSlotMap<T>::Find(const CSlotHandle Handle) noexcept
+	{
+		return Contains(Handle) ?
+			&Values[Slots[Handle.Index].Position] : nullptr;
+	}
+
+
+	template <typename T>
+	bool TSlotMap<T>::Contains(const CSlotHandle Handle) const noexcept
+	{
+		return (Handle.Version & 1) && Handle.Index < Slots.GetSize() &&
+			Slots[Handle.Index].Version == Handle.Version;
+	}
+
+
+	template <typename T>
+	T& TSlotMap<T>::operator [] (const CSlotHandle Handle)
+	{
+		ASSERT(Contains(Handle), "Slot map: Stale handle");
+		return Values[Slots[Handle.Index].Position];
+	}
+
+
+	template <typename T>
+	T& TSlotMap<T>::SafeAt(const CSlotHandle Handle)
+	{
+		if (!Contains(Handle))
+		{
+			COMMON_THROW(CDoesNotExist("Slot map: Stale handle"));
+		}
+		return Values[Slots[Handle.Index].Position];
+	}
+
+
+
+	template <typename T>
+	TSpan<T> TSlotMap<T>::GetValues() noexcept
+	{
+		return TSpan<T>(Values.RawData(), Values.GetSize());
+	}
+
+
+	template <typename T>
+	TSpan<const T> TSlotMap<T>::GetValues() const noexcept
+	{
+		return TSpan<const T>(Values.RawData(), Values.GetSize());
+	}
+
+
+	template <typename T>
+	CSlotHandle TSlotMap<T>::GetHandle(const size_t Position) const
+	{
+		ASSERT(Position < Owners.GetSize(), "Slot map: Out of range");
+		const uint32_t Index = Owners[Position];
+		return CSlotHandle{ Index, Slots[Index].Version };
+	}
+
+
+	template <typename T>
+	template <typename FunctionType>
+	void TSlotMap<T>::ForEach(FunctionType Function)
+	{
+		for (size_t i = 0; i < Values.GetSize(); ++i)
+		{
+			Function(GetHandle(i), Values[i]);
+		}
+	}
+
+
+	template <typename T>
+	template <typename FunctionType>
+	void TSlotMap<T>::ForEach(FunctionType Function) const
+	{
+		for (size_t i = 0; i < Values.GetSize(); ++i)
+		{
+			Function(GetHandle(i), Values[i]);
+		}
+	}
+
+
+
+	template <typename T>
+	void TSlotMap<T>::Reserve(const size_t Count)
+	{
+		Values.Reserve(Count);
+		Owners.Reserve(Count);
+		Slots.Reserve(Count);
+	}
+
+
+	template <typename T>
+	void TSlotMap<T>::ShrinkToFit()
+	{
+		Values.ShrinkToFit();
+		Owners.ShrinkToFit();
+	}
+
+
+	template <typename T>
+	void TSlotMap<T>::Clear() noexcept
+	{
+		ReleaseAll();
+		Values.Clear(TVector<T>::EShrinkBehavior::Deny);
+		Owners.Clear(TVector<uint32_t>::EShrinkBehavior::Deny);
+	}
+
+
+	template <typename T>
+	void TSlotMap<T>::Swap(TSlotMap& Other) noexcept
+	{
+		Values.Swap(Other.Values);
+		Owners.Swap(Other.Owners);
+		Slots.Swap(Other.Slots);
+		Common::Swap(FreeHead, Other.FreeHead);
+	}
+
+
+
+	template <typename T>
+	size_t TSlotMap<T>::GetSize() const noexcept
+	{
+		return Values.GetSize();
+	}
+
+
+	template <typename T>
+	size_t TSlotMap<T>::GetSlotCount() const noexcept
+	{
+		return Slots.GetSize();
+	}
+
+
+	template <typename T>
+	bool TSlotMap<T>::IsEmpty() const noexcept
+	{
+		return Values.IsEmpty();
+	}
+
+
+
+	template <typename T>
+	void TSlotMap<T>::ReleaseSlot(const uint32_t Index) noexcept
+	{
+		CSlot& Slot = Slots[Index];
+		++Slot.Version;
+		// after the wrap new versions would match old handles
+		if (Slot.Version == 0)
+		{
+			return;
+		}
+		Slot.Position = FreeHead;
+		FreeHead = Index;
+	}
+
+
+	template <typename T>
+	void TSlotMap<T>::ReleaseAll() noexcept
+	{
+		for (size_t i = 0; i < Owners.GetSize(); ++i)
+		{
+			ReleaseSlot(Owners[i]);
+		}
+	}
+
+}
\ No newline at end of file
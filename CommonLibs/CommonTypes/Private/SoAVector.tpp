@@ -0,0 +1,613 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	template <typename OwnerType>
+	TSoARowReference<OwnerType>::TSoARowReference(OwnerType* const Owner,
+		const size_t Row) noexcept
+		: Owner(Owner), Row(Row) {}
+
+
+	template <typename OwnerType>
+	template <typename OtherOwnerType>
+	const TSoARowReference<OwnerType>&
+	TSoARowReference<OwnerType>::operator = (
+		const TSoARowReference<OtherOwnerType>& Other) const
+	{
+		CopyFields(Other, std::make_index_sequence<OwnerType::FieldCount>());
+		return *this;
+	}
+
+
+	template <typename OwnerType>
+	const TSoARowReference<OwnerType>&
+	TSoARowReference<OwnerType>::operator = (
+		const TSoARowReference& Other) const
+	{
+		CopyFields(Other, std::make_index_sequence<OwnerType::FieldCount>());
+		return *this;
+	}
+
+
+	template <typename OwnerType>
+	size_t TSoARowReference<OwnerType>::GetIndex() const noexcept
+	{
+		return Row;
+	}
+
+
+	template <typename OwnerType>
+	template <typename OtherOwnerType, size_t... Indices>
+	void TSoARowReference<OwnerType>::CopyFields(
+		const TSoARowReference<OtherOwnerType>& Other,
+		std::index_sequence<Indices...>) const
+	{
+		((Get<Indices>() = Other.template Get<Indices>()), ...);
+	}
+
+
+
+	template <typename... Fields>
+	TSoAVector<Fields...>::TSoAVector(const TSoAVector& Other)
+		: CapacityRule(Other.CapacityRule)
+	{
+		if (!Other.Size)
+		{
+			return;
+		}
+
+		Reallocate(Other.Size);
+		COMMON_TRY
+		{
+			CopyRows(Other, CIndices());
+		}
+		COMMON_CATCH_ALL	// destructor is not called if ctor throws
+		{
+			DeallocateColumns(Columns, CIndices());
+			COMMON_RETHROW;
+		}
+		Size = Other.Size;
+	}
+
+
+	template <typename... Fields>
+	TSoAVector<Fields...>::TSoAVector(TSoAVector&& Other) noexcept
+		: Size(Other.Size), Capacity(Other.Capacity),
+		Columns(Other.Columns), CapacityRule(Other.CapacityRule)
+	{
+		Other.Size = 0;
+		Other.Capacity = 0;
+		Other.Columns = CColumns();
+	}
+
+
+	template <typename... Fields>
+	TSoAVector<Fields...>::~TSoAVector()
+	{
+		Clear();
+	}
+
+
+	template <typename... Fields>
+	TSoAVector<Fields...>&
+	TSoAVector<Fields...>::operator = (const TSoAVector& Other)
+	{
+		if (this != &Other)
+		{
+			TSoAVector Temp(Other);
+			Swap(Temp);
+		}
+		return *this;
+	}
+
+
+	template <typename... Fields>
+	TSoAVector<Fields...>&
+	TSoAVector<Fields...>::operator = (TSoAVector&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			Clear();
+			Swap(Other);
+		}
+		return *this;
+	}
+
+
+
+	template <typename... Fields>
+	void TSoAVector<Fields...>::Push(const Fields&... Values)
+	{
+		ConstructBack(Values...);
+	}
+
+
+	template <typename... Fields>
+	void TSoAVector<Fields...>::Insert(const size_t Position,
+		const Fields&... Values)
+	{
+		ASSERT(Position <= Size, "Insert() SoA vector out of range");
+
+		// Values may be fields of this vector, so they are copied
+		// before rows are shifted
+		ConstructBack(Values...);
+		RotateBackTo(Position, CIndices());
+	}
+
+
+	template <typename... Fields>
+	void TSoAVector<Fields...>::Pop(const EShrinkBehavior ShrinkBehavior)
+	{
+		ASSERT(Size, "Pop() operation on empty SoA vector");
+
+		DestructRows(Size - 1, Size, CIndices());
+		--Size;
+		AutoShrinkIfNeeded(ShrinkBehavior);
+	}
+
+
+	template <typename... Fields>
+	void TSoAVector<Fields...>::Erase(const size_t Position,
+		const EShrinkBehavior ShrinkBehavior)
+	{
+		ASSERT(Position < Size, "Erase() SoA vector out of range");
+
+		EraseRow(Position, CIndices());
+		--Size;
+		AutoShrinkIfNeeded(ShrinkBehavior);
+	}
+
+
+	template <typename... Fields>
+	void TSoAVector<Fields...>::Resize(const size_t NewSize,
+		const EShrinkBehavior ShrinkBehavior)
+	{
+		if (NewSize > Size)
+		{
+			if (NewSize > Capacity)
+			{
+				Reallocate(CalcExtendedCapacity(NewSize));
+			}
+			ConstructDefaultRows(Size, NewSize, CIndices());
+			Size = NewSize;
+		}
+		else
+		{
+			DestructRows(NewSize, Size, CIndices());
+			Size = NewSize;
+			AutoShrinkIfNeeded(ShrinkBehavior);
+		}
+	}
+
+
+	template <typename... Fields>
+	void TSoAVector<Fields...>::Reserve(const size_t NewCapacity)
+	{
+		if (NewCapacity >= Size && NewCapacity != Capacity)
+		{
+			if (NewCapacity)
+			{
+				Reallocate(NewCapacity);
+			}
+			else
+			{
+				Clear();
+			}
+		}
+	}
+
+
+	template <typename... Fields>
+	void TSoAVector<Fields...>::ShrinkToFit()
+	{
+		Reserve(Size);
+	}
+
+
+	template <typename... Fields>
+	void TSoAVector<Fields...>::Clear() noexcept
+	{
+		DestructRows(0, Size, CIndices());
+		DeallocateColumns(Columns, CIndices());
+		Size = 0;
+		Capacity = 0;
+	}
+
+
+	template <typename... Fields>
+	void TSoAVector<Fields...>::Swap(TSoAVector& Other) noexcept
+	{
+		Common::Swap(Size, Other.Size);
+		Common::Swap(Capacity, Other.Capacity);
+		Common::Swap(Columns, Other.Columns);
+		Common::Swap(CapacityRule, Other.CapacityRule);
+	}
+
+
+
+	template <typename... Fields>
+	size_t TSoAVector<Fields...>::GetSize() const noexcept
+	{
+		return Size;
+	}
+
+
+	template <typename... Fields>
+	size_t TSoAVector<Fields...>::GetCapacity() const noexcept
+	{
+		return Capacity;
+	}
+
+
+	template <typename... Fields>
+	bool TSoAVector<Fields...>::IsEmpty() const noexcept
+	{
+		return Size == 0;
+	}
+
+
+	template <typename... Fields>
+	void TSoAVector<Fields...>::SetCapacityRule(
+		const EReservedCapacityRule NewRule) noexcept
+	{
+		CapacityRule = NewRule;
+	}
+
+
+	template <typename... Fields>
+	EReservedCapacityRule
+	TSoAVector<Fields...>::GetCapacityRule() const noexcept
+	{
+		return CapacityRule;
+	}
+
+
+
+	template <typename... Fields>
+	template <size_t Index>
+	typename TTypeAt<Index, Fields...>::Type&
+	TSoAVector<Fields...>::At(const size_t Row)
+	{
+		ASSERT(Row < Size, "SoA vector index out of range");
+
+		return ColumnOf<Index>(Columns)[Row];
+	}
+
+
+	template <typename... Fields>
+	template <size_t Index>
+	TSpan<typename TSoAVector<Fields...>::template TField<Index>>
+	TSoAVector<Fields...>::GetColumn() noexcept
+	{
+		return TSpan<TField<Index>>(ColumnOf<Index>(Columns), Size);
+	}
+
+
+	template <typename... Fields>
+	typename TSoAVector<Fields...>::CRowReference
+	TSoAVector<Fields...>::operator [] (const size_t Row)
+	{
+		ASSERT(Row < Size, "SoA vector index out of range");
+
+		return CRowReference(this, Row);
+	}
+
+
+	template <typename... Fields>
+	typename TSoAVector<Fields...>::CConstRowReference
+	TSoAVector<Fields...>::operator [] (const size_t Row) const
+	{
+		ASSERT(Row < Size, "SoA vector index out of range");
+
+		return CConstRowReference(this, Row);
+	}
+
+
+
+	template <typename... Fields>
+	typename TSoAVector<Fields...>::CIterator
+	TSoAVector<Fields...>::Begin() noexcept
+	{
+		return CIterator(this, 0);
+	}
+
+
+	template <typename... Fields>
+	typename TSoAVector<Fields...>::CIterator
+	TSoAVector<Fields...>::End() noexcept
+	{
+		return CIterator(this, Size);
+	}
+
+
+	template <typename... Fields>
+	typename TSoAVector<Fields...>::CConstIterator
+	TSoAVector<Fields...>::ConstBegin() const noexcept
+	{
+		return CConstIterator(this, 0);
+	}
+
+
+	template <typename... Fields>
+	typename TSoAVector<Fields...>::CConstIterator
+	TSoAVector<Fields...>::ConstEnd() const noexcept
+	{
+		return CConstIterator(this, Size);
+	}
+
+
+
+	template <typename... Fields>
+	template <size_t Index>
+	typename TTypeAt<Index, Fields...>::Type*&
+	TSoAVector<Fields...>::ColumnOf(CColumns& Target) noexcept
+	{
+		return static_cast<TSoAColumn<Index, TField<Index>>&>(Target).Buffer;
+	}
+
+
+	template <typename... Fields>
+	template <size_t Index>
+	typename TTypeAt<Index, Fields...>::Type*
+	TSoAVector<Fields...>::ColumnOf(const CColumns& Target) noexcept
+	{
+		return static_cast<const TSoAColumn<Index, TField<Index>>&>(
+			Target).Buffer;
+	}
+
+
+	template <typename... Fields>
+	size_t TSoAVector<Fields...>::CalcExtendedCapacity(
+		const size_t NewSize) const noexcept
+	{
+		if (CapacityRule == EReservedCapacityRule::NeverReserve)
+		{
+			return NewSize;
+		}
+		return CRuleGrowth::CalcExtendedCapacity(NewSize, RowSize,
+			CapacityRule);
+	}
+
+
+	template <typename... Fields>
+	void TSoAVector<Fields...>::AutoShrinkIfNeeded(
+		const EShrinkBehavior ShrinkBehavior)
+	{
+		size_t NewCapacity = Capacity;
+		if (ShrinkBehavior == EShrinkBehavior::Require ||
+			(ShrinkBehavior == EShrinkBehavior::Allow &&
+			CapacityRule == EReservedCapacityRule::NeverReserve))
+		{
+			NewCapacity = Size;
+		}
+		else if (ShrinkBehavior == EShrinkBehavior::Allow)
+		{
+			NewCapacity = CRuleShrink::CalcShrinkedCapacity(Size, Capacity,
+				RowSize, CapacityRule);
+		}
+
+		if (NewCapacity == Capacity)
+		{
+			return;
+		}
+		if (NewCapacity)
+		{
+			// shrink is optional; keep memory if allocation failed
+			TryReallocate(NewCapacity);
+		}
+		else
+		{
+			DeallocateColumns(Columns, CIndices());
+			Capacity = 0;
+		}
+	}
+
+
+	template <typename... Fields>
+	bool TSoAVector<Fields...>::TryReallocate(const size_t NewCapacity)
+	{
+		CColumns NewColumns;
+		if (!TryAllocateColumns(NewColumns, NewCapacity, CIndices()))
+		{
+			return false;
+		}
+		MoveColumns(NewColumns, CIndices());
+		Capacity = NewCapacity;
+		return true;
+	}
+
+
+	template <typename... Fields>
+	void TSoAVector<Fields...>::Reallocate(const size_t NewCapacity)
+	{
+		if (!TryReallocate(NewCapacity))
+		{
+			COMMON_THROW(CBadAlloc("SoA vector: Failed to allocate",
+				RowSize * NewCapacity));
+		}
+	}
+
+
+	template <typename... Fields>
+	template <size_t... Indices>
+	bool TSoAVector<Fields...>::TryAllocateColumns(CColumns& Target,
+		const size_t NewCapacity, std::index_sequence<Indices...>) noexcept
+	{
+		if ((TryAllocate(NewCapacity, ColumnOf<Indices>(Target)) && ...))
+		{
+			return true;
+		}
+		DeallocateColumns(Target, CIndices());	// some may be allocated
+		return false;
+	}
+
+
+	template <typename... Fields>
+	template <size_t... Indices>
+	void TSoAVector<Fields...>::DeallocateColumns(CColumns& Target,
+		std::index_sequence<Indices...>) noexcept
+	{
+		(Deallocate(ColumnOf<Indices>(Target)), ...);
+	}
+
+
+	template <typename... Fields>
+	template <size_t... Indices>
+	void TSoAVector<Fields...>::MoveColumns(CColumns& Target,
+		std::index_sequence<Indices...>) noexcept
+	{
+		if (Capacity)	// first allocation is not a reallocation
+		{
+			(RecordReallocation<Fields>(Size), ...);
+		}
+		(SafeMoveBlock(Size, ColumnOf<Indices>(Columns),
+			ColumnOf<Indices>(Target)), ...);
+		DeallocateColumns(Columns, CIndices());
+		Columns = Target;
+	}
+
+
+	template <typename... Fields>
+	template <size_t... Indices>
+	void TSoAVector<Fields...>::ConstructRow(CColumns& Target,
+		const size_t Row, std::index_sequence<Indices...>,
+		const Fields&... Values)
+	{
+		size_t Constructed = 0;
+		COMMON_TRY
+		{
+			((Construct(Row, ColumnOf<Indices>(Target), Values),
+				++Constructed), ...);
+		}
+		COMMON_CATCH_ALL
+		{
+			((Indices < Constructed ?
+				Destruct(Row, ColumnOf<Indices>(Target)) : void()), ...);
+			COMMON_RETHROW;
+		}
+	}
+
+
+	template <typename... Fields>
+	void TSoAVector<Fields...>::ConstructBack(const Fields&... Values)
+	{
+		if (Size < Capacity)
+		{
+			ConstructRow(Columns, Size, CIndices(), Values...);
+			++Size;
+			return;
+		}
+
+		const size_t NewCapacity = CalcExtendedCapacity(Size + 1);
+		CColumns NewColumns;
+		if (!TryAllocateColumns(NewColumns, NewCapacity, CIndices()))
+		{
+			COMMON_THROW(CBadAlloc("SoA vector: Failed to allocate",
+				RowSize * NewCapacity));
+		}
+
+		// Values may be fields of this vector; copy them before move
+		COMMON_TRY
+		{
+			ConstructRow(NewColumns, Size, CIndices(), Values...);
+		}
+		COMMON_CATCH_ALL
+		{
+			DeallocateColumns(NewColumns, CIndices());
+			COMMON_RETHROW;
+		}
+		MoveColumns(NewColumns, CIndices());
+		Capacity = NewCapacity;
+		++Size;
+	}
+
+
+	template <typename... Fields>
+	template <size_t... Indices>
+	void TSoAVector<Fields...>::CopyRows(const TSoAVector& Other,
+		std::index_sequence<Indices...>)
+	{
+		size_t Copied = 0;
+		COMMON_TRY
+		{
+			((SafeBulkConstruct(0, ColumnOf<Indices>(Other.Columns),
+				ColumnOf<Indices>(Other.Columns) + Other.Size,
+				ColumnOf<Indices>(Columns)), ++Copied), ...);
+		}
+		COMMON_CATCH_ALL
+		{
+			((Indices < Copied ? DestructAll(Other.Size,
+				ColumnOf<Indices>(Columns)) : void()), ...);
+			COMMON_RETHROW;
+		}
+	}
+
+
+	template <typename... Fields>
+	template <size_t... Indices>
+	void TSoAVector<Fields...>::ConstructDefaultRows(const size_t From,
+		const size_t To, std::index_sequence<Indices...>)
+	{
+		size_t Constructed = 0;
+		COMMON_TRY
+		{
+			((SafeFillConstruct(From, To, ColumnOf<Indices>(Columns),
+				TField<Indices>()), ++Constructed), ...);
+		}
+		COMMON_CATCH_ALL
+		{
+			((Indices < Constructed ?
+				DestructRange(From, To, ColumnOf<Indices>(Columns)) : void()),
+				...);
+			COMMON_RETHROW;
+		}
+	}
+
+
+	template <typename... Fields>
+	template <size_t... Indices>
+	void TSoAVector<Fields...>::RotateBackTo(const size_t Position,
+		std::index_sequence<Indices...>) noexcept
+	{
+		const size_t Last = Size - 1;
+		const auto Rotate = [Position, Last](auto* const Buffer)
+		{
+			auto Temp(Move(Buffer[Last]));
+			for (size_t i = Last; i > Position; --i)
+			{
+				Buffer[i] = Move(Buffer[i - 1]);
+			}
+			Buffer[Position] = Move(Temp);
+		};
+		(Rotate(ColumnOf<Indices>(Columns)), ...);
+	}
+
+
+	template <typename... Fields>
+	template <size_t... Indices>
+	void TSoAVector<Fields...>::EraseRow(const size_t Position,
+		std::index_sequence<Indices...>) noexcept
+	{
+		const size_t Last = Size - 1;
+		const auto EraseFrom = [Position, Last](auto* const Buffer)
+		{
+			for (size_t i = Position; i < Last; ++i)
+			{
+				Buffer[i] = Move(Buffer[i + 1]);
+			}
+			Destruct(Last, Buffer);
+		};
+		(EraseFrom(ColumnOf<Indices>(Columns)), ...);
+	}
+
+
+	template <typename... Fields>
+	template <size_t... Indices>
+	void TSoAVector<Fields...>::DestructRows(const size_t From,
+		const size_t To, std::index_sequence<Indices...>) noexcept
+	{
+		(DestructRange(From, To, ColumnOf<Indices>(Columns)), ...);
+	}
+
+}
\ No newline at end of file
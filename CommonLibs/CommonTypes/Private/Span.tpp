@@ -0,0 +1,76 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	template <typename T>
+	TSpan<T>::TSpan(T* const Data, const size_t Size) noexcept
+		: Data(Data), Size(Size) {}
+
+
+
+	template <typename T>
+	T& TSpan<T>::operator [] (const size_t Index) const
+	{
+		ASSERT(Index < Size, "Span index out of range");
+
+		return Data[Index];
+	}
+
+
+	template <typename T>
+	TSpan<T> TSpan<T>::Subspan(const size_t Offset, const size_t Count) const
+	{
+		ASSERT(Offset <= Size && Count <= Size - Offset,
+			"Subspan out of range");
+
+		return TSpan(Data + Offset, Count);
+	}
+
+
+	template <typename T>
+	TSpan<T> TSpan<T>::Subspan(const size_t Offset) const
+	{
+		ASSERT(Offset <= Size, "Subspan out of range");
+
+		return TSpan(Data + Offset, Size - Offset);
+	}
+
+
+
+	template <typename T>
+	T* TSpan<T>::RawData() const noexcept
+	{
+		return Data;
+	}
+
+
+	template <typename T>
+	size_t TSpan<T>::GetSize() const noexcept
+	{
+		return Size;
+	}
+
+
+	template <typename T>
+	bool TSpan<T>::IsEmpty() const noexcept
+	{
+		return Size == 0;
+	}
+
+
+
+	template <typename T>
+	typename TSpan<T>::CIterator TSpan<T>::Begin() const noexcept
+	{
+		return CIterator(Data);
+	}
+
+
+	template <typename T>
+	typename TSpan<T>::CIterator TSpan<T>::End() const noexcept
+	{
+		return CIterator(Data + Size);
+	}
+
+}
\ No newline at end of file
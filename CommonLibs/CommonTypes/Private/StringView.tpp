@@ -0,0 +1,160 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	template <typename CharType>
+	TStringView<CharType>::TStringView(const CharType* const Data,
+		const size_t Size) noexcept
+		: Data(Data), Size(Size) {}
+
+
+	template <typename CharType>
+	TStringView<CharType>::TStringView(
+		const CharType* const NullTermString) noexcept
+		: Data(NullTermString), Size(0)
+	{
+		while (NullTermString[Size] != CharType())
+		{
+			++Size;
+		}
+	}
+
+
+
+	template <typename CharType>
+	const CharType& TStringView<CharType>::operator [] (
+		const size_t Index) const
+	{
+		ASSERT(Index < Size, "String view index out of range");
+
+		return Data[Index];
+	}
+
+
+	template <typename CharType>
+	TStringView<CharType> TStringView<CharType>::Subview(
+		const size_t Offset, const size_t Count) const
+	{
+		ASSERT(Offset <= Size && Count <= Size - Offset,
+			"Subview out of range");
+
+		return TStringView(Data + Offset, Count);
+	}
+
+
+	template <typename CharType>
+	TStringView<CharType> TStringView<CharType>::Subview(
+		const size_t Offset) const
+	{
+		ASSERT(Offset <= Size, "Subview out of range");
+
+		return TStringView(Data + Offset, Size - Offset);
+	}
+
+
+	template <typename CharType>
+	size_t TStringView<CharType>::Find(const CharType Value,
+		const size_t Offset) const noexcept
+	{
+		if constexpr (sizeof(CharType) == 1)
+		{
+			if (Offset >= Size)
+			{
+				return NotFound;
+			}
+			const char* const Begin = reinterpret_cast<const char*>(Data);
+			const char* const Found = FindRawByte(Begin + Offset,
+				Begin + Size, static_cast<char>(Value));
+			return Found == Begin + Size ? NotFound :
+				static_cast<size_t>(Found - Begin);
+		}
+		else
+		{
+			for (size_t i = Offset; i < Size; ++i)
+			{
+				if (Data[i] == Value)
+				{
+					return i;
+				}
+			}
+			return NotFound;
+		}
+	}
+
+
+	template <typename CharType>
+	bool TStringView<CharType>::StartsWith(
+		const TStringView Prefix) const noexcept
+	{
+		return Prefix.Size <= Size &&
+			TStringView(Data, Prefix.Size) == Prefix;
+	}
+
+
+	template <typename CharType>
+	bool TStringView<CharType>::operator == (
+		const TStringView Other) const noexcept
+	{
+		if (Size != Other.Size)
+		{
+			return false;
+		}
+		for (size_t i = 0; i < Size; ++i)
+		{
+			if (Data[i] != Other.Data[i])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+
+	template <typename CharType>
+	bool TStringView<CharType>::operator != (
+		const TStringView Other) const noexcept
+	{
+		return !(*this == Other);
+	}
+
+
+
+	template <typename CharType>
+	const CharType* TStringView<CharType>::RawData() const noexcept
+	{
+		return Data;
+	}
+
+
+	template <typename CharType>
+	size_t TStringView<CharType>::GetSize() const noexcept
+	{
+		return Size;
+	}
+
+
+	template <typename CharType>
+	bool TStringView<CharType>::IsEmpty() const noexcept
+	{
+		return Size == 0;
+	}
+
+
+
+	template <typename CharType>
+	typename TStringView<CharType>::CIterator
+	TStringView<CharType>::Begin() const noexcept
+	{
+		return CIterator(Data);
+	}
+
+
+	template <typename CharType>
+	typename TStringView<CharType>::CIterator
+	TStringView<CharType>::End() const noexcept
+	{
+		return CIterator(Data + Size);
+	}
+
+}
@@ -0,0 +1,41 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	template <typename... Types>
+	template <typename FirstArgType, typename... ArgTypes, typename>
+	constexpr TTuple<Types...>::TTuple(FirstArgType&& First,
+		ArgTypes&&... Args)
+		: CStorage(Forward<FirstArgType>(First),
+			Forward<ArgTypes>(Args)...) {}
+
+
+	template <typename... Types>
+	template <size_t Index>
+	typename TTuple<Types...>::template TElement<Index>&
+	TTuple<Types...>::Get() noexcept
+	{
+		return static_cast<TCompressedElement<TElement<Index>, Index>&>(
+			*this).Get();
+	}
+
+
+	template <typename... Types>
+	template <size_t Index>
+	const typename TTuple<Types...>::template TElement<Index>&
+	TTuple<Types...>::Get() const noexcept
+	{
+		return static_cast<const TCompressedElement<TElement<Index>, Index>&>(
+			*this).Get();
+	}
+
+
+
+	template <typename... Types>
+	inline constexpr TTuple<Types...> MakeTuple(const Types&... Values)
+	{
+		return TTuple<Types...>(Values...);
+	}
+
+}
\ No newline at end of file
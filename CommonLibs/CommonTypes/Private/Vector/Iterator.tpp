@@ -5,109 +5,125 @@
 namespace Common
 {
 
-	template<typename T>
-	typename TVector<T>::CIterator TVector<T>::Begin()
+	template <typename T, typename GrowthType, typename ShrinkType>
+	typename TVector<T, GrowthType, ShrinkType>::CIterator
+		TVector<T, GrowthType, ShrinkType>::Begin()
 	{
-		return CIterator(Buffer);
+		return CIterator(Buffer, GetGenerationCheck());
 	}
 
 
-	template<typename T>
-	typename TVector<T>::CConstIterator TVector<T>::ConstBegin() const
+	template <typename T, typename GrowthType, typename ShrinkType>
+	typename TVector<T, GrowthType, ShrinkType>::CConstIterator
+		TVector<T, GrowthType, ShrinkType>::ConstBegin() const
 	{
-		return CConstIterator(Buffer);
+		return CConstIterator(Buffer, GetGenerationCheck());
 	}
 
-	template<typename T>
-	typename TVector<T>::CReverseIterator TVector<T>::ReverseBegin()
+	template <typename T, typename GrowthType, typename ShrinkType>
+	typename TVector<T, GrowthType, ShrinkType>::CReverseIterator
+		TVector<T, GrowthType, ShrinkType>::ReverseBegin()
 	{
-		return CReverseIterator(Buffer + Size);
+		return CReverseIterator(Buffer + Size, GetGenerationCheck());
 	}
 
-	template<typename T>
-	typename TVector<T>::CConstReverseIterator
-		TVector<T>::ConstReverseBegin() const
+	template <typename T, typename GrowthType, typename ShrinkType>
+	typename TVector<T, GrowthType, ShrinkType>::CConstReverseIterator
+		TVector<T, GrowthType, ShrinkType>::ConstReverseBegin() const
 	{
-		return CConstReverseIterator(Buffer + Size);
+		return CConstReverseIterator(Buffer + Size, GetGenerationCheck());
 	}
 
-	template<typename T>
-	typename TVector<T>::CSafeIterator TVector<T>::SafeBegin()
+	template <typename T, typename GrowthType, typename ShrinkType>
+	typename TVector<T, GrowthType, ShrinkType>::CSafeIterator
+		TVector<T, GrowthType, ShrinkType>::SafeBegin()
 	{
-		return CSafeIterator(Buffer, this);
+		return CSafeIterator(Buffer, Buffer, Buffer + Size,
+			GetGenerationCheck());
 	}
 
-	template<typename T>
-	typename TVector<T>::CSafeConstIterator
-		TVector<T>::SafeConstBegin() const
+	template <typename T, typename GrowthType, typename ShrinkType>
+	typename TVector<T, GrowthType, ShrinkType>::CSafeConstIterator
+		TVector<T, GrowthType, ShrinkType>::SafeConstBegin() const
 	{
-		return CSafeConstIterator(Buffer, this);
+		return CSafeConstIterator(Buffer, Buffer, Buffer + Size,
+			GetGenerationCheck());
 	}
 
-	template<typename T>
-	typename TVector<T>::CSafeReverseIterator
-		TVector<T>::SafeReverseBegin()
+	template <typename T, typename GrowthType, typename ShrinkType>
+	typename TVector<T, GrowthType, ShrinkType>::CSafeReverseIterator
+		TVector<T, GrowthType, ShrinkType>::SafeReverseBegin()
 	{
-		return CSafeReverseIterator(Buffer + Size, this);
+		return CSafeReverseIterator(Buffer + Size, Buffer, Buffer + Size,
+			GetGenerationCheck());
 	}
 
-	template<typename T>
-	typename TVector<T>::CSafeConstReverseIterator
-		TVector<T>::SafeConstReverseBegin() const
+	template <typename T, typename GrowthType, typename ShrinkType>
+	typename TVector<T, GrowthType, ShrinkType>::CSafeConstReverseIterator
+		TVector<T, GrowthType, ShrinkType>::SafeConstReverseBegin() const
 	{
-		return CSafeConstReverseIterator(Buffer + Size, this);
+		return CSafeConstReverseIterator(Buffer + Size, Buffer, Buffer + Size,
+			GetGenerationCheck());
 	}
 
-	template<typename T>
-	typename TVector<T>::CIterator TVector<T>::End()
+	template <typename T, typename GrowthType, typename ShrinkType>
+	typename TVector<T, GrowthType, ShrinkType>::CIterator
+		TVector<T, GrowthType, ShrinkType>::End()
 	{
-		return CIterator(Buffer + Size);
+		return CIterator(Buffer + Size, GetGenerationCheck());
 	}
 
-	template<typename T>
-	typename TVector<T>::CConstIterator TVector<T>::ConstEnd() const
+	template <typename T, typename GrowthType, typename ShrinkType>
+	typename TVector<T, GrowthType, ShrinkType>::CConstIterator
+		TVector<T, GrowthType, ShrinkType>::ConstEnd() const
 	{
-		return CConstIterator(Buffer + Size);
+		return CConstIterator(Buffer + Size, GetGenerationCheck());
 	}
 
-	template<typename T>
-	typename TVector<T>::CReverseIterator TVector<T>::ReverseEnd()
+	template <typename T, typename GrowthType, typename ShrinkType>
+	typename TVector<T, GrowthType, ShrinkType>::CReverseIterator
+		TVector<T, GrowthType, ShrinkType>::ReverseEnd()
 	{
-		return CReverseIterator(Buffer);
+		return CReverseIterator(Buffer, GetGenerationCheck());
 	}
 
-	template<typename T>
-	typename TVector<T>::CConstReverseIterator
-		TVector<T>::ConstReverseEnd() const
+	template <typename T, typename GrowthType, typename ShrinkType>
+	typename TVector<T, GrowthType, ShrinkType>::CConstReverseIterator
+		TVector<T, GrowthType, ShrinkType>::ConstReverseEnd() const
 	{
-		return CConstReverseIterator(Buffer);
+		return CConstReverseIterator(Buffer, GetGenerationCheck());
 	}
 
-	template<typename T>
-	typename TVector<T>::CSafeIterator TVector<T>::SafeEnd()
+	template <typename T, typename GrowthType, typename ShrinkType>
+	typename TVector<T, GrowthType, ShrinkType>::CSafeIterator
+		TVector<T, GrowthType, ShrinkType>::SafeEnd()
 	{
-		return CSafeIterator(Buffer + Size, this);
+		return CSafeIterator(Buffer + Size, Buffer, Buffer + Size,
+			GetGenerationCheck());
 	}
 
-	template<typename T>
-	typename TVector<T>::CSafeConstIterator
-		TVector<T>::SafeConstEnd() const
+	template <typename T, typename GrowthType, typename ShrinkType>
+	typename TVector<T, GrowthType, ShrinkType>::CSafeConstIterator
+		TVector<T, GrowthType, ShrinkType>::SafeConstEnd() const
 	{
-		return CSafeConstIterator(Buffer + Size, this);
+		return CSafeConstIterator(Buffer + Size, Buffer, Buffer + Size,
+			GetGenerationCheck());
 	}
 
-	template<typename T>
-	typename TVector<T>::CSafeReverseIterator
-		TVector<T>::SafeReverseEnd()
+	template <typename T, typename GrowthType, typename ShrinkType>
+	typename TVector<T, GrowthType, ShrinkType>::CSafeReverseIterator
+		TVector<T, GrowthType, ShrinkType>::SafeReverseEnd()
 	{
-		return CSafeReverseIterator(Buffer, this);
+		return CSafeReverseIterator(Buffer, Buffer, Buffer + Size,
+			GetGenerationCheck());
 	}
 
-	template<typename T>
-	typename TVector<T>::CSafeConstReverseIterator
-		TVector<T>::SafeConstReverseEnd() const
+	template <typename T, typename GrowthType, typename ShrinkType>
+	typename TVector<T, GrowthType, ShrinkType>::CSafeConstReverseIterator
+		TVector<T, GrowthType, ShrinkType>::SafeConstReverseEnd() const
 	{
-		return CSafeConstReverseIterator(Buffer, this);
+		return CSafeConstReverseIterator(Buffer, Buffer, Buffer + Size,
+			GetGenerationCheck());
 	}
 
 }
\ No newline at end of file
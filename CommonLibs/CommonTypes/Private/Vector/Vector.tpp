@@ -3,13 +3,15 @@
 namespace Common
 {
 
-	template<typename T>
-	TVector<T>::TVector(const EReservedCapacityRule CapacityRule) noexcept
+	template <typename T, typename GrowthType, typename ShrinkType>
+	TVector<T, GrowthType, ShrinkType>::TVector(
+		const EReservedCapacityRule CapacityRule) noexcept
 		: CapacityRule(CapacityRule) {};
 
 
-	template<typename T>
-	TVector<T>::TVector(const size_t Size, const T& DefaultValue,
+	template <typename T, typename GrowthType, typename ShrinkType>
+	TVector<T, GrowthType, ShrinkType>::TVector(const size_t Size,
+		const T& DefaultValue,
 		const EReservedCapacityRule CapacityRule)
 		: Capacity(Size), CapacityRule(CapacityRule)
 	{
@@ -24,8 +26,9 @@ namespace Common
 	}
 
 
-	template<typename T>
-	TVector<T>::TVector(const size_t Size, const T* const Array,
+	template <typename T, typename GrowthType, typename ShrinkType>
+	TVector<T, GrowthType, ShrinkType>::TVector(const size_t Size,
+		const T* const Array,
 		const EReservedCapacityRule CapacityRule)
 		: Capacity(Size), CapacityRule(CapacityRule)
 	{
@@ -40,14 +43,16 @@ namespace Common
 	}
 
 
-	template<typename T>
-	TVector<T>::TVector(const std::initializer_list<T>& ValuesList)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	TVector<T, GrowthType, ShrinkType>::TVector(
+		const std::initializer_list<T>& ValuesList)
 		: TVector(ValuesList.begin(), ValuesList.end()) {};
 
 
-	template <typename T>
+	template <typename T, typename GrowthType, typename ShrinkType>
 	template <typename IteratorType>
-	TVector<T>::TVector(const IteratorType Begin, const IteratorType End,
+	TVector<T, GrowthType, ShrinkType>::TVector(const IteratorType Begin,
+		const IteratorType End,
 		EReservedCapacityRule CapacityRule,
 		// disable this constructor when it "wins" the first one
 		typename std::enable_if<!std::is_integral<
@@ -67,8 +72,8 @@ namespace Common
 	}
 
 
-	template<typename T>
-	TVector<T>::TVector(const TVector<T>& Other)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	TVector<T, GrowthType, ShrinkType>::TVector(const TVector& Other)
 		: Capacity(Other.Capacity),
 		CapacityRule(Other.CapacityRule)
 	{
@@ -83,15 +88,15 @@ namespace Common
 	}
 
 
-	template<typename T>
-	TVector<T>::TVector(TVector<T>&& Other) noexcept
+	template <typename T, typename GrowthType, typename ShrinkType>
+	TVector<T, GrowthType, ShrinkType>::TVector(TVector&& Other) noexcept
 	{
 		Swap(Other);
 	}
 
 
-	template<typename T>
-	TVector<T>::~TVector()
+	template <typename T, typename GrowthType, typename ShrinkType>
+	TVector<T, GrowthType, ShrinkType>::~TVector()
 	{
 		DestructAll(Size, Buffer);
 		Deallocate(Buffer);
@@ -99,9 +104,9 @@ namespace Common
 
 
 
-	template<typename T>
+	template <typename T, typename GrowthType, typename ShrinkType>
 	template<typename IteratorType>
-	void TVector<T>::Assign(const IteratorType Begin,
+	void TVector<T, GrowthType, ShrinkType>::Assign(const IteratorType Begin,
 		const IteratorType End, const EShrinkBehavior ShrinkBehavior)
 	{
 		size_t NewSize = GetIteratorDistance(Begin, End);
@@ -109,27 +114,29 @@ namespace Common
 
 		T* TempBuffer;
 		Allocate(NewCapacity, TempBuffer);
-		try
+		COMMON_TRY
 		{
 			SafeBulkConstruct(0, Begin, End, TempBuffer);
 		}
-		catch (...)
+		COMMON_CATCH_ALL
 		{
 			Deallocate(TempBuffer);
-			throw;
+			COMMON_RETHROW;
 		}
 
 		Common::Swap(TempBuffer, Buffer);
 		Common::Swap(Size, NewSize);
 		Capacity = NewCapacity;
+		InvalidateIterators();
 
 		DestructAll(NewSize, TempBuffer);
 		Deallocate(TempBuffer);
 	}
 
 
-	template <typename T>
-	TVector<T>& TVector<T>::operator = (const
+	template <typename T, typename GrowthType, typename ShrinkType>
+	TVector<T, GrowthType, ShrinkType>&
+	TVector<T, GrowthType, ShrinkType>::operator = (const
 		std::initializer_list<T>& ValuesList)
 	{
 		Assign(ValuesList.begin(), ValuesList.end());
@@ -137,22 +144,24 @@ namespace Common
 	}
 
 
-	template<typename T>
-	TVector<T>& TVector<T>::operator = (const TVector<T>& Other)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	TVector<T, GrowthType, ShrinkType>&
+	TVector<T, GrowthType, ShrinkType>::operator = (const TVector& Other)
 	{
+		InvalidateIterators();
 		size_t NewSize = Other.Size;
 
 		T* TempBuffer;
 		Allocate(Other.Capacity, TempBuffer);
-		try
+		COMMON_TRY
 		{
 			SafeBulkConstruct(0, Other.Buffer,
 				Other.Buffer + Other.Size, TempBuffer);
 		}
-		catch (...)
+		COMMON_CATCH_ALL
 		{
 			Deallocate(TempBuffer);
-			throw;
+			COMMON_RETHROW;
 		}
 
 		Common::Swap(TempBuffer, Buffer);
@@ -166,8 +175,9 @@ namespace Common
 	}
 
 
-	template<typename T>
-	TVector<T>& TVector<T>::operator = (TVector<T>&& Other) noexcept
+	template <typename T, typename GrowthType, typename ShrinkType>
+	TVector<T, GrowthType, ShrinkType>&
+	TVector<T, GrowthType, ShrinkType>::operator = (TVector&& Other) noexcept
 	{
 		Swap(Other);
 		return *this;
@@ -175,29 +185,38 @@ namespace Common
 
 
 
-	template<typename T>
-	T& TVector<T>::operator [](const size_t Index)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	T& TVector<T, GrowthType, ShrinkType>::operator [](const size_t Index)
 	{
 		ASSERT(Index < Size, "Out of range: [] vector");
 		return Buffer[Index];
 	}
 
 
-	template<typename T>
-	T& TVector<T>::SafeAt(const size_t Index)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	T& TVector<T, GrowthType, ShrinkType>::SafeAt(const size_t Index)
 	{
 		if (Index >= Size)
 		{
-			throw COutOfRange("Out of range: [] vector",
-				static_cast<int>(Index), TPair<size_t, size_t>(0, Size));
+			COMMON_THROW(COutOfRange("Out of range: [] vector",
+				static_cast<int>(Index), TPair<size_t, size_t>(0, Size)));
 		}
 
 		return Buffer[Index];
 	}
 
 
-	template<typename T>
-	T& TVector<T>::AutoAt(const size_t Index, const T& DefaultValue)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	T* TVector<T, GrowthType, ShrinkType>::TryAt(const size_t Index) noexcept
+	{
+		return Index < Size ? Buffer + Index : nullptr;
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	T&
+	TVector<T, GrowthType, ShrinkType>::AutoAt(const size_t Index,
+		const T& DefaultValue)
 	{
 		if (Index >= Size)
 		{
@@ -208,16 +227,18 @@ namespace Common
 	}
 
 
-	template<typename T>
-	T* TVector<T>::RawData() noexcept
+	template <typename T, typename GrowthType, typename ShrinkType>
+	T* TVector<T, GrowthType, ShrinkType>::RawData() noexcept
 	{
 		return Buffer;
 	}
 
 
 
-	template<typename T>
-	bool TVector<T>::operator == (const TVector<T>& Other) const noexcept
+	template <typename T, typename GrowthType, typename ShrinkType>
+	bool
+	TVector<T, GrowthType, ShrinkType>::operator == (
+		const TVector& Other) const noexcept
 	{
 		if (Size != Other.Size)
 		{
@@ -235,26 +256,30 @@ namespace Common
 	}
 
 
-	template<typename T>
-	bool TVector<T>::operator != (const TVector<T>& Other) const noexcept
+	template <typename T, typename GrowthType, typename ShrinkType>
+	bool
+	TVector<T, GrowthType, ShrinkType>::operator != (
+		const TVector& Other) const noexcept
 	{
 		return !operator==(Other);
 	}
 
 
-	template<typename T>
-	TVector<T>& TVector<T>::operator += (const TVector<T>& Other)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	TVector<T, GrowthType, ShrinkType>&
+	TVector<T, GrowthType, ShrinkType>::operator += (const TVector& Other)
 	{
 		Push(Other.Buffer, Other.Buffer + Other.Size);
 		return *this;
 	}
 
 
-	template<typename T>
-	TVector<T> TVector<T>::operator + (const TVector<T>& Other) const
+	template <typename T, typename GrowthType, typename ShrinkType>
+	TVector<T, GrowthType, ShrinkType>
+	TVector<T, GrowthType, ShrinkType>::operator + (const TVector& Other) const &
 	{
 		size_t NewSize = Size + Other.Size;
-		TVector<T> NewVector;
+		TVector<T, GrowthType, ShrinkType> NewVector;
 		Allocate(NewSize, NewVector.Buffer);
 		NewVector.Capacity = NewSize;
 
@@ -268,132 +293,196 @@ namespace Common
 	}
 
 
-	template <typename T>
-	void TVector<T>::Push(const T& Value)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	TVector<T, GrowthType, ShrinkType>
+	TVector<T, GrowthType, ShrinkType>::operator + (const TVector& Other) &&
+	{
+		Push(Other.Buffer, Other.Buffer + Other.Size);
+		return Move(*this);
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void TVector<T, GrowthType, ShrinkType>::Push(const T& Value)
 	{
+		InvalidateIterators();
 		if (Size + 1 > Capacity)
 		{
-			Reconstruct(Size, CalcExtendedCapacity(Size + 1),
-				Buffer, Size, Capacity);
+			// Value may be an element of this vector
+			ReconstructWithGap(Size, &Value, &Value + 1, 1);
+			return;
 		}
 		Construct(Size, Buffer, Value);
 		++Size;
 	}
 
 
-	template <typename T>
+	template <typename T, typename GrowthType, typename ShrinkType>
+	EStatus TVector<T, GrowthType, ShrinkType>::TryPush(const T& Value)
+	{
+		InvalidateIterators();
+		if (Size + 1 > Capacity)
+		{
+			// Value may be an element of this vector
+			return TryReconstructWithGap(Size, &Value, &Value + 1, 1)
+				? EStatus::Ok : EStatus::BadAlloc;
+		}
+		Construct(Size, Buffer, Value);
+		++Size;
+		return EStatus::Ok;
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
 	template <typename IteratorType>
-	void TVector<T>::Push(const IteratorType Begin, const IteratorType End)
+	void
+	TVector<T, GrowthType, ShrinkType>::Push(const IteratorType Begin,
+		const IteratorType End)
 	{
 		size_t Distance = GetIteratorDistance(Begin, End);
 
 		if (Size + Distance > Capacity)
 		{
-			Reconstruct(Size, CalcExtendedCapacity(Size + Distance),
-				Buffer, Size, Capacity);
+			ReconstructWithGap(Size, Begin, End, Distance);
+			return;
 		}
 		SafeBulkConstruct(Size, Begin, End, Buffer);
 		Size += Distance;
+		InvalidateIterators();
 	}
 
 
 
-	template <typename T>
-	void TVector<T>::Insert(const size_t Position, const T& Value)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void
+	TVector<T, GrowthType, ShrinkType>::Insert(const size_t Position,
+		const T& Value)
 	{
 		Insert(Position, &Value, &Value + 1);
 	}
 
 
-	template <typename T>
-	void TVector<T>::SafeInsert(const size_t Position, const T& Value)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void
+	TVector<T, GrowthType, ShrinkType>::SafeInsert(const size_t Position,
+		const T& Value)
 	{
 		SafeInsert(Position, &Value, &Value + 1);
 	}
 
 
-	template <typename T>
-	void TVector<T>::AutoInsert(const size_t Position, const T& Value,
+	template <typename T, typename GrowthType, typename ShrinkType>
+	EStatus
+	TVector<T, GrowthType, ShrinkType>::TryInsert(const size_t Position,
+		const T& Value)
+	{
+		if (Position > Size)
+		{
+			return EStatus::OutOfRange;
+		}
+
+		if (Size + 1 > Capacity)
+		{
+			return TryReconstructWithGap(Position, &Value, &Value + 1, 1)
+				? EStatus::Ok : EStatus::BadAlloc;
+		}
+		Insert(Position, Value);
+		return EStatus::Ok;
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void
+	TVector<T, GrowthType, ShrinkType>::AutoInsert(const size_t Position,
+		const T& Value,
 		const T& DefaultValue)
 	{
 		AutoInsert(Position, &Value, &Value + 1, DefaultValue);
 	}
 
 
-	template <typename T>
+	template <typename T, typename GrowthType, typename ShrinkType>
 	template <typename IteratorType>
-	void TVector<T>::Insert(const size_t Position, const IteratorType Begin,
+	void
+	TVector<T, GrowthType, ShrinkType>::Insert(const size_t Position,
+		const IteratorType Begin,
 		const IteratorType End)
 	{
 		ASSERT(Position <= Size, "Out of range: vector insert");
 
 		size_t Distance = GetIteratorDistance(Begin, End);
 
-		// Step 1: reconstruct up to insert position
-		// Note: clears vector if Move construction fails
+		// Growth: every element is moved once, directly to its
+		// final slot in the new buffer
 		if (Size + Distance > Capacity)
 		{
-			Reconstruct(Size, CalcExtendedCapacity(Size + Distance),
-				Buffer, Size, Capacity);
+			ReconstructWithGap(Position, Begin, End, Distance);
+			return;
 		}
 
-		// Step 2: Move old elements out of insertion position
+		// Step 1: Move old elements out of insertion position
 		// Note: clears vector if Move construction fails
-		try
+		COMMON_TRY
 		{
 			SafeMoveBlockReverse(Size - Position, Buffer + Position,
 				Buffer + Position + Distance);
 		}
-		catch (...)
+		COMMON_CATCH_ALL
 		{
 			DestructRange(0, Position, Buffer);	// SafeMoveBlock destructed the rest
 			Size = 0;
 			AutoShrinkIfNeeded(EShrinkBehavior::Allow);
-			throw;
+			COMMON_RETHROW;
 		}
 
-		// Step 3: Copy elements to insert
+		// Step 2: Copy elements to insert
 		// Note: If copy construction fails, tries to revert vector 
 		// to a previous state. In case of Move faulure - clear vector
-		try
+		COMMON_TRY
 		{
 			SafeBulkConstruct(Position, Begin, End, Buffer);
 		}
-		catch (...)
+		COMMON_CATCH_ALL
 		{
 			// try to move values back
-			try
+			COMMON_TRY
 			{
-				SafeMoveBlock(Distance, Buffer + Position + Distance, Buffer + Position);
+				SafeMoveBlock(Size - Position, Buffer + Position + Distance,
+					Buffer + Position);
 			}
-			catch (...)
+			COMMON_CATCH_ALL
 			{
 				DestructRange(0, Position, Buffer);	// SafeMoveBlock destructed the rest
 				Size = 0;
 				AutoShrinkIfNeeded(EShrinkBehavior::Allow);
-				throw;
+				COMMON_RETHROW;
 			}
-			throw;
+			COMMON_RETHROW;
 		}
 		Size += Distance;
+		InvalidateIterators();
 	}
 
 
-	template <typename T>
+	template <typename T, typename GrowthType, typename ShrinkType>
 	template <typename IteratorType>
-	void TVector<T>::SafeInsert(const size_t Position, const IteratorType Begin,
+	void
+	TVector<T, GrowthType, ShrinkType>::SafeInsert(const size_t Position,
+		const IteratorType Begin,
 		const IteratorType End)
 	{
 		if (Position > Size)
 		{
-			throw  COutOfRange("Insert() vector out of range");
+			COMMON_THROW(COutOfRange("Insert() vector out of range"));
 		}
 		Insert(Position, Begin, End);
 	}
 
-	template <typename T>
+	template <typename T, typename GrowthType, typename ShrinkType>
 	template <typename IteratorType>
-	void TVector<T>::AutoInsert(const size_t Position, const IteratorType Begin,
+	void
+	TVector<T, GrowthType, ShrinkType>::AutoInsert(const size_t Position,
+		const IteratorType Begin,
 		const IteratorType End, const T& DefaultValue)
 	{
 		if (Position > Size)
@@ -404,9 +493,11 @@ namespace Common
 	}
 
 
-	template<typename T>
-	void TVector<T>::Pop(const EShrinkBehavior ShrinkBehavior)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void
+	TVector<T, GrowthType, ShrinkType>::Pop(const EShrinkBehavior ShrinkBehavior)
 	{
+		InvalidateIterators();
 		ASSERT(Size, "Pop() operation on empty vector");
 
 		Destruct(Size - 1, Buffer);
@@ -415,46 +506,66 @@ namespace Common
 	}
 
 
-	template<typename T>
-	void TVector<T>::SafePop(const EShrinkBehavior ShrinkBehavior)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void
+	TVector<T, GrowthType, ShrinkType>::SafePop(
+		const EShrinkBehavior ShrinkBehavior)
 	{
 		if (!Size)
 		{
-			throw COutOfRange("Pop() operation on empty vector");
+			COMMON_THROW(COutOfRange("Pop() operation on empty vector"));
 		}
 
 		Pop(ShrinkBehavior);
 	}
 
 
-	template<typename T>
-	T TVector<T>::SafePopGet(const EShrinkBehavior ShrinkBehavior)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	EStatus
+	TVector<T, GrowthType, ShrinkType>::TryPop(
+		const EShrinkBehavior ShrinkBehavior)
 	{
 		if (!Size)
 		{
-			throw COutOfRange("Pop() operation on empty vector");
+			return EStatus::OutOfRange;
 		}
-		try
+
+		Pop(ShrinkBehavior);
+		return EStatus::Ok;
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	T
+	TVector<T, GrowthType, ShrinkType>::SafePopGet(
+		const EShrinkBehavior ShrinkBehavior)
+	{
+		if (!Size)
+		{
+			COMMON_THROW(COutOfRange("Pop() operation on empty vector"));
+		}
+		COMMON_TRY
 		{
 			T PopValue(Move(Buffer[Size - 1]));	// may throw
 			Pop(ShrinkBehavior);
 			return PopValue;
 		}
-		catch (...)
+		COMMON_CATCH_ALL
 		{
 			// handles Move(Buffer[...]) exception
 			// not the best solution, because vector may be cleared
 			// twice, but move throw is not supposed to happen often
 			Clear();
-			throw;
+			COMMON_RETHROW;
 		}
 	}
 
 
-	template<typename T>
-	void TVector<T>::PopMultiple(const size_t ElementsToPop,
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void TVector<T, GrowthType, ShrinkType>::PopMultiple(const size_t ElementsToPop,
 		const EShrinkBehavior ShrinkBehavior)
 	{
+		InvalidateIterators();
 		if (ElementsToPop >= Size)
 		{
 			Clear(ShrinkBehavior);
@@ -469,22 +580,24 @@ namespace Common
 
 
 
-	template<typename T>
-	void TVector<T>::Shift(const EShrinkBehavior ShrinkBehavior)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void
+	TVector<T, GrowthType, ShrinkType>::Shift(const EShrinkBehavior ShrinkBehavior)
 	{
+		InvalidateIterators();
 		ASSERT(Size, "Shift() operation on empty vector");
 
 		Destruct(0, Buffer);
 
-		try
+		COMMON_TRY
 		{
 			SafeMoveBlock(Size - 1, Buffer + 1, Buffer);
 		}
-		catch (...)
+		COMMON_CATCH_ALL
 		{
 			Size = 0;
 			AutoShrinkIfNeeded(ShrinkBehavior);
-			throw;
+			COMMON_RETHROW;
 		}
 		--Size;
 
@@ -492,61 +605,83 @@ namespace Common
 	}
 
 
-	template<typename T>
-	void TVector<T>::SafeShift(const EShrinkBehavior ShrinkBehavior)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void
+	TVector<T, GrowthType, ShrinkType>::SafeShift(
+		const EShrinkBehavior ShrinkBehavior)
+	{
+		if (!Size)
+		{
+			COMMON_THROW(COutOfRange("Shift() operation on empty vector"));
+		}
+
+		Shift(ShrinkBehavior);
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	EStatus
+	TVector<T, GrowthType, ShrinkType>::TryShift(
+		const EShrinkBehavior ShrinkBehavior)
 	{
 		if (!Size)
 		{
-			throw COutOfRange("Shift() operation on empty vector");
+			return EStatus::OutOfRange;
 		}
 
 		Shift(ShrinkBehavior);
+		return EStatus::Ok;
 	}
 
 
-	template<typename T>
-	T TVector<T>::SafeShiftGet(const EShrinkBehavior ShrinkBehavior)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	T
+	TVector<T, GrowthType, ShrinkType>::SafeShiftGet(
+		const EShrinkBehavior ShrinkBehavior)
 	{
 		if (!Size)
 		{
-			throw COutOfRange("Shift() operation on empty vector");
+			COMMON_THROW(COutOfRange("Shift() operation on empty vector"));
 		}
-		try
+		COMMON_TRY
 		{
 			T ShiftValue(Move(Buffer[0]));	// may throw
 			Shift(ShrinkBehavior);
 			return ShiftValue;
 		}
-		catch (...)
+		COMMON_CATCH_ALL
 		{
 			// handles Move(Buffer[...]) exception
 			// not the best solution, because vector may be cleared
 			// twice, but move throw is not supposed to happen often
 			Clear();
-			throw;
+			COMMON_RETHROW;
 		}
 	}
 
 
-	template<typename T>
-	void TVector<T>::ShiftMultiple(const size_t ElementsToShift,
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void
+	TVector<T, GrowthType, ShrinkType>::ShiftMultiple(const size_t ElementsToShift,
 		const EShrinkBehavior ShrinkBehavior)
 	{
+		InvalidateIterators();
 		if (ElementsToShift >= Size)
 		{
 			Clear(ShrinkBehavior);
 			return;
 		}
 
-		try
+		DestructRange(0, ElementsToShift, Buffer);
+		COMMON_TRY
 		{
 			SafeMoveBlock(Size - ElementsToShift, Buffer + ElementsToShift, Buffer);
 		}
-		catch (...)
+		COMMON_CATCH_ALL
 		{
 			Size = 0;
 			AutoShrinkIfNeeded(ShrinkBehavior);
-			throw;
+			COMMON_RETHROW;
 		}
 		Size -= ElementsToShift;
 
@@ -555,23 +690,27 @@ namespace Common
 
 
 
-	template<typename T>
-	void TVector<T>::Erase(const size_t Position, const EShrinkBehavior ShrinkBehavior)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void
+	TVector<T, GrowthType, ShrinkType>::Erase(const size_t Position,
+		const EShrinkBehavior ShrinkBehavior)
 	{
+		InvalidateIterators();
 		ASSERT(Position < Size, "Erase() vector out of range");
 
 		Destruct(Position, Buffer);
 
-		try
+		COMMON_TRY
 		{
-			SafeMoveBlock(Size - Position, Buffer + Position + 1, Buffer + Position);
+			SafeMoveBlock(Size - Position - 1, Buffer + Position + 1,
+				Buffer + Position);
 		}
-		catch (...)
+		COMMON_CATCH_ALL
 		{
 			DestructRange(0, Position, Buffer);
 			Size = 0;
 			AutoShrinkIfNeeded(ShrinkBehavior);
-			throw;
+			COMMON_RETHROW;
 		}
 		Size--;
 
@@ -579,66 +718,88 @@ namespace Common
 	}
 
 
-	template<typename T>
-	void TVector<T>::SafeErase(const size_t Position,
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void TVector<T, GrowthType, ShrinkType>::SafeErase(const size_t Position,
+		const EShrinkBehavior ShrinkBehavior)
+	{
+		if (Position >= Size)
+		{
+			COMMON_THROW(COutOfRange("Out of range: Erase() vector"));
+		}
+
+		Erase(Position, ShrinkBehavior);
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	EStatus
+	TVector<T, GrowthType, ShrinkType>::TryErase(const size_t Position,
 		const EShrinkBehavior ShrinkBehavior)
 	{
 		if (Position >= Size)
 		{
-			throw COutOfRange("Out of range: Erase() vector");
+			return EStatus::OutOfRange;
 		}
 
-		Erase(ShrinkBehavior);
+		Erase(Position, ShrinkBehavior);
+		return EStatus::Ok;
 	}
 
 
-	template<typename T>
-	T TVector<T>::SafeEraseGet(const size_t Position,
+	template <typename T, typename GrowthType, typename ShrinkType>
+	T TVector<T, GrowthType, ShrinkType>::SafeEraseGet(const size_t Position,
 		const EShrinkBehavior ShrinkBehavior)
 	{
 		if (Position >= Size)
 		{
-			throw COutOfRange("Out of range: Erase() vector");
+			COMMON_THROW(COutOfRange("Out of range: Erase() vector"));
 		}
-		try
+		COMMON_TRY
 		{
 			T EraseValue(Move(Buffer[Position]));	// may throw
 			Erase(Position, ShrinkBehavior);
 			return EraseValue;
 		}
-		catch (...)
+		COMMON_CATCH_ALL
 		{
 			// handles Move(Buffer[...]) exception
 			// not the best solution, because vector may be cleared
 			// twice, but move throw is not supposed to happen often
 			Clear();
-			throw;
+			COMMON_RETHROW;
 		}
 	}
 
 
 	// Note: different name was chosen to avoid implicit conversion
 	// of second parameter to boolean and deleting only one element
-	template<typename T>
-	void TVector<T>::EraseMultiple(const size_t PositionFrom,
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void
+	TVector<T, GrowthType, ShrinkType>::EraseMultiple(const size_t PositionFrom,
 		size_t PositionTo, const EShrinkBehavior ShrinkBehavior)
 	{
 		if (PositionTo > Size)
 		{
 			PositionTo = Size;
 		}
+		if (PositionFrom >= PositionTo)
+		{
+			return;
+		}
 
-		try
+		InvalidateIterators();
+		DestructRange(PositionFrom, PositionTo, Buffer);
+		COMMON_TRY
 		{
 			SafeMoveBlock(Size - PositionTo, Buffer + PositionTo,
 				Buffer + PositionFrom);
 		}
-		catch (...)
+		COMMON_CATCH_ALL
 		{
 			DestructRange(0, PositionFrom, Buffer);
 			Size = 0;
 			AutoShrinkIfNeeded(ShrinkBehavior);
-			throw;
+			COMMON_RETHROW;
 		}
 		Size -= PositionTo - PositionFrom;
 
@@ -646,10 +807,123 @@ namespace Common
 	}
 
 
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void TVector<T, GrowthType, ShrinkType>::EraseUnordered(const size_t Position,
+		const EShrinkBehavior ShrinkBehavior)
+	{
+		InvalidateIterators();
+		ASSERT(Position < Size, "EraseUnordered() vector out of range");
 
-	template<typename T>
-	void TVector<T>::Reserve(const size_t NewCapacity)
+		Destruct(Position, Buffer);
+		if (Position != Size - 1)
+		{
+			COMMON_TRY
+			{
+				Construct(Position, Buffer, Move(Buffer[Size - 1]));
+			}
+			COMMON_CATCH_ALL
+			{
+				DestructRange(0, Position, Buffer);
+				DestructRange(Position + 1, Size, Buffer);
+				Size = 0;
+				AutoShrinkIfNeeded(ShrinkBehavior);
+				COMMON_RETHROW;
+			}
+			Destruct(Size - 1, Buffer);
+		}
+		--Size;
+
+		AutoShrinkIfNeeded(ShrinkBehavior);
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void
+	TVector<T, GrowthType, ShrinkType>::SafeEraseUnordered(const size_t Position,
+		const EShrinkBehavior ShrinkBehavior)
 	{
+		if (Position >= Size)
+		{
+			COMMON_THROW(COutOfRange("Out of range: EraseUnordered() vector",
+				static_cast<int>(Position), TPair<size_t, size_t>(0, Size)));
+		}
+
+		EraseUnordered(Position, ShrinkBehavior);
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	template<typename FunctionType>
+	size_t TVector<T, GrowthType, ShrinkType>::EraseIf(FunctionType Predicate,
+		const EShrinkBehavior ShrinkBehavior)
+	{
+		return CompactFrom(0, [&](const size_t Index)
+			{ return Predicate(static_cast<const T&>(Buffer[Index])); },
+			ShrinkBehavior);
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	size_t
+	TVector<T, GrowthType, ShrinkType>::EraseIndices(
+		const TVector<size_t>& SortedPositions,
+		const EShrinkBehavior ShrinkBehavior)
+	{
+		if (SortedPositions.IsEmpty())
+		{
+			return 0;
+		}
+		ASSERT(SortedPositions.Back() < Size,
+			"EraseIndices() vector out of range");
+
+		const size_t Count = SortedPositions.GetSize();
+		size_t Next = 0;
+		return CompactFrom(SortedPositions[0], [&](const size_t Index)
+			{
+				if (Next == Count || SortedPositions[Next] != Index)
+				{
+					ASSERT(Next == Count || SortedPositions[Next] > Index,
+						"EraseIndices() positions are not sorted");
+					return false;
+				}
+				while (Next != Count && SortedPositions[Next] == Index)
+				{
+					++Next;
+				}
+				return true;
+			}, ShrinkBehavior);
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	size_t
+	TVector<T, GrowthType, ShrinkType>::SafeEraseIndices(
+		const TVector<size_t>& SortedPositions,
+		const EShrinkBehavior ShrinkBehavior)
+	{
+		for (size_t i = 0; i < SortedPositions.GetSize(); ++i)
+		{
+			if (SortedPositions[i] >= Size)
+			{
+				COMMON_THROW(COutOfRange("Out of range: EraseIndices() vector",
+					static_cast<int>(SortedPositions[i]),
+					TPair<size_t, size_t>(0, Size)));
+			}
+			if (i && SortedPositions[i] < SortedPositions[i - 1])
+			{
+				COMMON_THROW(COutOfRange("EraseIndices() positions are not sorted"));
+			}
+		}
+
+		return EraseIndices(SortedPositions, ShrinkBehavior);
+	}
+
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void TVector<T, GrowthType, ShrinkType>::Reserve(const size_t NewCapacity)
+	{
+		InvalidateIterators();
 		if (NewCapacity >= Size)
 		{
 			if (NewCapacity)
@@ -664,17 +938,43 @@ namespace Common
 	}
 
 
-	template<typename T>
-	void TVector<T>::Resize(const size_t NewSize, const T& DefaultValue,
+	template <typename T, typename GrowthType, typename ShrinkType>
+	EStatus
+	TVector<T, GrowthType, ShrinkType>::TryReserve(const size_t NewCapacity)
+	{
+		InvalidateIterators();
+		if (NewCapacity >= Size)
+		{
+			if (NewCapacity)
+			{
+				if (!TryReconstruct(Size, NewCapacity, Buffer, Size, Capacity))
+				{
+					return EStatus::BadAlloc;
+				}
+			}
+			else
+			{
+				Clear();
+			}
+		}
+		return EStatus::Ok;
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void
+	TVector<T, GrowthType, ShrinkType>::Resize(const size_t NewSize,
+		const T& DefaultValue,
 		const EShrinkBehavior ShrinkBehavior)
 	{
+		InvalidateIterators();
 		if (NewSize > Capacity)
 		{
 			Reconstruct(Size, CalcExtendedCapacity(NewSize),
 				Buffer, Size, Capacity);
 		}
 
-		try
+		COMMON_TRY
 		{
 			if (NewSize > Size)
 			{
@@ -685,10 +985,10 @@ namespace Common
 				DestructRange(NewSize, Size, Buffer);
 			}
 		}
-		catch (...)
+		COMMON_CATCH_ALL
 		{
 			AutoShrinkIfNeeded(ShrinkBehavior);
-			throw;
+			COMMON_RETHROW;
 		}
 
 		Size = NewSize;
@@ -696,10 +996,82 @@ namespace Common
 	}
 
 
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void TVector<T, GrowthType, ShrinkType>::ResizeDefaultInit(const size_t NewSize,
+		const EShrinkBehavior ShrinkBehavior)
+	{
+		InvalidateIterators();
+		if (NewSize > Capacity)
+		{
+			Reconstruct(Size, CalcExtendedCapacity(NewSize),
+				Buffer, Size, Capacity);
+		}
+
+		COMMON_TRY
+		{
+			if (NewSize > Size)
+			{
+				SafeDefaultConstruct(Size, NewSize, Buffer);
+			}
+			else
+			{
+				DestructRange(NewSize, Size, Buffer);
+			}
+		}
+		COMMON_CATCH_ALL
+		{
+			AutoShrinkIfNeeded(ShrinkBehavior);
+			COMMON_RETHROW;
+		}
+
+		Size = NewSize;
+		AutoShrinkIfNeeded(ShrinkBehavior);
+	}
+
 
-	template<typename T>
-	void TVector<T>::Swap(TVector<T>& Other) noexcept
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void
+	TVector<T, GrowthType, ShrinkType>::ResizeUninitialized(const size_t NewSize,
+		const EShrinkBehavior ShrinkBehavior)
+	{
+		InvalidateIterators();
+		static_assert(std::is_trivial<T>::value,
+			"ResizeUninitialized() requires trivial type");
+
+		if (NewSize > Capacity)
+		{
+			Reconstruct(Size, CalcExtendedCapacity(NewSize),
+				Buffer, Size, Capacity);
+		}
+		Size = NewSize;
+		AutoShrinkIfNeeded(ShrinkBehavior);
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	T* TVector<T, GrowthType, ShrinkType>::AppendUninitialized(const size_t Count)
+	{
+		InvalidateIterators();
+		static_assert(std::is_trivial<T>::value,
+			"AppendUninitialized() requires trivial type");
+
+		if (Size + Count > Capacity)
+		{
+			Reconstruct(Size, CalcExtendedCapacity(Size + Count),
+				Buffer, Size, Capacity);
+		}
+		T* const Tail = Buffer + Size;
+		Size += Count;
+		return Tail;
+	}
+
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void TVector<T, GrowthType, ShrinkType>::Swap(TVector& Other) noexcept
 	{
+		InvalidateIterators();
+		Other.InvalidateIterators();
 		Common::Swap(Other.Buffer, this->Buffer);
 		Common::Swap(Other.Capacity, this->Capacity);
 		Common::Swap(Other.Size, this->Size);
@@ -707,9 +1079,10 @@ namespace Common
 
 
 
-	template<typename T>
-	void TVector<T>::ShrinkToFit()
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void TVector<T, GrowthType, ShrinkType>::ShrinkToFit()
 	{
+		InvalidateIterators();
 		if (Size == Capacity)
 		{
 			return;
@@ -726,9 +1099,10 @@ namespace Common
 	}
 
 
-	template<typename T>
-	void TVector<T>::Clear(EShrinkBehavior ShrinkBehavior)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void TVector<T, GrowthType, ShrinkType>::Clear(EShrinkBehavior ShrinkBehavior)
 	{
+		InvalidateIterators();
 		DestructAll(Size, Buffer);
 		Size = 0;
 		if (ShrinkBehavior == EShrinkBehavior::Require)
@@ -744,45 +1118,45 @@ namespace Common
 
 
 
-	template<typename T>
-	size_t TVector<T>::GetSize() const noexcept
+	template <typename T, typename GrowthType, typename ShrinkType>
+	size_t TVector<T, GrowthType, ShrinkType>::GetSize() const noexcept
 	{
 		return Size;
 	}
 
 
-	template<typename T>
-	size_t TVector<T>::GetCapacity() const noexcept
+	template <typename T, typename GrowthType, typename ShrinkType>
+	size_t TVector<T, GrowthType, ShrinkType>::GetCapacity() const noexcept
 	{
 		return Capacity;
 	}
 
-	template<typename T>
-	bool TVector<T>::IsEmpty() const noexcept
+	template <typename T, typename GrowthType, typename ShrinkType>
+	bool TVector<T, GrowthType, ShrinkType>::IsEmpty() const noexcept
 	{
 		return Size == 0;
 	}
 
 
-	template<typename T>
-	void TVector<T>::SetCapacityRule(
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void TVector<T, GrowthType, ShrinkType>::SetCapacityRule(
 		const EReservedCapacityRule CapacityRule) noexcept
 	{
 		this->CapacityRule = CapacityRule;
 	}
 
 
-	template<typename T>
-	typename TVector<T>::EReservedCapacityRule
-		TVector<T>::GetCapacityRule() const noexcept
+	template <typename T, typename GrowthType, typename ShrinkType>
+	typename TVector<T, GrowthType, ShrinkType>::EReservedCapacityRule
+		TVector<T, GrowthType, ShrinkType>::GetCapacityRule() const noexcept
 	{
 		return CapacityRule;
 	}
 
 
 
-	template<typename T>
-	T& TVector<T>::Front()
+	template <typename T, typename GrowthType, typename ShrinkType>
+	T& TVector<T, GrowthType, ShrinkType>::Front()
 	{
 		ASSERT(Size, "Front() operation on empty vector");
 
@@ -790,20 +1164,27 @@ namespace Common
 	}
 
 
-	template<typename T>
-	T& TVector<T>::SafeFront()
+	template <typename T, typename GrowthType, typename ShrinkType>
+	T& TVector<T, GrowthType, ShrinkType>::SafeFront()
 	{
 		if (!Size)
 		{
-			throw COutOfRange("Front() operation on empty vector");
+			COMMON_THROW(COutOfRange("Front() operation on empty vector"));
 		}
 
 		return Front();
 	}
 
 
-	template<typename T>
-	T& TVector<T>::Back()
+	template <typename T, typename GrowthType, typename ShrinkType>
+	T* TVector<T, GrowthType, ShrinkType>::TryFront() noexcept
+	{
+		return Size ? Buffer : nullptr;
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	T& TVector<T, GrowthType, ShrinkType>::Back()
 	{
 		ASSERT(Size, "Back() operation on empty vector");
 
@@ -811,80 +1192,230 @@ namespace Common
 	}
 
 
-	template<typename T>
-	T& TVector<T>::SafeBack()
+	template <typename T, typename GrowthType, typename ShrinkType>
+	T& TVector<T, GrowthType, ShrinkType>::SafeBack()
 	{
 		if (!Size)
 		{
-			throw COutOfRange("Back() operation on empty vector");
+			COMMON_THROW(COutOfRange("Back() operation on empty vector"));
 		}
 
 		return Back();
 	}
 
 
+	template <typename T, typename GrowthType, typename ShrinkType>
+	T* TVector<T, GrowthType, ShrinkType>::TryBack() noexcept
+	{
+		return Size ? Buffer + Size - 1 : nullptr;
+	}
+
+
 
-	template<typename T>
-	size_t TVector<T>::CalcExtendedCapacity(const size_t NewSize)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	size_t
+	TVector<T, GrowthType, ShrinkType>::CalcExtendedCapacity(const size_t NewSize)
 	{
-		// no switch case for optimization
-		// as first condition is almost always true
-		if (CapacityRule ==
-			EReservedCapacityRule::Exponential)
-		{	// Capacity is never calculated for size==0; omitting that
-			return NewSize >= 2 ? (NewSize - 1) * 2 : 2;
+		if (CapacityRule == EReservedCapacityRule::NeverReserve)
+		{
+			return NewSize;
 		}
-		if (CapacityRule ==
-			EReservedCapacityRule::Linear)
+		return GrowthType::CalcExtendedCapacity(NewSize, sizeof(T),
+			CapacityRule);
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	template<typename IteratorType>
+	void
+	TVector<T, GrowthType, ShrinkType>::ReconstructWithGap(const size_t Position,
+		const IteratorType Begin, const IteratorType End, const size_t Distance)
+	{
+		const size_t NewCapacity = CalcExtendedCapacity(Size + Distance);
+		T* NewBuffer;
+		Allocate(NewCapacity, NewBuffer);
+		MoveWithGap(NewBuffer, NewCapacity, Position, Begin, End, Distance);
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	template<typename IteratorType>
+	bool
+	TVector<T, GrowthType, ShrinkType>::TryReconstructWithGap(
+		const size_t Position, const IteratorType Begin,
+		const IteratorType End, const size_t Distance)
+	{
+		const size_t NewCapacity = CalcExtendedCapacity(Size + Distance);
+		T* NewBuffer;
+		if (!TryAllocate(NewCapacity, NewBuffer))
 		{
-			return NewSize + 3 + 32 / sizeof(T);
+			return false;
 		}
-		return NewSize;
+		MoveWithGap(NewBuffer, NewCapacity, Position, Begin, End, Distance);
+		return true;
 	}
 
 
-	template<typename T>
-	void TVector<T>::AutoShrinkIfNeeded(EShrinkBehavior ShrinkBehavior)
+	template <typename T, typename GrowthType, typename ShrinkType>
+	template<typename IteratorType>
+	void
+	TVector<T, GrowthType, ShrinkType>::MoveWithGap(T* NewBuffer,
+		const size_t NewCapacity, const size_t Position,
+		const IteratorType Begin, const IteratorType End, const size_t Distance)
 	{
-		// no switch case for optimization
-		// as first conditions are almost always true
+		// Step 1: Copy inserted elements into the gap. Old buffer is
+		// still intact, so source may point into this vector
+		// Note: vector is not changed if copy construction fails
+		COMMON_TRY
+		{
+			SafeBulkConstruct(Position, Begin, End, NewBuffer);
+		}
+		COMMON_CATCH_ALL
+		{
+			Deallocate(NewBuffer);
+			COMMON_RETHROW;
+		}
+
+		// Step 2: Move prefix and suffix to their final slots
+		// Note: clears vector if Move construction fails
+		COMMON_TRY
+		{
+			SafeMoveBlock(Position, Buffer, NewBuffer);
+		}
+		COMMON_CATCH_ALL
+		{
+			DestructRange(Position, Position + Distance, NewBuffer);
+			DestructRange(Position, Size, Buffer);
+			Deallocate(NewBuffer);
+			Size = 0;
+			AutoShrinkIfNeeded(EShrinkBehavior::Allow);
+			COMMON_RETHROW;
+		}
+		COMMON_TRY
+		{
+			SafeMoveBlock(Size - Position, Buffer + Position,
+				NewBuffer + Position + Distance);
+		}
+		COMMON_CATCH_ALL
+		{
+			DestructRange(0, Position + Distance, NewBuffer);
+			Deallocate(NewBuffer);
+			Size = 0;
+			AutoShrinkIfNeeded(EShrinkBehavior::Allow);
+			COMMON_RETHROW;
+		}
 
-		if (ShrinkBehavior == EShrinkBehavior::Allow)
+		if (Buffer)
 		{
+			RecordReallocation<T>(Size);
+		}
+		Deallocate(Buffer);
+		Buffer = NewBuffer;
+		Capacity = NewCapacity;
+		Size += Distance;
+		InvalidateIterators();
+	}
+
 
-			if (CapacityRule == EReservedCapacityRule::Exponential)
+	// Invariant: [0: Kept) are alive, [Kept: i) are destructed,
+	// [i: Size) are alive and were not checked yet
+	template <typename T, typename GrowthType, typename ShrinkType>
+	template<typename FunctionType>
+	size_t TVector<T, GrowthType, ShrinkType>::CompactFrom(const size_t Position,
+		FunctionType ShouldErase, const EShrinkBehavior ShrinkBehavior)
+	{
+		InvalidateIterators();
+		size_t Kept = Position;
+		size_t i = Position;
+		COMMON_TRY
+		{
+			while (i < Size)
 			{
-				// if capacity exceeds 4*size and is
-				// not small, dealloc half of it. 
-				if (Capacity >= 4 * Size &&
-					Capacity >= 2 + 16 / sizeof(T))
+				if (ShouldErase(i))
 				{
-					Reconstruct(Size, Size * 2, Buffer, Size, Capacity);
+					Destruct(i, Buffer);
 				}
+				else
+				{
+					if (Kept != i)
+					{
+						Construct(Kept, Buffer, Move(Buffer[i]));
+						Destruct(i, Buffer);
+					}
+					++Kept;
+				}
+				++i;
 			}
-
-			else if (CapacityRule == EReservedCapacityRule::Linear)
+		}
+		COMMON_CATCH_ALL
+		{
+			// close the gap, so unchecked elements stay in vector
+			if (Kept != i)
 			{
-				// if capacity exceeds size by > 2 chunks,
-				// leave one empty chunk
-				if (Capacity - Size >= 8 + 64 / sizeof(T))
+				COMMON_TRY
+				{
+					SafeMoveBlock(Size - i, Buffer + i, Buffer + Kept);
+				}
+				COMMON_CATCH_ALL
 				{
-					Reconstruct(Size, Size + 4 + 32 / sizeof(T),
-						Buffer, Size, Capacity);
+					Size = Kept;	// SafeMoveBlock destructed the rest
+					AutoShrinkIfNeeded(ShrinkBehavior);
+					COMMON_RETHROW;
 				}
 			}
+			Size = Kept + (Size - i);
+			AutoShrinkIfNeeded(ShrinkBehavior);
+			COMMON_RETHROW;
+		}
+
+		const size_t Erased = Size - Kept;
+		Size = Kept;
+		AutoShrinkIfNeeded(ShrinkBehavior);
+		return Erased;
+	}
 
-			else
-			{
-				ShrinkToFit();
-			}
 
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void
+	TVector<T, GrowthType, ShrinkType>::AutoShrinkIfNeeded(
+		EShrinkBehavior ShrinkBehavior)
+	{
+		if (ShrinkBehavior == EShrinkBehavior::Require ||
+			(ShrinkBehavior == EShrinkBehavior::Allow &&
+			CapacityRule == EReservedCapacityRule::NeverReserve))
+		{
+			TryShrinkTo(Size);
 		}
 
-		else if (ShrinkBehavior == EShrinkBehavior::Require)
+		else if (ShrinkBehavior == EShrinkBehavior::Allow)
 		{
-			ShrinkToFit();
+			TryShrinkTo(ShrinkType::CalcShrinkedCapacity(
+				Size, Capacity, sizeof(T), CapacityRule));
+		}
+	}
+
+
+	template <typename T, typename GrowthType, typename ShrinkType>
+	void
+	TVector<T, GrowthType, ShrinkType>::TryShrinkTo(const size_t NewCapacity)
+	{
+		if (NewCapacity == Capacity)
+		{
+			return;
+		}
+
+		const size_t OldCapacity = Capacity;
+		if (NewCapacity)
+		{
+			// shrink is optional; keep memory if allocation failed
+			TryReconstruct(Size, NewCapacity, Buffer, Size, Capacity);
+		}
+		else
+		{
+			Deallocate(Buffer);
+			Capacity = 0;
 		}
+		RecordShrink<T>(OldCapacity, Capacity);
 	}
 
 }
\ No newline at end of file
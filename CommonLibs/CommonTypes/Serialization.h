@@ -0,0 +1,198 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>	// memcpy
+#include <type_traits>
+
+#include "Exception.h"
+#include "Pair.h"
+#include "Optional.h"
+#include "Vector.h"
+#include "List.h"
+#include "../CommonUtils/Intrinsics.h"	// COMMON_LITTLE_ENDIAN
+#include "./../CommonUtils/BufferedStream.h"
+
+namespace Common
+{
+
+	/*
+	 * Compact binary format:
+	 *	- arithmetic types and enums: little-endian, sizeof(T) bytes;
+	 *	  bool is one byte 0 or 1
+	 *	- lengths: unsigned LEB128 (7 bits per byte, 1 byte below 128)
+	 *	- TPair: First, then Second
+	 *	- TOptional: byte 0 (empty) or 1 followed by value
+	 *	- TVector, TList: length, then elements
+	 *
+	 * Writer is any class with Write(const void*, size_t) that throws
+	 * on failure (TBufferedWriter), reader is any class with
+	 * Read(void*, size_t) (TBufferedReader). Read errors throw
+	 * CIOError, malformed data throws CBadFormat.
+	*/
+
+
+	/**
+	 * @brief Describes how T is written and read.
+	 *
+	 * Specialize it for own types with two static methods:
+	 *	template <typename WriterType>
+	 *	static void Write(WriterType& Writer, const T& Value);
+	 *	template <typename ReaderType>
+	 *	static void Read(ReaderType& Reader, T& OutValue);
+	 * and bBitwise = false. Or derive from TBitwiseSerializer<T>.
+	 *
+	 * bBitwise means that the encoding equals memory of T, so arrays
+	 * are written and read with one memcpy-like block.
+	*/
+	template <typename T, typename Enable = void>
+	struct TSerializer;
+
+
+	/**
+	 * @brief TSerializer for records that are stored as raw memory.
+	 *
+	 * Use for trivially copyable structs without padding:
+	 *	template <> struct TSerializer<CPoint>
+	 *		: TBitwiseSerializer<CPoint> {};
+	 *
+	 * @note Layout and byte order of the struct become the format.
+	*/
+	template <typename T>
+	struct TBitwiseSerializer
+	{
+		static_assert(std::is_trivially_copyable<T>::value,
+			"Bitwise serialization requires trivially copyable type");
+
+		static constexpr bool bBitwise = true;
+
+		template <typename WriterType>
+		static void Write(WriterType& Writer, const T& Value);
+
+		template <typename ReaderType>
+		static void Read(ReaderType& Reader, T& OutValue);
+	};
+
+
+	/**
+	 * @brief Writes value in binary format.
+	 * @param Writer Destination (TBufferedWriter)
+	 * @param Value Value that has TSerializer
+	*/
+	template <typename WriterType, typename T>
+	void Serialize(WriterType& Writer, const T& Value);
+
+	/**
+	 * @brief Reads value written by Serialize().
+	 * @param Reader Source (TBufferedReader)
+	 * @param OutValue Receives value. Is valid, but unspecified if
+	 *		  reading fails
+	 * @note Throws CBadFormat if data is malformed or ends early.
+	 *		 Containers allocate memory for the stored length at once,
+	 *		 so a corrupted length may throw CBadAlloc instead.
+	*/
+	template <typename ReaderType, typename T>
+	void Deserialize(ReaderType& Reader, T& OutValue);
+
+
+	/// Writes unsigned integer in LEB128 (1 to 10 bytes).
+	template <typename WriterType>
+	void WriteVarUInt(WriterType& Writer, uint64_t Value);
+
+	/// Reads unsigned integer written by WriteVarUInt().
+	template <typename ReaderType>
+	uint64_t ReadVarUInt(ReaderType& Reader);
+
+
+
+	template <typename T>
+	struct TSerializer<T, typename std::enable_if<(std::is_arithmetic<T>::value
+		|| std::is_enum<T>::value) && !std::is_same<T, bool>::value>::type>
+	{
+		static constexpr bool bBitwise = COMMON_LITTLE_ENDIAN || sizeof(T) == 1;
+
+		template <typename WriterType>
+		static void Write(WriterType& Writer, const T& Value);
+
+		template <typename ReaderType>
+		static void Read(ReaderType& Reader, T& OutValue);
+	};
+
+
+	template <>
+	struct TSerializer<bool>
+	{
+		static constexpr bool bBitwise = false;	// other bytes are not bool
+
+		template <typename WriterType>
+		static void Write(WriterType& Writer, bool Value);
+
+		template <typename ReaderType>
+		static void Read(ReaderType& Reader, bool& OutValue);
+	};
+
+
+	template <typename T1, typename T2>
+	struct TSerializer<TPair<T1, T2>>
+	{
+		// pair without padding is stored as its memory
+		static constexpr bool bBitwise = TSerializer<T1>::bBitwise &&
+			TSerializer<T2>::bBitwise &&
+			sizeof(TPair<T1, T2>) == sizeof(T1) + sizeof(T2);
+
+		template <typename WriterType>
+		static void Write(WriterType& Writer, const TPair<T1, T2>& Value);
+
+		template <typename ReaderType>
+		static void Read(ReaderType& Reader, TPair<T1, T2>& OutValue);
+	};
+
+
+	template <typename T, typename NicheType>
+	struct TSerializer<TOptional<T, NicheType>>
+	{
+		static constexpr bool bBitwise = false;
+
+		template <typename WriterType>
+		static void Write(WriterType& Writer,
+			const TOptional<T, NicheType>& Value);
+
+		template <typename ReaderType>
+		static void Read(ReaderType& Reader,
+			TOptional<T, NicheType>& OutValue);
+	};
+
+
+	/// Bitwise elements are written and read as one block.
+	template <typename T, typename GrowthType, typename ShrinkType>
+	struct TSerializer<TVector<T, GrowthType, ShrinkType>>
+	{
+		static constexpr bool bBitwise = false;
+
+		template <typename WriterType>
+		static void Write(WriterType& Writer,
+			const TVector<T, GrowthType, ShrinkType>& Value);
+
+		/// Allocates memory once, before elements are read.
+		template <typename ReaderType>
+		static void Read(ReaderType& Reader,
+			TVector<T, GrowthType, ShrinkType>& OutValue);
+	};
+
+
+	template <typename T>
+	struct TSerializer<TList<T>>
+	{
+		static constexpr bool bBitwise = false;
+
+		template <typename WriterType>
+		static void Write(WriterType& Writer, const TList<T>& Value);
+
+		template <typename ReaderType>
+		static void Read(ReaderType& Reader, TList<T>& OutValue);
+	};
+
+}
+
+#include "Private/Serialization.tpp"
\ No newline at end of file
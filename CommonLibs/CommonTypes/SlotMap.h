@@ -0,0 +1,217 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstdint>
+
+#include "Span.h"
+#include "Vector.h"
+#include "Exception.h"
+#include "./../CommonUtils/Hash.h"
+#include "./../CommonUtils/Assert.h"
+
+namespace Common
+{
+
+	/**
+	 * @brief Handle of a value in TSlotMap: slot index and its version.
+	 *
+	 * Default handle is null, it never refers to a value.
+	*/
+	struct CSlotHandle
+	{
+		uint32_t Index = 0;
+		uint32_t Version = 0;	// odd while the slot is occupied
+
+		/// True for default-constructed handle.
+		bool IsNull() const noexcept
+		{
+			return Version == 0;
+		}
+
+		bool operator == (const CSlotHandle& Other) const noexcept
+		{
+			return Index == Other.Index && Version == Other.Version;
+		}
+
+		bool operator != (const CSlotHandle& Other) const noexcept
+		{
+			return !(*this == Other);
+		}
+	};
+
+	template <>
+	struct THash<CSlotHandle>
+	{
+		size_t operator () (const CSlotHandle& Value) const noexcept
+		{
+			return static_cast<size_t>(MixBits(
+				(static_cast<uint64_t>(Value.Version) << 32) | Value.Index));
+		}
+	};
+
+
+	/**
+	 * @brief Container that gives out stable handles to its values.
+	 *
+	 * Values are stored densely in TVector, so iteration over them is
+	 * as fast as over plain array. Handle points to a slot, the slot
+	 * keeps the current position of the value. Erase moves the last
+	 * value into the gap (EraseUnordered) and fixes its slot, so
+	 * insertion, erase and lookup are O(1).
+	 *
+	 * Every slot has a version that changes when the value is erased,
+	 * so handles of erased values become stale: Find() returns nullptr
+	 * for them even if the slot was reused. Free slots are reused in
+	 * LIFO order. Slot whose version would wrap around is retired.
+	 *
+	 * @note Order of values changes on Erase. Pointers and spans are
+	 *		 valid until the next Insert, Erase, Clear or Reserve;
+	 *		 handles are valid until their value is erased.
+	 * @note Erase and Clear keep memory, use ShrinkToFit() to free it.
+	 * @tparam T Type of value, must be copy and move constructible
+	*/
+	template <typename T>
+	class TSlotMap
+	{
+
+	public:
+
+		/// Creates empty map (nothing is allocated).
+		TSlotMap() = default;
+
+
+		/**
+		 * @brief Adds a value.
+		 * @param Value Value to copy into the map
+		 * @return Handle of the value
+		 * @throw CBadAlloc if 2^32 - 1 slots are already used
+		*/
+		CSlotHandle Insert(const T& Value);
+
+		/**
+		 * @brief Removes value, last value takes its position.
+		 * @param Handle Handle returned by Insert()
+		 * @return False if handle is stale or null
+		*/
+		bool Erase(CSlotHandle Handle);
+
+		/**
+		 * @brief Finds value by handle.
+		 * @param Handle Handle returned by Insert()
+		 * @return Pointer to the value, nullptr if handle is stale
+		*/
+		T* Find(CSlotHandle Handle) noexcept;
+
+		/// Find() for const maps.
+		const T* Find(CSlotHandle Handle) const noexcept
+		{
+			return const_cast<TSlotMap*>(this)->Find(Handle);
+		}
+
+		/// Checks if handle refers to a value of the map.
+		bool Contains(CSlotHandle Handle) const noexcept;
+
+		/**
+		 * @brief Provides access to the value.
+		 * @param Handle Handle of a value that is in the map
+		 * @return Reference to the value
+		*/
+		T& operator [] (CSlotHandle Handle);
+
+		/// Index operator for const maps.
+		const T& operator [] (CSlotHandle Handle) const
+		{
+			return const_cast<TSlotMap*>(this)->operator[](Handle);
+		}
+
+		/// [] that throws CDoesNotExist for stale handle.
+		T& SafeAt(CSlotHandle Handle);
+
+		/// SafeAt() for const maps.
+		const T& SafeAt(CSlotHandle Handle) const
+		{
+			return const_cast<TSlotMap*>(this)->SafeAt(Handle);
+		}
+
+
+		/// All values in storage order.
+		TSpan<T> GetValues() noexcept;
+
+		/// GetValues() for const maps.
+		TSpan<const T> GetValues() const noexcept;
+
+		/**
+		 * @brief Gives handle of a value by its position in storage.
+		 * @param Position Index in GetValues(), less than size
+		 * @return Handle of the value
+		*/
+		CSlotHandle GetHandle(size_t Position) const;
+
+		/**
+		 * @brief Calls function for every value in storage order.
+		 * @tparam FunctionType void(CSlotHandle, T&)
+		 * @param Function Function to call, must not modify the map
+		*/
+		template <typename FunctionType>
+		void ForEach(FunctionType Function);
+
+		/// ForEach() for const maps, FunctionType is void(CSlotHandle, const T&).
+		template <typename FunctionType>
+		void ForEach(FunctionType Function) const;
+
+
+		/**
+		 * @brief Allocates memory for the future values.
+		 * @param Count Number of values that fit without reallocation
+		*/
+		void Reserve(size_t Count);
+
+		/// Frees unused memory of values (slots are kept for handles).
+		void ShrinkToFit();
+
+		/// Removes all values (memory is kept), all handles become stale.
+		void Clear() noexcept;
+
+		/**
+		 * @brief Swaps two maps internally without deep copy.
+		 * @param Other Object to swap resources with
+		*/
+		void Swap(TSlotMap& Other) noexcept;
+
+
+		/// Number of values.
+		size_t GetSize() const noexcept;
+
+		/// Number of slots (values and free or retired slots).
+		size_t GetSlotCount() const noexcept;
+
+		/// Simple check if size of this map equals 0.
+		bool IsEmpty() const noexcept;
+
+	private:
+
+		static constexpr uint32_t NoSlot = uint32_t(-1);
+
+		struct CSlot
+		{
+			uint32_t Position;	// of the value, next free slot if free
+			uint32_t Version;
+		};
+
+		TVector<T> Values;
+		TVector<uint32_t> Owners;	// slot of every value
+		TVector<CSlot> Slots;
+		uint32_t FreeHead = NoSlot;
+
+		// bumps version, puts slot to the free list unless it is retired
+		void ReleaseSlot(uint32_t Index) noexcept;
+
+		// releases slots of all values, values must be cleared after
+		void ReleaseAll() noexcept;
+
+	};
+
+}
+
+#include "Private/SlotMap.tpp"
\ No newline at end of file
@@ -0,0 +1,396 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <type_traits>
+#include <utility>	// index_sequence
+
+#include "Exception.h"
+#include "CapacityPolicy.h"
+#include "Span.h"
+#include "Iterators/Row.h"
+#include "../CommonUtils/Assert.h"
+#include "./../CommonUtils/TypeOperations.h"	// Move, Swap, TTypeAt
+#include "./../CommonUtils/BlockAllocation.h"	// Allocate, construct, ...
+
+namespace Common
+{
+
+	/// Buffer of one TSoAVector field. Index makes every base unique.
+	template <size_t Index, typename T>
+	struct TSoAColumn
+	{
+		T* Buffer = nullptr;
+	};
+
+	/// Buffers of all TSoAVector fields. Used by TSoAVector only.
+	template <typename IndexSequence, typename... Fields>
+	struct TSoAColumns;
+
+	template <size_t... Indices, typename... Fields>
+	struct TSoAColumns<std::index_sequence<Indices...>, Fields...>
+		: TSoAColumn<Indices, Fields>...
+	{
+	};
+
+
+	/**
+	 * @brief Proxy that refers to one row of TSoAVector.
+	 *
+	 * Row is not stored as an object, so iterators and operator []
+	 * return this proxy. Assignment copies field values, it does not
+	 * rebind the proxy.
+	 *
+	 * @tparam OwnerType TSoAVector or const TSoAVector
+	*/
+	template <typename OwnerType>
+	class TSoARowReference
+	{
+
+	public:
+
+		TSoARowReference(OwnerType* Owner, size_t Row) noexcept;
+
+		TSoARowReference(const TSoARowReference& Other) = default;
+
+		/**
+		 * @brief Copies field values of another row to this row.
+		 * @param Other Row of this or another vector with same fields
+		 * @return Reference to this proxy
+		*/
+		template <typename OtherOwnerType>
+		const TSoARowReference& operator = (
+			const TSoARowReference<OtherOwnerType>& Other) const;
+
+		/// Copies field values of another row to this row.
+		const TSoARowReference& operator = (
+			const TSoARowReference& Other) const;
+
+		/**
+		 * @brief Provides access to the field of this row.
+		 * @tparam Index Index of field in TSoAVector's parameters
+		 * @return Reference to the field (const if owner is const)
+		*/
+		template <size_t Index>
+		decltype(auto) Get() const
+		{
+			return Owner->template At<Index>(Row);
+		}
+
+		/// Index of the row in vector.
+		size_t GetIndex() const noexcept;
+
+	private:
+
+		OwnerType* Owner;
+		size_t Row;
+
+		template <typename OtherOwnerType, size_t... Indices>
+		void CopyFields(const TSoARowReference<OtherOwnerType>& Other,
+			std::index_sequence<Indices...>) const;
+
+	};
+
+
+	/**
+	 * @brief Container of records that stores every field in its own
+	 *		  contiguous buffer (structure of arrays).
+	 *
+	 * TVector<TPair<A, B>> loads whole records into cache even if a
+	 * loop needs only A. TSoAVector<A, B> keeps all A's next to each
+	 * other and all B's next to each other, so scans over one field
+	 * read only that field, and GetColumn() gives TSpan that can be
+	 * passed to vectorized kernels.
+	 *
+	 * All columns share size and capacity. Capacity is managed with
+	 * EReservedCapacityRule, as in TVector (CRuleGrowth, CRuleShrink),
+	 * with the size of whole row as element size.
+	 *
+	 * Rows are accessed with At<Index>(Row), GetColumn<Index>(), or
+	 * with proxies TSoARowReference returned by [] and iterators.
+	 *
+	 * @note Fields must be nothrow move constructible and assignable:
+	 *		 columns are relocated one by one, and a failed move would
+	 *		 leave them inconsistent.
+	 * @tparam Fields Types of fields of one record
+	*/
+	template <typename... Fields>
+	class TSoAVector
+	{
+		static_assert(sizeof...(Fields) > 0, "SoA vector needs fields");
+		static_assert((std::is_nothrow_move_constructible<Fields>::value
+			&& ...) && (std::is_nothrow_move_assignable<Fields>::value
+			&& ...), "SoA vector fields must be nothrow movable");
+
+	public:
+
+		/// Number of fields (columns).
+		static constexpr size_t FieldCount = sizeof...(Fields);
+
+		/// Type of field with given index.
+		template <size_t Index>
+		using TField = typename TTypeAt<Index, Fields...>::Type;
+
+		/// Proxy reference to a row.
+		typedef TSoARowReference<TSoAVector> CRowReference;
+		/// Version of CRowReference for const vectors.
+		typedef TSoARowReference<const TSoAVector> CConstRowReference;
+
+		/// Row iterator. Implemented op-s: ++, +=, +, --, -=, -, ==, !=.
+		typedef Iterators::TRowIterator<TSoAVector*, CRowReference>
+			CIterator;
+		/// Version of CIterator for const vectors.
+		typedef Iterators::TRowIterator<const TSoAVector*,
+			CConstRowReference> CConstIterator;
+
+		/// Defines how extra Capacity is reserved.
+		typedef Common::EReservedCapacityRule EReservedCapacityRule;
+
+		/// Overrides CapacityRule for specific element removal case.
+		enum class EShrinkBehavior
+		{
+			/// Force reallocation if possible.
+			Require,
+
+			/// Inherits behavior from EReservedCapacityRule (default).
+			Allow,
+
+			/// Do not deallocate memory.
+			Deny
+		};
+
+
+		/// Creates empty vector.
+		TSoAVector() = default;
+
+		/**
+		 * @brief Copy constructor (deep copy).
+		 * @param Other Vector to create copy from
+		*/
+		TSoAVector(const TSoAVector& Other);
+
+		/**
+		 * @brief Move constructor.
+		 * @param Other Temporary object to get data from
+		*/
+		TSoAVector(TSoAVector&& Other) noexcept;
+
+		~TSoAVector();
+
+		/// Assignment operator (deep copy).
+		TSoAVector& operator = (const TSoAVector& Other);
+
+		/// Move assignment operator.
+		TSoAVector& operator = (TSoAVector&& Other) noexcept;
+
+
+		/**
+		 * @brief Adds one row to the end of vector.
+		 * @param Values Value of each field
+		*/
+		void Push(const Fields&... Values);
+
+		/**
+		 * @brief Inserts one row to the specified position.
+		 * @param Position Index where to insert
+		 * @param Values Value of each field
+		 * @note Position must not exceed Size
+		*/
+		void Insert(size_t Position, const Fields&... Values);
+
+		/**
+		 * @brief Removes one row from the end of vector.
+		 * @param ShrinkBehavior Optional. Describes how memory is freed
+		 * @note Vector must not be empty.
+		*/
+		void Pop(EShrinkBehavior ShrinkBehavior = EShrinkBehavior::Allow);
+
+		/**
+		 * @brief Removes row with specified position.
+		 * @param Position Position of row to be removed
+		 * @param ShrinkBehavior Optional. Describes how memory is freed
+		 * @note Position must be less than Size.
+		*/
+		void Erase(size_t Position,
+			EShrinkBehavior ShrinkBehavior = EShrinkBehavior::Allow);
+
+		/**
+		 * @brief Changes size of vector.
+		 * @param NewSize If less than Size, removes last rows,
+		 *		  otherwise adds value-initialized rows
+		 * @param ShrinkBehavior Optional. Describes how memory is freed
+		*/
+		void Resize(size_t NewSize,
+			EShrinkBehavior ShrinkBehavior = EShrinkBehavior::Allow);
+
+		/**
+		 * @brief Allocates rows internally for the future use.
+		 * @param NewCapacity If greater than size, will update capacity
+		*/
+		void Reserve(size_t NewCapacity);
+
+		/// Frees memory that is reserved for future rows.
+		void ShrinkToFit();
+
+		/// Removes all rows and frees memory.
+		void Clear() noexcept;
+
+		/**
+		 * @brief Swaps two vectors internally without deep copy.
+		 * @param Other Object to swap resources with
+		*/
+		void Swap(TSoAVector& Other) noexcept;
+
+
+		/// Number of rows.
+		size_t GetSize() const noexcept;
+
+		/// Number of rows that fit into allocated memory.
+		size_t GetCapacity() const noexcept;
+
+		/// Simple check if size of this vector equals 0.
+		bool IsEmpty() const noexcept;
+
+		/// Updates rule of memory management.
+		void SetCapacityRule(EReservedCapacityRule NewRule) noexcept;
+
+		/// Returns current rule of memory management.
+		EReservedCapacityRule GetCapacityRule() const noexcept;
+
+
+		/**
+		 * @brief Provides access to one field of a row.
+		 * @tparam Index Index of field
+		 * @param Row Index of row
+		 * @return Reference to the field
+		 * @note Row must be less than Size.
+		*/
+		template <size_t Index>
+		TField<Index>& At(size_t Row);
+
+		/// At() for const vectors.
+		template <size_t Index>
+		const TField<Index>& At(size_t Row) const
+		{
+			return const_cast<TSoAVector*>(this)->template At<Index>(Row);
+		}
+
+		/**
+		 * @brief Contiguous view of all values of one field.
+		 * @tparam Index Index of field
+		 * @return Span over Size values
+		 * @note Span is invalidated when vector reallocates.
+		*/
+		template <size_t Index>
+		TSpan<TField<Index>> GetColumn() noexcept;
+
+		/// GetColumn() for const vectors.
+		template <size_t Index>
+		TSpan<const TField<Index>> GetColumn() const noexcept
+		{
+			return const_cast<TSoAVector*>(this)->template GetColumn<Index>();
+		}
+
+		/**
+		 * @brief Proxy reference to the row.
+		 * @param Row Index of row
+		 * @return Proxy with Get<Index>() for fields
+		 * @note Row must be less than Size.
+		*/
+		CRowReference operator [] (size_t Row);
+
+		/// Index operator for const vectors.
+		CConstRowReference operator [] (size_t Row) const;
+
+
+		/// Iterator pointing to the first row.
+		CIterator Begin() noexcept;
+
+		/// Iterator pointing to the row after last.
+		CIterator End() noexcept;
+
+		/// Const iterator pointing to the first row.
+		CConstIterator ConstBegin() const noexcept;
+
+		/// Const iterator pointing to the row after last.
+		CConstIterator ConstEnd() const noexcept;
+
+		/// Begin() alias (for compatibity)
+		CIterator begin() { return Begin(); }
+		/// ConstBegin() alias (overloaded, for compatibity)
+		CConstIterator begin() const { return ConstBegin(); }
+		/// End() alias (for compatibity)
+		CIterator end() { return End(); }
+		/// ConstEnd() alias (overloaded, for compatibity)
+		CConstIterator end() const { return ConstEnd(); }
+
+	private:
+
+		typedef std::index_sequence_for<Fields...> CIndices;
+		typedef TSoAColumns<CIndices, Fields...> CColumns;
+
+		/// Bytes in one row, element size for capacity rules.
+		static constexpr size_t RowSize = (sizeof(Fields) + ...);
+
+		size_t Size = 0;
+		size_t Capacity = 0;
+		CColumns Columns;
+		EReservedCapacityRule CapacityRule =
+			EReservedCapacityRule::Exponential;
+
+		template <size_t Index>
+		static TField<Index>*& ColumnOf(CColumns& Target) noexcept;
+
+		template <size_t Index>
+		static TField<Index>* ColumnOf(const CColumns& Target) noexcept;
+
+		size_t CalcExtendedCapacity(size_t NewSize) const noexcept;
+		void AutoShrinkIfNeeded(EShrinkBehavior ShrinkBehavior);
+
+		// false and no changes if allocation failed
+		bool TryReallocate(size_t NewCapacity);
+		void Reallocate(size_t NewCapacity);
+
+		template <size_t... Indices>
+		static bool TryAllocateColumns(CColumns& Target,
+			size_t NewCapacity, std::index_sequence<Indices...>) noexcept;
+
+		template <size_t... Indices>
+		static void DeallocateColumns(CColumns& Target,
+			std::index_sequence<Indices...>) noexcept;
+
+		template <size_t... Indices>
+		void MoveColumns(CColumns& Target,
+			std::index_sequence<Indices...>) noexcept;
+
+		template <size_t... Indices>
+		static void ConstructRow(CColumns& Target, size_t Row,
+			std::index_sequence<Indices...>, const Fields&... Values);
+
+		void ConstructBack(const Fields&... Values);
+
+		template <size_t... Indices>
+		void CopyRows(const TSoAVector& Other,
+			std::index_sequence<Indices...>);
+
+		template <size_t... Indices>
+		void ConstructDefaultRows(size_t From, size_t To,
+			std::index_sequence<Indices...>);
+
+		template <size_t... Indices>
+		void RotateBackTo(size_t Position,
+			std::index_sequence<Indices...>) noexcept;
+
+		template <size_t... Indices>
+		void EraseRow(size_t Position,
+			std::index_sequence<Indices...>) noexcept;
+
+		template <size_t... Indices>
+		void DestructRows(size_t From, size_t To,
+			std::index_sequence<Indices...>) noexcept;
+
+	};
+
+}
+
+#include "Private/SoAVector.tpp"
\ No newline at end of file
@@ -0,0 +1,104 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Iterators/Block.h"
+#include "../CommonUtils/Assert.h"
+
+namespace Common
+{
+
+	/**
+	 * @brief Non-owning view of contiguous elements (pointer and size).
+	 *
+	 * Cheap to copy and pass by value. Use it to give a function access
+	 * to part of a container, or to a column of TSoAVector, without
+	 * telling which container it is. RawData() can be passed to
+	 * vectorized kernels directly.
+	 *
+	 * @note Span is invalidated when the owner reallocates its buffer.
+	 * @tparam T Element type; const T for read-only span
+	*/
+	template <typename T>
+	class TSpan
+	{
+
+	public:
+
+		typedef T value_type;	// Follow convention
+
+		/// Iterator. Implemented op-s: ++, +=, +, --, -=, -, ==, !=, =.
+		typedef Iterators::TBlockIterator<T*, T&> CIterator;
+
+		/// Creates empty span.
+		TSpan() = default;
+
+		/**
+		 * @brief Creates span over Size elements from Data.
+		 * @param Data Pointer to the first element
+		 * @param Size Number of elements
+		*/
+		TSpan(T* Data, size_t Size) noexcept;
+
+		/// Span of non-const elements can be used as span of const ones.
+		template <typename OtherT, typename = typename std::enable_if<
+			std::is_same<const OtherT, T>::value>::type>
+		TSpan(const TSpan<OtherT>& Other) noexcept
+			: TSpan(Other.RawData(), Other.GetSize()) {}
+
+
+		/**
+		 * @brief Provides access to the element.
+		 * @param Index aka offset value
+		 * @return Reference to the requested element
+		 * @note Index must be less than size.
+		*/
+		T& operator [] (size_t Index) const;
+
+		/**
+		 * @brief Creates span over part of this span.
+		 * @param Offset Index of the first element of subspan
+		 * @param Count Number of elements in subspan
+		 * @return Subspan, shares elements with this span
+		 * @note [Offset; Offset + Count) must be in range.
+		*/
+		TSpan Subspan(size_t Offset, size_t Count) const;
+
+		/// Subspan from Offset to the end.
+		TSpan Subspan(size_t Offset) const;
+
+
+		/// Pointer to the first element.
+		T* RawData() const noexcept;
+
+		/// Number of elements.
+		size_t GetSize() const noexcept;
+
+		/// Simple check if size equals 0.
+		bool IsEmpty() const noexcept;
+
+
+		/// Iterator pointing to the first elem.
+		CIterator Begin() const noexcept;
+
+		/// Iterator pointing to the elem after last.
+		CIterator End() const noexcept;
+
+		/// Begin() alias (for compatibity)
+		T* begin() const noexcept { return Data; }
+		/// End() alias (for compatibity)
+		T* end() const noexcept { return Data + Size; }
+
+	private:
+
+		T* Data = nullptr;
+		size_t Size = 0;
+
+	};
+
+}
+
+#include "Private/Span.tpp"
\ No newline at end of file
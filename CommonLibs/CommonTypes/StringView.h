@@ -0,0 +1,134 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstddef>
+
+#include "Span.h"
+#include "Iterators/Block.h"
+#include "../CommonUtils/Assert.h"
+#include "./../CommonUtils/RawString.h"	// FindRawByte
+
+namespace Common
+{
+
+	/**
+	 * @brief Non-owning view of characters (pointer and length).
+	 *
+	 * Does not need '\0' at the end, so it can point into the middle
+	 * of a buffer: TBufferedReader returns lines as views into its
+	 * buffer without copying them.
+	 *
+	 * @note View is invalidated when the owner of characters changes
+	 *		 or frees them.
+	 * @tparam CharType Character type (char)
+	*/
+	template <typename CharType>
+	class TStringView
+	{
+
+	public:
+
+		typedef CharType value_type;	// Follow convention
+
+		/// Iterator. Implemented op-s: ++, +=, +, --, -=, -, ==, !=, =.
+		typedef Iterators::TBlockIterator<const CharType*, const CharType&>
+			CIterator;
+
+		/// Returned by Find() if there is no such character.
+		static constexpr size_t NotFound = size_t(-1);
+
+
+		/// Creates empty view.
+		TStringView() = default;
+
+		/**
+		 * @brief Creates view over Size characters from Data.
+		 * @param Data Pointer to the first character
+		 * @param Size Number of characters
+		*/
+		TStringView(const CharType* Data, size_t Size) noexcept;
+
+		/**
+		 * @brief Creates view over null-terminated string.
+		 * @param NullTermString Characters that end with '\0'
+		 *		  ('\0' is not included into view)
+		*/
+		TStringView(const CharType* NullTermString) noexcept;
+
+
+		/**
+		 * @brief Provides access to the character.
+		 * @param Index aka offset value
+		 * @return Const reference to the character
+		 * @note Index must be less than size.
+		*/
+		const CharType& operator [] (size_t Index) const;
+
+		/**
+		 * @brief Creates view over part of this view.
+		 * @param Offset Index of the first character of subview
+		 * @param Count Number of characters in subview
+		 * @return Subview, shares characters with this view
+		 * @note [Offset; Offset + Count) must be in range.
+		*/
+		TStringView Subview(size_t Offset, size_t Count) const;
+
+		/// Subview from Offset to the end.
+		TStringView Subview(size_t Offset) const;
+
+		/**
+		 * @brief Finds the first occurrence of character.
+		 * @param Value Character to find
+		 * @param Offset Optional. Index where search starts
+		 * @return Index of character, NotFound if there is none
+		*/
+		size_t Find(CharType Value, size_t Offset = 0) const noexcept;
+
+		/// Checks if view begins with characters of Prefix.
+		bool StartsWith(TStringView Prefix) const noexcept;
+
+		/// Checks if views have same characters.
+		bool operator == (TStringView Other) const noexcept;
+
+		/// Checks if views have different characters.
+		bool operator != (TStringView Other) const noexcept;
+
+
+		/// Pointer to the first character.
+		const CharType* RawData() const noexcept;
+
+		/// Number of characters.
+		size_t GetSize() const noexcept;
+
+		/// Simple check if size equals 0.
+		bool IsEmpty() const noexcept;
+
+		/// View as span of characters.
+		operator TSpan<const CharType>() const noexcept
+		{
+			return TSpan<const CharType>(Data, Size);
+		}
+
+
+		/// Iterator pointing to the first character.
+		CIterator Begin() const noexcept;
+
+		/// Iterator pointing to the character after last.
+		CIterator End() const noexcept;
+
+		/// Begin() alias (for compatibity)
+		const CharType* begin() const noexcept { return Data; }
+		/// End() alias (for compatibity)
+		const CharType* end() const noexcept { return Data + Size; }
+
+	private:
+
+		const CharType* Data = nullptr;
+		size_t Size = 0;
+
+	};
+
+}
+
+#include "Private/StringView.tpp"
@@ -0,0 +1,105 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <type_traits>
+#include <utility>	// index_sequence
+
+#include "Pair.h"	// TCompressedElement
+#include "./../CommonUtils/TypeOperations.h"	// Forward, TTypeAt
+
+namespace Common
+{
+
+	/// Elements of TTuple. Used by TTuple only.
+	template <typename IndexSequence, typename... Types>
+	class TTupleStorage;
+
+	template <size_t... Indices, typename... Types>
+	class TTupleStorage<std::index_sequence<Indices...>, Types...>
+		: protected TCompressedElement<Types, Indices>...
+	{
+
+	protected:
+
+		TTupleStorage() = default;
+
+		template <typename... ArgTypes>
+		constexpr explicit TTupleStorage(ArgTypes&&... Args)
+			: TCompressedElement<Types, Indices>(Forward<ArgTypes>(Args))...
+		{}
+
+	};
+
+
+	/**
+	 * @brief Fixed set of values of different types.
+	 *
+	 * Layout follows TCompressedPair: empty types take no space, and
+	 * the tuple is trivially copyable (and trivially constructible)
+	 * if all types are.
+	 *
+	 * @tparam Types Types of values, may be empty
+	*/
+	template <typename... Types>
+	class TTuple
+		: private TTupleStorage<std::index_sequence_for<Types...>, Types...>
+	{
+
+		typedef TTupleStorage<std::index_sequence_for<Types...>, Types...>
+			CStorage;
+
+	public:
+
+		/// Number of values in tuple.
+		static constexpr size_t Size = sizeof...(Types);
+
+		/// Type of value with given index.
+		template <size_t Index>
+		using TElement = typename TTypeAt<Index, Types...>::Type;
+
+
+		/// Default-initialize all values.
+		TTuple() = default;
+
+		/**
+		 * @brief Creates tuple from values (copied or moved).
+		 * @param First Argument for the first value
+		 * @param Args One argument per each other value
+		 * @note Not used for TTuple argument, so copy of one-value
+		 *		 tuple calls copy constructor.
+		*/
+		template <typename FirstArgType, typename... ArgTypes,
+			typename = typename std::enable_if<
+			sizeof...(ArgTypes) + 1 == sizeof...(Types) &&
+			!std::is_same<std::decay_t<FirstArgType>, TTuple>::value>::type>
+		constexpr explicit TTuple(FirstArgType&& First, ArgTypes&&... Args);
+
+
+		/**
+		 * @brief Provides access to value.
+		 * @tparam Index Index of value
+		 * @return Reference to the value
+		*/
+		template <size_t Index>
+		TElement<Index>& Get() noexcept;
+
+		/// Get() for const tuples.
+		template <size_t Index>
+		const TElement<Index>& Get() const noexcept;
+
+	};
+
+
+
+	/**
+	 * @brief Creates tuple copying passed values.
+	 * @param Values Values of tuple
+	 * @return Tuple with types of values
+	*/
+	template <typename... Types>
+	inline constexpr TTuple<Types...> MakeTuple(const Types&... Values);
+
+}
+
+#include "Private/Tuple.tpp"
\ No newline at end of file
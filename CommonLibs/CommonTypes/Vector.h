@@ -8,6 +8,7 @@
 #include <type_traits>
 
 #include "Exception.h"
+#include "CapacityPolicy.h"
 #include "Iterators/Block.h"
 #include "../CommonUtils/Assert.h"
 #include "./../CommonUtils/TypeOperations.h"	// Move, Swap
@@ -31,6 +32,11 @@ namespace Common
 	 * EShrinkBehavior can be passed to every function that is supposed
 	 * to decrease TVector capacity, overriding EReservedCapacityRule
 	 * in terms of removing elements in this specific case.
+	 *
+	 * Formulas behind Exponential and Linear rules are provided by
+	 * GrowthType and ShrinkType policies (see CapacityPolicy.h), e.g.
+	 * TVector<T, COneAndHalfGrowth, THysteresisShrink<>>. Vectors with
+	 * different policies are different types.
 	 * 
 	 * Exception policy: Generally, TVector stays in the previous state if
 	 * operation fails. TVector is cleared if move construction of
@@ -46,6 +52,10 @@ namespace Common
 	 *
 	 * @note Underlying object must be copy and move constructible.
 	 *
+	 * @note Modifications that change size or buffer invalidate all
+	 *		 iterators. With COMMONLIBS_CHECKED_ITERATORS (on in Debug
+	 *		 configurations) using them throws CInvalidIterator.
+	 *
 	 * @todo In case of construction errors, do not decrease capacity 
 	 *		 unless CapacityRule is set to NeverReserve. 
 	 *		 Capacity management is not consistent now, especially if
@@ -60,8 +70,9 @@ namespace Common
 	 * 
 	 * @bug Object might be copied when it could be moved
 	*/
-	template <typename T>
-	class TVector
+	template <typename T, typename GrowthType = CRuleGrowth,
+		typename ShrinkType = CRuleShrink>
+	class TVector : private Iterators::CGenerationCounter
 	{
 
 	public:
@@ -78,43 +89,20 @@ namespace Common
 		typedef Iterators::TReverseBlockIterator<const T*, const T&>
 			CConstReverseIterator;
 		/// Iterator that does bounds checking and throws OutOfRange().
-		typedef Iterators::TSafeBlockIterator<T*, T&, TVector<T>*> CSafeIterator;
+		typedef Iterators::TSafeBlockIterator<T*, T&> CSafeIterator;
 		/// Version of TSafeIterator for const values.
-		typedef Iterators::TSafeBlockIterator<const T*, const T&, const  TVector<T>*>
+		typedef Iterators::TSafeBlockIterator<const T*, const T&>
 			CSafeConstIterator;
 		/// Reverse iterator that can throw OutOfRange().
-		typedef Iterators::TSafeReverseBlockIterator<T*, T&, TVector<T>*>
+		typedef Iterators::TSafeReverseBlockIterator<T*, T&>
 			CSafeReverseIterator;
 		/// Version of TSafeReverseIterator for const values.
-		typedef Iterators::TSafeReverseBlockIterator<const T*, const T&, const TVector<T>*>
+		typedef Iterators::TSafeReverseBlockIterator<const T*, const T&>
 			CSafeConstReverseIterator;
 
 
-		/// Defines how extra Capacity is reserved
-		enum class EReservedCapacityRule : uint8_t
-		{
-			/**
-			 * [ADD] allocates (NewSize-1)*2 if capacity
-			 * exceed and vector is not small enough <br>
-			 * [DEL] allocates 2*Size if Capacity > 4 * Size
-			 * and vector is not small enough
-			*/
-			Exponential,
-
-			/**
-			 * [ADD] allocates NewSize + 3 + 32 / sizeof(T) if
-			 * capacity exceed <br>
-			 * [DEL] allocates Size + 4 + 32 / sizeof(T) if size
-			 * exceeds capacity by more than 2*(8 + 64 / sizeof(T))
-			*/
-			Linear,
-
-			/**
-			 * [ADD, DEL] memory is never reserved automatically;
-			 * Decrease of vector size causes ShrinkToFit() immediately
-			*/
-			NeverReserve
-		};
+		/// Defines how extra Capacity is reserved.
+		typedef Common::EReservedCapacityRule EReservedCapacityRule;
 
 		/// Overrides CapacityRule for specific element removal case.
 		enum class EShrinkBehavior
@@ -201,13 +189,13 @@ namespace Common
 		 * @brief Initialize by copying another TVector.
 		 * @param Other vector to copy
 		*/
-		TVector(const TVector<T>& Other);
+		TVector(const TVector& Other);
 
 		/**
 		 * @brief Move constructor.
 		 * @param Other Temporary object to get data from
 		*/
-		TVector(TVector<T>&& Other) noexcept;
+		TVector(TVector&& Other) noexcept;
 
 		~TVector();
 
@@ -229,21 +217,21 @@ namespace Common
 		 * @param ValuesList Initializer list
 		 * @return Reference to this vector
 		*/
-		TVector<T>& operator = (const std::initializer_list<T>& ValuesList);
+		TVector& operator = (const std::initializer_list<T>& ValuesList);
 
 		/**
 		 * @brief Makes a copy of another vector.
 		 * @param Other vector
 		 * @return Reference to this vector
 		*/
-		TVector<T>& operator = (const TVector<T>& Other);
+		TVector& operator = (const TVector& Other);
 
 		/**
 		 * @brief Move assignment.
 		 * @param Other Temporary object to get data from
 		 * @return Reference to this vector
 		*/
-		TVector<T>& operator = (TVector<T>&& Other) noexcept;
+		TVector& operator = (TVector&& Other) noexcept;
 
 
 		/**
@@ -257,7 +245,7 @@ namespace Common
 		/// Index operator for const vectors.
 		const T& operator [] (size_t Index) const
 		{
-			return const_cast<TVector<T>*>(this)->operator[](Index);
+			return const_cast<TVector*>(this)->operator[](Index);
 		}
 
 		/// [] with range check.
@@ -266,7 +254,16 @@ namespace Common
 		/// SafeAt() for const vectors.
 		const T& SafeAt(size_t Index) const
 		{
-			return const_cast<TVector<T>*>(this)->SafeAt(Index);
+			return const_cast<TVector*>(this)->SafeAt(Index);
+		}
+
+		/// [] with range check that returns nullptr instead of throwing.
+		T* TryAt(size_t Index) noexcept;
+
+		/// TryAt() for const vectors.
+		const T* TryAt(size_t Index) const noexcept
+		{
+			return const_cast<TVector*>(this)->TryAt(Index);
 		}
 
 		////////////// TODO: add variant based on default ctor
@@ -291,7 +288,7 @@ namespace Common
 		/// RawData() for const vectors.
 		const T* RawData() const noexcept
 		{
-			return const_cast<TVector<T>*>(this)->RawData();
+			return const_cast<TVector*>(this)->RawData();
 		}
 
 
@@ -302,24 +299,32 @@ namespace Common
 		 * @return True if sizes and values are equal, false otherwise
 		 * @note Containing elements must implement == operator
 		*/
-		bool operator == (const TVector<T>& Other) const noexcept;
+		bool operator == (const TVector& Other) const noexcept;
 
 		/// Opposite to operator ==.
-		bool operator != (const TVector<T>& Other) const noexcept;
+		bool operator != (const TVector& Other) const noexcept;
 
 		/**
 		 * @brief Concatenates vectors (push 1 with 2)
 		 * @param Other Other vector to copy values from
 		 * @return Reference to this vector
 		*/
-		TVector<T>& operator += (const TVector<T>& Other);
+		TVector& operator += (const TVector& Other);
 
 		/**
 		 * @brief Concatenates vectors (push 1 with 2)
 		 * @param Other Other vector to copy values from
 		 * @return New vector, containing elements from both vectors
 		*/
-		TVector<T> operator + (const TVector<T>& Other) const;
+		TVector operator + (const TVector& Other) const &;
+
+		/**
+		 * @brief Concatenation for temporary vectors (e.g. A + B + C).
+		 *		  Appends to this vector instead of copying it again
+		 * @param Other Other vector to copy values from
+		 * @return This vector (moved), extended with Other's elements
+		*/
+		TVector operator + (const TVector& Other) &&;
 
 
 		/**
@@ -330,6 +335,14 @@ namespace Common
 		*/
 		void Push(const T& Value);
 
+		/**
+		 * @brief Push() that reports failures instead of throwing.
+		 * @param Value Element to add
+		 * @return EStatus::BadAlloc if memory could not be reserved.
+		 *		   Vector is not changed in that case.
+		*/
+		EStatus TryPush(const T& Value);
+
 		/**
 		 * @brief Adds multiple elements to the end via iterators.
 		 * @tparam IteratorType Iterator with implemented ++, != and *
@@ -350,6 +363,9 @@ namespace Common
 		/// Insert() with range check
 		void SafeInsert(size_t Position, const T& Value);
 
+		/// SafeInsert() that returns EStatus instead of throwing
+		EStatus TryInsert(size_t Position, const T& Value);
+
 		/**
 		 * @brief Inserts element, extends vector if range check failed
 		 * @param Position 
@@ -404,6 +420,10 @@ namespace Common
 		void SafePop(EShrinkBehavior ShrinkBehavior
 			= EShrinkBehavior::Allow);
 
+		/// SafePop() that returns EStatus instead of throwing
+		EStatus TryPop(EShrinkBehavior ShrinkBehavior
+			= EShrinkBehavior::Allow);
+
 		/// SafePop() that returns removed value
 		T SafePopGet(EShrinkBehavior ShrinkBehavior
 			= EShrinkBehavior::Allow);
@@ -428,6 +448,10 @@ namespace Common
 		void SafeShift(EShrinkBehavior ShrinkBehavior
 			= EShrinkBehavior::Allow);
 
+		/// SafeShift() that returns EStatus instead of throwing
+		EStatus TryShift(EShrinkBehavior ShrinkBehavior
+			= EShrinkBehavior::Allow);
+
 		/// SafeShift() that returns removed value
 		T SafeShiftGet(EShrinkBehavior ShrinkBehavior
 			= EShrinkBehavior::Allow);
@@ -456,6 +480,10 @@ namespace Common
 		void SafeErase(size_t Position,
 			EShrinkBehavior ShrinkBehavior = EShrinkBehavior::Allow);
 
+		/// SafeErase() that returns EStatus instead of throwing
+		EStatus TryErase(size_t Position,
+			EShrinkBehavior ShrinkBehavior = EShrinkBehavior::Allow);
+
 		/// SafeErase() that returns removed value
 		T SafeEraseGet(size_t Position,
 			EShrinkBehavior ShrinkBehavior = EShrinkBehavior::Allow);
@@ -474,6 +502,52 @@ namespace Common
 		void EraseMultiple(size_t PositionFrom, size_t PositionTo,
 			EShrinkBehavior ShrinkBehavior = EShrinkBehavior::Allow);
 
+		/**
+		 * @brief Removes element with specified position by moving the
+		 *		  last element into its place. Order is not preserved,
+		 *		  but only one element is moved
+		 * @param Position Position of element to be removed
+		 * @param ShrinkBehavior Optional. Describes how memory is freed
+		 * @note Position must be less than Size
+		*/
+		void EraseUnordered(size_t Position,
+			EShrinkBehavior ShrinkBehavior = EShrinkBehavior::Allow);
+
+		/// EraseUnordered() with range check
+		void SafeEraseUnordered(size_t Position,
+			EShrinkBehavior ShrinkBehavior = EShrinkBehavior::Allow);
+
+		/**
+		 * @brief Removes all elements that satisfy the predicate. Other
+		 *		  elements keep their order. Every element is moved at
+		 *		  most once and memory is reallocated at most once
+		 * @tparam FunctionType Callable object: bool(const T&)
+		 * @param Predicate Returns true for elements to be removed
+		 * @param ShrinkBehavior Optional. Describes how memory is freed
+		 * @return Number of removed elements
+		 * @note If Predicate throws, vector keeps all elements that
+		 *		 were not removed yet.
+		*/
+		template <typename FunctionType>
+		size_t EraseIf(FunctionType Predicate,
+			EShrinkBehavior ShrinkBehavior = EShrinkBehavior::Allow);
+
+		/**
+		 * @brief Removes elements with specified positions in one pass.
+		 *		  Other elements keep their order
+		 * @param SortedPositions Positions of elements to be removed,
+		 *		  in ascending order. Duplicates are ignored
+		 * @param ShrinkBehavior Optional. Describes how memory is freed
+		 * @return Number of removed elements
+		 * @note Every position must be less than Size.
+		*/
+		size_t EraseIndices(const TVector<size_t>& SortedPositions,
+			EShrinkBehavior ShrinkBehavior = EShrinkBehavior::Allow);
+
+		/// EraseIndices() with range and order check
+		size_t SafeEraseIndices(const TVector<size_t>& SortedPositions,
+			EShrinkBehavior ShrinkBehavior = EShrinkBehavior::Allow);
+
 
 		/**
 		 * @brief Allocates elements internally for the future use.
@@ -485,6 +559,15 @@ namespace Common
 		*/
 		void Reserve(size_t NewCapacity);
 
+		/**
+		 * @brief Reserve() that reports failures instead of throwing.
+		 * @param NewCapacity If greater than size, will update
+		 *		  internal capacity
+		 * @return EStatus::BadAlloc if memory could not be allocated.
+		 *		   Vector is not changed in that case.
+		*/
+		EStatus TryReserve(size_t NewCapacity);
+
 		/**
 		 * @brief Changes size of vector
 		 * @param NewSize New size of vector. If NewSize < Size, deletes
@@ -495,11 +578,45 @@ namespace Common
 		void Resize(size_t NewSize, const T& DefaultValue = {},
 			EShrinkBehavior ShrinkBehavior = EShrinkBehavior::Allow);
 
+		/**
+		 * @brief Changes size of vector. Added elements are default-
+		 *		  initialized: constructors of class types are called,
+		 *		  trivial types are left uninitialized
+		 * @param NewSize New size of vector. If NewSize < Size, deletes
+		 *		  last elements
+		 * @param ShrinkBehavior Optional. Describes how memory is freed
+		*/
+		void ResizeDefaultInit(size_t NewSize,
+			EShrinkBehavior ShrinkBehavior = EShrinkBehavior::Allow);
+
+		/**
+		 * @brief Changes size of vector without touching added elements.
+		 *		  Use it when the buffer is about to be overwritten
+		 *		  (e.g. by read()), so memory is not written twice
+		 * @param NewSize New size of vector. If NewSize < Size, deletes
+		 *		  last elements
+		 * @param ShrinkBehavior Optional. Describes how memory is freed
+		 * @note Available for trivial types only. Added elements have
+		 *		 indeterminate values until they are assigned.
+		*/
+		void ResizeUninitialized(size_t NewSize,
+			EShrinkBehavior ShrinkBehavior = EShrinkBehavior::Allow);
+
+		/**
+		 * @brief Adds Count uninitialized elements to the end of vector.
+		 * @param Count Number of elements to add
+		 * @return Pointer to the first added element. Valid until the
+		 *		   next operation that changes capacity
+		 * @note Available for trivial types only. Added elements have
+		 *		 indeterminate values until they are assigned.
+		*/
+		T* AppendUninitialized(size_t Count);
+
 		/**
 		 * @brief Swaps two vectors internally without deep copy.
 		 * @param Other Object to swap resources with
 		*/
-		void Swap(TVector<T>& Other) noexcept;
+		void Swap(TVector& Other) noexcept;
 
 		/**
 		 * @brief Clears memory that was reserved for future use.
@@ -563,7 +680,7 @@ namespace Common
 		/// Front() for const vectors.
 		const T& Front() const
 		{
-			return const_cast<TVector<T>*>(this)->Front();
+			return const_cast<TVector*>(this)->Front();
 		}
 
 		/// Front() with range check.
@@ -572,7 +689,16 @@ namespace Common
 		/// SafeFront() for const vectors.
 		const T& SafeFront() const
 		{
-			return const_cast<TVector<T>*>(this)->SafeFront();
+			return const_cast<TVector*>(this)->SafeFront();
+		}
+
+		/// Front() that returns nullptr for empty vector.
+		T* TryFront() noexcept;
+
+		/// TryFront() for const vectors.
+		const T* TryFront() const noexcept
+		{
+			return const_cast<TVector*>(this)->TryFront();
 		}
 
 
@@ -586,7 +712,7 @@ namespace Common
 		/// Back() for const vectors.
 		const T& Back() const
 		{
-			return const_cast<TVector<T>*>(this)->Back();
+			return const_cast<TVector*>(this)->Back();
 		}
 
 		/// Back() with range check.
@@ -595,7 +721,16 @@ namespace Common
 		/// SafeBack() for const vectors.
 		const T& SafeBack() const
 		{
-			return const_cast<TVector<T>*>(this)->SafeBack();
+			return const_cast<TVector*>(this)->SafeBack();
+		}
+
+		/// Back() that returns nullptr for empty vector.
+		T* TryBack() noexcept;
+
+		/// TryBack() for const vectors.
+		const T* TryBack() const noexcept
+		{
+			return const_cast<TVector*>(this)->TryBack();
 		}
 
 
@@ -731,14 +866,26 @@ namespace Common
 			EReservedCapacityRule::Exponential;
 
 		size_t CalcExtendedCapacity(size_t NewSize);
+
+		// shrinking is optional, so capacity is kept if allocation fails
 		void AutoShrinkIfNeeded(EShrinkBehavior ShrinkBehavior);
+		void TryShrinkTo(size_t NewCapacity);
 
+		template <typename IteratorType>
+		void ReconstructWithGap(size_t Position, IteratorType Begin,
+			IteratorType End, size_t Distance);
+
+		template <typename IteratorType>
+		bool TryReconstructWithGap(size_t Position, IteratorType Begin,
+			IteratorType End, size_t Distance);
+
+		template <typename IteratorType>
+		void MoveWithGap(T* NewBuffer, size_t NewCapacity, size_t Position,
+			IteratorType Begin, IteratorType End, size_t Distance);
 
-		friend CSafeIterator;
-		friend CSafeConstIterator;
-		friend CSafeReverseIterator;
-		friend CSafeConstReverseIterator;
-		
+		template <typename FunctionType>
+		size_t CompactFrom(size_t Position, FunctionType ShouldErase,
+			EShrinkBehavior ShrinkBehavior);
 	};
 
 }
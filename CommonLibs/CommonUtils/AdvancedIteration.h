@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <cstddef>	// size_t
+
 namespace Common 
 {
 
@@ -0,0 +1,147 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+// Opt-in: define COMMONLIBS_ALLOCATION_STATS for the whole project
+// (every translation unit) to collect statistics. Otherwise all
+// Record* hooks are empty and are removed by compiler.
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <typeinfo>		// type names
+
+namespace Common
+{
+
+#if defined(COMMONLIBS_ALLOCATION_STATS)
+	constexpr bool bAllocationStatsEnabled = true;
+#else
+	constexpr bool bAllocationStatsEnabled = false;
+#endif
+
+
+	/// Memory usage of containers with one underlying type.
+	struct CAllocationStats
+	{
+		/// Bucket K counts allocations of [2^K; 2^(K+1)) bytes
+		static constexpr size_t HistogramSize = 32;
+
+		const char* TypeName = nullptr;		// implementation-defined
+		size_t ElementSize = 0;
+
+		uint64_t Allocations = 0;			// TVector buffers
+		uint64_t Deallocations = 0;
+		uint64_t AllocatedBytes = 0;
+		uint64_t Reallocations = 0;			// buffer replaced by larger/smaller
+		uint64_t MovedBytes = 0;			// moved during reallocations
+		uint64_t Shrinks = 0;				// capacity decreased by shrink
+		uint64_t ShrinkedBytes = 0;			// capacity released by shrinks
+		uint64_t NodeAllocations = 0;		// TList nodes
+		uint64_t NodeDeallocations = 0;
+
+		uint64_t AllocationSizes[HistogramSize] = {};
+	};
+
+
+	/**
+	 * @brief Per-type counters behind hooks. Do not use directly.
+	 *
+	 * Counters are relaxed atomics, so containers may be used from
+	 * different threads; values of one snapshot are not synchronized.
+	*/
+	class CAllocationCounters
+	{
+
+	public:
+
+		CAllocationCounters(const char* TypeName,
+			size_t ElementSize) noexcept;	// registers itself
+
+		void AddAllocation(size_t Bytes) noexcept;
+		void AddDeallocation() noexcept;
+		void AddReallocation(size_t MovedBytes) noexcept;
+		void AddShrink(size_t ShrinkedBytes) noexcept;
+		void AddNodeAllocation() noexcept;
+		void AddNodeDeallocation() noexcept;
+
+		CAllocationStats GetStats() const noexcept;
+		void Reset() noexcept;
+
+	private:
+
+		const char* const TypeName;
+		const size_t ElementSize;
+
+		std::atomic<uint64_t> Allocations{ 0 };
+		std::atomic<uint64_t> Deallocations{ 0 };
+		std::atomic<uint64_t> AllocatedBytes{ 0 };
+		std::atomic<uint64_t> Reallocations{ 0 };
+		std::atomic<uint64_t> MovedBytes{ 0 };
+		std::atomic<uint64_t> Shrinks{ 0 };
+		std::atomic<uint64_t> ShrinkedBytes{ 0 };
+		std::atomic<uint64_t> NodeAllocations{ 0 };
+		std::atomic<uint64_t> NodeDeallocations{ 0 };
+		std::atomic<uint64_t>
+			AllocationSizes[CAllocationStats::HistogramSize] = {};
+
+		CAllocationCounters* Next = nullptr;	// registry list
+
+		friend size_t TakeAllocationSnapshot(CAllocationStats*,
+			size_t) noexcept;
+		friend void ResetAllocationStats() noexcept;
+		friend void PrintAllocationReport(std::ostream&);
+
+	};
+
+
+	/**
+	 * @brief Copies statistics of all types that were used since start.
+	 * @param OutStats Array to write to (may be nullptr if MaxCount is 0)
+	 * @param MaxCount Size of OutStats
+	 * @return Number of registered types, may exceed MaxCount.
+	 *		   Always 0 if statistics are disabled.
+	*/
+	size_t TakeAllocationSnapshot(CAllocationStats* OutStats,
+		size_t MaxCount) noexcept;
+
+	/**
+	 * @brief Statistics of containers with the underlying type T.
+	 * @return Copy of counters, zeroes if statistics are disabled
+	*/
+	template <typename T>
+	CAllocationStats GetAllocationStats() noexcept;
+
+	/// Sets all counters to 0. Types stay registered.
+	void ResetAllocationStats() noexcept;
+
+	/**
+	 * @brief Writes human-readable table with one line per type.
+	 * @param Stream Output stream
+	*/
+	void PrintAllocationReport(std::ostream& Stream);
+
+
+	// Hooks called by BlockAllocation, TVector and TList
+
+	template <typename T>
+	inline void RecordAllocation(size_t Count) noexcept;
+
+	template <typename T>
+	inline void RecordDeallocation() noexcept;
+
+	template <typename T>
+	inline void RecordReallocation(size_t MovedCount) noexcept;
+
+	template <typename T>
+	inline void RecordShrink(size_t OldCapacity, size_t NewCapacity) noexcept;
+
+	template <typename T>
+	inline void RecordNodeAllocation() noexcept;
+
+	template <typename T>
+	inline void RecordNodeDeallocation() noexcept;
+
+}
+
+#include "Private/AllocationStats.tpp"
\ No newline at end of file
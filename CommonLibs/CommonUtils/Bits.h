@@ -0,0 +1,49 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstddef>	// size_t
+#include <cstdint>
+
+#include "Intrinsics.h"	// PopCount, CountTrailingZeros
+
+namespace Common
+{
+
+	/// Number of bits in one word of bit containers.
+	constexpr size_t BitsPerWord = 64;
+
+	/// Number of 64-bit words that hold BitCount bits.
+	constexpr size_t GetBitWordCount(size_t BitCount) noexcept
+	{
+		return (BitCount + BitsPerWord - 1) / BitsPerWord;
+	}
+
+	/**
+	 * @brief Counts set bits in array of words.
+	 * @param Words Array of words
+	 * @param WordCount Number of words
+	 * @return Number of bits that equal 1
+	*/
+	size_t CountBits(const uint64_t* Words, size_t WordCount) noexcept;
+
+	/**
+	 * @brief Finds the first set bit at Position or after it.
+	 * @param Words Array of words, bit i is bit (i % 64) of word i / 64
+	 * @param WordCount Number of words
+	 * @param Position Index of bit to start from
+	 * @return Index of found bit, WordCount * 64 if there is none
+	*/
+	size_t FindNextBit(const uint64_t* Words, size_t WordCount,
+		size_t Position) noexcept;
+
+	/**
+	 * @brief Finds position of set bit by its number.
+	 * @param Word Word to search in
+	 * @param Rank Number of set bit (from 0, counted from the lowest)
+	 * @return Index of the bit in Word
+	 * @note Word must have more than Rank set bits.
+	*/
+	unsigned SelectBit(uint64_t Word, unsigned Rank) noexcept;
+
+}
\ No newline at end of file
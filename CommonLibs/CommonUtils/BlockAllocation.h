@@ -2,22 +2,32 @@
 
 #pragma once
 
+#include <cstring>	// memmove
 #include <new>
+#include <type_traits>
 
 #include "./../CommonTypes/Exception.h"
 #include "TypeOperations.h"	// Move, Swap
+#include "AllocationStats.h"	// Record* hooks
 
 namespace Common
 {
 	template <typename T>
 	inline void Allocate(size_t NewSize, T*& OutBuffer);
 
+	template <typename T>
+	inline bool TryAllocate(size_t NewSize,
+		T*& OutBuffer) noexcept;	// false instead of CBadAlloc
+
 	template <typename T>
 	inline void Deallocate(T*& OutBuffer) noexcept;
 
 	template <typename T>
 	inline void Construct(size_t Index, T* OutBuffer, const T& Value);
 
+	template <typename T>
+	inline void Construct(size_t Index, T* OutBuffer, T&& Value);
+
 	template <typename T>
 	inline void Destruct(size_t Index, T* OutBuffer) noexcept;
 
@@ -30,6 +40,7 @@ namespace Common
 	inline void DestructAll(size_t Size, T* OutBuffer) noexcept;
 
 
+	// trivially copyable types are moved with memmove (may overlap)
 	template <typename T>
 	void SafeMoveBlock(size_t Size, T* FromBuffer, T* ToBuffer);
 
@@ -40,6 +51,16 @@ namespace Common
 	void Reconstruct(size_t CopySize, size_t NewCapacity,
 		T*& OutBuffer, size_t& OutCapacity, size_t& OutSize);
 
+	template <typename T>
+	bool TryReconstruct(size_t CopySize, size_t AllocSize,
+		T*& OutBuffer, size_t& OutCopySize,
+		size_t& OutAllocSize);	// false and no changes if allocation failed
+
+	template <typename T>
+	void ReplaceBuffer(T* NewBuffer, size_t CopySize, size_t AllocSize,
+		T*& OutBuffer, size_t& OutCopySize, size_t& OutAllocSize);
+
+	// memcpy if IteratorType is pointer to trivially copyable T
 	template <typename IteratorType, typename T>
 	void SafeBulkConstruct(size_t StartPosition, IteratorType From,
 		IteratorType To, T* OutBuffer);
@@ -48,6 +69,10 @@ namespace Common
 	void SafeFillConstruct(size_t StartPosition, size_t EndPosition,
 		T* OutBuffer, const T& Value);
 
+	template <typename T>
+	void SafeDefaultConstruct(size_t StartPosition, size_t EndPosition,
+		T* OutBuffer);	// default-init: trivial types are left uninitialized
+
 }
 
 #include "Private/BlockAllocation.tpp"
\ No newline at end of file
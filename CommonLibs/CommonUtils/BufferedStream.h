@@ -0,0 +1,196 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstddef>	// size_t
+#include <cstring>	// memcpy, memmove
+
+#include "./../CommonTypes/Exception.h"
+#include "./../CommonTypes/Span.h"
+#include "./../CommonTypes/StringView.h"
+#include "Assert.h"
+#include "BlockAllocation.h"	// Allocate, Deallocate
+#include "ByteStream.h"	// sinks and sources
+
+namespace Common
+{
+
+	/// Buffer size of TBufferedWriter and TBufferedReader by default.
+	constexpr size_t DefaultStreamBufferSize = 64 * 1024;
+
+
+	/**
+	 * @brief Collects small writes in a buffer and passes them to the
+	 *		  sink in large blocks.
+	 *
+	 * Writes that are larger than the buffer go to the sink directly,
+	 * so a large block costs one Write() call of the sink, without
+	 * a copy.
+	 *
+	 * @note Destructor flushes but cannot report errors: call Flush().
+	 * @tparam SinkType Class with EStatus Write(const void*, size_t),
+	 *		   e.g. CFileDescriptorSink, CMemorySink
+	*/
+	template <typename SinkType>
+	class TBufferedWriter
+	{
+
+	public:
+
+		/**
+		 * @brief Creates writer and allocates its buffer.
+		 * @param Sink Destination of bytes, must outlive the writer
+		 * @param BufferSize Size of buffer in bytes (not 0)
+		*/
+		explicit TBufferedWriter(SinkType& Sink,
+			size_t BufferSize = DefaultStreamBufferSize);
+
+		TBufferedWriter(const TBufferedWriter&) = delete;
+		TBufferedWriter& operator = (const TBufferedWriter&) = delete;
+
+		~TBufferedWriter();
+
+
+		/**
+		 * @brief Writes bytes (to the buffer if they fit).
+		 * @param Data Bytes to write
+		 * @param Size Number of bytes
+		 * @note Throws CIOError (CBadAlloc for memory sinks).
+		*/
+		void Write(const void* Data, size_t Size);
+
+		/// Write() that returns error instead of throwing.
+		EStatus TryWrite(const void* Data, size_t Size) noexcept;
+
+		/// Writes characters of the view. Throws as Write().
+		void Write(TStringView<char> Text);
+
+		/**
+		 * @brief Writes characters of the view and '\n'.
+		 * @param Line Text without line break
+		 * @note Throws CIOError (CBadAlloc for memory sinks).
+		*/
+		void WriteLine(TStringView<char> Line);
+
+		/// Passes buffered bytes to the sink. Throws CIOError.
+		void Flush();
+
+		/// Flush() that returns error instead of throwing.
+		EStatus TryFlush() noexcept;
+
+
+		/// Number of bytes that wait for Flush().
+		size_t GetBufferedSize() const noexcept;
+
+	private:
+
+		SinkType& Sink;
+		char* Buffer = nullptr;
+		size_t Capacity;
+		size_t Size = 0;
+
+	};
+
+
+	/**
+	 * @brief Reads source in large blocks into a buffer and hands out
+	 *		  bytes from it.
+	 *
+	 * Reads that are larger than the buffer go to the destination
+	 * directly, without a copy.
+	 *
+	 * ReadLine(), ReadDelimited() and ReadView() do not copy at all:
+	 * they return views into the buffer. The buffer grows if a record
+	 * does not fit into it.
+	 *
+	 * @tparam SourceType Class with EStatus Read(void*, size_t,
+	 *		   size_t&), e.g. CFileDescriptorSource, CMemorySource
+	*/
+	template <typename SourceType>
+	class TBufferedReader
+	{
+
+	public:
+
+		/**
+		 * @brief Creates reader and allocates its buffer.
+		 * @param Source Origin of bytes, must outlive the reader
+		 * @param BufferSize Size of buffer in bytes (not 0)
+		*/
+		explicit TBufferedReader(SourceType& Source,
+			size_t BufferSize = DefaultStreamBufferSize);
+
+		TBufferedReader(const TBufferedReader&) = delete;
+		TBufferedReader& operator = (const TBufferedReader&) = delete;
+
+		~TBufferedReader();
+
+
+		/**
+		 * @brief Reads exactly Size bytes.
+		 * @param OutData Receives bytes
+		 * @param Size Number of bytes
+		 * @note Throws CIOError, or CBadFormat if source ends earlier.
+		*/
+		void Read(void* OutData, size_t Size);
+
+		/// Read() that returns IOError or BadFormat instead of throwing.
+		EStatus TryRead(void* OutData, size_t Size) noexcept;
+
+		/**
+		 * @brief Reads one line, zero-copy.
+		 * @param OutLine Receives characters before '\n' ("\r" of
+		 *		  "\r\n" is kept). Last line may have no '\n'
+		 * @return false if source has no more lines
+		 * @note OutLine is valid until the next read. Throws CIOError.
+		*/
+		bool ReadLine(TStringView<char>& OutLine);
+
+		/**
+		 * @brief Reads bytes until delimiter, zero-copy.
+		 * @param Delimiter Byte that ends a record (not included)
+		 * @param OutRecord Receives bytes before delimiter
+		 * @return false if source has no more records
+		 * @note OutRecord is valid until the next read. Throws CIOError.
+		*/
+		bool ReadDelimited(char Delimiter, TStringView<char>& OutRecord);
+
+		/**
+		 * @brief Reads exactly Size bytes, zero-copy. Pair it with
+		 *		  ReadVarUInt() for length-prefixed records.
+		 * @param Size Number of bytes
+		 * @return View of bytes, valid until the next read
+		 * @note Throws CIOError, or CBadFormat if source ends earlier.
+		*/
+		TSpan<const char> ReadView(size_t Size);
+
+		/**
+		 * @brief Checks if all bytes of the source have been read.
+		 * @return true if nothing is left. May read the source
+		 * @note Throws CIOError.
+		*/
+		bool IsEnd();
+
+	private:
+
+		SourceType& Source;
+		char* Buffer = nullptr;
+		size_t Capacity;
+		size_t Position = 0;	// first unread byte
+		size_t Size = 0;		// end of read bytes
+
+		// keeps unread bytes, moves them to the front, reads the rest;
+		// OutRead is 0 at the end of source
+		EStatus Refill(size_t& OutRead) noexcept;
+
+		// Refill() that throws; false at the end of source
+		bool RefillOrThrow();
+
+		// moves unread bytes to a buffer of at least NewCapacity bytes
+		void Grow(size_t NewCapacity);
+
+	};
+
+}
+
+#include "Private/BufferedStream.tpp"
\ No newline at end of file
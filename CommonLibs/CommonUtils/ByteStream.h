@@ -0,0 +1,129 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstddef>	// size_t
+
+#include "./../CommonTypes/Exception.h"	// EStatus
+#include "./../CommonTypes/Vector.h"
+
+namespace Common
+{
+
+	// Sinks and sources are the ends of TBufferedWriter and
+	// TBufferedReader. Any class with the same Write() or Read()
+	// method can be used there as well (sockets, compressors, ...).
+
+
+	/// Writes bytes to file descriptor (file, pipe, socket).
+	class CFileDescriptorSink
+	{
+
+	public:
+
+		/**
+		 * @brief Creates sink over open descriptor. Does not own it.
+		 * @param Descriptor Descriptor opened for writing
+		*/
+		explicit CFileDescriptorSink(int Descriptor) noexcept;
+
+		/**
+		 * @brief Writes all bytes (repeats partial writes).
+		 * @param Data Bytes to write
+		 * @param Size Number of bytes
+		 * @return Ok or IOError
+		*/
+		EStatus Write(const void* Data, size_t Size) noexcept;
+
+	private:
+
+		int Descriptor;
+
+	};
+
+
+	/// Reads bytes from file descriptor (file, pipe, socket).
+	class CFileDescriptorSource
+	{
+
+	public:
+
+		/**
+		 * @brief Creates source over open descriptor. Does not own it.
+		 * @param Descriptor Descriptor opened for reading
+		*/
+		explicit CFileDescriptorSource(int Descriptor) noexcept;
+
+		/**
+		 * @brief Reads up to Capacity bytes with one read() call.
+		 * @param OutData Receives bytes
+		 * @param Capacity Max number of bytes to read
+		 * @param OutSize Receives number of read bytes, 0 at the end
+		 * @return Ok or IOError
+		*/
+		EStatus Read(void* OutData, size_t Capacity, size_t& OutSize) noexcept;
+
+	private:
+
+		int Descriptor;
+
+	};
+
+
+	/// Appends bytes to the end of TVector<char>.
+	class CMemorySink
+	{
+
+	public:
+
+		/**
+		 * @brief Creates sink over vector. Does not own it.
+		 * @param Target Vector that receives bytes
+		*/
+		explicit CMemorySink(TVector<char>& Target) noexcept;
+
+		/**
+		 * @brief Appends bytes to the vector.
+		 * @param Data Bytes to write
+		 * @param Size Number of bytes
+		 * @return Ok or BadAlloc
+		*/
+		EStatus Write(const void* Data, size_t Size) noexcept;
+
+	private:
+
+		TVector<char>& Target;
+
+	};
+
+
+	/// Reads bytes from memory block.
+	class CMemorySource
+	{
+
+	public:
+
+		/**
+		 * @brief Creates source over memory. Does not copy it.
+		 * @param Data Pointer to the first byte
+		 * @param Size Number of bytes
+		*/
+		CMemorySource(const void* Data, size_t Size) noexcept;
+
+		/**
+		 * @brief Copies up to Capacity next bytes.
+		 * @param OutData Receives bytes
+		 * @param Capacity Max number of bytes to read
+		 * @param OutSize Receives number of read bytes, 0 at the end
+		 * @return Ok
+		*/
+		EStatus Read(void* OutData, size_t Capacity, size_t& OutSize) noexcept;
+
+	private:
+
+		const char* Data;
+		size_t Size;
+
+	};
+
+}
\ No newline at end of file
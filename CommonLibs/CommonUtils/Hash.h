@@ -0,0 +1,96 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstddef>	// size_t
+#include <cstdint>
+#include <type_traits>
+
+#include "./../CommonTypes/StringView.h"
+
+namespace Common
+{
+
+	/**
+	 * @brief Mixes bits of the value so that every input bit affects
+	 *		  every output bit (finalizer of SplitMix64). Bijective, so
+	 *		  distinct integers never collide.
+	 * @param Value Any 64-bit value
+	 * @return Well-distributed 64-bit value
+	*/
+	constexpr uint64_t MixBits(uint64_t Value) noexcept
+	{
+		Value ^= Value >> 30;
+		Value *= 0xBF58476D1CE4E5B9ull;
+		Value ^= Value >> 27;
+		Value *= 0x94D049BB133111EBull;
+		Value ^= Value >> 31;
+		return Value;
+	}
+
+	/**
+	 * @brief Combines hash of one more field into the hash of record.
+	 * @param Seed Hash of previous fields
+	 * @param Hash Hash of the next field
+	 * @return Hash of fields so far (depends on their order)
+	*/
+	constexpr uint64_t CombineHashes(uint64_t Seed, uint64_t Hash) noexcept
+	{
+		return MixBits(Seed + 0x9E3779B97F4A7C15ull + Hash);
+	}
+
+	/**
+	 * @brief Hashes a block of bytes, 8 bytes per step. Not
+	 *		  cryptographic: use it for hash tables and filters only.
+	 * @param Data Bytes to hash
+	 * @param Size Number of bytes
+	 * @param Seed Optional. Different seeds give independent hashes
+	 * @return 64-bit hash
+	 * @note Result is the same on all little-endian targets, so it may
+	 *		 be stored (e.g. in serialized filters).
+	*/
+	uint64_t HashBytes(const void* Data, size_t Size,
+		uint64_t Seed = 0) noexcept;
+
+
+	/**
+	 * @brief Default hash functor of hash containers.
+	 *
+	 * Implemented for integers, enums, pointers and TStringView.
+	 * Specialize it (or pass own functor to container) for other
+	 * types: functor is called as size_t(const T&).
+	*/
+	template <typename T, typename Enable = void>
+	struct THash;
+
+	template <typename T>
+	struct THash<T, typename std::enable_if<std::is_integral<T>::value ||
+		std::is_enum<T>::value>::type>
+	{
+		size_t operator () (const T Value) const noexcept
+		{
+			return static_cast<size_t>(MixBits(static_cast<uint64_t>(Value)));
+		}
+	};
+
+	template <typename T>
+	struct THash<T*>
+	{
+		size_t operator () (const T* const Value) const noexcept
+		{
+			return static_cast<size_t>(
+				MixBits(reinterpret_cast<uintptr_t>(Value)));
+		}
+	};
+
+	template <typename CharType>
+	struct THash<TStringView<CharType>>
+	{
+		size_t operator () (const TStringView<CharType>& Value) const noexcept
+		{
+			return static_cast<size_t>(HashBytes(Value.RawData(),
+				Value.GetSize() * sizeof(CharType)));
+		}
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstddef>	// size_t
+#include <cstdint>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+// Byte order of the target. MSVC targets are little-endian only.
+#if defined(_MSC_VER) || (defined(__BYTE_ORDER__) && \
+	__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	#define COMMON_LITTLE_ENDIAN 1
+#else
+	#define COMMON_LITTLE_ENDIAN 0
+#endif
+
+namespace Common
+{
+
+	/// Cache line size of supported targets (x86-64, most of ARM64).
+	/// Data written by different threads should be this far apart.
+	constexpr size_t CacheLineSize = 64;
+
+	/**
+	 * @brief Hints CPU to load cache line with the address into cache.
+	 * @param Address Any address. It is not dereferenced, so invalid
+	 *		  pointers are allowed (but useless)
+	*/
+	inline void Prefetch(const void* Address) noexcept
+	{
+#if defined(_MSC_VER)
+		_mm_prefetch(static_cast<const char*>(Address), _MM_HINT_T0);
+#else
+		__builtin_prefetch(Address);
+#endif
+	}
+
+	/**
+	 * @brief Counts zero bits before the lowest set bit.
+	 * @param Value Number to scan
+	 * @return Index of the lowest set bit
+	 * @note Value must not be 0.
+	*/
+	inline unsigned CountTrailingZeros(uint64_t Value) noexcept
+	{
+#if defined(_MSC_VER)
+		unsigned long Index;
+		_BitScanForward64(&Index, Value);
+		return static_cast<unsigned>(Index);
+#else
+		return static_cast<unsigned>(__builtin_ctzll(Value));
+#endif
+	}
+
+	/**
+	 * @brief Counts set bits. Compiles to popcnt instruction on MSVC and
+	 *		  on GCC/Clang with -mpopcnt (or -march that has it).
+	 * @param Value Number to scan
+	 * @return Number of bits that equal 1
+	*/
+	inline unsigned PopCount(uint64_t Value) noexcept
+	{
+#if defined(_MSC_VER)
+		return static_cast<unsigned>(__popcnt64(Value));
+#else
+		return static_cast<unsigned>(__builtin_popcountll(Value));
+#endif
+	}
+
+}
\ No newline at end of file
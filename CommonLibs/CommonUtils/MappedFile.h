@@ -0,0 +1,101 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstddef>	// size_t
+
+#include "./../CommonTypes/Exception.h"	// EStatus
+
+namespace Common
+{
+
+	/// Expected access pattern of mapped memory (hint for the OS).
+	enum class EAccessHint
+	{
+		/// Default read-ahead.
+		Normal,
+
+		/// Pages are read in order: aggressive read-ahead.
+		Sequential,
+
+		/// Pages are read in random order: no read-ahead.
+		Random,
+
+		/// Whole mapping will be needed soon: start reading it now.
+		WillNeed,
+
+		/// Back mapping with huge pages where the OS supports it.
+		HugePage
+	};
+
+
+	/**
+	 * @brief Read-only memory mapping of a whole file.
+	 *
+	 * File contents are loaded by the OS on first access to each page
+	 * and are shared with the page cache, so opening is O(1) and no
+	 * memory is spent on a private copy. Uses mmap on POSIX systems
+	 * and MapViewOfFile on Windows.
+	 *
+	 * @note Move-only. Data is valid until Close() or destruction.
+	*/
+	class CMappedFile
+	{
+
+	public:
+
+		/// Creates closed file.
+		CMappedFile() = default;
+
+		CMappedFile(const CMappedFile&) = delete;
+		CMappedFile& operator = (const CMappedFile&) = delete;
+
+		/**
+		 * @brief Move constructor.
+		 * @param Other Mapping to take, is closed after the call
+		*/
+		CMappedFile(CMappedFile&& Other) noexcept;
+
+		/// Move assignment. Closes current mapping.
+		CMappedFile& operator = (CMappedFile&& Other) noexcept;
+
+		~CMappedFile();
+
+
+		/**
+		 * @brief Maps the file for reading. Closes current mapping.
+		 * @param Path Path to the file
+		 * @return Ok or IOError; empty file is mapped with nullptr data
+		*/
+		EStatus TryOpen(const char* Path) noexcept;
+
+		/// Unmaps the file. Does nothing if file is not open.
+		void Close() noexcept;
+
+		/**
+		 * @brief Passes access pattern to the OS (madvise).
+		 * @param Hint Expected access pattern
+		 * @return false if hint is not supported and was ignored
+		 * @note Hints never change contents, only performance.
+		*/
+		bool Advise(EAccessHint Hint) const noexcept;
+
+
+		/// Simple check if file is mapped.
+		bool IsOpen() const noexcept;
+
+		/// Pointer to the first byte of the file.
+		const void* GetData() const noexcept;
+
+		/// Size of the file in bytes.
+		size_t GetSize() const noexcept;
+
+	private:
+
+		const void* Data = nullptr;
+		size_t Size = 0;
+		bool bOpen = false;
+
+	};
+
+}
\ No newline at end of file
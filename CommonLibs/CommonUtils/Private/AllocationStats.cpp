@@ -0,0 +1,178 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#include "../AllocationStats.h"
+
+#include <ostream>
+
+namespace Common
+{
+
+	// Counters are never destroyed before the end of the program,
+	// so the registry is an intrusive list without allocations
+	static std::atomic<CAllocationCounters*> RegistryHead{ nullptr };
+
+	static constexpr std::memory_order Relaxed = std::memory_order_relaxed;
+
+
+	CAllocationCounters::CAllocationCounters(const char* const TypeName,
+		const size_t ElementSize) noexcept
+		: TypeName(TypeName), ElementSize(ElementSize)
+	{
+		Next = RegistryHead.load();
+		while (!RegistryHead.compare_exchange_weak(Next, this)) {}
+	}
+
+
+	void CAllocationCounters::AddAllocation(const size_t Bytes) noexcept
+	{
+		size_t Bucket = 0;
+		for (size_t Value = Bytes; Value > 1 &&
+			Bucket + 1 < CAllocationStats::HistogramSize; Value >>= 1)
+		{
+			++Bucket;
+		}
+
+		Allocations.fetch_add(1, Relaxed);
+		AllocatedBytes.fetch_add(Bytes, Relaxed);
+		AllocationSizes[Bucket].fetch_add(1, Relaxed);
+	}
+
+
+	void CAllocationCounters::AddDeallocation() noexcept
+	{
+		Deallocations.fetch_add(1, Relaxed);
+	}
+
+
+	void CAllocationCounters::AddReallocation(const size_t Bytes) noexcept
+	{
+		Reallocations.fetch_add(1, Relaxed);
+		MovedBytes.fetch_add(Bytes, Relaxed);
+	}
+
+
+	void CAllocationCounters::AddShrink(const size_t Bytes) noexcept
+	{
+		Shrinks.fetch_add(1, Relaxed);
+		ShrinkedBytes.fetch_add(Bytes, Relaxed);
+	}
+
+
+	void CAllocationCounters::AddNodeAllocation() noexcept
+	{
+		NodeAllocations.fetch_add(1, Relaxed);
+	}
+
+
+	void CAllocationCounters::AddNodeDeallocation() noexcept
+	{
+		NodeDeallocations.fetch_add(1, Relaxed);
+	}
+
+
+
+	CAllocationStats CAllocationCounters::GetStats() const noexcept
+	{
+		CAllocationStats Stats;
+		Stats.TypeName = TypeName;
+		Stats.ElementSize = ElementSize;
+		Stats.Allocations = Allocations.load(Relaxed);
+		Stats.Deallocations = Deallocations.load(Relaxed);
+		Stats.AllocatedBytes = AllocatedBytes.load(Relaxed);
+		Stats.Reallocations = Reallocations.load(Relaxed);
+		Stats.MovedBytes = MovedBytes.load(Relaxed);
+		Stats.Shrinks = Shrinks.load(Relaxed);
+		Stats.ShrinkedBytes = ShrinkedBytes.load(Relaxed);
+		Stats.NodeAllocations = NodeAllocations.load(Relaxed);
+		Stats.NodeDeallocations = NodeDeallocations.load(Relaxed);
+		for (size_t i = 0; i < CAllocationStats::HistogramSize; ++i)
+		{
+			Stats.AllocationSizes[i] = AllocationSizes[i].load(Relaxed);
+		}
+		return Stats;
+	}
+
+
+	void CAllocationCounters::Reset() noexcept
+	{
+		Allocations.store(0, Relaxed);
+		Deallocations.store(0, Relaxed);
+		AllocatedBytes.store(0, Relaxed);
+		Reallocations.store(0, Relaxed);
+		MovedBytes.store(0, Relaxed);
+		Shrinks.store(0, Relaxed);
+		ShrinkedBytes.store(0, Relaxed);
+		NodeAllocations.store(0, Relaxed);
+		NodeDeallocations.store(0, Relaxed);
+		for (size_t i = 0; i < CAllocationStats::HistogramSize; ++i)
+		{
+			AllocationSizes[i].store(0, Relaxed);
+		}
+	}
+
+
+
+	size_t TakeAllocationSnapshot(CAllocationStats* const OutStats,
+		const size_t MaxCount) noexcept
+	{
+		size_t Count = 0;
+		for (const CAllocationCounters* Current = RegistryHead.load();
+			Current; Current = Current->Next)
+		{
+			if (Count < MaxCount)
+			{
+				OutStats[Count] = Current->GetStats();
+			}
+			++Count;
+		}
+		return Count;
+	}
+
+
+	void ResetAllocationStats() noexcept
+	{
+		for (CAllocationCounters* Current = RegistryHead.load();
+			Current; Current = Current->Next)
+		{
+			Current->Reset();
+		}
+	}
+
+
+	void PrintAllocationReport(std::ostream& Stream)
+	{
+		if (!bAllocationStatsEnabled)
+		{
+			Stream << "Allocation stats are disabled "
+				"(define COMMONLIBS_ALLOCATION_STATS)\n";
+			return;
+		}
+
+		for (const CAllocationCounters* Current = RegistryHead.load();
+			Current; Current = Current->Next)
+		{
+			const CAllocationStats Stats = Current->GetStats();
+			Stream << Stats.TypeName << " (" << Stats.ElementSize << " B): "
+				<< "allocs " << Stats.Allocations
+				<< ", frees " << Stats.Deallocations
+				<< ", bytes " << Stats.AllocatedBytes
+				<< ", reallocs " << Stats.Reallocations
+				<< ", moved " << Stats.MovedBytes
+				<< ", shrinks " << Stats.Shrinks
+				<< ", released " << Stats.ShrinkedBytes
+				<< ", nodes +" << Stats.NodeAllocations
+				<< "/-" << Stats.NodeDeallocations << '\n';
+
+			// histogram: only non-empty buckets, as "[from B): count"
+			for (size_t i = 0; i < CAllocationStats::HistogramSize; ++i)
+			{
+				if (Stats.AllocationSizes[i])
+				{
+					Stream << "\t[" << (uint64_t(1) << i) << " B): "
+						<< Stats.AllocationSizes[i] << '\n';
+				}
+			}
+		}
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	template<typename T>
+	CAllocationCounters& GetAllocationCounters() noexcept
+	{
+		// one instance per type; registered on first use
+		static CAllocationCounters Counters(typeid(T).name(), sizeof(T));
+		return Counters;
+	}
+
+
+	template<typename T>
+	CAllocationStats GetAllocationStats() noexcept
+	{
+		if constexpr (bAllocationStatsEnabled)
+		{
+			return GetAllocationCounters<T>().GetStats();
+		}
+		else
+		{
+			return CAllocationStats();
+		}
+	}
+
+
+
+	template<typename T>
+	inline void RecordAllocation(const size_t Count) noexcept
+	{
+		if constexpr (bAllocationStatsEnabled)
+		{
+			GetAllocationCounters<T>().AddAllocation(Count * sizeof(T));
+		}
+	}
+
+
+	template<typename T>
+	inline void RecordDeallocation() noexcept
+	{
+		if constexpr (bAllocationStatsEnabled)
+		{
+			GetAllocationCounters<T>().AddDeallocation();
+		}
+	}
+
+
+	template<typename T>
+	inline void RecordReallocation(const size_t MovedCount) noexcept
+	{
+		if constexpr (bAllocationStatsEnabled)
+		{
+			GetAllocationCounters<T>().AddReallocation(MovedCount * sizeof(T));
+		}
+	}
+
+
+	template<typename T>
+	inline void RecordShrink(const size_t OldCapacity,
+		const size_t NewCapacity) noexcept
+	{
+		if constexpr (bAllocationStatsEnabled)
+		{
+			if (NewCapacity < OldCapacity)
+			{
+				GetAllocationCounters<T>().AddShrink(
+					(OldCapacity - NewCapacity) * sizeof(T));
+			}
+		}
+	}
+
+
+	template<typename T>
+	inline void RecordNodeAllocation() noexcept
+	{
+		if constexpr (bAllocationStatsEnabled)
+		{
+			GetAllocationCounters<T>().AddNodeAllocation();
+		}
+	}
+
+
+	template<typename T>
+	inline void RecordNodeDeallocation() noexcept
+	{
+		if constexpr (bAllocationStatsEnabled)
+		{
+			GetAllocationCounters<T>().AddNodeDeallocation();
+		}
+	}
+
+}
\ No newline at end of file
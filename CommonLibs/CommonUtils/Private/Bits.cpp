@@ -0,0 +1,73 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#include "../Bits.h"
+
+namespace Common
+{
+
+	size_t CountBits(const uint64_t* const Words,
+		const size_t WordCount) noexcept
+	{
+		// independent sums let CPU run several popcnt at once
+		size_t Counts[4] = {};
+		size_t i = 0;
+		for (; i + 4 <= WordCount; i += 4)
+		{
+			Counts[0] += PopCount(Words[i]);
+			Counts[1] += PopCount(Words[i + 1]);
+			Counts[2] += PopCount(Words[i + 2]);
+			Counts[3] += PopCount(Words[i + 3]);
+		}
+		for (; i < WordCount; ++i)
+		{
+			Counts[0] += PopCount(Words[i]);
+		}
+		return Counts[0] + Counts[1] + Counts[2] + Counts[3];
+	}
+
+
+	size_t FindNextBit(const uint64_t* const Words, const size_t WordCount,
+		const size_t Position) noexcept
+	{
+		size_t Index = Position / BitsPerWord;
+		if (Index >= WordCount)
+		{
+			return WordCount * BitsPerWord;
+		}
+		// bits before Position are masked out in the first word
+		uint64_t Word = Words[Index] & (~uint64_t(0) << (Position % BitsPerWord));
+		while (!Word)
+		{
+			if (++Index == WordCount)
+			{
+				return WordCount * BitsPerWord;
+			}
+			Word = Words[Index];
+		}
+		return Index * BitsPerWord + CountTrailingZeros(Word);
+	}
+
+
+	unsigned SelectBit(uint64_t Word, unsigned Rank) noexcept
+	{
+		// halves of the word are skipped by popcount, then the rest
+		// of the lowest bits are cleared one by one
+		unsigned Offset = 0;
+		for (unsigned Width = 32; Width >= 8; Width /= 2)
+		{
+			const unsigned Low = PopCount(Word & ((uint64_t(1) << Width) - 1));
+			if (Rank >= Low)
+			{
+				Rank -= Low;
+				Word >>= Width;
+				Offset += Width;
+			}
+		}
+		while (Rank--)
+		{
+			Word &= Word - 1;
+		}
+		return Offset + CountTrailingZeros(Word);
+	}
+
+}
\ No newline at end of file
@@ -6,21 +6,46 @@ namespace Common
 	template<typename T>
 	inline void Allocate(const size_t AllocSize, T*& OutBuffer)
 	{
-		try
+		COMMON_TRY
 		{
 			OutBuffer = reinterpret_cast<T*>(::operator new (sizeof(T) * AllocSize));
 		}
-		catch (...)		// use own exception system
+		COMMON_CATCH_ALL		// use own exception system
 		{
-			throw CBadAlloc("Vector: Failed to allocate", sizeof(T) * AllocSize);
+			COMMON_THROW(CBadAlloc("Vector: Failed to allocate",
+				sizeof(T) * AllocSize));
 		}
+		RecordAllocation<T>(AllocSize);
+	}
+
+
+	template<typename T>
+	inline bool TryAllocate(const size_t AllocSize, T*& OutBuffer) noexcept
+	{
+		if (AllocSize > static_cast<size_t>(-1) / sizeof(T))	// overflow
+		{
+			OutBuffer = nullptr;
+			return false;
+		}
+		OutBuffer = reinterpret_cast<T*>(
+			::operator new (sizeof(T) * AllocSize, std::nothrow));
+		if (!OutBuffer)
+		{
+			return false;
+		}
+		RecordAllocation<T>(AllocSize);
+		return true;
 	}
 
 
 	template<typename T>
 	inline void Deallocate(T*& OutBuffer) noexcept
 	{
-		::operator delete[](OutBuffer);
+		if (OutBuffer)
+		{
+			RecordDeallocation<T>();
+		}
+		::operator delete(OutBuffer);	// pairs with operator new
 		OutBuffer = nullptr;
 	}
 
@@ -33,6 +58,14 @@ namespace Common
 	}
 
 
+	template<typename T>
+	inline void Construct(const size_t Index, T* const OutBuffer,
+		T&& Value)
+	{
+		new (OutBuffer + Index) T(Move(Value));
+	}
+
+
 	template<typename T>
 	inline void Destruct(const size_t Index,
 		T* const OutBuffer) noexcept
@@ -65,8 +98,17 @@ namespace Common
 	void SafeMoveBlock(const size_t Size,
 		T* const FromBuffer, T* const ToBuffer)
 	{
+		if constexpr (std::is_trivially_copyable<T>::value)
+		{
+			if (Size)	// buffers may be nullptr if nothing is moved
+			{
+				std::memmove(ToBuffer, FromBuffer, sizeof(T) * Size);
+			}
+			return;
+		}
+
 		size_t i = 0;
-		try
+		COMMON_TRY
 		{
 			while (i < Size)
 			{
@@ -75,10 +117,11 @@ namespace Common
 				++i;
 			}
 		}
-		catch (...)
+		COMMON_CATCH_ALL
 		{
 			DestructRange(0, i, ToBuffer);
 			DestructRange(i, Size, FromBuffer);
+			COMMON_RETHROW;
 		}
 	}
 
@@ -87,8 +130,17 @@ namespace Common
 	void SafeMoveBlockReverse(const size_t Size,
 		T* const FromBuffer, T* const ToBuffer)
 	{
+		if constexpr (std::is_trivially_copyable<T>::value)
+		{
+			if (Size)
+			{
+				std::memmove(ToBuffer, FromBuffer, sizeof(T) * Size);
+			}
+			return;
+		}
+
 		size_t i = Size;
-		try
+		COMMON_TRY
 		{
 			while (i >= 1)	// i is unsigned; cannot compare to 0 there
 			{
@@ -97,10 +149,11 @@ namespace Common
 				Destruct(i, FromBuffer);
 			}
 		}
-		catch (...)
+		COMMON_CATCH_ALL
 		{
 			DestructRange(i + 1, Size, ToBuffer);
 			DestructRange(0, i + 1, FromBuffer);
+			COMMON_RETHROW;
 		}
 	}
 
@@ -111,22 +164,51 @@ namespace Common
 	{
 		T* TempBuffer;
 		Allocate(AllocSize, TempBuffer);
-		try
+		ReplaceBuffer(TempBuffer, CopySize, AllocSize,
+			OutBuffer, OutCopySize, OutAllocSize);
+	}
+
+
+	template<typename T>
+	bool TryReconstruct(size_t CopySize, size_t AllocSize,
+		T*& OutBuffer, size_t& OutCopySize, size_t& OutAllocSize)
+	{
+		T* TempBuffer;
+		if (!TryAllocate(AllocSize, TempBuffer))
+		{
+			return false;
+		}
+		ReplaceBuffer(TempBuffer, CopySize, AllocSize,
+			OutBuffer, OutCopySize, OutAllocSize);
+		return true;
+	}
+
+
+	template<typename T>
+	void ReplaceBuffer(T* NewBuffer, const size_t CopySize,
+		const size_t AllocSize, T*& OutBuffer, size_t& OutCopySize,
+		size_t& OutAllocSize)
+	{
+		COMMON_TRY
 		{
-			SafeMoveBlock(CopySize, OutBuffer, TempBuffer);
+			SafeMoveBlock(CopySize, OutBuffer, NewBuffer);
 		}
-		catch (...)
+		COMMON_CATCH_ALL
 		{
-			Deallocate(TempBuffer);
+			Deallocate(NewBuffer);
 			OutCopySize = 0;
-			throw;
+			COMMON_RETHROW;
 		}
 
-		Common::Swap(TempBuffer, OutBuffer);
+		if (OutBuffer)	// first allocation is not a reallocation
+		{
+			RecordReallocation<T>(CopySize);
+		}
+		Common::Swap(NewBuffer, OutBuffer);
 		OutCopySize = CopySize;
 		OutAllocSize = AllocSize;
 
-		Deallocate(TempBuffer);
+		Deallocate(NewBuffer);
 	}
 
 
@@ -134,8 +216,21 @@ namespace Common
 	void SafeBulkConstruct(const size_t StartPosition,
 		const IteratorType Begin, const IteratorType End, T* const OutBuffer)
 	{
+		if constexpr (std::is_pointer<IteratorType>::value &&
+			std::is_same<typename std::remove_cv<typename std::remove_pointer<
+			IteratorType>::type>::type, T>::value &&
+			std::is_trivially_copyable<T>::value)
+		{
+			if (Begin != End)
+			{
+				std::memcpy(OutBuffer + StartPosition, Begin,
+					sizeof(T) * static_cast<size_t>(End - Begin));
+			}
+			return;
+		}
+
 		size_t i = StartPosition;
-		try
+		COMMON_TRY
 		{
 			for (auto it = Begin; it != End; ++it)
 			{
@@ -143,10 +238,10 @@ namespace Common
 				++i;
 			}
 		}
-		catch (...)
+		COMMON_CATCH_ALL
 		{
 			DestructRange(StartPosition, i, OutBuffer);
-			throw;
+			COMMON_RETHROW;
 		}
 	}
 
@@ -156,7 +251,7 @@ namespace Common
 		const size_t EndPosition, T* const OutBuffer, const T& Value)
 	{
 		size_t i = StartPosition;
-		try
+		COMMON_TRY
 		{
 			while (i < EndPosition)
 			{
@@ -164,10 +259,32 @@ namespace Common
 				++i;
 			}
 		}
-		catch (...)
+		COMMON_CATCH_ALL
+		{
+			DestructRange(StartPosition, i, OutBuffer);
+			COMMON_RETHROW;
+		}
+	}
+
+
+
+	template<typename T>
+	void SafeDefaultConstruct(const size_t StartPosition,
+		const size_t EndPosition, T* const OutBuffer)
+	{
+		size_t i = StartPosition;
+		COMMON_TRY
+		{
+			while (i < EndPosition)
+			{
+				new (OutBuffer + i) T;	// no braces: do not zero trivial types
+				++i;
+			}
+		}
+		COMMON_CATCH_ALL
 		{
 			DestructRange(StartPosition, i, OutBuffer);
-			throw;
+			COMMON_RETHROW;
 		}
 	}
 
@@ -0,0 +1,332 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+namespace Common
+{
+
+	template <typename SinkType>
+	TBufferedWriter<SinkType>::TBufferedWriter(SinkType& Sink,
+		const size_t BufferSize)
+		: Sink(Sink), Capacity(BufferSize)
+	{
+		ASSERT(BufferSize, "Buffered writer needs buffer");
+
+		Allocate(Capacity, Buffer);
+	}
+
+
+	template <typename SinkType>
+	TBufferedWriter<SinkType>::~TBufferedWriter()
+	{
+		TryFlush();
+		Deallocate(Buffer);
+	}
+
+
+
+	template <typename SinkType>
+	void TBufferedWriter<SinkType>::Write(const void* const Data,
+		const size_t Size)
+	{
+		const EStatus Status = TryWrite(Data, Size);
+		if (Status == EStatus::BadAlloc)
+		{
+			COMMON_THROW(CBadAlloc("Buffered writer: Sink is out of memory"));
+		}
+		if (Status != EStatus::Ok)
+		{
+			COMMON_THROW(CIOError("Buffered writer: Failed to write"));
+		}
+	}
+
+
+	template <typename SinkType>
+	EStatus TBufferedWriter<SinkType>::TryWrite(const void* const Data,
+		const size_t Size) noexcept
+	{
+		if (Size <= Capacity - this->Size)
+		{
+			if (Size)
+			{
+				std::memcpy(Buffer + this->Size, Data, Size);
+				this->Size += Size;
+			}
+			return EStatus::Ok;
+		}
+
+		const EStatus Status = TryFlush();
+		if (Status != EStatus::Ok)
+		{
+			return Status;
+		}
+		if (Size >= Capacity)	// would be flushed immediately
+		{
+			return Sink.Write(Data, Size);
+		}
+		std::memcpy(Buffer, Data, Size);
+		this->Size = Size;
+		return EStatus::Ok;
+	}
+
+
+	template <typename SinkType>
+	void TBufferedWriter<SinkType>::Write(const TStringView<char> Text)
+	{
+		Write(Text.RawData(), Text.GetSize());
+	}
+
+
+	template <typename SinkType>
+	void TBufferedWriter<SinkType>::WriteLine(const TStringView<char> Line)
+	{
+		Write(Line.RawData(), Line.GetSize());
+		if (Size == Capacity)
+		{
+			Flush();
+		}
+		Buffer[Size++] = '\n';
+	}
+
+
+	template <typename SinkType>
+	void TBufferedWriter<SinkType>::Flush()
+	{
+		const EStatus Status = TryFlush();
+		if (Status == EStatus::BadAlloc)
+		{
+			COMMON_THROW(CBadAlloc("Buffered writer: Sink is out of memory"));
+		}
+		if (Status != EStatus::Ok)
+		{
+			COMMON_THROW(CIOError("Buffered writer: Failed to write"));
+		}
+	}
+
+
+	template <typename SinkType>
+	EStatus TBufferedWriter<SinkType>::TryFlush() noexcept
+	{
+		if (!Size)
+		{
+			return EStatus::Ok;
+		}
+		const EStatus Status = Sink.Write(Buffer, Size);
+		Size = 0;	// bytes are dropped if sink failed
+		return Status;
+	}
+
+
+	template <typename SinkType>
+	size_t TBufferedWriter<SinkType>::GetBufferedSize() const noexcept
+	{
+		return Size;
+	}
+
+
+
+	template <typename SourceType>
+	TBufferedReader<SourceType>::TBufferedReader(SourceType& Source,
+		const size_t BufferSize)
+		: Source(Source), Capacity(BufferSize)
+	{
+		ASSERT(BufferSize, "Buffered reader needs buffer");
+
+		Allocate(Capacity, Buffer);
+	}
+
+
+	template <typename SourceType>
+	TBufferedReader<SourceType>::~TBufferedReader()
+	{
+		Deallocate(Buffer);
+	}
+
+
+
+	template <typename SourceType>
+	void TBufferedReader<SourceType>::Read(void* const OutData,
+		const size_t Size)
+	{
+		const EStatus Status = TryRead(OutData, Size);
+		if (Status == EStatus::BadFormat)
+		{
+			COMMON_THROW(CBadFormat("Buffered reader: Unexpected end"));
+		}
+		if (Status != EStatus::Ok)
+		{
+			COMMON_THROW(CIOError("Buffered reader: Failed to read"));
+		}
+	}
+
+
+	template <typename SourceType>
+	EStatus TBufferedReader<SourceType>::TryRead(void* const OutData,
+		const size_t Size) noexcept
+	{
+		char* Destination = static_cast<char*>(OutData);
+		size_t Left = Size;
+		while (Left)
+		{
+			const size_t Buffered = this->Size - Position;
+			if (Buffered)
+			{
+				const size_t Chunk = Left < Buffered ? Left : Buffered;
+				std::memcpy(Destination, Buffer + Position, Chunk);
+				Position += Chunk;
+				Destination += Chunk;
+				Left -= Chunk;
+				continue;
+			}
+
+			size_t Read;
+			const EStatus Status = Left >= Capacity ?	// skip the buffer
+				Source.Read(Destination, Left, Read) : Refill(Read);
+			if (Status != EStatus::Ok)
+			{
+				return Status;
+			}
+			if (!Read)
+			{
+				return EStatus::BadFormat;
+			}
+			if (Left >= Capacity)
+			{
+				Destination += Read;
+				Left -= Read;
+			}
+		}
+		return EStatus::Ok;
+	}
+
+
+	template <typename SourceType>
+	bool TBufferedReader<SourceType>::ReadLine(TStringView<char>& OutLine)
+	{
+		return ReadDelimited('\n', OutLine);
+	}
+
+
+	template <typename SourceType>
+	bool TBufferedReader<SourceType>::ReadDelimited(const char Delimiter,
+		TStringView<char>& OutRecord)
+	{
+		size_t Scanned = 0;	// unread bytes known to have no delimiter
+		for (;;)
+		{
+			const char* const End = Buffer + Size;
+			const char* const Found = FindRawByte(
+				Buffer + Position + Scanned, End, Delimiter);
+			if (Found != End)
+			{
+				const size_t Length =
+					static_cast<size_t>(Found - (Buffer + Position));
+				OutRecord = TStringView<char>(Buffer + Position, Length);
+				Position += Length + 1;
+				return true;
+			}
+
+			Scanned = Size - Position;
+			if (Scanned == Capacity)	// record is longer than buffer
+			{
+				Grow(Capacity * 2);
+			}
+			if (!RefillOrThrow())
+			{
+				if (!Scanned)
+				{
+					return false;
+				}
+				OutRecord = TStringView<char>(Buffer + Position, Scanned);
+				Position = Size;
+				return true;
+			}
+		}
+	}
+
+
+	template <typename SourceType>
+	TSpan<const char> TBufferedReader<SourceType>::ReadView(
+		const size_t Size)
+	{
+		if (Size > Capacity)
+		{
+			Grow(Size);
+		}
+		while (this->Size - Position < Size)
+		{
+			if (!RefillOrThrow())
+			{
+				COMMON_THROW(CBadFormat("Buffered reader: Unexpected end"));
+			}
+		}
+		const TSpan<const char> View(Buffer + Position, Size);
+		Position += Size;
+		return View;
+	}
+
+
+	template <typename SourceType>
+	bool TBufferedReader<SourceType>::IsEnd()
+	{
+		if (Position < Size)
+		{
+			return false;
+		}
+		size_t Read;
+		if (Refill(Read) != EStatus::Ok)
+		{
+			COMMON_THROW(CIOError("Buffered reader: Failed to read"));
+		}
+		return Read == 0;
+	}
+
+
+	template <typename SourceType>
+	EStatus TBufferedReader<SourceType>::Refill(size_t& OutRead) noexcept
+	{
+		const size_t Unread = Size - Position;
+		if (Position)
+		{
+			std::memmove(Buffer, Buffer + Position, Unread);
+			Position = 0;
+			Size = Unread;
+		}
+		const EStatus Status = Source.Read(Buffer + Size, Capacity - Size,
+			OutRead);
+		if (Status == EStatus::Ok)
+		{
+			Size += OutRead;
+		}
+		return Status;
+	}
+
+
+	template <typename SourceType>
+	bool TBufferedReader<SourceType>::RefillOrThrow()
+	{
+		size_t Read;
+		if (Refill(Read) != EStatus::Ok)
+		{
+			COMMON_THROW(CIOError("Buffered reader: Failed to read"));
+		}
+		return Read != 0;
+	}
+
+
+	template <typename SourceType>
+	void TBufferedReader<SourceType>::Grow(const size_t NewCapacity)
+	{
+		char* NewBuffer;
+		Allocate(NewCapacity, NewBuffer);
+		const size_t Unread = Size - Position;
+		if (Unread)
+		{
+			std::memcpy(NewBuffer, Buffer + Position, Unread);
+		}
+		Deallocate(Buffer);
+		Buffer = NewBuffer;
+		Capacity = NewCapacity;
+		Position = 0;
+		Size = Unread;
+	}
+
+}
\ No newline at end of file
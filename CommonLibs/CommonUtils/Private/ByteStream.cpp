@@ -0,0 +1,132 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#include "../ByteStream.h"
+
+#include <cerrno>
+#include <climits>	// INT_MAX
+#include <cstring>	// memcpy
+
+#if defined(_WIN32)
+	#include <io.h>		// _read, _write
+#else
+	#include <unistd.h>	// read, write
+#endif
+
+namespace Common
+{
+
+	// one call must not exceed limits of read() and write()
+	static constexpr size_t MaxChunk = INT_MAX / 2 + 1;	// 1 GiB
+
+
+	CFileDescriptorSink::CFileDescriptorSink(const int Descriptor) noexcept
+		: Descriptor(Descriptor) {}
+
+
+	EStatus CFileDescriptorSink::Write(const void* const Data,
+		const size_t Size) noexcept
+	{
+		const char* Position = static_cast<const char*>(Data);
+		size_t Left = Size;
+		while (Left)
+		{
+			const size_t Chunk = Left < MaxChunk ? Left : MaxChunk;
+#if defined(_WIN32)
+			const int Written = _write(Descriptor, Position,
+				static_cast<unsigned>(Chunk));
+#else
+			const ssize_t Written = write(Descriptor, Position, Chunk);
+#endif
+			if (Written < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+				return EStatus::IOError;
+			}
+			Position += Written;
+			Left -= static_cast<size_t>(Written);
+		}
+		return EStatus::Ok;
+	}
+
+
+
+	CFileDescriptorSource::CFileDescriptorSource(const int Descriptor) noexcept
+		: Descriptor(Descriptor) {}
+
+
+	EStatus CFileDescriptorSource::Read(void* const OutData,
+		const size_t Capacity, size_t& OutSize) noexcept
+	{
+		const size_t Chunk = Capacity < MaxChunk ? Capacity : MaxChunk;
+		while (true)
+		{
+#if defined(_WIN32)
+			const int Read = _read(Descriptor, OutData,
+				static_cast<unsigned>(Chunk));
+#else
+			const ssize_t Read = read(Descriptor, OutData, Chunk);
+#endif
+			if (Read >= 0)
+			{
+				OutSize = static_cast<size_t>(Read);
+				return EStatus::Ok;
+			}
+			if (errno != EINTR)
+			{
+				return EStatus::IOError;
+			}
+		}
+	}
+
+
+
+	CMemorySink::CMemorySink(TVector<char>& Target) noexcept
+		: Target(Target) {}
+
+
+	EStatus CMemorySink::Write(const void* const Data,
+		const size_t Size) noexcept
+	{
+		const size_t OldSize = Target.GetSize();
+		if (OldSize + Size > Target.GetCapacity())
+		{
+			// keep amortized growth, Reserve() alone is exact
+			const size_t Doubled = 2 * Target.GetCapacity();
+			const size_t Required = OldSize + Size;
+			if (Target.TryReserve(Required > Doubled ? Required : Doubled)
+				!= EStatus::Ok)
+			{
+				return EStatus::BadAlloc;
+			}
+		}
+		if (Size)
+		{
+			std::memcpy(Target.AppendUninitialized(Size), Data, Size);
+		}
+		return EStatus::Ok;
+	}
+
+
+
+	CMemorySource::CMemorySource(const void* const Data,
+		const size_t Size) noexcept
+		: Data(static_cast<const char*>(Data)), Size(Size) {}
+
+
+	EStatus CMemorySource::Read(void* const OutData, const size_t Capacity,
+		size_t& OutSize) noexcept
+	{
+		OutSize = Capacity < Size ? Capacity : Size;
+		if (OutSize)
+		{
+			std::memcpy(OutData, Data, OutSize);
+			Data += OutSize;
+			Size -= OutSize;
+		}
+		return EStatus::Ok;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#include "../Hash.h"
+
+#include <cstring>	// memcpy
+
+namespace Common
+{
+
+	uint64_t HashBytes(const void* const Data, size_t Size,
+		const uint64_t Seed) noexcept
+	{
+		constexpr uint64_t Multiplier = 0x9E3779B97F4A7C15ull;
+		const unsigned char* Bytes = static_cast<const unsigned char*>(Data);
+		uint64_t Hash = Seed ^ (Size * Multiplier);
+
+		uint64_t Word;
+		while (Size >= sizeof(Word))
+		{
+			memcpy(&Word, Bytes, sizeof(Word));	// unaligned load
+			Hash = (Hash ^ MixBits(Word)) * Multiplier;
+			Bytes += sizeof(Word);
+			Size -= sizeof(Word);
+		}
+
+		// tail of 0-7 bytes, length is already mixed into the seed
+		Word = 0;
+		memcpy(&Word, Bytes, Size);
+		Hash ^= MixBits(Word);
+		return MixBits(Hash);
+	}
+
+}
\ No newline at end of file
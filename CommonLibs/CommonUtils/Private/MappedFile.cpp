@@ -0,0 +1,234 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#include "../MappedFile.h"
+
+#if defined(_WIN32)
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <windows.h>
+#else
+	#include <fcntl.h>		// open
+	#include <sys/mman.h>	// mmap, madvise
+	#include <sys/stat.h>	// fstat
+	#include <unistd.h>		// close
+#endif
+
+#include "../TypeOperations.h"	// Swap
+
+namespace Common
+{
+
+	CMappedFile::CMappedFile(CMappedFile&& Other) noexcept
+		: Data(Other.Data), Size(Other.Size), bOpen(Other.bOpen)
+	{
+		Other.Data = nullptr;
+		Other.Size = 0;
+		Other.bOpen = false;
+	}
+
+
+	CMappedFile& CMappedFile::operator = (CMappedFile&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			Close();
+			Swap(Data, Other.Data);
+			Swap(Size, Other.Size);
+			Swap(bOpen, Other.bOpen);
+		}
+		return *this;
+	}
+
+
+	CMappedFile::~CMappedFile()
+	{
+		Close();
+	}
+
+
+
+#if defined(_WIN32)
+
+	EStatus CMappedFile::TryOpen(const char* const Path) noexcept
+	{
+		Close();
+
+		const HANDLE File = CreateFileA(Path, GENERIC_READ, FILE_SHARE_READ,
+			nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (File == INVALID_HANDLE_VALUE)
+		{
+			return EStatus::IOError;
+		}
+
+		LARGE_INTEGER FileSize;
+		if (!GetFileSizeEx(File, &FileSize) ||
+			static_cast<unsigned long long>(FileSize.QuadPart) > size_t(-1))
+		{
+			CloseHandle(File);
+			return EStatus::IOError;
+		}
+
+		const void* View = nullptr;
+		if (FileSize.QuadPart)	// empty files cannot be mapped
+		{
+			// view keeps mapping and file alive after handles are closed
+			const HANDLE Mapping = CreateFileMappingA(File, nullptr,
+				PAGE_READONLY, 0, 0, nullptr);
+			if (Mapping)
+			{
+				View = MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0);
+				CloseHandle(Mapping);
+			}
+			if (!View)
+			{
+				CloseHandle(File);
+				return EStatus::IOError;
+			}
+		}
+		CloseHandle(File);
+
+		Data = View;
+		Size = static_cast<size_t>(FileSize.QuadPart);
+		bOpen = true;
+		return EStatus::Ok;
+	}
+
+
+	void CMappedFile::Close() noexcept
+	{
+		if (Data)
+		{
+			UnmapViewOfFile(Data);
+		}
+		Data = nullptr;
+		Size = 0;
+		bOpen = false;
+	}
+
+
+	bool CMappedFile::Advise(const EAccessHint Hint) const noexcept
+	{
+		if (!Data)
+		{
+			return false;
+		}
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602	// Windows 8
+		if (Hint == EAccessHint::WillNeed)
+		{
+			WIN32_MEMORY_RANGE_ENTRY Range;
+			Range.VirtualAddress = const_cast<void*>(Data);
+			Range.NumberOfBytes = Size;
+			return PrefetchVirtualMemory(GetCurrentProcess(), 1, &Range, 0);
+		}
+#endif
+		// read-ahead of mapped views and large pages for file
+		// mappings cannot be controlled after mapping
+		return Hint == EAccessHint::Normal;
+	}
+
+#else
+
+	EStatus CMappedFile::TryOpen(const char* const Path) noexcept
+	{
+		Close();
+
+		const int File = open(Path, O_RDONLY | O_CLOEXEC);
+		if (File < 0)
+		{
+			return EStatus::IOError;
+		}
+
+		struct stat FileInfo;
+		if (fstat(File, &FileInfo) != 0 ||
+			static_cast<unsigned long long>(FileInfo.st_size) > size_t(-1))
+		{
+			close(File);
+			return EStatus::IOError;
+		}
+
+		const size_t FileSize = static_cast<size_t>(FileInfo.st_size);
+		void* View = nullptr;
+		if (FileSize)	// empty files cannot be mapped
+		{
+			View = mmap(nullptr, FileSize, PROT_READ, MAP_SHARED, File, 0);
+			if (View == MAP_FAILED)
+			{
+				close(File);
+				return EStatus::IOError;
+			}
+		}
+		close(File);	// mapping keeps file alive
+
+		Data = View;
+		Size = FileSize;
+		bOpen = true;
+		return EStatus::Ok;
+	}
+
+
+	void CMappedFile::Close() noexcept
+	{
+		if (Data)
+		{
+			munmap(const_cast<void*>(Data), Size);
+		}
+		Data = nullptr;
+		Size = 0;
+		bOpen = false;
+	}
+
+
+	bool CMappedFile::Advise(const EAccessHint Hint) const noexcept
+	{
+		if (!Data)
+		{
+			return false;
+		}
+
+		int Advice;
+		switch (Hint)
+		{
+		case EAccessHint::Sequential:
+			Advice = MADV_SEQUENTIAL;
+			break;
+		case EAccessHint::Random:
+			Advice = MADV_RANDOM;
+			break;
+		case EAccessHint::WillNeed:
+			Advice = MADV_WILLNEED;
+			break;
+		case EAccessHint::HugePage:
+#if defined(MADV_HUGEPAGE)
+			Advice = MADV_HUGEPAGE;	// file-backed THP needs kernel support
+			break;
+#else
+			return false;
+#endif
+		default:
+			Advice = MADV_NORMAL;
+		}
+		return madvise(const_cast<void*>(Data), Size, Advice) == 0;
+	}
+
+#endif
+
+
+
+	bool CMappedFile::IsOpen() const noexcept
+	{
+		return bOpen;
+	}
+
+
+	const void* CMappedFile::GetData() const noexcept
+	{
+		return Data;
+	}
+
+
+	size_t CMappedFile::GetSize() const noexcept
+	{
+		return Size;
+	}
+
+}
\ No newline at end of file
@@ -2,6 +2,18 @@
 
 #include "../RawString.h"
 
+#include <cstring>	// memchr
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+	(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define COMMON_SSE2 1
+	#include <emmintrin.h>
+#else
+	#define COMMON_SSE2 0
+#endif
+
+#include "../Intrinsics.h"	// CountTrailingZeros
+
 namespace Common
 {
 
@@ -91,4 +103,34 @@ namespace Common
 		return true;
 	}
 
+
+	const char* FindRawByte(const char* Begin, const char* const End,
+		const char Value) noexcept
+	{
+#if COMMON_SSE2
+		const __m128i Pattern = _mm_set1_epi8(Value);
+		while (End - Begin >= 16)
+		{
+			const __m128i Block = _mm_loadu_si128(
+				reinterpret_cast<const __m128i*>(Begin));
+			const int Mask = _mm_movemask_epi8(
+				_mm_cmpeq_epi8(Block, Pattern));
+			if (Mask)
+			{
+				return Begin + CountTrailingZeros(static_cast<uint64_t>(Mask));
+			}
+			Begin += 16;
+		}
+		while (Begin != End && *Begin != Value)	// tail of < 16 bytes
+		{
+			++Begin;
+		}
+		return Begin;
+#else
+		const void* const Found = Begin == End ? nullptr :
+			std::memchr(Begin, Value, static_cast<size_t>(End - Begin));
+		return Found ? static_cast<const char*>(Found) : End;
+#endif
+	}
+
 }
\ No newline at end of file
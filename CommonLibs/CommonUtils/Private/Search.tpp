@@ -0,0 +1,184 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+namespace Common
+{
+
+	template <typename IteratorType, typename T, typename FunctionType>
+	IteratorType LowerBound(IteratorType Begin, const IteratorType End,
+		const T& Value, FunctionType Comparator)
+	{
+		size_t Length = End - Begin;
+		while (Length > 0)
+		{
+			const size_t Half = Length / 2;
+			IteratorType Middle = Begin + Half;
+			if (Comparator(*Middle, Value))
+			{
+				Begin = ++Middle;
+				Length -= Half + 1;
+			}
+			else
+			{
+				Length = Half;
+			}
+		}
+		return Begin;
+	}
+
+
+	template <typename IteratorType, typename T>
+	IteratorType LowerBound(const IteratorType Begin, const IteratorType End,
+		const T& Value)
+	{
+		return LowerBound(Begin, End, Value,
+			[](const auto& First, const auto& Second)
+			{ return First < Second; });
+	}
+
+
+	template <typename IteratorType, typename T, typename FunctionType>
+	IteratorType UpperBound(IteratorType Begin, const IteratorType End,
+		const T& Value, FunctionType Comparator)
+	{
+		size_t Length = End - Begin;
+		while (Length > 0)
+		{
+			const size_t Half = Length / 2;
+			IteratorType Middle = Begin + Half;
+			if (!Comparator(Value, *Middle))
+			{
+				Begin = ++Middle;
+				Length -= Half + 1;
+			}
+			else
+			{
+				Length = Half;
+			}
+		}
+		return Begin;
+	}
+
+
+	template <typename IteratorType, typename T>
+	IteratorType UpperBound(const IteratorType Begin, const IteratorType End,
+		const T& Value)
+	{
+		return UpperBound(Begin, End, Value,
+			[](const auto& First, const auto& Second)
+			{ return First < Second; });
+	}
+
+
+	template <typename IteratorType, typename T, typename FunctionType>
+	bool BinarySearch(const IteratorType Begin, IteratorType End,
+		const T& Value, FunctionType Comparator)
+	{
+		IteratorType Found = LowerBound(Begin, End, Value, Comparator);
+		return Found != End && !Comparator(Value, *Found);
+	}
+
+
+	template <typename IteratorType, typename T>
+	bool BinarySearch(const IteratorType Begin, const IteratorType End,
+		const T& Value)
+	{
+		return BinarySearch(Begin, End, Value,
+			[](const auto& First, const auto& Second)
+			{ return First < Second; });
+	}
+
+
+	template <typename IteratorType, typename T, typename FunctionType>
+	TPair<IteratorType, IteratorType> EqualRange(const IteratorType Begin,
+		const IteratorType End, const T& Value, FunctionType Comparator)
+	{
+		IteratorType Lower = LowerBound(Begin, End, Value, Comparator);
+		return TPair<IteratorType, IteratorType>(Lower,
+			UpperBound(Lower, End, Value, Comparator));
+	}
+
+
+	template <typename IteratorType, typename T>
+	TPair<IteratorType, IteratorType> EqualRange(const IteratorType Begin,
+		const IteratorType End, const T& Value)
+	{
+		return EqualRange(Begin, End, Value,
+			[](const auto& First, const auto& Second)
+			{ return First < Second; });
+	}
+
+
+
+	// Base is moved by the selected offset instead of a branch, so the
+	// loop runs ceil(log2(Length)) times and compiles to cmov. Both
+	// candidates for the next probe are prefetched while comparing.
+	template <typename IteratorType, typename T, typename FunctionType>
+	IteratorType BranchlessLowerBound(IteratorType Begin, const IteratorType End,
+		const T& Value, FunctionType Comparator)
+	{
+		size_t Length = End - Begin;
+		if (!Length)
+		{
+			return Begin;
+		}
+
+		size_t Base = 0;
+		while (Length > 1)
+		{
+			const size_t Half = Length / 2;
+			Prefetch(&*(Begin + (Base + Half / 2)));
+			Prefetch(&*(Begin + (Base + Half + Half / 2)));
+			Base += Comparator(*(Begin + (Base + Half)), Value) ? Half : 0;
+			Length -= Half;
+		}
+		Base += Comparator(*(Begin + Base), Value) ? 1 : 0;
+		return Begin += Base;
+	}
+
+
+	template <typename IteratorType, typename T>
+	IteratorType BranchlessLowerBound(const IteratorType Begin,
+		const IteratorType End, const T& Value)
+	{
+		return BranchlessLowerBound(Begin, End, Value,
+			[](const auto& First, const auto& Second)
+			{ return First < Second; });
+	}
+
+
+	template <typename IteratorType, typename T, typename FunctionType>
+	IteratorType BranchlessUpperBound(IteratorType Begin, const IteratorType End,
+		const T& Value, FunctionType Comparator)
+	{
+		size_t Length = End - Begin;
+		if (!Length)
+		{
+			return Begin;
+		}
+
+		size_t Base = 0;
+		while (Length > 1)
+		{
+			const size_t Half = Length / 2;
+			Prefetch(&*(Begin + (Base + Half / 2)));
+			Prefetch(&*(Begin + (Base + Half + Half / 2)));
+			Base += !Comparator(Value, *(Begin + (Base + Half))) ? Half : 0;
+			Length -= Half;
+		}
+		Base += !Comparator(Value, *(Begin + Base)) ? 1 : 0;
+		return Begin += Base;
+	}
+
+
+	template <typename IteratorType, typename T>
+	IteratorType BranchlessUpperBound(const IteratorType Begin,
+		const IteratorType End, const T& Value)
+	{
+		return BranchlessUpperBound(Begin, End, Value,
+			[](const auto& First, const auto& Second)
+			{ return First < Second; });
+	}
+
+}
\ No newline at end of file
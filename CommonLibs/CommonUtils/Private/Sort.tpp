@@ -47,6 +47,12 @@ namespace Common
 	IteratorType Partition(IteratorType Begin, IteratorType End, FunctionType Compare)
 	{
 		IteratorType Pivot = End - 1;
+		// middle pivot: sorted and reversed ranges stay O(n log n)
+		IteratorType Middle = Begin + GetIteratorDistance(Begin, End) / 2;
+		if (Middle != Pivot)
+		{
+			Swap(*Middle, *Pivot);
+		}
 		IteratorType it1 = Begin;
 		for (auto it2 = Begin; it2 != Pivot; ++it2) {
 			if (Compare(*it2, *Pivot)) {
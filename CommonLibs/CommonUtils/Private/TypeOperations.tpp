@@ -12,6 +12,13 @@ namespace Common
 	}
 
 
+	template<typename T>
+	T&& Forward(typename RemoveReference<T>::Type& Value) noexcept
+	{
+		return static_cast<T&&>(Value);
+	}
+
+
 	template<typename T>
 	void Swap(T& First, T& Second) {
 		T Temp(Move(First));
@@ -19,4 +26,20 @@ namespace Common
 		Second = Move(Temp);
 	}
 
+
+
+	template <size_t Index, typename FirstType, typename... OtherTypes>
+	const auto& GetArgumentAt(const FirstType& First,
+		const OtherTypes&... Others) noexcept
+	{
+		if constexpr (Index == 0)
+		{
+			return First;
+		}
+		else
+		{
+			return GetArgumentAt<Index - 1>(Others...);
+		}
+	}
+
 }
\ No newline at end of file
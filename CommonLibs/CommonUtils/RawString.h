@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <cstddef>	// size_t
+
 namespace Common
 {
 
@@ -81,4 +83,16 @@ namespace Common
 	*/
 	bool AreRawStringsEqual(const char* NullTermString1,
 		const char* NullTermString2, size_t MaxCompareLength);
+
+
+	/**
+	 * @brief Finds the first occurrence of a byte in the range.
+	 *		  Compares 16 bytes at once with SSE2 where available.
+	 * @param Begin Pointer to the first byte
+	 * @param End Pointer to the byte after last
+	 * @param Value Byte to find (e.g. '\n')
+	 * @return Pointer to the found byte, End if there is none
+	*/
+	const char* FindRawByte(const char* Begin, const char* End,
+		char Value) noexcept;
 }
\ No newline at end of file
@@ -0,0 +1,125 @@
+// Yuri Zamyatin, 2020-2021. This file is part of CommonLibs
+
+#pragma once
+
+#include <cstddef>	// size_t
+
+#include "Intrinsics.h"	// Prefetch
+#include "./../CommonTypes/Pair.h"
+
+namespace Common
+{
+
+	/**
+	 * @brief Finds the first element that is not less than Value.
+	 *		  Range: [Begin: End) must be sorted by Comparator
+	 * @tparam IteratorType Random access iterator (implements +, - and *)
+	 * @param Begin Iterator referring to the first element
+	 * @param End Iterator referring to the element after last one
+	 * @param Value Value to search for
+	 * @param Comparator Returns true if first argument goes before second
+	 * @return Iterator to the found element or End
+	*/
+	template <typename IteratorType, typename T, typename FunctionType>
+	IteratorType LowerBound(IteratorType Begin, IteratorType End,
+		const T& Value, FunctionType Comparator);
+
+	/// LowerBound() that compares elements with operator <.
+	template <typename IteratorType, typename T>
+	IteratorType LowerBound(IteratorType Begin, IteratorType End,
+		const T& Value);
+
+	/**
+	 * @brief Finds the first element that is greater than Value.
+	 *		  Range: [Begin: End) must be sorted by Comparator
+	 * @tparam IteratorType Random access iterator (implements +, - and *)
+	 * @param Begin Iterator referring to the first element
+	 * @param End Iterator referring to the element after last one
+	 * @param Value Value to search for
+	 * @param Comparator Returns true if first argument goes before second
+	 * @return Iterator to the found element or End
+	*/
+	template <typename IteratorType, typename T, typename FunctionType>
+	IteratorType UpperBound(IteratorType Begin, IteratorType End,
+		const T& Value, FunctionType Comparator);
+
+	/// UpperBound() that compares elements with operator <.
+	template <typename IteratorType, typename T>
+	IteratorType UpperBound(IteratorType Begin, IteratorType End,
+		const T& Value);
+
+	/**
+	 * @brief Checks if sorted range contains element equivalent to Value.
+	 * @tparam IteratorType Random access iterator (implements +, - and *)
+	 * @param Begin Iterator referring to the first element
+	 * @param End Iterator referring to the element after last one
+	 * @param Value Value to search for
+	 * @param Comparator Returns true if first argument goes before second
+	 * @return True if element was found, false otherwise
+	*/
+	template <typename IteratorType, typename T, typename FunctionType>
+	bool BinarySearch(IteratorType Begin, IteratorType End,
+		const T& Value, FunctionType Comparator);
+
+	/// BinarySearch() that compares elements with operator <.
+	template <typename IteratorType, typename T>
+	bool BinarySearch(IteratorType Begin, IteratorType End,
+		const T& Value);
+
+	/**
+	 * @brief Finds all elements equivalent to Value in sorted range.
+	 * @tparam IteratorType Random access iterator (implements +, - and *)
+	 * @param Begin Iterator referring to the first element
+	 * @param End Iterator referring to the element after last one
+	 * @param Value Value to search for
+	 * @param Comparator Returns true if first argument goes before second
+	 * @return Pair of LowerBound() and UpperBound() results
+	*/
+	template <typename IteratorType, typename T, typename FunctionType>
+	TPair<IteratorType, IteratorType> EqualRange(IteratorType Begin,
+		IteratorType End, const T& Value, FunctionType Comparator);
+
+	/// EqualRange() that compares elements with operator <.
+	template <typename IteratorType, typename T>
+	TPair<IteratorType, IteratorType> EqualRange(IteratorType Begin,
+		IteratorType End, const T& Value);
+
+
+	/**
+	 * @brief LowerBound() without unpredictable branches. The range is
+	 *		  halved the same number of times for every Value, and both
+	 *		  possible next probes are prefetched.
+	 * @tparam IteratorType Random access iterator (implements +, - and *)
+	 * @param Begin Iterator referring to the first element
+	 * @param End Iterator referring to the element after last one
+	 * @param Value Value to search for
+	 * @param Comparator Returns true if first argument goes before second
+	 * @return Iterator to the found element or End
+	 * @note Faster than LowerBound() on large arrays of small elements,
+	 *		 when mispredictions and cache misses dominate.
+	*/
+	template <typename IteratorType, typename T, typename FunctionType>
+	IteratorType BranchlessLowerBound(IteratorType Begin, IteratorType End,
+		const T& Value, FunctionType Comparator);
+
+	/// BranchlessLowerBound() that compares elements with operator <.
+	template <typename IteratorType, typename T>
+	IteratorType BranchlessLowerBound(IteratorType Begin, IteratorType End,
+		const T& Value);
+
+	/**
+	 * @brief UpperBound() without unpredictable branches.
+	 * @see BranchlessLowerBound() for details.
+	*/
+	template <typename IteratorType, typename T, typename FunctionType>
+	IteratorType BranchlessUpperBound(IteratorType Begin, IteratorType End,
+		const T& Value, FunctionType Comparator);
+
+	/// BranchlessUpperBound() that compares elements with operator <.
+	template <typename IteratorType, typename T>
+	IteratorType BranchlessUpperBound(IteratorType Begin, IteratorType End,
+		const T& Value);
+
+}
+
+#include "Private/Search.tpp"
\ No newline at end of file
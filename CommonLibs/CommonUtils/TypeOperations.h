@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 namespace Common
 {
 
@@ -18,10 +20,37 @@ namespace Common
 	template<typename T>
 	typename RemoveReference<T>::Type&& Move(T&& Value);
 
+	/// Keeps value category of forwarding reference (std::forward).
+	template<typename T>
+	T&& Forward(typename RemoveReference<T>::Type& Value) noexcept;
+
 
 	template<typename T>
 	void Swap(T& First, T& Second);
 
+
+	/// Type with given index in the parameter pack.
+	template <size_t Index, typename... Types>
+	struct TTypeAt;
+
+	template <size_t Index, typename FirstType, typename... OtherTypes>
+	struct TTypeAt<Index, FirstType, OtherTypes...>
+	{
+		typedef typename TTypeAt<Index - 1, OtherTypes...>::Type Type;
+	};
+
+	template <typename FirstType, typename... OtherTypes>
+	struct TTypeAt<0, FirstType, OtherTypes...>
+	{
+		typedef FirstType Type;
+	};
+
+
+	/// Argument with given index from the argument pack.
+	template <size_t Index, typename FirstType, typename... OtherTypes>
+	const auto& GetArgumentAt(const FirstType& First,
+		const OtherTypes&... Others) noexcept;
+
 }
 
 #include "Private/TypeOperations.tpp"
\ No newline at end of file
@@ -0,0 +1,17 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#pragma once
+
+#include "Sort.h"
+#include "RawString.h"
+#include "Search.h"
+#include "BufferedLines.h"
+
+
+inline void BenchmarkAlgorithms()
+{
+	RunSortBenchmarks();
+	RunRawStringBenchmarks();
+	RunSearchBenchmarks();
+	RunBufferedLinesBenchmarks();
+}
\ No newline at end of file
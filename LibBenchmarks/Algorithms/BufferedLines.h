@@ -0,0 +1,17 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#pragma once
+
+#include "../Harness.h"
+#include "CommonUtils/BufferedStream.h"
+
+
+void BufferedLinesBenchmarkReadLine();
+void BufferedLinesBenchmarkWriteLine();
+
+
+inline void RunBufferedLinesBenchmarks()
+{
+	BufferedLinesBenchmarkReadLine();
+	BufferedLinesBenchmarkWriteLine();
+}
\ No newline at end of file
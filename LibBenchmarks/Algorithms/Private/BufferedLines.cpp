@@ -0,0 +1,124 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#include "../BufferedLines.h"
+
+#include <cstdio>
+#include <cstring>	// strlen
+#include <fstream>
+#include <string>
+
+#if defined(_WIN32)
+	#include <io.h>	// _fileno
+	#define fileno _fileno
+#endif
+
+using namespace Common;
+
+
+static constexpr size_t LineCount = 200000;
+static constexpr const char* FileName = "BufferedLines.tmp";
+
+
+// lines of 0..120 random letters, ~12 MB
+static void WriteLinesFile()
+{
+	CRandom Random;
+	std::FILE* const File = std::fopen(FileName, "wb");
+	for (size_t i = 0; i < LineCount; ++i)
+	{
+		const size_t Length = Random.Next() % 121;
+		for (size_t j = 0; j < Length; ++j)
+		{
+			std::fputc('a' + static_cast<int>(Random.Next() % 26), File);
+		}
+		std::fputc('\n', File);
+	}
+	std::fclose(File);
+}
+
+
+void BufferedLinesBenchmarkReadLine()
+{
+	if (!IsBenchmarkGroupSelected("BufferedLines"))
+	{
+		return;
+	}
+	WriteLinesFile();
+
+	CompareWithStd("BufferedLines", "Read 200k lines", LineCount,
+		[]()
+		{
+			std::FILE* const File = std::fopen(FileName, "rb");
+			CFileDescriptorSource Source(fileno(File));
+			TBufferedReader<CFileDescriptorSource> Reader(Source);
+			size_t Total = 0;
+			TStringView<char> Line;
+			while (Reader.ReadLine(Line))
+			{
+				Total += Line.GetSize();
+			}
+			DoNotOptimize(Total);
+			std::fclose(File);
+		},
+		[]()
+		{
+			std::ifstream File(FileName, std::ios::binary);
+			size_t Total = 0;
+			std::string Line;
+			while (std::getline(File, Line))
+			{
+				Total += Line.size();
+			}
+			DoNotOptimize(Total);
+		});
+
+	RunBenchmark("BufferedLines", "Read 200k lines", "fgets", LineCount,
+		[]()
+		{
+			std::FILE* const File = std::fopen(FileName, "rb");
+			size_t Total = 0;
+			char Line[256];
+			while (std::fgets(Line, sizeof(Line), File))
+			{
+				Total += std::strlen(Line) - 1;	// without '\n'
+			}
+			DoNotOptimize(Total);
+			std::fclose(File);
+		});
+
+	std::remove(FileName);
+}
+
+
+void BufferedLinesBenchmarkWriteLine()
+{
+	static const char Text[] = "short line of a log file";
+	static constexpr size_t Length = sizeof(Text) - 1;
+
+	CompareWithStd("BufferedLines", "Write 200k lines", LineCount,
+		[]()
+		{
+			std::FILE* const File = std::fopen(FileName, "wb");
+			CFileDescriptorSink Sink(fileno(File));
+			{
+				TBufferedWriter<CFileDescriptorSink> Writer(Sink);
+				for (size_t i = 0; i < LineCount; ++i)
+				{
+					Writer.WriteLine(TStringView<char>(Text, Length));
+				}
+				Writer.Flush();
+			}
+			std::fclose(File);
+		},
+		[]()
+		{
+			std::ofstream File(FileName, std::ios::binary);
+			for (size_t i = 0; i < LineCount; ++i)
+			{
+				File.write(Text, Length);
+				File.put('\n');
+			}
+		});
+
+	std::remove(FileName);
+}
\ No newline at end of file
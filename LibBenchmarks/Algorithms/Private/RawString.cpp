@@ -0,0 +1,97 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#include "../RawString.h"
+
+#include <cstring>
+
+using namespace Common;
+
+
+static constexpr size_t StringLength = 1000;
+static constexpr size_t CallCount = 1000;
+
+// filled at run time, so compiler can not compute results
+static char First[StringLength + 1];
+static char Second[StringLength + 1];
+
+
+static void FillStrings()
+{
+	CRandom Random;
+	for (size_t i = 0; i < StringLength; ++i)
+	{
+		First[i] = static_cast<char>('a' + Random.Next() % 26);
+		Second[i] = First[i];
+	}
+	First[StringLength] = '\0';
+	Second[StringLength] = '\0';
+}
+
+
+void RawStringBenchmarkLength()
+{
+	FillStrings();
+	CompareWithStd("RawString", "Length 1000 chars", CallCount,
+		[]()
+		{
+			for (size_t i = 0; i < CallCount; ++i)
+			{
+				DoNotOptimize(First);
+				DoNotOptimize(GetRawStringLength(First));
+			}
+		},
+		[]()
+		{
+			for (size_t i = 0; i < CallCount; ++i)
+			{
+				DoNotOptimize(First);
+				DoNotOptimize(std::strlen(First));
+			}
+		});
+}
+
+
+void RawStringBenchmarkCopy()
+{
+	FillStrings();
+	CompareWithStd("RawString", "Copy 1000 chars", CallCount,
+		[]()
+		{
+			for (size_t i = 0; i < CallCount; ++i)
+			{
+				CopyRawString(First, Second);
+				DoNotOptimize(Second);
+			}
+		},
+		[]()
+		{
+			for (size_t i = 0; i < CallCount; ++i)
+			{
+				std::strcpy(Second, First);
+				DoNotOptimize(Second);
+			}
+		});
+}
+
+
+void RawStringBenchmarkEqual()
+{
+	FillStrings();
+	CompareWithStd("RawString", "Equal 1000 chars", CallCount,
+		[]()
+		{
+			for (size_t i = 0; i < CallCount; ++i)
+			{
+				DoNotOptimize(Second);
+				DoNotOptimize(AreRawStringsEqual(First, Second));
+			}
+		},
+		[]()
+		{
+			for (size_t i = 0; i < CallCount; ++i)
+			{
+				DoNotOptimize(Second);
+				DoNotOptimize(std::strcmp(First, Second) == 0);
+			}
+		});
+}
\ No newline at end of file
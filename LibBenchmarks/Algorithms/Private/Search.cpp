@@ -0,0 +1,84 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#include "../Search.h"
+
+#include <algorithm>	// lower_bound
+
+using namespace Common;
+
+
+static constexpr size_t QueryCount = 100000;
+
+
+// all searches over Size sorted ints; Case must be a string literal
+static void BenchmarkLowerBound(const size_t Size, const char* const Case)
+{
+	TVector<int> Sorted(Size, 0);
+	for (size_t i = 0; i < Size; ++i)
+	{
+		Sorted[i] = static_cast<int>(i * 2);
+	}
+	const TEytzingerIndex<int> Index(Sorted);
+
+	CRandom Random;
+	TVector<int> Queries(QueryCount, 0);
+	for (size_t i = 0; i < QueryCount; ++i)
+	{
+		Queries[i] = static_cast<int>(Random.Next() % (Size * 2));
+	}
+
+	const int* const Begin = Sorted.RawData();
+	const int* const End = Begin + Size;
+
+	RunBenchmark("Search", Case, "Common", QueryCount,
+		[&]()
+		{
+			for (const int Query : Queries)
+			{
+				DoNotOptimize(LowerBound(Begin, End, Query));
+			}
+		});
+
+	RunBenchmark("Search", Case, "Common branchless", QueryCount,
+		[&]()
+		{
+			for (const int Query : Queries)
+			{
+				DoNotOptimize(BranchlessLowerBound(Begin, End, Query));
+			}
+		});
+
+	RunBenchmark("Search", Case, "Common Eytzinger", QueryCount,
+		[&]()
+		{
+			for (const int Query : Queries)
+			{
+				DoNotOptimize(Index.LowerBound(Query));
+			}
+		});
+
+	RunBenchmark("Search", Case, "std", QueryCount,
+		[&]()
+		{
+			for (const int Query : Queries)
+			{
+				DoNotOptimize(std::lower_bound(Begin, End, Query));
+			}
+		});
+}
+
+
+void SearchBenchmarkLowerBound()
+{
+	if (!IsBenchmarkGroupSelected("Search"))
+	{
+		return;
+	}
+
+	// from L1-resident to far beyond LLC (100M ints: 400 MB + index)
+	BenchmarkLowerBound(1000, "LowerBound 1K ints");
+	BenchmarkLowerBound(64 * 1000, "LowerBound 64K ints");
+	BenchmarkLowerBound(1000 * 1000, "LowerBound 1M ints");
+	BenchmarkLowerBound(16 * 1000 * 1000, "LowerBound 16M ints");
+	BenchmarkLowerBound(100 * 1000 * 1000, "LowerBound 100M ints");
+}
\ No newline at end of file
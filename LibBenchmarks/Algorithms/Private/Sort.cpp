@@ -0,0 +1,83 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#include "../Sort.h"
+
+#include <algorithm>	// sort
+#include <vector>
+
+using namespace Common;
+
+
+static TVector<int> MakeRandomValues(const size_t Count)
+{
+	CRandom Random;
+	TVector<int> Values(Count, 0);
+	for (size_t i = 0; i < Count; ++i)
+	{
+		Values[i] = static_cast<int>(Random.Next() % 1000000);
+	}
+	return Values;
+}
+
+
+static bool Less(const int First, const int Second)
+{
+	return First < Second;
+}
+
+
+// copying the source is measured too; it is a tiny part of sorting
+void SortBenchmarkQuickSort()
+{
+	static constexpr size_t Count = 100000;
+	const TVector<int> Source = MakeRandomValues(Count);
+
+	CompareWithStd("Sort", "QuickSort 100k", Count,
+		[&Source]()
+		{
+			TVector<int> Values = Source;
+			QuickSort(Values.Begin(), Values.End(), Less);
+			DoNotOptimize(Values.RawData()[0]);
+		},
+		[&Source]()
+		{
+			std::vector<int> Values(Source.RawData(), Source.RawData() + Count);
+			std::sort(Values.begin(), Values.end(), Less);
+			DoNotOptimize(Values.data()[0]);
+		});
+}
+
+
+void SortBenchmarkQuadratic()
+{
+	static constexpr size_t Count = 2000;
+	const TVector<int> Source = MakeRandomValues(Count);
+
+	CompareWithStd("Sort", "BubbleSort 2k", Count,
+		[&Source]()
+		{
+			TVector<int> Values = Source;
+			BubbleSort(Values.Begin(), Values.End(), Less);
+			DoNotOptimize(Values.RawData()[0]);
+		},
+		[&Source]()
+		{
+			std::vector<int> Values(Source.RawData(), Source.RawData() + Count);
+			std::sort(Values.begin(), Values.end(), Less);
+			DoNotOptimize(Values.data()[0]);
+		});
+
+	CompareWithStd("Sort", "SelectionSort 2k", Count,
+		[&Source]()
+		{
+			TVector<int> Values = Source;
+			SelectionSort(Values.Begin(), Values.End(), Less);
+			DoNotOptimize(Values.RawData()[0]);
+		},
+		[&Source]()
+		{
+			std::vector<int> Values(Source.RawData(), Source.RawData() + Count);
+			std::sort(Values.begin(), Values.end(), Less);
+			DoNotOptimize(Values.data()[0]);
+		});
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#pragma once
+
+#include "../Harness.h"
+#include "CommonUtils/RawString.h"
+
+
+void RawStringBenchmarkLength();
+void RawStringBenchmarkCopy();
+void RawStringBenchmarkEqual();
+
+
+inline void RunRawStringBenchmarks()
+{
+	RawStringBenchmarkLength();
+	RawStringBenchmarkCopy();
+	RawStringBenchmarkEqual();
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#pragma once
+
+#include "../Harness.h"
+#include "CommonUtils/Search.h"
+#include "CommonTypes/EytzingerIndex.h"
+#include "CommonTypes/Vector.h"
+
+
+void SearchBenchmarkLowerBound();
+
+
+inline void RunSearchBenchmarks()
+{
+	SearchBenchmarkLowerBound();
+}
\ No newline at end of file
@@ -0,0 +1,18 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#pragma once
+
+#include "../Harness.h"
+#include "CommonUtils/Sort.h"
+#include "CommonTypes/Vector.h"
+
+
+void SortBenchmarkQuickSort();
+void SortBenchmarkQuadratic();
+
+
+inline void RunSortBenchmarks()
+{
+	SortBenchmarkQuickSort();
+	SortBenchmarkQuadratic();
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#pragma once
+
+#include "Vector.h"
+#include "List.h"
+#include "Optional.h"
+#include "SoAVector.h"
+#include "Cache.h"
+#include "ConcurrentHashMap.h"
+#include "BitVector.h"
+#include "BloomFilter.h"
+#include "SlotMap.h"
+#include "FlatMap.h"
+
+
+inline void BenchmarkContainers()
+{
+	RunVectorBenchmarks();
+	RunListBenchmarks();
+	RunOptionalBenchmarks();
+	RunSoAVectorBenchmarks();
+	RunCacheBenchmarks();
+	RunConcurrentHashMapBenchmarks();
+	RunBitVectorBenchmarks();
+	RunBloomFilterBenchmarks();
+	RunSlotMapBenchmarks();
+	RunFlatMapBenchmarks();
+}
\ No newline at end of file
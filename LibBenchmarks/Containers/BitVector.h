@@ -0,0 +1,17 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#pragma once
+
+#include "../Harness.h"
+#include "CommonTypes/BitVector.h"
+
+
+void BitVectorBenchmarkBulk();
+void BitVectorBenchmarkRankSelect();
+
+
+inline void RunBitVectorBenchmarks()
+{
+	BitVectorBenchmarkBulk();
+	BitVectorBenchmarkRankSelect();
+}
\ No newline at end of file
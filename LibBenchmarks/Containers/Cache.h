@@ -0,0 +1,15 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#pragma once
+
+#include "../Harness.h"
+#include "CommonTypes/Cache.h"
+
+
+void CacheBenchmarkZipf();
+
+
+inline void RunCacheBenchmarks()
+{
+	CacheBenchmarkZipf();
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#pragma once
+
+#include "../Harness.h"
+#include "CommonTypes/List.h"
+#include "CommonTypes/IntrusiveList.h"
+
+
+void ListBenchmarkPush();
+void ListBenchmarkTraversal();
+void ListBenchmarkSplice();
+void ListBenchmarkIntrusive();
+
+
+inline void RunListBenchmarks()
+{
+	ListBenchmarkPush();
+	ListBenchmarkTraversal();
+	ListBenchmarkSplice();
+	ListBenchmarkIntrusive();
+}
\ No newline at end of file
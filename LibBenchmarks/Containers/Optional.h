@@ -0,0 +1,19 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#pragma once
+
+#include "../Harness.h"
+#include "CommonTypes/Optional.h"
+
+
+void OptionalBenchmarkConstruct();
+void OptionalBenchmarkCopy();
+void OptionalBenchmarkNiche();
+
+
+inline void RunOptionalBenchmarks()
+{
+	OptionalBenchmarkConstruct();
+	OptionalBenchmarkCopy();
+	OptionalBenchmarkNiche();
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#include "../BitVector.h"
+
+#include <algorithm>	// count
+#include <vector>
+
+using namespace Common;
+
+
+static constexpr size_t BitCount = 10000000;
+
+
+void BitVectorBenchmarkBulk()
+{
+	if (!IsBenchmarkGroupSelected("BitVector"))
+	{
+		return;
+	}
+
+	// sparse membership flags: 1 of 64 ids is set
+	CRandom Random;
+	CBitVector First(BitCount);
+	CBitVector Second(BitCount);
+	std::vector<bool> StdFirst(BitCount);
+	std::vector<bool> StdSecond(BitCount);
+	for (size_t i = 0; i < BitCount / 64; ++i)
+	{
+		const size_t A = Random.Next() % BitCount;
+		const size_t B = Random.Next() % BitCount;
+		First.Set(A);
+		Second.Set(B);
+		StdFirst[A] = true;
+		StdSecond[B] = true;
+	}
+
+	CompareWithStd("BitVector", "Count", BitCount,
+		[&First]()
+		{
+			DoNotOptimize(First.Count());
+		},
+		[&StdFirst]()
+		{
+			DoNotOptimize(std::count(StdFirst.begin(), StdFirst.end(), true));
+		});
+
+	CompareWithStd("BitVector", "AND", BitCount,
+		[&First, &Second]()
+		{
+			CBitVector Result = First;
+			Result &= Second;
+			DoNotOptimize(Result.GetWords()[0]);
+		},
+		[&StdFirst, &StdSecond]()
+		{
+			std::vector<bool> Result = StdFirst;
+			for (size_t i = 0; i < BitCount; ++i)
+			{
+				Result[i] = Result[i] && StdSecond[i];
+			}
+			DoNotOptimize(Result[0]);
+		});
+
+	CompareWithStd("BitVector", "Scan set bits", BitCount,
+		[&First]()
+		{
+			size_t Sum = 0;
+			for (size_t i = First.FindFirst(); i != CBitVector::NotFound;
+				i = First.FindNext(i + 1))
+			{
+				Sum += i;
+			}
+			DoNotOptimize(Sum);
+		},
+		[&StdFirst]()
+		{
+			size_t Sum = 0;
+			for (size_t i = 0; i < BitCount; ++i)
+			{
+				if (StdFirst[i])
+				{
+					Sum += i;
+				}
+			}
+			DoNotOptimize(Sum);
+		});
+}
+
+
+void BitVectorBenchmarkRankSelect()
+{
+	if (!IsBenchmarkGroupSelected("BitVector"))
+	{
+		return;
+	}
+
+	CBitVector Bits(BitCount);
+	CRandom Random;
+	for (size_t i = 0; i < BitCount / 4; ++i)
+	{
+		Bits.Set(Random.Next() % BitCount);
+	}
+	const CRankSelect Index(Bits);
+	constexpr size_t QueryCount = 1000000;
+
+	RunBenchmark("BitVector", "Rank", "Common", QueryCount,
+		[&Index, &Random]()
+		{
+			size_t Sum = 0;
+			for (size_t i = 0; i < QueryCount; ++i)
+			{
+				Sum += Index.Rank(Random.Next() % BitCount);
+			}
+			DoNotOptimize(Sum);
+		});
+
+	RunBenchmark("BitVector", "Select", "Common", QueryCount,
+		[&Index, &Random]()
+		{
+			size_t Sum = 0;
+			for (size_t i = 0; i < QueryCount; ++i)
+			{
+				Sum += Index.Select(Random.Next() % Index.GetCount());
+			}
+			DoNotOptimize(Sum);
+		});
+}
\ No newline at end of file
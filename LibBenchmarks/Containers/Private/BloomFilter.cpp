@@ -0,0 +1,50 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#include "../BloomFilter.h"
+
+using namespace Common;
+
+
+// filter far larger than cache, most queried keys are absent
+static constexpr size_t KeyCount = 2000000;
+static constexpr size_t QueryCount = 1000000;
+
+
+template <typename FilterType>
+static void BenchmarkFilter(const char* const Case, const char* const Name,
+	const double Rate)
+{
+	FilterType Filter(KeyCount, Rate);
+	CRandom Random;
+	for (size_t i = 0; i < KeyCount; ++i)
+	{
+		Filter.Insert(Random.Next());
+	}
+
+	RunBenchmark("BloomFilter", Case, Name, QueryCount,
+		[&Filter, &Random]()
+		{
+			size_t Positives = 0;
+			for (size_t i = 0; i < QueryCount; ++i)
+			{
+				Positives += Filter.MayContain(Random.Next());
+			}
+			DoNotOptimize(Positives);
+		});
+}
+
+
+void BloomFilterBenchmarkQuery()
+{
+	if (!IsBenchmarkGroupSelected("BloomFilter"))
+	{
+		return;
+	}
+
+	BenchmarkFilter<CBloomFilter>("Query p = 0.1", "Classic", 0.1);
+	BenchmarkFilter<CBlockedBloomFilter>("Query p = 0.1", "Blocked", 0.1);
+	BenchmarkFilter<CBloomFilter>("Query p = 0.01", "Classic", 0.01);
+	BenchmarkFilter<CBlockedBloomFilter>("Query p = 0.01", "Blocked", 0.01);
+	BenchmarkFilter<CBloomFilter>("Query p = 0.001", "Classic", 0.001);
+	BenchmarkFilter<CBlockedBloomFilter>("Query p = 0.001", "Blocked", 0.001);
+}
\ No newline at end of file
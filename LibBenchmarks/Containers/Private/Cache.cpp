@@ -0,0 +1,105 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#include "../Cache.h"
+
+#include <algorithm>	// upper_bound
+#include <cmath>		// pow
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+using namespace Common;
+
+
+static constexpr size_t KeySpace = 1000000;
+static constexpr size_t RequestCount = 1000000;
+static constexpr size_t CacheCapacity = KeySpace / 10;
+
+
+// keys with Zipf distribution (s = 0.99): few hot keys, long cold tail
+static std::vector<int> MakeZipfKeys()
+{
+	std::vector<double> Cdf(KeySpace);
+	double Sum = 0;
+	for (size_t i = 0; i < KeySpace; ++i)
+	{
+		Sum += 1.0 / std::pow(static_cast<double>(i + 1), 0.99);
+		Cdf[i] = Sum;
+	}
+
+	CRandom Random;
+	std::vector<int> Keys(RequestCount);
+	for (int& Key : Keys)
+	{
+		const double Point = Random.Next() / 4294967296.0 * Sum;
+		const size_t Rank = static_cast<size_t>(
+			std::upper_bound(Cdf.begin(), Cdf.end(), Point) - Cdf.begin());
+		// scatter ranks so that hot keys are not neighbours
+		Key = static_cast<int>(MixBits(std::min(Rank, KeySpace - 1)) >> 1);
+	}
+	return Keys;
+}
+
+
+void CacheBenchmarkZipf()
+{
+	if (!IsBenchmarkGroupSelected("Cache"))
+	{
+		return;
+	}
+	const std::vector<int> Keys = MakeZipfKeys();
+
+	// get, on miss put: the usual way to use a cache
+	CompareWithStd("Cache", "LRU get or put", RequestCount,
+		[&Keys]()
+		{
+			TLruCache<int, int> Cache(CacheCapacity);
+			for (const int Key : Keys)
+			{
+				if (!Cache.Get(Key))
+				{
+					Cache.Put(Key, Key);
+				}
+			}
+			DoNotOptimize(Cache.GetStats().Hits);
+		},
+		[&Keys]()
+		{
+			typedef std::list<std::pair<int, int>> COrder;
+			COrder Order;
+			std::unordered_map<int, COrder::iterator> Index;
+			Index.reserve(CacheCapacity);
+			uint64_t Hits = 0;
+			for (const int Key : Keys)
+			{
+				auto Found = Index.find(Key);
+				if (Found != Index.end())
+				{
+					Order.splice(Order.end(), Order, Found->second);
+					++Hits;
+					continue;
+				}
+				if (Index.size() == CacheCapacity)
+				{
+					Index.erase(Order.front().first);
+					Order.pop_front();
+				}
+				Index.emplace(Key, Order.insert(Order.end(), { Key, Key }));
+			}
+			DoNotOptimize(Hits);
+		});
+
+	RunBenchmark("Cache", "LFU get or put", "Common", RequestCount,
+		[&Keys]()
+		{
+			TLfuCache<int, int> Cache(CacheCapacity);
+			for (const int Key : Keys)
+			{
+				if (!Cache.Get(Key))
+				{
+					Cache.Put(Key, Key);
+				}
+			}
+			DoNotOptimize(Cache.GetStats().Hits);
+		});
+}
\ No newline at end of file
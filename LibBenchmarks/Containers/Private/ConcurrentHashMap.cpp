@@ -0,0 +1,137 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#include "../ConcurrentHashMap.h"
+
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace Common;
+
+
+static constexpr size_t KeySpace = 100000;
+static constexpr size_t OperationCount = 1000000;
+
+static constexpr unsigned ThreadCounts[] = { 1, 2, 4, 8, 16, 32, 64 };
+static constexpr unsigned ReadPercents[] = { 90, 50 };
+
+// results keep pointers to names, so they are literals
+static const char* const CaseNames[2][7] = {
+	{ "90% reads, 1 thread", "90% reads, 2 threads", "90% reads, 4 threads",
+	"90% reads, 8 threads", "90% reads, 16 threads",
+	"90% reads, 32 threads", "90% reads, 64 threads" },
+	{ "50% reads, 1 thread", "50% reads, 2 threads", "50% reads, 4 threads",
+	"50% reads, 8 threads", "50% reads, 16 threads",
+	"50% reads, 32 threads", "50% reads, 64 threads" }
+};
+
+
+// baseline: one lock for the whole map
+struct CLockedStdMap
+{
+	mutable std::shared_mutex Lock;
+	std::unordered_map<int, int> Map;
+};
+
+
+// splits OperationCount between threads, every thread gets own seed
+template <typename FunctionType>
+static void RunThreads(const unsigned ThreadCount, FunctionType Function)
+{
+	std::vector<std::thread> Threads;
+	for (unsigned t = 0; t < ThreadCount; ++t)
+	{
+		Threads.emplace_back(Function, CRandom(t + 1),
+			OperationCount / ThreadCount);
+	}
+	for (std::thread& Thread : Threads)
+	{
+		Thread.join();
+	}
+}
+
+
+void ConcurrentHashMapBenchmarkScaling()
+{
+	if (!IsBenchmarkGroupSelected("ConcurrentMap"))
+	{
+		return;
+	}
+
+	TConcurrentHashMap<int, int> Map;
+	CLockedStdMap StdMap;
+	Map.Reserve(KeySpace);
+	StdMap.Map.reserve(KeySpace);
+	for (size_t i = 0; i < KeySpace; ++i)
+	{
+		Map.Insert(static_cast<int>(i), 0);
+		StdMap.Map.emplace(static_cast<int>(i), 0);
+	}
+
+	for (size_t Ratio = 0; Ratio < 2; ++Ratio)
+	{
+		const unsigned ReadPercent = ReadPercents[Ratio];
+		for (size_t i = 0; i < 7; ++i)
+		{
+			const unsigned ThreadCount = ThreadCounts[i];
+			CompareWithStd("ConcurrentMap", CaseNames[Ratio][i],
+				OperationCount,
+				[&Map, ReadPercent, ThreadCount]()
+				{
+					RunThreads(ThreadCount,
+						[&Map, ReadPercent](CRandom Random, size_t Count)
+						{
+							int64_t Sum = 0;
+							while (Count--)
+							{
+								const uint32_t Number = Random.Next();
+								const int Key = static_cast<int>(Number % KeySpace);
+								if ((Number >> 24) % 100 < ReadPercent)
+								{
+									Map.FindAndApply(Key, [&Sum](const int& Value)
+										{
+											Sum += Value;
+										});
+								}
+								else
+								{
+									Map.Upsert(Key, static_cast<int>(Count));
+								}
+							}
+							DoNotOptimize(Sum);
+						});
+				},
+				[&StdMap, ReadPercent, ThreadCount]()
+				{
+					RunThreads(ThreadCount,
+						[&StdMap, ReadPercent](CRandom Random, size_t Count)
+						{
+							int64_t Sum = 0;
+							while (Count--)
+							{
+								const uint32_t Number = Random.Next();
+								const int Key = static_cast<int>(Number % KeySpace);
+								if ((Number >> 24) % 100 < ReadPercent)
+								{
+									std::shared_lock<std::shared_mutex> Lock(
+										StdMap.Lock);
+									auto Found = StdMap.Map.find(Key);
+									if (Found != StdMap.Map.end())
+									{
+										Sum += Found->second;
+									}
+								}
+								else
+								{
+									std::unique_lock<std::shared_mutex> Lock(
+										StdMap.Lock);
+									StdMap.Map[Key] = static_cast<int>(Count);
+								}
+							}
+							DoNotOptimize(Sum);
+						});
+				});
+		}
+	}
+}
\ No newline at end of file
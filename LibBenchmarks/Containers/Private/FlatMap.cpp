@@ -0,0 +1,104 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#include "../FlatMap.h"
+
+#include <map>
+#include <vector>
+
+using namespace Common;
+
+
+static constexpr size_t EntryCount = 10000;
+static constexpr size_t QueryCount = 1000000;
+
+
+void FlatMapBenchmarkReadMostly()
+{
+	if (!IsBenchmarkGroupSelected("FlatMap"))
+	{
+		return;
+	}
+
+	CRandom Random;
+	TVector<TPair<uint32_t, uint32_t>> Entries;
+	for (size_t i = 0; i < EntryCount; ++i)
+	{
+		const uint32_t Key = Random.Next();
+		Entries.Push(TPair<uint32_t, uint32_t>(Key, Key / 2));
+	}
+
+	CompareWithStd("FlatMap", "Bulk build", EntryCount,
+		[&Entries]()
+		{
+			TFlatMap<uint32_t, uint32_t> Map;
+			Map.Insert(Entries.Begin(), Entries.End());
+			DoNotOptimize(Map.GetSize());
+		},
+		[&Entries]()
+		{
+			std::map<uint32_t, uint32_t> Map;
+			for (const auto& Entry : Entries)
+			{
+				Map.emplace(Entry.First, Entry.Second);
+			}
+			DoNotOptimize(Map.size());
+		});
+
+	TFlatMap<uint32_t, uint32_t> Map;
+	Map.Insert(Entries.Begin(), Entries.End());
+	std::map<uint32_t, uint32_t> StdMap;
+	for (const auto& Entry : Entries)
+	{
+		StdMap.emplace(Entry.First, Entry.Second);
+	}
+
+	// half of queried keys are present
+	std::vector<uint32_t> Queries(QueryCount);
+	for (uint32_t& Query : Queries)
+	{
+		Query = Random.Next() % 2 ?
+			Entries[Random.Next() % EntryCount].First : Random.Next();
+	}
+
+	CompareWithStd("FlatMap", "Lookup", QueryCount,
+		[&Map, &Queries]()
+		{
+			uint64_t Sum = 0;
+			for (const uint32_t Query : Queries)
+			{
+				const uint32_t* Value = Map.Find(Query);
+				Sum += Value ? *Value : 0;
+			}
+			DoNotOptimize(Sum);
+		},
+		[&StdMap, &Queries]()
+		{
+			uint64_t Sum = 0;
+			for (const uint32_t Query : Queries)
+			{
+				const auto Found = StdMap.find(Query);
+				Sum += Found != StdMap.end() ? Found->second : 0;
+			}
+			DoNotOptimize(Sum);
+		});
+
+	CompareWithStd("FlatMap", "Iterate", Map.GetSize(),
+		[&Map]()
+		{
+			uint64_t Sum = 0;
+			for (const uint32_t Value : Map.GetValues())
+			{
+				Sum += Value;
+			}
+			DoNotOptimize(Sum);
+		},
+		[&StdMap]()
+		{
+			uint64_t Sum = 0;
+			for (const auto& Entry : StdMap)
+			{
+				Sum += Entry.second;
+			}
+			DoNotOptimize(Sum);
+		});
+}
\ No newline at end of file
@@ -0,0 +1,196 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#include "../List.h"
+
+#include <iterator>	// next
+#include <list>
+#include <vector>
+
+using namespace Common;
+
+
+static constexpr size_t ListSize = 100000;
+
+
+struct CListEntry
+{
+	int Value = 0;
+	CIntrusiveListHook Hook;
+};
+
+
+void ListBenchmarkPush()
+{
+	CompareWithStd("List", "Push", ListSize,
+		[]()
+		{
+			TList<int> List;
+			for (size_t i = 0; i < ListSize; ++i)
+			{
+				List.Push(static_cast<int>(i));
+			}
+			DoNotOptimize(List.Back());
+		},
+		[]()
+		{
+			std::list<int> List;
+			for (size_t i = 0; i < ListSize; ++i)
+			{
+				List.push_back(static_cast<int>(i));
+			}
+			DoNotOptimize(List.back());
+		});
+
+	CompareWithStd("List", "Unshift", ListSize,
+		[]()
+		{
+			TList<int> List;
+			for (size_t i = 0; i < ListSize; ++i)
+			{
+				List.Unshift(static_cast<int>(i));
+			}
+			DoNotOptimize(List.Front());
+		},
+		[]()
+		{
+			std::list<int> List;
+			for (size_t i = 0; i < ListSize; ++i)
+			{
+				List.push_front(static_cast<int>(i));
+			}
+			DoNotOptimize(List.front());
+		});
+}
+
+
+void ListBenchmarkTraversal()
+{
+	TList<int> First;
+	std::list<int> Second;
+	for (size_t i = 0; i < ListSize; ++i)
+	{
+		First.Push(static_cast<int>(i));
+		Second.push_back(static_cast<int>(i));
+	}
+
+	CompareWithStd("List", "Traversal sum", ListSize,
+		[&First]()
+		{
+			int64_t Sum = 0;
+			for (auto it = First.Begin(); it != First.End(); ++it)
+			{
+				Sum += *it;
+			}
+			DoNotOptimize(Sum);
+		},
+		[&Second]()
+		{
+			int64_t Sum = 0;
+			for (const int Value : Second)
+			{
+				Sum += Value;
+			}
+			DoNotOptimize(Sum);
+		});
+
+	CompareWithStd("List", "Copy", ListSize,
+		[&First]()
+		{
+			TList<int> Copy(First);
+			DoNotOptimize(Copy.Back());
+		},
+		[&Second]()
+		{
+			std::list<int> Copy(Second);
+			DoNotOptimize(Copy.back());
+		});
+}
+
+
+void ListBenchmarkSplice()
+{
+	TList<int> First(ListSize, 1), FirstOther;
+	std::list<int> Second(ListSize, 1), SecondOther;
+
+	// moves half of the list back and forth, ListSize nodes in total
+	CompareWithStd("List", "Splice half", ListSize,
+		[&First, &FirstOther]()
+		{
+			auto Middle = First.Begin() + ListSize / 2;
+			FirstOther.Splice(FirstOther.End(), First, Middle, First.End());
+			First.Splice(First.End(), FirstOther);
+			DoNotOptimize(First.Back());
+		},
+		[&Second, &SecondOther]()
+		{
+			auto Middle = std::next(Second.begin(), ListSize / 2);
+			SecondOther.splice(SecondOther.end(), Second, Middle,
+				Second.end());
+			Second.splice(Second.end(), SecondOther);
+			DoNotOptimize(Second.back());
+		});
+}
+
+
+void ListBenchmarkIntrusive()
+{
+	// elements are stored elsewhere, lists only link them
+	std::vector<CListEntry> Entries(ListSize);
+	for (size_t i = 0; i < ListSize; ++i)
+	{
+		Entries[i].Value = static_cast<int>(i);
+	}
+
+	CompareWithStd("List", "Link existing", ListSize,
+		[&Entries]()
+		{
+			TIntrusiveList<CListEntry, &CListEntry::Hook> List;
+			for (CListEntry& Entry : Entries)
+			{
+				List.Push(Entry);
+			}
+			DoNotOptimize(List.Back());
+		},
+		[&Entries]()
+		{
+			std::list<CListEntry*> List;
+			for (CListEntry& Entry : Entries)
+			{
+				List.push_back(&Entry);
+			}
+			DoNotOptimize(List.back());
+		});
+
+	// LRU "touch": move pseudo-random element to the back
+	TIntrusiveList<CListEntry, &CListEntry::Hook> Order;
+	std::list<CListEntry*> StdOrder;
+	std::vector<std::list<CListEntry*>::iterator> StdPositions;
+	for (CListEntry& Entry : Entries)
+	{
+		Order.Push(Entry);
+		StdPositions.push_back(StdOrder.insert(StdOrder.end(), &Entry));
+	}
+
+	CompareWithStd("List", "LRU touch", ListSize,
+		[&Entries, &Order]()
+		{
+			size_t Index = 0;
+			for (size_t i = 0; i < ListSize; ++i)
+			{
+				Index = (Index + 7919) % ListSize;
+				Order.MoveToBack(Entries[Index]);
+			}
+			DoNotOptimize(Order.Back());
+		},
+		[&StdOrder, &StdPositions]()
+		{
+			size_t Index = 0;
+			for (size_t i = 0; i < ListSize; ++i)
+			{
+				Index = (Index + 7919) % ListSize;
+				StdOrder.splice(StdOrder.end(), StdOrder,
+					StdPositions[Index]);
+			}
+			DoNotOptimize(StdOrder.back());
+		});
+}
\ No newline at end of file
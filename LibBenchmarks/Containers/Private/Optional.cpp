@@ -0,0 +1,121 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#include "../Optional.h"
+
+#include <optional>
+
+using namespace Common;
+
+
+static constexpr size_t OptionalCount = 100000;
+
+
+void OptionalBenchmarkConstruct()
+{
+	CompareWithStd("Optional", "Construct and read int", OptionalCount,
+		[]()
+		{
+			int64_t Sum = 0;
+			for (size_t i = 0; i < OptionalCount; ++i)
+			{
+				TOptional<int> Optional;
+				if (i % 3)
+				{
+					Optional = static_cast<int>(i);
+				}
+				DoNotOptimize(Optional);
+				Sum += Optional.GetValueOr(0);
+			}
+			DoNotOptimize(Sum);
+		},
+		[]()
+		{
+			int64_t Sum = 0;
+			for (size_t i = 0; i < OptionalCount; ++i)
+			{
+				std::optional<int> Optional;
+				if (i % 3)
+				{
+					Optional = static_cast<int>(i);
+				}
+				DoNotOptimize(Optional);
+				Sum += Optional.value_or(0);
+			}
+			DoNotOptimize(Sum);
+		});
+}
+
+
+void OptionalBenchmarkCopy()
+{
+	// copies of array of optionals show if the type is trivially copyable
+	static TOptional<int> FirstFrom[256];
+	static TOptional<int> FirstTo[256];
+	static std::optional<int> SecondFrom[256];
+	static std::optional<int> SecondTo[256];
+	for (int i = 0; i < 256; i += 2)
+	{
+		FirstFrom[i] = i;
+		SecondFrom[i] = i;
+	}
+
+	CompareWithStd("Optional", "Copy assign int", 256,
+		[]()
+		{
+			for (size_t i = 0; i < 256; ++i)
+			{
+				FirstTo[i] = FirstFrom[i];
+			}
+			DoNotOptimize(FirstTo);
+		},
+		[]()
+		{
+			for (size_t i = 0; i < 256; ++i)
+			{
+				SecondTo[i] = SecondFrom[i];
+			}
+			DoNotOptimize(SecondTo);
+		});
+}
+
+
+void OptionalBenchmarkNiche()
+{
+	// optional pointer without niche is twice bigger, so scan reads more
+	static int Values[OptionalCount];
+	typedef TOptional<int*, TSentinelNiche<int*, nullptr>> CNullNiche;
+	static CNullNiche FirstArray[OptionalCount];
+	static std::optional<int*> SecondArray[OptionalCount];
+	for (size_t i = 0; i < OptionalCount; i += 2)
+	{
+		Values[i] = static_cast<int>(i);
+		FirstArray[i] = &Values[i];
+		SecondArray[i] = &Values[i];
+	}
+
+	CompareWithStd("Optional", "Scan optional pointers", OptionalCount,
+		[]()
+		{
+			int64_t Sum = 0;
+			for (const CNullNiche& Optional : FirstArray)
+			{
+				if (const int* const* Pointer = Optional.TryGetValue())
+				{
+					Sum += **Pointer;
+				}
+			}
+			DoNotOptimize(Sum);
+		},
+		[]()
+		{
+			int64_t Sum = 0;
+			for (const std::optional<int*>& Optional : SecondArray)
+			{
+				if (Optional)
+				{
+					Sum += **Optional;
+				}
+			}
+			DoNotOptimize(Sum);
+		});
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#include "../SlotMap.h"
+
+#include <unordered_map>
+#include <vector>
+
+using namespace Common;
+
+
+static constexpr size_t ObjectCount = 100000;
+static constexpr size_t QueryCount = 1000000;
+
+
+// game-like objects: position and velocity
+struct CObject
+{
+	float Position[3];
+	float Velocity[3];
+};
+
+
+void SlotMapBenchmarkObjects()
+{
+	if (!IsBenchmarkGroupSelected("SlotMap"))
+	{
+		return;
+	}
+
+	// handles of erased objects are kept to mix stale lookups in
+	TSlotMap<CObject> Map;
+	std::unordered_map<uint64_t, CObject> StdMap;
+	std::vector<CSlotHandle> Handles;
+	std::vector<uint64_t> Ids;
+	for (size_t i = 0; i < ObjectCount; ++i)
+	{
+		const CObject Object = { { 1, 2, 3 }, { 0.5f, 0.5f, 0.5f } };
+		Handles.push_back(Map.Insert(Object));
+		Ids.push_back(i);
+		StdMap.emplace(i, Object);
+	}
+	CRandom Random;
+	for (size_t i = 0; i < ObjectCount / 4; ++i)
+	{
+		const size_t Victim = Random.Next() % ObjectCount;
+		Map.Erase(Handles[Victim]);
+		StdMap.erase(Ids[Victim]);
+	}
+
+	CompareWithStd("SlotMap", "Lookup by handle", QueryCount,
+		[&Map, &Handles, &Random]()
+		{
+			float Sum = 0;
+			for (size_t i = 0; i < QueryCount; ++i)
+			{
+				const CObject* Object =
+					Map.Find(Handles[Random.Next() % ObjectCount]);
+				Sum += Object ? Object->Position[0] : 0;
+			}
+			DoNotOptimize(Sum);
+		},
+		[&StdMap, &Ids, &Random]()
+		{
+			float Sum = 0;
+			for (size_t i = 0; i < QueryCount; ++i)
+			{
+				const auto Found = StdMap.find(Ids[Random.Next() % ObjectCount]);
+				Sum += Found != StdMap.end() ? Found->second.Position[0] : 0;
+			}
+			DoNotOptimize(Sum);
+		});
+
+	CompareWithStd("SlotMap", "Update all", Map.GetSize(),
+		[&Map]()
+		{
+			for (CObject& Object : Map.GetValues())
+			{
+				for (int Axis = 0; Axis < 3; ++Axis)
+				{
+					Object.Position[Axis] += Object.Velocity[Axis];
+				}
+			}
+			DoNotOptimize(Map.GetValues()[0].Position[0]);
+		},
+		[&StdMap]()
+		{
+			for (auto& Entry : StdMap)
+			{
+				for (int Axis = 0; Axis < 3; ++Axis)
+				{
+					Entry.second.Position[Axis] += Entry.second.Velocity[Axis];
+				}
+			}
+			DoNotOptimize(StdMap.begin()->second.Position[0]);
+		});
+
+	// spawn and despawn: erase random object, insert a new one
+	CompareWithStd("SlotMap", "Erase and insert", QueryCount,
+		[&Map, &Random]()
+		{
+			TSlotMap<CObject> Copy = Map;
+			TVector<CSlotHandle> Live;
+			Copy.ForEach([&Live](const CSlotHandle Handle, const CObject&)
+				{
+					Live.Push(Handle);
+				});
+			for (size_t i = 0; i < QueryCount; ++i)
+			{
+				const size_t Victim = Random.Next() % Live.GetSize();
+				const CObject Object = Copy[Live[Victim]];
+				Copy.Erase(Live[Victim]);
+				Live[Victim] = Copy.Insert(Object);
+			}
+			DoNotOptimize(Copy.GetSize());
+		},
+		[&StdMap, &Random]()
+		{
+			std::unordered_map<uint64_t, CObject> Copy = StdMap;
+			std::vector<uint64_t> Live;
+			for (const auto& Entry : Copy)
+			{
+				Live.push_back(Entry.first);
+			}
+			uint64_t NextId = ObjectCount;
+			for (size_t i = 0; i < QueryCount; ++i)
+			{
+				const size_t Victim = Random.Next() % Live.size();
+				const CObject Object = Copy[Live[Victim]];
+				Copy.erase(Live[Victim]);
+				Copy.emplace(NextId, Object);
+				Live[Victim] = NextId++;
+			}
+			DoNotOptimize(Copy.size());
+		});
+}
\ No newline at end of file
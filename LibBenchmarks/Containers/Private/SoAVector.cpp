@@ -0,0 +1,89 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#include "../SoAVector.h"
+
+#include <vector>
+
+using namespace Common;
+
+
+static constexpr size_t SoARowCount = 100000;
+
+
+namespace
+{
+	// record of std:: baseline (array of structures)
+	struct CParticle
+	{
+		float X;
+		float Y;
+		float Z;
+		float Mass;
+		int64_t Id;
+	};
+}
+
+typedef TSoAVector<float, float, float, float, int64_t> CParticles;
+
+
+void SoAVectorBenchmarkPush()
+{
+	CompareWithStd("SoAVector", "Push rows", SoARowCount,
+		[]()
+		{
+			CParticles Particles;
+			for (size_t i = 0; i < SoARowCount; ++i)
+			{
+				const float Value = static_cast<float>(i);
+				Particles.Push(Value, Value, Value, 1.0f, int64_t(i));
+			}
+			DoNotOptimize(Particles);
+		},
+		[]()
+		{
+			std::vector<CParticle> Particles;
+			for (size_t i = 0; i < SoARowCount; ++i)
+			{
+				const float Value = static_cast<float>(i);
+				Particles.push_back({Value, Value, Value, 1.0f, int64_t(i)});
+			}
+			DoNotOptimize(Particles);
+		});
+}
+
+
+void SoAVectorBenchmarkColumnScan()
+{
+	// sum of one field reads 4 of 24 bytes per row from array of structs
+	static CParticles FirstParticles;
+	static std::vector<CParticle> SecondParticles;
+	for (size_t i = 0; i < SoARowCount; ++i)
+	{
+		const float Value = static_cast<float>(i % 100);
+		FirstParticles.Push(Value, Value, Value, Value, int64_t(i));
+		SecondParticles.push_back({Value, Value, Value, Value, int64_t(i)});
+	}
+
+	CompareWithStd("SoAVector", "Sum of one field", SoARowCount,
+		[]()
+		{
+			float Sum = 0.0f;
+			for (const float Mass : FirstParticles.GetColumn<3>())
+			{
+				Sum += Mass;
+			}
+			DoNotOptimize(Sum);
+		},
+		[]()
+		{
+			float Sum = 0.0f;
+			for (const CParticle& Particle : SecondParticles)
+			{
+				Sum += Particle.Mass;
+			}
+			DoNotOptimize(Sum);
+		});
+
+	FirstParticles.Clear();
+	SecondParticles = std::vector<CParticle>();
+}
\ No newline at end of file
@@ -0,0 +1,218 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#include "../Vector.h"
+
+#include <algorithm>	// remove_if
+#include <utility>	// pair
+#include <vector>
+
+using namespace Common;
+
+
+static constexpr size_t PushCount = 100000;
+static constexpr size_t QuadraticCount = 2000;	// front insert/erase
+static constexpr size_t IterateCount = 1000000;
+
+
+void VectorBenchmarkPush()
+{
+	CompareWithStd("Vector", "Push int", PushCount,
+		[]()
+		{
+			TVector<int> Vector;
+			for (size_t i = 0; i < PushCount; ++i)
+			{
+				Vector.Push(static_cast<int>(i));
+			}
+			DoNotOptimize(Vector.RawData()[PushCount - 1]);
+		},
+		[]()
+		{
+			std::vector<int> Vector;
+			for (size_t i = 0; i < PushCount; ++i)
+			{
+				Vector.push_back(static_cast<int>(i));
+			}
+			DoNotOptimize(Vector.data()[PushCount - 1]);
+		});
+
+	RunBenchmark("Vector", "Push int", "Common 1.5x growth", PushCount,
+		[]()
+		{
+			TVector<int, COneAndHalfGrowth> Vector;
+			for (size_t i = 0; i < PushCount; ++i)
+			{
+				Vector.Push(static_cast<int>(i));
+			}
+			DoNotOptimize(Vector.RawData()[PushCount - 1]);
+		});
+
+	RunBenchmark("Vector", "Push int", "Common size classes", PushCount,
+		[]()
+		{
+			TVector<int, TSizeClassGrowth<>> Vector;
+			for (size_t i = 0; i < PushCount; ++i)
+			{
+				Vector.Push(static_cast<int>(i));
+			}
+			DoNotOptimize(Vector.RawData()[PushCount - 1]);
+		});
+}
+
+
+void VectorBenchmarkInsert()
+{
+	CompareWithStd("Vector", "Insert front", QuadraticCount,
+		[]()
+		{
+			TVector<int> Vector;
+			for (size_t i = 0; i < QuadraticCount; ++i)
+			{
+				Vector.Insert(0, static_cast<int>(i));
+			}
+			DoNotOptimize(Vector.RawData()[0]);
+		},
+		[]()
+		{
+			std::vector<int> Vector;
+			for (size_t i = 0; i < QuadraticCount; ++i)
+			{
+				Vector.insert(Vector.begin(), static_cast<int>(i));
+			}
+			DoNotOptimize(Vector.data()[0]);
+		});
+
+	// trivial pairs are shifted with memmove, as std::pair in std::vector
+	CompareWithStd("Vector", "Insert front pair", QuadraticCount,
+		[]()
+		{
+			TVector<TPair<int, int>> Vector;
+			for (size_t i = 0; i < QuadraticCount; ++i)
+			{
+				const int Value = static_cast<int>(i);
+				Vector.Insert(0, MakePair(Value, Value));
+			}
+			DoNotOptimize(Vector.RawData()[0]);
+		},
+		[]()
+		{
+			std::vector<std::pair<int, int>> Vector;
+			for (size_t i = 0; i < QuadraticCount; ++i)
+			{
+				const int Value = static_cast<int>(i);
+				Vector.insert(Vector.begin(), std::make_pair(Value, Value));
+			}
+			DoNotOptimize(Vector.data()[0]);
+		});
+}
+
+
+void VectorBenchmarkErase()
+{
+	// filling is a small part of quadratic erase, so it is measured too
+	CompareWithStd("Vector", "Erase front", QuadraticCount,
+		[]()
+		{
+			TVector<int> Vector(QuadraticCount, 1);
+			while (!Vector.IsEmpty())
+			{
+				Vector.Erase(0);
+			}
+			DoNotOptimize(Vector);
+		},
+		[]()
+		{
+			std::vector<int> Vector(QuadraticCount, 1);
+			while (!Vector.empty())
+			{
+				Vector.erase(Vector.begin());
+			}
+			DoNotOptimize(Vector);
+		});
+
+	CompareWithStd("Vector", "Erase odd (EraseIf)", PushCount,
+		[]()
+		{
+			TVector<int> Vector(PushCount, 0);
+			for (size_t i = 0; i < PushCount; ++i)
+			{
+				Vector[i] = static_cast<int>(i);
+			}
+			Vector.EraseIf([](const int Value) { return Value % 2; });
+			DoNotOptimize(Vector.RawData()[0]);
+		},
+		[]()
+		{
+			std::vector<int> Vector(PushCount, 0);
+			for (size_t i = 0; i < PushCount; ++i)
+			{
+				Vector[i] = static_cast<int>(i);
+			}
+			Vector.erase(std::remove_if(Vector.begin(), Vector.end(),
+				[](const int Value) { return Value % 2; }), Vector.end());
+			DoNotOptimize(Vector.data()[0]);
+		});
+}
+
+
+void VectorBenchmarkShift()
+{
+	CompareWithStd("Vector", "Shift", QuadraticCount,
+		[]()
+		{
+			TVector<int> Vector(QuadraticCount, 1);
+			while (!Vector.IsEmpty())
+			{
+				Vector.Shift();
+			}
+			DoNotOptimize(Vector);
+		},
+		[]()
+		{
+			std::vector<int> Vector(QuadraticCount, 1);
+			while (!Vector.empty())
+			{
+				Vector.erase(Vector.begin());
+			}
+			DoNotOptimize(Vector);
+		});
+}
+
+
+void VectorBenchmarkIterate()
+{
+	TVector<int> Vector(IterateCount, 1);
+	std::vector<int> StdVector(IterateCount, 1);
+
+	CompareWithStd("Vector", "Iterate int", IterateCount,
+		[&]()
+		{
+			int Sum = 0;
+			for (auto it = Vector.Begin(); it != Vector.End(); ++it)
+			{
+				Sum += *it;
+			}
+			DoNotOptimize(Sum);
+		},
+		[&]()
+		{
+			int Sum = 0;
+			for (auto it = StdVector.begin(); it != StdVector.end(); ++it)
+			{
+				Sum += *it;
+			}
+			DoNotOptimize(Sum);
+		});
+
+	RunBenchmark("Vector", "Iterate int", "Common safe iterator",
+		IterateCount,
+		[&]()
+		{
+			int Sum = 0;
+			for (auto it = Vector.SafeBegin(); it != Vector.SafeEnd(); ++it)
+			{
+				Sum += *it;
+			}
+			DoNotOptimize(Sum);
+		});
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#pragma once
+
+#include "../Harness.h"
+#include "CommonTypes/SlotMap.h"
+
+
+void SlotMapBenchmarkObjects();
+
+
+inline void RunSlotMapBenchmarks()
+{
+	SlotMapBenchmarkObjects();
+}
\ No newline at end of file
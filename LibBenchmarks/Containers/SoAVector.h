@@ -0,0 +1,17 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#pragma once
+
+#include "../Harness.h"
+#include "CommonTypes/SoAVector.h"
+
+
+void SoAVectorBenchmarkPush();
+void SoAVectorBenchmarkColumnScan();
+
+
+inline void RunSoAVectorBenchmarks()
+{
+	SoAVectorBenchmarkPush();
+	SoAVectorBenchmarkColumnScan();
+}
\ No newline at end of file
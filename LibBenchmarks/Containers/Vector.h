@@ -0,0 +1,23 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#pragma once
+
+#include "../Harness.h"
+#include "CommonTypes/Vector.h"
+
+
+void VectorBenchmarkPush();
+void VectorBenchmarkInsert();
+void VectorBenchmarkErase();
+void VectorBenchmarkShift();
+void VectorBenchmarkIterate();
+
+
+inline void RunVectorBenchmarks()
+{
+	VectorBenchmarkPush();
+	VectorBenchmarkInsert();
+	VectorBenchmarkErase();
+	VectorBenchmarkShift();
+	VectorBenchmarkIterate();
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#pragma once
+
+// RUN IN RELEASE MODE!!
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>	// _ReadWriteBarrier
+#endif
+
+
+/// Measurement of one implementation of one benchmark case.
+struct CBenchmarkResult
+{
+	const char* Group;				// "Vector", "Sort", ...
+	const char* Case;				// operation being measured
+	const char* Implementation;		// "std" rows are baselines
+	size_t OperationsPerRun;
+	size_t Runs;
+	double NanosecondsPerOperation;	// fastest run
+	double OperationsPerSecond;
+	double AllocationsPerOperation;	// operator new calls, all runs
+};
+
+
+/// Small and fast generator; same sequence on every platform.
+class CRandom
+{
+
+public:
+
+	explicit CRandom(uint64_t Seed = 0x9E3779B97F4A7C15ull) noexcept
+		: State(Seed) {};
+
+	uint32_t Next() noexcept
+	{
+		State ^= State >> 12;
+		State ^= State << 25;
+		State ^= State >> 27;
+		return static_cast<uint32_t>((State * 0x2545F4914F6CDD1Dull) >> 32);
+	}
+
+private:
+
+	uint64_t State;
+
+};
+
+
+/// Prevents compiler from removing computation of Value.
+template <typename T>
+inline void DoNotOptimize(const T& Value)
+{
+#if defined(_MSC_VER)
+	extern const volatile void* BenchmarkSink;
+	BenchmarkSink = &Value;
+	_ReadWriteBarrier();
+#else
+	asm volatile("" : : "r,m"(Value) : "memory");
+#endif
+}
+
+
+// Implemented in Private/Harness.cpp
+
+uint64_t GetTimeNanoseconds() noexcept;
+uint64_t GetAllocationCount() noexcept;		// operator new calls since start
+
+/// Minimal total time of runs of one implementation.
+void SetMinBenchmarkTime(uint64_t Nanoseconds) noexcept;
+uint64_t GetMinBenchmarkTime() noexcept;
+
+/// Only groups that contain Filter are run; nullptr runs all.
+void SetBenchmarkFilter(const char* Filter) noexcept;
+bool IsBenchmarkGroupSelected(const char* Group) noexcept;
+
+void AddBenchmarkResult(const CBenchmarkResult& Result);
+
+/// Table with ns/op, throughput, allocations and ratio to std.
+void PrintBenchmarkResults(std::ostream& Stream);
+void WriteBenchmarkJson(std::ostream& Stream);
+
+
+/**
+ * @brief Runs Function until minimal benchmark time passes (at least
+ *		  3 times) and stores the result of the fastest run.
+ * @param OperationsPerRun Number of operations one Function call does
+ * @param Function Callable without arguments; performs the operations
+*/
+template <typename FunctionType>
+void RunBenchmark(const char* Group, const char* Case,
+	const char* Implementation, size_t OperationsPerRun,
+	FunctionType Function)
+{
+	if (!IsBenchmarkGroupSelected(Group))
+	{
+		return;
+	}
+
+	Function();		// warm up caches and allocator
+
+	size_t Runs = 0;
+	uint64_t Total = 0;
+	uint64_t Best = UINT64_MAX;
+	const uint64_t AllocationsBefore = GetAllocationCount();
+	while (Runs < 3 || Total < GetMinBenchmarkTime())
+	{
+		const uint64_t Start = GetTimeNanoseconds();
+		Function();
+		const uint64_t Elapsed = GetTimeNanoseconds() - Start;
+		Total += Elapsed;
+		Best = Elapsed < Best ? Elapsed : Best;
+		++Runs;
+	}
+	const uint64_t Allocations = GetAllocationCount() - AllocationsBefore;
+
+	CBenchmarkResult Result;
+	Result.Group = Group;
+	Result.Case = Case;
+	Result.Implementation = Implementation;
+	Result.OperationsPerRun = OperationsPerRun;
+	Result.Runs = Runs;
+	Result.NanosecondsPerOperation =
+		static_cast<double>(Best ? Best : 1) / OperationsPerRun;
+	Result.OperationsPerSecond = 1e9 / Result.NanosecondsPerOperation;
+	Result.AllocationsPerOperation =
+		static_cast<double>(Allocations) / (Runs * OperationsPerRun);
+	AddBenchmarkResult(Result);
+}
+
+
+/// Runs CommonLibs implementation and its std:: baseline.
+template <typename CommonFunctionType, typename StdFunctionType>
+void CompareWithStd(const char* Group, const char* Case,
+	size_t OperationsPerRun, CommonFunctionType CommonFunction,
+	StdFunctionType StdFunction)
+{
+	RunBenchmark(Group, Case, "Common", OperationsPerRun, CommonFunction);
+	RunBenchmark(Group, Case, "std", OperationsPerRun, StdFunction);
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+// Usage: LibBenchmarks [--filter Group] [--quick] [--json File]
+//	--filter	run only groups which name contains the string
+//	--quick		10 ms per implementation instead of 100 ms
+//	--json		also write results to File ("-" for stdout)
+
+#include <fstream>
+#include <iostream>
+
+#include "Harness.h"
+#include "Containers/All.h"
+#include "Algorithms/All.h"
+#include "CommonUtils/RawString.h"
+
+using namespace Common;
+
+int main(int ArgumentCount, char** Arguments)
+{
+	const char* JsonPath = nullptr;
+	for (int i = 1; i < ArgumentCount; ++i)
+	{
+		if (AreRawStringsEqual(Arguments[i], "--quick"))
+		{
+			SetMinBenchmarkTime(10000000);
+		}
+		else if (AreRawStringsEqual(Arguments[i], "--filter")
+			&& i + 1 < ArgumentCount)
+		{
+			SetBenchmarkFilter(Arguments[++i]);
+		}
+		else if (AreRawStringsEqual(Arguments[i], "--json")
+			&& i + 1 < ArgumentCount)
+		{
+			JsonPath = Arguments[++i];
+		}
+		else
+		{
+			std::cerr << "Unknown argument: " << Arguments[i] << '\n'
+				<< "Usage: LibBenchmarks [--filter Group] [--quick]"
+				" [--json File]\n";
+			return 1;
+		}
+	}
+
+	BenchmarkContainers();
+	BenchmarkAlgorithms();
+
+	if (!JsonPath || !AreRawStringsEqual(JsonPath, "-"))
+	{
+		PrintBenchmarkResults(std::cout);
+	}
+	if (JsonPath && AreRawStringsEqual(JsonPath, "-"))
+	{
+		WriteBenchmarkJson(std::cout);
+	}
+	else if (JsonPath)
+	{
+		std::ofstream Json(JsonPath);
+		if (!Json)
+		{
+			std::cerr << "Can not open " << JsonPath << '\n';
+			return 1;
+		}
+		WriteBenchmarkJson(Json);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,191 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibBenchmarks
+
+#include "../Harness.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>	// snprintf
+#include <cstdlib>	// malloc, free
+#include <cstring>	// strstr
+#include <new>
+#include <ostream>
+
+#include "CommonTypes/Vector.h"
+#include "CommonUtils/RawString.h"
+
+using namespace Common;
+
+
+// Counting every operator new lets std:: baselines and
+// CommonLibs containers be compared the same way. Atomic because
+// multithreaded benchmarks allocate from many threads
+static std::atomic<uint64_t> AllocationCount{ 0 };
+
+void* operator new(const size_t Size)
+{
+	AllocationCount.fetch_add(1, std::memory_order_relaxed);
+	if (void* Pointer = std::malloc(Size ? Size : 1))
+	{
+		return Pointer;
+	}
+#if COMMON_EXCEPTIONS
+	throw std::bad_alloc();
+#else
+	std::abort();
+#endif
+}
+
+void operator delete(void* const Pointer) noexcept
+{
+	std::free(Pointer);
+}
+
+void operator delete(void* const Pointer, size_t) noexcept
+{
+	std::free(Pointer);
+}
+
+
+const volatile void* BenchmarkSink = nullptr;
+
+static uint64_t MinBenchmarkTime = 100000000;	// 0.1 s
+static const char* BenchmarkFilter = nullptr;
+static TVector<CBenchmarkResult> Results;
+
+
+uint64_t GetTimeNanoseconds() noexcept
+{
+	return static_cast<uint64_t>(
+		std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+uint64_t GetAllocationCount() noexcept
+{
+	return AllocationCount.load(std::memory_order_relaxed);
+}
+
+
+
+void SetMinBenchmarkTime(const uint64_t Nanoseconds) noexcept
+{
+	MinBenchmarkTime = Nanoseconds;
+}
+
+
+uint64_t GetMinBenchmarkTime() noexcept
+{
+	return MinBenchmarkTime;
+}
+
+
+void SetBenchmarkFilter(const char* const Filter) noexcept
+{
+	BenchmarkFilter = Filter;
+}
+
+
+bool IsBenchmarkGroupSelected(const char* const Group) noexcept
+{
+	return !BenchmarkFilter || std::strstr(Group, BenchmarkFilter);
+}
+
+
+void AddBenchmarkResult(const CBenchmarkResult& Result)
+{
+	Results.Push(Result);
+}
+
+
+
+// std:: row with the same group and case, or nullptr
+static const CBenchmarkResult* FindBaseline(const CBenchmarkResult& Result)
+{
+	for (const CBenchmarkResult& Other : Results)
+	{
+		if (AreRawStringsEqual(Other.Group, Result.Group) &&
+			AreRawStringsEqual(Other.Case, Result.Case) &&
+			AreRawStringsEqual(Other.Implementation, "std"))
+		{
+			return &Other;
+		}
+	}
+	return nullptr;
+}
+
+
+void PrintBenchmarkResults(std::ostream& Stream)
+{
+	char Line[256];
+	std::snprintf(Line, sizeof(Line), "%-10s %-30s %-18s %12s %12s %10s %8s\n",
+		"Group", "Case", "Implementation", "ns/op", "Mops/s",
+		"allocs/op", "vs std");
+	Stream << Line;
+
+	for (const CBenchmarkResult& Result : Results)
+	{
+		const CBenchmarkResult* Baseline = FindBaseline(Result);
+		char Ratio[16] = "";
+		if (Baseline && Baseline != &Result)
+		{
+			std::snprintf(Ratio, sizeof(Ratio), "x%.2f",
+				Result.NanosecondsPerOperation /
+				Baseline->NanosecondsPerOperation);
+		}
+
+		std::snprintf(Line, sizeof(Line),
+			"%-10s %-30s %-18s %12.2f %12.2f %10.3f %8s\n",
+			Result.Group, Result.Case, Result.Implementation,
+			Result.NanosecondsPerOperation,
+			Result.OperationsPerSecond / 1e6,
+			Result.AllocationsPerOperation, Ratio);
+		Stream << Line;
+	}
+}
+
+
+// benchmark names are literals without quotes, but keep JSON valid
+static void WriteJsonString(std::ostream& Stream, const char* String)
+{
+	Stream << '"';
+	for (; *String; ++String)
+	{
+		if (*String == '"' || *String == '\\')
+		{
+			Stream << '\\';
+		}
+		Stream << *String;
+	}
+	Stream << '"';
+}
+
+
+void WriteBenchmarkJson(std::ostream& Stream)
+{
+	char Number[64];
+	Stream << "{\n  \"benchmarks\": [";
+	for (size_t i = 0; i < Results.GetSize(); ++i)
+	{
+		const CBenchmarkResult& Result = Results[i];
+		Stream << (i ? ",\n" : "\n") << "    { \"group\": ";
+		WriteJsonString(Stream, Result.Group);
+		Stream << ", \"case\": ";
+		WriteJsonString(Stream, Result.Case);
+		Stream << ", \"implementation\": ";
+		WriteJsonString(Stream, Result.Implementation);
+
+		std::snprintf(Number, sizeof(Number), "%.3f",
+			Result.NanosecondsPerOperation);
+		Stream << ", \"operations_per_run\": " << Result.OperationsPerRun
+			<< ", \"runs\": " << Result.Runs
+			<< ", \"ns_per_op\": " << Number;
+		std::snprintf(Number, sizeof(Number), "%.1f",
+			Result.OperationsPerSecond);
+		Stream << ", \"ops_per_second\": " << Number;
+		std::snprintf(Number, sizeof(Number), "%.4f",
+			Result.AllocationsPerOperation);
+		Stream << ", \"allocations_per_op\": " << Number << " }";
+	}
+	Stream << "\n  ]\n}\n";
+}
\ No newline at end of file
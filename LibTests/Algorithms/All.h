@@ -4,9 +4,13 @@
 
 #include "RawString.h"
 #include "Sort.h"
+#include "Search.h"
+#include "AllocationStats.h"
 
 inline void TestAlgorithms()
 {
 	RunRawStringTests();
 	RunSortTests();
+	RunSearchTests();
+	RunAllocationStatsTests();
 }
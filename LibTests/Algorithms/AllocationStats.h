@@ -0,0 +1,21 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#pragma once
+
+// RUN IN DEBUG MODE!!
+
+#include "CommonUtils/AllocationStats.h"
+#include "CommonTypes/Vector.h"
+#include "CommonTypes/List.h"
+#include "CommonUtils/Assert.h"
+
+
+void AllocationStatsTestVector();
+void AllocationStatsTestList();
+
+
+inline void RunAllocationStatsTests()
+{
+	AllocationStatsTestVector();
+	AllocationStatsTestList();
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#include "../AllocationStats.h"
+
+using namespace Common;
+
+
+// own types, so other tests do not affect counters
+struct CVectorProbe { int64_t Value = 0; };
+struct CListProbe { int Value = 0; };
+
+
+void AllocationStatsTestVector()
+{
+	{
+		TVector<CVectorProbe> First;
+		for (int i = 0; i < 5; ++i)
+		{
+			First.Push(CVectorProbe());	// capacity 2, 4, 8
+		}
+		First.Resize(1);				// shrink to 2
+	}
+
+	const CAllocationStats Stats = GetAllocationStats<CVectorProbe>();
+	if (!bAllocationStatsEnabled)
+	{
+		ASSERT(Stats.Allocations == 0 && Stats.TypeName == nullptr &&
+			TakeAllocationSnapshot(nullptr, 0) == 0,
+			"Allocation stats error");
+		return;
+	}
+
+	ASSERT(Stats.ElementSize == 8 && Stats.Allocations == 4 &&
+		Stats.Deallocations == 4 && Stats.AllocatedBytes == 128,
+		"Allocation stats error");
+	ASSERT(Stats.Reallocations == 3 && Stats.MovedBytes == 56 &&
+		Stats.Shrinks == 1 && Stats.ShrinkedBytes == 48,
+		"Allocation stats error");
+	ASSERT(Stats.AllocationSizes[4] == 2 && Stats.AllocationSizes[5] == 1
+		&& Stats.AllocationSizes[6] == 1, "Allocation stats error");
+
+	// snapshot goes to a plain array: a vector would register one more type
+	CAllocationStats Snapshot[64];
+	const size_t Count = TakeAllocationSnapshot(Snapshot, 64);
+	bool bFound = false;
+	for (size_t i = 0; i < Count && i < 64; ++i)
+	{
+		bFound |= Snapshot[i].ElementSize == 8 &&
+			Snapshot[i].AllocatedBytes == 128;
+	}
+	ASSERT(bFound && Count == TakeAllocationSnapshot(nullptr, 0),
+		"Allocation stats error");
+
+	ResetAllocationStats();
+	ASSERT(GetAllocationStats<CVectorProbe>().Allocations == 0,
+		"Allocation stats error");
+}
+
+
+void AllocationStatsTestList()
+{
+	{
+		TList<CListProbe> First;
+		First.Push(CListProbe());
+		First.Push(CListProbe());
+		First.Unshift(CListProbe());
+		First.Pop();
+	}
+
+	const CAllocationStats Stats = GetAllocationStats<CListProbe>();
+	ASSERT(bAllocationStatsEnabled ? Stats.NodeAllocations == 3 &&
+		Stats.NodeDeallocations == 3 && Stats.Allocations == 0
+		: Stats.NodeAllocations == 0, "Allocation stats error");
+}
\ No newline at end of file
@@ -45,3 +45,25 @@ void RawStringTestCopy()
 	CopyRawString("ABCKHDG", Second, 0);
 	ASSERT(AreRawStringsEqual(Second, ""), "Old string copy error");
 }
+
+
+void RawStringTestFind()
+{
+	// every position inside and after 16-byte blocks, and not found
+	char Text[70];
+	for (size_t i = 0; i < sizeof(Text); ++i)
+	{
+		Text[i] = 'a';
+	}
+	for (size_t i = 0; i < sizeof(Text); ++i)
+	{
+		Text[i] = '\n';
+		ASSERT(FindRawByte(Text, Text + sizeof(Text), '\n') == Text + i,
+			"Raw string find error");
+		Text[i] = 'a';
+	}
+	ASSERT(FindRawByte(Text, Text + sizeof(Text), '\n') ==
+		Text + sizeof(Text), "Raw string find error");
+	ASSERT(FindRawByte(Text + 3, Text + 3, 'a') == Text + 3,
+		"Raw string find error");
+}
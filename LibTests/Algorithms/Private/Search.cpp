@@ -0,0 +1,110 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#include "../Search.h"
+
+using namespace Common;
+
+
+void SearchTestBounds()
+{
+	TVector<int> First = { 1,3,3,3,5,7,9 };
+	ASSERT(*LowerBound(First.Begin(), First.End(), 3) == 3 &&
+		LowerBound(First.Begin(), First.End(), 3) == First.Begin() + 1,
+		"Search bounds error");
+	ASSERT(UpperBound(First.Begin(), First.End(), 3) == First.Begin() + 4,
+		"Search bounds error");
+	ASSERT(LowerBound(First.Begin(), First.End(), 10) == First.End() &&
+		LowerBound(First.Begin(), First.End(), 0) == First.Begin(),
+		"Search bounds error");
+	ASSERT(LowerBound(First.Begin(), First.End(), 4) == First.Begin() + 4,
+		"Search bounds error");
+
+	auto Range = EqualRange(First.ConstBegin(), First.ConstEnd(), 3);
+	ASSERT(Range.Second - Range.First == 3, "Search bounds error");
+	Range = EqualRange(First.ConstBegin(), First.ConstEnd(), 4);
+	ASSERT(Range.First == Range.Second, "Search bounds error");
+
+	ASSERT(BinarySearch(First.Begin(), First.End(), 9) &&
+		BinarySearch(First.Begin(), First.End(), 1) &&
+		!BinarySearch(First.Begin(), First.End(), 2) &&
+		!BinarySearch(First.Begin(), First.End(), 10),
+		"Search bounds error");
+
+	TVector<int> Second;
+	ASSERT(LowerBound(Second.Begin(), Second.End(), 1) == Second.End() &&
+		!BinarySearch(Second.Begin(), Second.End(), 1),
+		"Search bounds error");
+
+	// descending order with custom comparator and reverse iterators
+	TVector<int> Third = { 9,7,5,3,1 };
+	auto Greater = [](int First, int Second) { return First > Second; };
+	ASSERT(*LowerBound(Third.Begin(), Third.End(), 6, Greater) == 5,
+		"Search bounds error");
+	ASSERT(*LowerBound(Third.ReverseBegin(), Third.ReverseEnd(), 6) == 7,
+		"Search bounds error");
+}
+
+
+void SearchTestBranchless()
+{
+	TVector<int> First;
+	for (int i = 0; i < 1000; ++i)
+	{
+		First.Push(i / 3 * 2);
+	}
+
+	for (int Value = -1; Value < 700; ++Value)
+	{
+		ASSERT(BranchlessLowerBound(First.Begin(), First.End(), Value) ==
+			LowerBound(First.Begin(), First.End(), Value),
+			"Branchless search error");
+		ASSERT(BranchlessUpperBound(First.Begin(), First.End(), Value) ==
+			UpperBound(First.Begin(), First.End(), Value),
+			"Branchless search error");
+	}
+
+	TVector<int> Second = { 4 };
+	ASSERT(BranchlessLowerBound(Second.Begin(), Second.End(), 4) ==
+		Second.Begin() && BranchlessUpperBound(Second.Begin(),
+		Second.End(), 4) == Second.End(), "Branchless search error");
+
+	Second.Clear();
+	ASSERT(BranchlessLowerBound(Second.Begin(), Second.End(), 4) ==
+		Second.End(), "Branchless search error");
+}
+
+
+void SearchTestEytzinger()
+{
+	TEytzingerIndex<int> First;
+	ASSERT(First.IsEmpty() && First.LowerBound(1) == nullptr,
+		"Eytzinger index error");
+
+	for (size_t Size = 1; Size < 70; ++Size)
+	{
+		TVector<int> Sorted;
+		for (size_t i = 0; i < Size; ++i)
+		{
+			Sorted.Push(static_cast<int>(i) * 2);
+		}
+
+		First.Rebuild(Sorted);
+		ASSERT(First.GetSize() == Size, "Eytzinger index error");
+		for (int Value = -1; Value <= static_cast<int>(Size) * 2; ++Value)
+		{
+			const int* Found = First.LowerBound(Value);
+			auto Expected = LowerBound(Sorted.ConstBegin(),
+				Sorted.ConstEnd(), Value);
+			ASSERT(Expected == Sorted.ConstEnd() ? Found == nullptr
+				: Found != nullptr && *Found == *Expected,
+				"Eytzinger index error");
+			ASSERT(First.Contains(Value) == (Value >= 0 && Value % 2 == 0
+				&& Value < static_cast<int>(Size) * 2),
+				"Eytzinger index error");
+		}
+	}
+
+	First.Rebuild({});
+	ASSERT(First.GetSize() == 0 && !First.Contains(0),
+		"Eytzinger index error");
+}
\ No newline at end of file
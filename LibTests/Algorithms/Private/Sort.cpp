@@ -18,4 +18,28 @@ void BubbleSortTest()
 	*/
 
 	//todo: tests
+}
+
+
+void QuickSortTestOrderedInput()
+{
+	// sorted and reversed input must not recurse once per element
+	TVector<int> Ascending;
+	TVector<int> Descending;
+	for (int i = 0; i < 100000; ++i)
+	{
+		Ascending.Push(i);
+		Descending.Push(100000 - i);
+	}
+	const auto Less = [](const int First, const int Second)
+	{
+		return First < Second;
+	};
+	QuickSort(Ascending.RawData(), Ascending.RawData() + 100000, Less);
+	QuickSort(Descending.RawData(), Descending.RawData() + 100000, Less);
+	for (int i = 0; i < 100000; ++i)
+	{
+		ASSERT(Ascending[i] == i && Descending[i] == i + 1,
+			"Quick sort ordered input error");
+	}
 }
\ No newline at end of file
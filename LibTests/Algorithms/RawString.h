@@ -11,6 +11,7 @@
 void RawStringTestLength();
 void RawStringTestCopy();
 void RawStringTestEqual();
+void RawStringTestFind();
 
 
 inline void RunRawStringTests()
@@ -18,4 +19,5 @@ inline void RunRawStringTests()
 	RawStringTestLength();
 	RawStringTestCopy();
 	RawStringTestEqual();
+	RawStringTestFind();
 }
\ No newline at end of file
@@ -0,0 +1,23 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#pragma once
+
+// RUN IN DEBUG MODE!!
+
+#include "CommonUtils/Search.h"
+#include "CommonTypes/EytzingerIndex.h"
+#include "CommonTypes/Vector.h"
+#include "CommonUtils/Assert.h"
+
+
+void SearchTestBounds();
+void SearchTestBranchless();
+void SearchTestEytzinger();
+
+
+inline void RunSearchTests()
+{
+	SearchTestBounds();
+	SearchTestBranchless();
+	SearchTestEytzinger();
+}
\ No newline at end of file
@@ -4,10 +4,13 @@
 
 #include "CommonUtils/Sort.h"
 #include "CommonTypes/Vector.h"
+#include "CommonUtils/Assert.h"
 
 void BubbleSortTest();
+void QuickSortTestOrderedInput();
 
 inline void RunSortTests()
 {
 	BubbleSortTest();
+	QuickSortTestOrderedInput();
 }
\ No newline at end of file
@@ -4,12 +4,42 @@
 
 #include "Vector.h"
 #include "Optional.h"
+#include "Expected.h"
+#include "SoAVector.h"
+#include "Tuple.h"
+#include "MappedArray.h"
+#include "Serialization.h"
+#include "BufferedLines.h"
 #include "List.h"
+#include "IntrusiveList.h"
+#include "HashMap.h"
+#include "Cache.h"
+#include "ConcurrentHashMap.h"
+#include "BitVector.h"
+#include "Bitset.h"
+#include "BloomFilter.h"
+#include "SlotMap.h"
+#include "FlatMap.h"
 
 
 inline void TestContainers()
 {
 	RunVectorTests();
 	RunOptionalTests();
+	RunExpectedTests();
+	RunSoAVectorTests();
+	RunTupleTests();
+	RunMappedArrayTests();
+	RunSerializationTests();
+	RunBufferedLinesTests();
 	RunListTests();
+	RunIntrusiveListTests();
+	RunHashMapTests();
+	RunCacheTests();
+	RunConcurrentHashMapTests();
+	RunBitVectorTests();
+	RunBitsetTests();
+	RunBloomFilterTests();
+	RunSlotMapTests();
+	RunFlatMapTests();
 }
@@ -0,0 +1,23 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#pragma once
+
+// RUN IN DEBUG MODE!!
+
+#include "CommonTypes/BitVector.h"
+#include "CommonUtils/Assert.h"
+
+
+void BitVectorTestAccess();
+void BitVectorTestBulkOperations();
+void BitVectorTestSearch();
+void BitVectorTestRankSelect();
+
+
+inline void RunBitVectorTests()
+{
+	BitVectorTestAccess();
+	BitVectorTestBulkOperations();
+	BitVectorTestSearch();
+	BitVectorTestRankSelect();
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#pragma once
+
+// RUN IN DEBUG MODE!!
+
+#include "CommonTypes/Bitset.h"
+#include "CommonUtils/Assert.h"
+
+
+void BitsetTestAccess();
+void BitsetTestOperations();
+
+
+inline void RunBitsetTests()
+{
+	BitsetTestAccess();
+	BitsetTestOperations();
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#pragma once
+
+// RUN IN DEBUG MODE!!
+
+#include "CommonTypes/BloomFilter.h"
+#include "CommonUtils/Assert.h"
+
+
+void BloomFilterTestMembership();
+void BloomFilterTestFalsePositives();
+void BloomFilterTestUnion();
+void BloomFilterTestSerialization();
+
+
+inline void RunBloomFilterTests()
+{
+	BloomFilterTestMembership();
+	BloomFilterTestFalsePositives();
+	BloomFilterTestUnion();
+	BloomFilterTestSerialization();
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#pragma once
+
+// RUN IN DEBUG MODE!!
+
+#include "CommonTypes/StringView.h"
+#include "CommonUtils/BufferedStream.h"
+#include "CommonUtils/Assert.h"
+
+
+void BufferedLinesTestStringView();
+void BufferedLinesTestReadLine();
+void BufferedLinesTestLongLines();
+void BufferedLinesTestRecords();
+void BufferedLinesTestWriteLine();
+
+
+inline void RunBufferedLinesTests()
+{
+	BufferedLinesTestStringView();
+	BufferedLinesTestReadLine();
+	BufferedLinesTestLongLines();
+	BufferedLinesTestRecords();
+	BufferedLinesTestWriteLine();
+}
\ No newline at end of file
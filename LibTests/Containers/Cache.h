@@ -0,0 +1,25 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#pragma once
+
+// RUN IN DEBUG MODE!!
+
+#include "CommonTypes/Cache.h"
+#include "CommonUtils/Assert.h"
+
+
+void CacheTestLruOrder();
+void CacheTestLruStats();
+void CacheTestLruErase();
+void CacheTestLfuOrder();
+void CacheTestLfuErase();
+
+
+inline void RunCacheTests()
+{
+	CacheTestLruOrder();
+	CacheTestLruStats();
+	CacheTestLruErase();
+	CacheTestLfuOrder();
+	CacheTestLfuErase();
+}
\ No newline at end of file
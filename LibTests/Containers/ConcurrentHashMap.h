@@ -0,0 +1,21 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#pragma once
+
+// RUN IN DEBUG MODE!!
+
+#include "CommonTypes/ConcurrentHashMap.h"
+#include "CommonUtils/Assert.h"
+
+
+void ConcurrentHashMapTestOperations();
+void ConcurrentHashMapTestShards();
+void ConcurrentHashMapTestThreads();
+
+
+inline void RunConcurrentHashMapTests()
+{
+	ConcurrentHashMapTestOperations();
+	ConcurrentHashMapTestShards();
+	ConcurrentHashMapTestThreads();
+}
\ No newline at end of file
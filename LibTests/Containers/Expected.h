@@ -0,0 +1,21 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#pragma once
+
+// RUN IN DEBUG MODE!!
+
+#include "CommonTypes/Expected.h"
+#include "CommonUtils/Assert.h"
+
+
+void ExpectedTestConstructors();
+void ExpectedTestMonadic();
+void ExpectedTestNonTrivial();
+
+
+inline void RunExpectedTests()
+{
+	ExpectedTestConstructors();
+	ExpectedTestMonadic();
+	ExpectedTestNonTrivial();
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#pragma once
+
+// RUN IN DEBUG MODE!!
+
+#include "CommonTypes/FlatMap.h"
+#include "CommonUtils/Assert.h"
+
+
+void FlatMapTestInsertFind();
+void FlatMapTestBulkInsert();
+void FlatMapTestErase();
+void FlatSetTestOperations();
+
+
+inline void RunFlatMapTests()
+{
+	FlatMapTestInsertFind();
+	FlatMapTestBulkInsert();
+	FlatMapTestErase();
+	FlatSetTestOperations();
+}
\ No newline at end of file
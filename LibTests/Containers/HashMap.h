@@ -0,0 +1,25 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#pragma once
+
+// RUN IN DEBUG MODE!!
+
+#include "CommonTypes/HashMap.h"
+#include "CommonUtils/Assert.h"
+
+
+void HashMapTestInsertFind();
+void HashMapTestErase();
+void HashMapTestCollisions();
+void HashMapTestCopyMove();
+void HashMapTestStringKeys();
+
+
+inline void RunHashMapTests()
+{
+	HashMapTestInsertFind();
+	HashMapTestErase();
+	HashMapTestCollisions();
+	HashMapTestCopyMove();
+	HashMapTestStringKeys();
+}
\ No newline at end of file
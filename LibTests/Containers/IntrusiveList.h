@@ -0,0 +1,23 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#pragma once
+
+// RUN IN DEBUG MODE!!
+
+#include "CommonTypes/IntrusiveList.h"
+#include "CommonUtils/Assert.h"
+
+
+void IntrusiveListTestLinks();
+void IntrusiveListTestIterators();
+void IntrusiveListTestSeveralLists();
+void IntrusiveListTestLifetime();
+
+
+inline void RunIntrusiveListTests()
+{
+	IntrusiveListTestLinks();
+	IntrusiveListTestIterators();
+	IntrusiveListTestSeveralLists();
+	IntrusiveListTestLifetime();
+}
\ No newline at end of file
@@ -5,10 +5,24 @@
 #include <iostream>
 
 #include "CommonTypes/List.h"
+#include "CommonUtils/Assert.h"
+#include "CommonUtils/AllocationStats.h"
 
 void ListTestConstructors();
+void ListTestTry();
+void ListTestCheckedIterators();
+void ListTestInsertErase();
+void ListTestSplice();
+void ListTestMerge();
+void ListTestReverseUnique();
 
 inline void RunListTests()
 {
 	ListTestConstructors();
+	ListTestTry();
+	ListTestCheckedIterators();
+	ListTestInsertErase();
+	ListTestSplice();
+	ListTestMerge();
+	ListTestReverseUnique();
 }
\ No newline at end of file
@@ -0,0 +1,19 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#pragma once
+
+// RUN IN DEBUG MODE!!
+
+#include "CommonTypes/MappedArray.h"
+#include "CommonUtils/Assert.h"
+
+
+void MappedArrayTestRead();
+void MappedArrayTestErrors();
+
+
+inline void RunMappedArrayTests()
+{
+	MappedArrayTestRead();
+	MappedArrayTestErrors();
+}
\ No newline at end of file
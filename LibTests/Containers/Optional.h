@@ -9,9 +9,19 @@
 
 
 void OptionalTestAllocation();
+void OptionalTestTry();
+void OptionalTestTrivial();
+void OptionalTestNiche();
+void OptionalTestEmplace();
+void OptionalTestReference();
 
 
 inline void RunOptionalTests()
 {
 	OptionalTestAllocation();
+	OptionalTestTry();
+	OptionalTestTrivial();
+	OptionalTestNiche();
+	OptionalTestEmplace();
+	OptionalTestReference();
 }
\ No newline at end of file
@@ -0,0 +1,163 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#include "..\BitVector.h"
+
+#include <vector>
+
+using namespace Common;
+
+
+// pseudo-random bits with given density, and their plain copy
+static CBitVector MakeBits(const size_t Size, const unsigned Percent,
+	std::vector<bool>& OutReference)
+{
+	CBitVector Bits(Size);
+	OutReference.assign(Size, false);
+	uint64_t State = 12345;
+	for (size_t i = 0; i < Size; ++i)
+	{
+		State = State * 6364136223846793005ull + 1442695040888963407ull;
+		if ((State >> 33) % 100 < Percent)
+		{
+			Bits.Set(i);
+			OutReference[i] = true;
+		}
+	}
+	return Bits;
+}
+
+
+void BitVectorTestAccess()
+{
+	CBitVector Bits;
+	ASSERT(Bits.IsEmpty() && Bits.Count() == 0 && !Bits.Any(),
+		"Bit vector access error");
+
+	for (size_t i = 0; i < 200; ++i)
+	{
+		Bits.Push(i % 3 == 0);
+	}
+	ASSERT(Bits.GetSize() == 200 && Bits.Count() == 67 &&
+		Bits.GetWords().GetSize() == 4, "Bit vector access error");
+	for (size_t i = 0; i < 200; ++i)
+	{
+		ASSERT(Bits.Test(i) == (i % 3 == 0), "Bit vector access error");
+	}
+
+	Bits.Set(1);
+	Bits.Reset(0);
+	Bits.Flip(2);
+	Bits.Flip(3);
+	Bits.Assign(4, true);
+	ASSERT(Bits.Test(1) && !Bits.Test(0) && Bits.Test(2) && !Bits.Test(3) &&
+		Bits.Test(4) && Bits.Count() == 68, "Bit vector access error");
+
+	// bits after size stay 0 in the last word
+	Bits.SetAll();
+	ASSERT(Bits.Count() == 200 && Bits.GetWords()[3] == 0xFF,
+		"Bit vector access error");
+	Bits.Resize(70);
+	Bits.Resize(130, false);
+	ASSERT(Bits.Count() == 70 && !Bits.Test(70) && !Bits.Test(129),
+		"Bit vector access error");
+	Bits.Resize(140, true);
+	ASSERT(Bits.Count() == 80 && Bits.Test(139) && !Bits.Test(129),
+		"Bit vector access error");
+
+	const CBitVector Ones(100, true);
+	ASSERT(Ones.Count() == 100 && Ones.GetWords()[1] == 0xFFFFFFFFFull,
+		"Bit vector access error");
+	Bits.ResetAll();
+	Bits.Clear();
+	ASSERT(Bits.IsEmpty() && Bits.Count() == 0, "Bit vector access error");
+}
+
+
+void BitVectorTestBulkOperations()
+{
+	std::vector<bool> First;
+	const CBitVector A = MakeBits(1000, 50, First);
+	CBitVector B(1000);
+	for (size_t i = 0; i < 1000; i += 7)
+	{
+		B.Set(i);
+	}
+
+	CBitVector And = A;
+	And &= B;
+	CBitVector Or = A;
+	Or |= B;
+	CBitVector Xor = A;
+	Xor ^= B;
+	CBitVector AndNot = A;
+	AndNot.AndNot(B);
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		const bool bA = First[i];
+		const bool bB = i % 7 == 0;
+		ASSERT(And.Test(i) == (bA && bB) && Or.Test(i) == (bA || bB) &&
+			Xor.Test(i) == (bA != bB) && AndNot.Test(i) == (bA && !bB),
+			"Bit vector bulk operations error");
+	}
+
+	CBitVector Restored = Xor;
+	Restored ^= B;
+	ASSERT(Restored == A && Restored != B && !(A == CBitVector(999)),
+		"Bit vector bulk operations error");
+	ASSERT(And.Count() + Xor.Count() == Or.Count(),
+		"Bit vector bulk operations error");
+}
+
+
+void BitVectorTestSearch()
+{
+	CBitVector Bits(1000);
+	ASSERT(Bits.FindFirst() == CBitVector::NotFound,
+		"Bit vector search error");
+
+	const size_t Positions[] = { 0, 63, 64, 200, 511, 999 };
+	for (const size_t Position : Positions)
+	{
+		Bits.Set(Position);
+	}
+	size_t Index = 0;
+	for (size_t i = Bits.FindFirst(); i != CBitVector::NotFound;
+		i = Bits.FindNext(i + 1))
+	{
+		ASSERT(Index < 6 && i == Positions[Index], "Bit vector search error");
+		++Index;
+	}
+	ASSERT(Index == 6 && Bits.FindNext(201) == 511 &&
+		Bits.FindNext(5000) == CBitVector::NotFound,
+		"Bit vector search error");
+}
+
+
+void BitVectorTestRankSelect()
+{
+	const size_t Sizes[] = { 0, 1, 64, 512, 1000, 4096, 10007 };
+	const unsigned Densities[] = { 0, 3, 50, 100 };
+	for (const size_t Size : Sizes)
+	{
+		for (const unsigned Density : Densities)
+		{
+			std::vector<bool> Reference;
+			const CBitVector Bits = MakeBits(Size, Density, Reference);
+			const CRankSelect Index(Bits);
+
+			size_t Ones = 0;
+			for (size_t i = 0; i <= Size; ++i)
+			{
+				ASSERT(Index.Rank(i) == Ones, "Rank select error");
+				if (i < Size && Reference[i])
+				{
+					ASSERT(Index.Select(Ones) == i, "Rank select error");
+					++Ones;
+				}
+			}
+			ASSERT(Index.GetCount() == Ones && Bits.Count() == Ones &&
+				Index.Select(Ones) == CRankSelect::NotFound,
+				"Rank select error");
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#include "..\Bitset.h"
+
+using namespace Common;
+
+
+void BitsetTestAccess()
+{
+	TBitset<100> Bits;
+	ASSERT(Bits.GetSize() == 100 && !Bits.Any() && Bits.Count() == 0 &&
+		sizeof(Bits) == 16, "Bitset access error");
+
+	Bits.Set(0);
+	Bits.Set(64);
+	Bits.Set(99);
+	Bits.Flip(1);
+	Bits.Flip(0);
+	Bits.Assign(50, true);
+	Bits.Reset(64);
+	ASSERT(!Bits.Test(0) && Bits.Test(1) && Bits.Test(50) &&
+		!Bits.Test(64) && Bits.Test(99) && Bits.Count() == 3,
+		"Bitset access error");
+	ASSERT(Bits.FindFirst() == 1 && Bits.FindNext(2) == 50 &&
+		Bits.FindNext(51) == 99 && Bits.FindNext(100) == Bits.NotFound,
+		"Bitset access error");
+
+	Bits.SetAll();
+	ASSERT(Bits.All() && Bits.Count() == 100 && Bits.GetWords()[1] ==
+		0xFFFFFFFFFull, "Bitset access error");
+	Bits.Reset(70);
+	ASSERT(!Bits.All(), "Bitset access error");
+	Bits.ResetAll();
+	ASSERT(!Bits.Any() && Bits.FindFirst() == Bits.NotFound,
+		"Bitset access error");
+
+	TBitset<64> Word;
+	Word.SetAll();
+	ASSERT(Word.All() && Word.Count() == 64, "Bitset access error");
+}
+
+
+void BitsetTestOperations()
+{
+	TBitset<130> First;
+	TBitset<130> Second;
+	for (size_t i = 0; i < 130; i += 2)
+	{
+		First.Set(i);
+	}
+	for (size_t i = 0; i < 130; i += 3)
+	{
+		Second.Set(i);
+	}
+
+	const TBitset<130> And = First & Second;
+	const TBitset<130> Or = First | Second;
+	const TBitset<130> Xor = First ^ Second;
+	TBitset<130> AndNot = First;
+	AndNot.AndNot(Second);
+	for (size_t i = 0; i < 130; ++i)
+	{
+		const bool bFirst = i % 2 == 0;
+		const bool bSecond = i % 3 == 0;
+		ASSERT(And.Test(i) == (bFirst && bSecond) &&
+			Or.Test(i) == (bFirst || bSecond) &&
+			Xor.Test(i) == (bFirst != bSecond) &&
+			AndNot.Test(i) == (bFirst && !bSecond),
+			"Bitset operations error");
+	}
+	ASSERT((Xor ^ Second) == First && (And | AndNot) == First &&
+		And != Or, "Bitset operations error");
+}
\ No newline at end of file
@@ -0,0 +1,190 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#include "..\BloomFilter.h"
+
+using namespace Common;
+
+
+// share of absent keys (from Begin) that filter reports as present
+template <typename FilterType>
+static double MeasureFalsePositives(const FilterType& Filter,
+	const int Begin, const int Count)
+{
+	int Positives = 0;
+	for (int i = Begin; i < Begin + Count; ++i)
+	{
+		Positives += Filter.MayContain(i);
+	}
+	return static_cast<double>(Positives) / Count;
+}
+
+
+template <typename FilterType>
+static void TestMembership()
+{
+	FilterType Empty;
+	ASSERT(!Empty.MayContain(1) && Empty.GetBitCount() == 0,
+		"Bloom filter membership error");
+
+	FilterType Filter(10000, 0.01);
+	for (int i = 0; i < 10000; ++i)
+	{
+		Filter.Insert(i * 3);
+	}
+	const char Text[] = "some key";
+	Filter.InsertBytes(Text, sizeof(Text) - 1);
+	for (int i = 0; i < 10000; ++i)
+	{
+		ASSERT(Filter.MayContain(i * 3), "Bloom filter membership error");
+	}
+	ASSERT(Filter.MayContainBytes(Text, sizeof(Text) - 1) &&
+		Filter.MayContainHash(HashBytes(Text, sizeof(Text) - 1)),
+		"Bloom filter membership error");
+
+	Filter.Clear();
+	ASSERT(!Filter.MayContain(3) && Filter.EstimateFalsePositiveRate() == 0,
+		"Bloom filter membership error");
+}
+
+
+template <typename FilterType>
+static void TestFalsePositives(const double Rate)
+{
+	FilterType Filter(20000, Rate);
+	for (int i = 0; i < 20000; ++i)
+	{
+		Filter.Insert(i);
+	}
+	const double Measured = MeasureFalsePositives(Filter, 1000000, 200000);
+	const double Estimated = Filter.EstimateFalsePositiveRate();
+	// sizes are rounded up, so both rates are usually well below target
+	ASSERT(Measured <= Rate && Estimated <= Rate,
+		"Bloom filter false positives error");
+}
+
+
+template <typename FilterType>
+static void TestUnion()
+{
+	FilterType First(1000, 0.01);
+	FilterType Second(1000, 0.01);
+	FilterType Other(100000, 0.01);
+	ASSERT(First.IsCompatible(Second) && !First.IsCompatible(Other),
+		"Bloom filter union error");
+
+	for (int i = 0; i < 500; ++i)
+	{
+		First.Insert(i);
+		Second.Insert(-1 - i);
+	}
+	FilterType United = First;
+	United.Union(Second);
+	for (int i = 0; i < 500; ++i)
+	{
+		ASSERT(United.MayContain(i) && United.MayContain(-1 - i),
+			"Bloom filter union error");
+	}
+	ASSERT(MeasureFalsePositives(United, 10000, 10000) < 0.02,
+		"Bloom filter union error");
+}
+
+
+template <typename FilterType>
+static void TestSerialization()
+{
+	FilterType Filter(5000, 0.02);
+	for (int i = 0; i < 5000; ++i)
+	{
+		Filter.Insert(i);
+	}
+
+	TVector<char> Bytes;
+	CMemorySink Sink(Bytes);
+	{
+		TBufferedWriter<CMemorySink> Writer(Sink, 64);
+		Serialize(Writer, Filter);
+		Serialize(Writer, FilterType());
+		Writer.Flush();
+	}
+
+	FilterType Restored;
+	FilterType Empty(10, 0.1);
+	CMemorySource Source(Bytes.RawData(), Bytes.GetSize());
+	TBufferedReader<CMemorySource> Reader(Source, 64);
+	Deserialize(Reader, Restored);
+	Deserialize(Reader, Empty);
+	ASSERT(Reader.IsEnd() && Restored.IsCompatible(Filter) &&
+		Empty.GetBitCount() == 0, "Bloom filter serialization error");
+	for (int i = 0; i < 5000; ++i)
+	{
+		ASSERT(Restored.MayContain(i), "Bloom filter serialization error");
+	}
+	ASSERT(MeasureFalsePositives(Restored, 10000, 10000) ==
+		MeasureFalsePositives(Filter, 10000, 10000),
+		"Bloom filter serialization error");
+
+	// size that is not a power of two
+	const char Bad[] = { 3, 3, 0, 0, 0 };
+	CMemorySource BadSource(Bad, sizeof(Bad));
+	TBufferedReader<CMemorySource> BadReader(BadSource, 64);
+	bool bThrown = false;
+	COMMON_TRY
+	{
+		Deserialize(BadReader, Restored);
+	}
+	COMMON_CATCH_ALL
+	{
+		bThrown = true;
+	}
+	ASSERT(bThrown && Restored.GetBitCount() == 0,
+		"Bloom filter serialization error");
+
+	// input that ends in the middle of the bits
+	Restored = Filter;
+	CMemorySource CutSource(Bytes.RawData(), Bytes.GetSize() / 4);
+	TBufferedReader<CMemorySource> CutReader(CutSource, 64);
+	bThrown = false;
+	COMMON_TRY
+	{
+		Deserialize(CutReader, Restored);
+	}
+	COMMON_CATCH_ALL
+	{
+		bThrown = true;
+	}
+	ASSERT(bThrown && Restored.GetBitCount() == 0 &&
+		!Restored.MayContain(1), "Bloom filter serialization error");
+}
+
+
+
+void BloomFilterTestMembership()
+{
+	TestMembership<CBloomFilter>();
+	TestMembership<CBlockedBloomFilter>();
+}
+
+
+void BloomFilterTestFalsePositives()
+{
+	const double Rates[] = { 0.1, 0.01, 0.001 };
+	for (const double Rate : Rates)
+	{
+		TestFalsePositives<CBloomFilter>(Rate);
+		TestFalsePositives<CBlockedBloomFilter>(Rate);
+	}
+}
+
+
+void BloomFilterTestUnion()
+{
+	TestUnion<CBloomFilter>();
+	TestUnion<CBlockedBloomFilter>();
+}
+
+
+void BloomFilterTestSerialization()
+{
+	TestSerialization<CBloomFilter>();
+	TestSerialization<CBlockedBloomFilter>();
+}
\ No newline at end of file
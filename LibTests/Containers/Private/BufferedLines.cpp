@@ -0,0 +1,164 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#include "..\BufferedLines.h"
+
+#include <string>
+
+#include "CommonTypes/Serialization.h"	// WriteVarUInt, ReadVarUInt
+
+using namespace Common;
+
+
+// reads all lines of Text with given buffer size, joins them with '|'
+static std::string JoinLines(const char* const Text,
+	const size_t BufferSize)
+{
+	const TStringView<char> View(Text);
+	CMemorySource Source(View.RawData(), View.GetSize());
+	TBufferedReader<CMemorySource> Reader(Source, BufferSize);
+	std::string Result;
+	TStringView<char> Line;
+	while (Reader.ReadLine(Line))
+	{
+		Result.append(Line.RawData(), Line.GetSize());
+		Result += '|';
+	}
+	ASSERT(!Reader.ReadLine(Line), "Buffered lines end error");
+	return Result;
+}
+
+
+void BufferedLinesTestStringView()
+{
+	const TStringView<char> Text("key=value");
+	ASSERT(Text.GetSize() == 9 && Text[3] == '=', "String view error");
+	ASSERT(Text.Find('=') == 3 && Text.Find('=', 4) ==
+		TStringView<char>::NotFound, "String view find error");
+	ASSERT(Text.Subview(0, 3) == "key" && Text.Subview(4) == "value",
+		"String view subview error");
+	ASSERT(Text.StartsWith("key") && !Text.StartsWith("value") &&
+		!TStringView<char>("k").StartsWith("key"),
+		"String view prefix error");
+	ASSERT(TStringView<char>().IsEmpty() && TStringView<char>("") ==
+		TStringView<char>() && Text != "key=valuE", "String view error");
+
+	size_t Count = 0;
+	for (const char Char : Text.Subview(4))
+	{
+		Count += Char == 'e';
+	}
+	const TSpan<const char> Span = Text;
+	ASSERT(Count == 1 && Span.GetSize() == 9 && Span.RawData() ==
+		Text.RawData(), "String view iteration error");
+}
+
+
+void BufferedLinesTestReadLine()
+{
+	ASSERT(JoinLines("", 16) == "", "Buffered lines error");
+	ASSERT(JoinLines("\n", 16) == "|", "Buffered lines error");
+	ASSERT(JoinLines("a\nbc\n\ndef", 16) == "a|bc||def|",
+		"Buffered lines error");
+	ASSERT(JoinLines("a\r\nb\r\n", 16) == "a\r|b\r|",
+		"Buffered lines CRLF error");
+
+	// lines that cross the end of buffer are moved to its front
+	ASSERT(JoinLines("12345\n1234567\n12\n", 8) == "12345|1234567|12|",
+		"Buffered lines refill error");
+}
+
+
+void BufferedLinesTestLongLines()
+{
+	std::string Text;
+	std::string Expected;
+	for (size_t Length = 0; Length < 100; Length += 7)
+	{
+		const std::string Line(Length, char('a' + Length % 26));
+		Text += Line + '\n';
+		Expected += Line + '|';
+	}
+	Text += std::string(50, 'z');	// no '\n' at the end
+	Expected += std::string(50, 'z') + '|';
+
+	// buffer of 4 bytes grows for every longer line
+	ASSERT(JoinLines(Text.c_str(), 4) == Expected,
+		"Buffered lines growth error");
+	ASSERT(JoinLines(Text.c_str(), 1) == Expected,
+		"Buffered lines growth error");
+}
+
+
+void BufferedLinesTestRecords()
+{
+	TVector<char> Bytes;
+	CMemorySink Sink(Bytes);
+	{
+		TBufferedWriter<CMemorySink> Writer(Sink, 8);
+		for (size_t Length : {3, 0, 20, 5})
+		{
+			WriteVarUInt(Writer, Length);
+			Writer.Write(std::string(Length, char('0' + Length % 10)).data(),
+				Length);
+		}
+		Writer.Flush();
+	}
+
+	CMemorySource Source(Bytes.RawData(), Bytes.GetSize());
+	TBufferedReader<CMemorySource> Reader(Source, 8);
+	for (size_t Length : {3, 0, 20, 5})
+	{
+		const size_t Size = static_cast<size_t>(ReadVarUInt(Reader));
+		const TSpan<const char> Record = Reader.ReadView(Size);
+		ASSERT(Record.GetSize() == Length, "Buffered records error");
+		for (const char Char : Record)
+		{
+			ASSERT(Char == char('0' + Length % 10), "Buffered records error");
+		}
+	}
+	ASSERT(Reader.IsEnd(), "Buffered records error");
+
+	CMemorySource Short(Bytes.RawData(), 3);
+	TBufferedReader<CMemorySource> ShortReader(Short, 8);
+	ReadVarUInt(ShortReader);
+	bool bThrown = false;
+	try
+	{
+		ShortReader.ReadView(3);
+	}
+	catch (const CBadFormat&)
+	{
+		bThrown = true;
+	}
+	ASSERT(bThrown, "Buffered records end error");
+
+	// records split by other delimiter
+	const char Fields[] = "a,bb,,c";
+	CMemorySource FieldSource(Fields, sizeof(Fields) - 1);
+	TBufferedReader<CMemorySource> FieldReader(FieldSource, 2);
+	std::string Joined;
+	TStringView<char> Field;
+	while (FieldReader.ReadDelimited(',', Field))
+	{
+		Joined.append(Field.RawData(), Field.GetSize());
+		Joined += '|';
+	}
+	ASSERT(Joined == "a|bb||c|", "Buffered records delimiter error");
+}
+
+
+void BufferedLinesTestWriteLine()
+{
+	TVector<char> Bytes;
+	CMemorySink Sink(Bytes);
+	{
+		TBufferedWriter<CMemorySink> Writer(Sink, 4);
+		Writer.WriteLine("abc");	// fills buffer
+		Writer.WriteLine("");	// flushes before '\n'
+		Writer.Write(TStringView<char>("de"));
+		Writer.WriteLine("fghij");	// bypasses buffer
+		Writer.Flush();
+	}
+	ASSERT(TStringView<char>(Bytes.RawData(), Bytes.GetSize()) ==
+		"abc\n\ndefghij\n", "Buffered write line error");
+}
\ No newline at end of file
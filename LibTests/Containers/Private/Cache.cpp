@@ -0,0 +1,244 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#include "..\Cache.h"
+
+#include <string>
+
+using namespace Common;
+
+
+// remembers evicted keys
+struct CEvictionLog
+{
+	TVector<int>* Keys;
+
+	void operator () (const int& Key, std::string&) const
+	{
+		Keys->Push(Key);
+	}
+};
+
+
+// throws while bThrow is set
+struct CThrowingEviction
+{
+	bool* bThrow;
+
+	void operator () (const int&, int&) const
+	{
+		if (*bThrow)
+		{
+			COMMON_THROW(CDoesNotExist("Eviction failed"));
+		}
+	}
+};
+
+
+typedef TLruCache<int, int, THash<int>, CThrowingEviction> CThrowingLruCache;
+typedef TLfuCache<int, int, THash<int>, CThrowingEviction> CThrowingLfuCache;
+
+
+// failed eviction callback must not cost a slot of capacity
+template <typename CacheType>
+static bool KeepsCapacityOnThrow()
+{
+	bool bThrow = false;
+	CacheType Cache(2, CThrowingEviction{ &bThrow });
+	Cache.Put(1, 1);
+	Cache.Put(2, 2);
+	bThrow = true;
+	bool bThrown = false;
+	COMMON_TRY
+	{
+		Cache.Put(3, 3);
+	}
+	COMMON_CATCH_ALL
+	{
+		bThrown = true;
+	}
+	bThrow = false;
+	if (!bThrown || Cache.GetSize() != 1 || Cache.Peek(1) || Cache.Peek(3))
+	{
+		return false;
+	}
+	// freed slot is reused without another eviction
+	Cache.Put(3, 3);
+	return Cache.GetSize() == 2 && Cache.Peek(2) && Cache.Peek(3) &&
+		Cache.GetStats().Evictions == 1;
+}
+
+
+static bool AreKeysEqual(const TVector<int>& Keys, const int* Expected,
+	const size_t Size)
+{
+	if (Keys.GetSize() != Size)
+	{
+		return false;
+	}
+	for (size_t i = 0; i < Size; ++i)
+	{
+		if (Keys[i] != Expected[i])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+
+void CacheTestLruOrder()
+{
+	TVector<int> Evicted;
+	TLruCache<int, std::string, THash<int>, CEvictionLog> Cache(3,
+		CEvictionLog{ &Evicted });
+	ASSERT(Cache.IsEmpty() && Cache.GetCapacity() == 3,
+		"LRU cache order error");
+
+	Cache.Put(1, "a");
+	Cache.Put(2, "b");
+	Cache.Put(3, "c");
+	ASSERT(*Cache.Get(1) == "a", "LRU cache order error");	// 2 3 1
+	Cache.Put(4, "d");										// 3 1 4
+	ASSERT(!Cache.Peek(2) && Cache.GetSize() == 3, "LRU cache order error");
+
+	ASSERT(*Cache.Peek(3) == "c", "LRU cache order error");	// no touch
+	Cache.Put(1, "A");										// 3 4 1
+	Cache.Put(5, "e");										// 4 1 5
+	Cache.Put(6, "f");										// 1 5 6
+	const int Keys[] = { 2,3,4 };
+	ASSERT(AreKeysEqual(Evicted, Keys, 3), "LRU cache order error");
+	ASSERT(*Cache.Peek(1) == "A" && *Cache.Peek(5) == "e" &&
+		*Cache.Peek(6) == "f" && Cache.GetSize() == 3,
+		"LRU cache order error");
+}
+
+
+void CacheTestLruStats()
+{
+	TLruCache<int, int> Cache(100);
+	for (int i = 0; i < 1000; ++i)
+	{
+		if (!Cache.Get(i % 150))
+		{
+			Cache.Put(i % 150, i);
+		}
+	}
+	// cyclic access over 150 keys never hits an LRU cache of 100
+	const CCacheStats& Stats = Cache.GetStats();
+	ASSERT(Stats.Hits == 0 && Stats.Misses == 1000 &&
+		Stats.Evictions == 900, "LRU cache stats error");
+
+	Cache.ResetStats();
+	for (int i = 0; i < 10; ++i)
+	{
+		Cache.Get(999 % 150 - i);
+	}
+	Cache.Get(-1);
+	ASSERT(Stats.Hits == 10 && Stats.Misses == 1 && Stats.Evictions == 0,
+		"LRU cache stats error");
+}
+
+
+void CacheTestLruErase()
+{
+	TLruCache<TStringView<char>, int> Cache(2);
+	Cache.Put("a", 1);
+	Cache.Put("b", 2);
+	ASSERT(Cache.Erase("a") && !Cache.Erase("a") && Cache.GetSize() == 1,
+		"LRU cache erase error");
+
+	// erased node is reused, nothing is evicted
+	Cache.Put("c", 3);
+	ASSERT(Cache.GetStats().Evictions == 0 && *Cache.Get("b") == 2 &&
+		*Cache.Get("c") == 3, "LRU cache erase error");
+
+	Cache.Clear();
+	ASSERT(Cache.IsEmpty() && !Cache.Peek("b"), "LRU cache erase error");
+	Cache.Put("d", 4);
+	Cache.Put("e", 5);
+	Cache.Put("f", 6);
+	ASSERT(!Cache.Peek("d") && *Cache.Peek("f") == 6 &&
+		Cache.GetStats().Evictions == 1, "LRU cache erase error");
+
+#if COMMON_EXCEPTIONS
+	ASSERT(KeepsCapacityOnThrow<CThrowingLruCache>(), "LRU cache erase error");
+#endif
+}
+
+
+void CacheTestLfuOrder()
+{
+	TVector<int> Evicted;
+	TLfuCache<int, std::string, THash<int>, CEvictionLog> Cache(3,
+		CEvictionLog{ &Evicted });
+
+	Cache.Put(1, "a");
+	Cache.Put(2, "b");
+	Cache.Put(3, "c");
+	Cache.Get(1);
+	Cache.Get(1);
+	Cache.Get(2);
+	ASSERT(Cache.GetFrequency(1) == 3 && Cache.GetFrequency(2) == 2 &&
+		Cache.GetFrequency(3) == 1 && Cache.GetFrequency(4) == 0,
+		"LFU cache order error");
+
+	Cache.Put(4, "d");					// evicts 3 (count 1)
+	Cache.Put(5, "e");					// evicts 4 (count 1)
+	Cache.Get(5);						// 5 and 2 have count 2
+	Cache.Put(6, "f");					// evicts 2, older of them
+	Cache.Put(5, "E");					// 5 has count 3, as 1
+	Cache.Get(6);
+	Cache.Put(7, "g");					// evicts 6 (count 2)
+	Cache.Put(8, "h");					// evicts 7 (count 1)
+	const int Keys[] = { 3,4,2,6,7 };
+	ASSERT(AreKeysEqual(Evicted, Keys, 5), "LFU cache order error");
+	ASSERT(*Cache.Peek(1) == "a" && *Cache.Peek(5) == "E" &&
+		*Cache.Peek(8) == "h" && Cache.GetFrequency(5) == 3,
+		"LFU cache order error");
+
+	Cache.Put(9, "i");					// evicts 8 (count 1)
+	Cache.Get(1);
+	Cache.Get(9);
+	Cache.Get(9);
+	Cache.Get(9);						// 5: 3, 1: 4, 9: 4
+	Cache.Put(10, "j");					// evicts 5
+	ASSERT(!Cache.Peek(5) && Cache.Peek(1) && Cache.Peek(9) &&
+		Cache.GetStats().Evictions == 7, "LFU cache order error");
+}
+
+
+void CacheTestLfuErase()
+{
+	TLfuCache<int, int> Cache(4);
+	for (int i = 0; i < 4; ++i)
+	{
+		Cache.Put(i, i);
+		for (int j = 0; j < i; ++j)
+		{
+			Cache.Get(i);
+		}
+	}
+	// erase tails and middles of runs: order must stay consistent
+	ASSERT(Cache.Erase(2) && Cache.Erase(0) && !Cache.Erase(0),
+		"LFU cache erase error");
+	Cache.Put(10, 10);
+	Cache.Put(11, 11);
+	Cache.Get(11);
+	Cache.Put(12, 12);					// evicts 10
+	ASSERT(!Cache.Peek(10) && Cache.GetFrequency(11) == 2 &&
+		Cache.GetFrequency(3) == 4 && Cache.GetSize() == 4,
+		"LFU cache erase error");
+
+	Cache.Clear();
+	ASSERT(Cache.IsEmpty() && !Cache.Peek(3), "LFU cache erase error");
+	for (int i = 0; i < 10; ++i)
+	{
+		Cache.Put(i, i);
+	}
+	ASSERT(Cache.GetSize() == 4 && Cache.Peek(9) && !Cache.Peek(5),
+		"LFU cache erase error");
+
+#if COMMON_EXCEPTIONS
+	ASSERT(KeepsCapacityOnThrow<CThrowingLfuCache>(), "LFU cache erase error");
+#endif
+}
\ No newline at end of file
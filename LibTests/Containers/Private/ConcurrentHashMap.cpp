@@ -0,0 +1,138 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#include "..\ConcurrentHashMap.h"
+
+#include <thread>
+#include <vector>
+
+using namespace Common;
+
+
+typedef TConcurrentHashMap<int, int> CIntMap;
+
+
+void ConcurrentHashMapTestOperations()
+{
+	CIntMap Map;
+	ASSERT(Map.IsEmpty() && !Map.Contains(1), "Concurrent map insert error");
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		ASSERT(Map.Insert(i, i), "Concurrent map insert error");
+	}
+	ASSERT(!Map.Insert(1, 5) && Map.GetSize() == 1000,
+		"Concurrent map insert error");
+	ASSERT(!Map.Upsert(1, 5) && Map.Upsert(-1, 7) && Map.GetSize() == 1001,
+		"Concurrent map upsert error");
+
+	int Found = 0;
+	ASSERT(Map.FindAndApply(1, [&Found](const int& Value) { Found = Value; })
+		&& Found == 5, "Concurrent map find error");
+	ASSERT(!Map.FindAndApply(5000, [&Found](const int&) { Found = 0; }) &&
+		Found == 5, "Concurrent map find error");
+	ASSERT(Map.FindAndUpdate(2, [](int& Value) { Value *= 10; }) &&
+		!Map.FindAndUpdate(5000, [](int& Value) { Value = 0; }),
+		"Concurrent map update error");
+	Map.FindAndApply(2, [&Found](const int& Value) { Found = Value; });
+	ASSERT(Found == 20, "Concurrent map update error");
+
+	ASSERT(Map.Erase(-1) && !Map.Erase(-1), "Concurrent map erase error");
+	const size_t Removed = Map.EraseIf([](const int Key, int&)
+		{
+			return Key >= 500;
+		});
+	int64_t Sum = 0;
+	Map.ForEach([&Sum](const int Key, const int&) { Sum += Key; });
+	ASSERT(Removed == 500 && Map.GetSize() == 500 && Sum == 499 * 500 / 2,
+		"Concurrent map erase error");
+
+	Map.Clear();
+	ASSERT(Map.IsEmpty() && !Map.Contains(2), "Concurrent map clear error");
+}
+
+
+void ConcurrentHashMapTestShards()
+{
+	const size_t Default = CIntMap::GetDefaultShardCount();
+	ASSERT(Default && (Default & (Default - 1)) == 0,
+		"Concurrent map shards error");
+
+	CIntMap One(1);
+	CIntMap Some(5);
+	CIntMap Many(1000000);
+	ASSERT(One.GetShardCount() == 1 && Some.GetShardCount() == 8 &&
+		Many.GetShardCount() == CIntMap::MaxShardCount,
+		"Concurrent map shards error");
+
+	Some.Reserve(10000);
+	for (int i = 0; i < 10000; ++i)
+	{
+		One.Insert(i, i);
+		Some.Insert(i, i);
+	}
+	for (int i = 0; i < 10000; ++i)
+	{
+		ASSERT(One.Contains(i) && Some.Contains(i),
+			"Concurrent map shards error");
+	}
+}
+
+
+void ConcurrentHashMapTestThreads()
+{
+	constexpr int ThreadCount = 8;
+	constexpr int KeysPerThread = 2000;
+	constexpr int SharedKeys = 16;
+	CIntMap Map(4);
+	for (int i = 0; i < SharedKeys; ++i)
+	{
+		Map.Insert(-1 - i, 0);
+	}
+
+	// every thread adds own keys, counts on shared ones and reads
+	std::vector<std::thread> Threads;
+	for (int t = 0; t < ThreadCount; ++t)
+	{
+		Threads.emplace_back([&Map, t]()
+			{
+				for (int i = 0; i < KeysPerThread; ++i)
+				{
+					const int Key = t * KeysPerThread + i;
+					Map.Upsert(Key, Key);
+					Map.FindAndUpdate(-1 - i % SharedKeys,
+						[](int& Value) { ++Value; });
+					int Read = -1;
+					Map.FindAndApply(Key, [&Read](const int& Value)
+						{
+							Read = Value;
+						});
+					ASSERT(Read == Key, "Concurrent map threads error");
+					if (i % 2)
+					{
+						Map.Erase(Key);
+					}
+				}
+			});
+	}
+	for (std::thread& Thread : Threads)
+	{
+		Thread.join();
+	}
+
+	int Count = 0;
+	Map.ForEach([&Count](const int Key, const int& Value)
+		{
+			if (Key < 0)
+			{
+				ASSERT(Value == ThreadCount * KeysPerThread / SharedKeys,
+					"Concurrent map threads error");
+			}
+			else
+			{
+				ASSERT(Key % 2 == 0, "Concurrent map threads error");
+			}
+			++Count;
+		});
+	ASSERT(Count == SharedKeys + ThreadCount * KeysPerThread / 2,
+		"Concurrent map threads error");
+}
\ No newline at end of file
@@ -0,0 +1,165 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#include "..\Expected.h"
+
+#include <type_traits>
+
+using namespace Common;
+
+
+// small trivial expected must fit into two registers
+static_assert(std::is_trivially_copyable<TExpected<int>>::value,
+	"Expected must be trivially copyable");
+static_assert(std::is_trivially_copyable<TExpected<double, int>>::value,
+	"Expected must be trivially copyable");
+static_assert(sizeof(TExpected<int>) == 2 * sizeof(int),
+	"Expected must not have extra fields");
+
+
+static TExpected<int> ParseDigit(const char Symbol)
+{
+	if (Symbol < '0' || Symbol > '9')
+	{
+		return MakeUnexpected(EStatus::OutOfRange);
+	}
+	return Symbol - '0';
+}
+
+
+void ExpectedTestConstructors()
+{
+	TExpected<int> First = ParseDigit('7');
+	ASSERT(First.HasValue() && First.GetValue() == 7 &&
+		*First.TryGetValue() == 7 && !First.TryGetError(),
+		"Expected constructor error");
+
+	const TExpected<int> Second = ParseDigit('x');
+	ASSERT(!Second.HasValue() && !Second.TryGetValue() &&
+		Second.GetError() == EStatus::OutOfRange &&
+		Second.GetValueOr(-1) == -1, "Expected constructor error");
+
+	First = Second;
+	ASSERT(*First.TryGetError() == EStatus::OutOfRange,
+		"Expected constructor error");
+
+	TExpected<int, long> Third = MakeUnexpected(5);
+	ASSERT(Third.GetError() == 5L, "Expected constructor error");
+}
+
+
+void ExpectedTestMonadic()
+{
+	const auto Twice = [](const int Value) { return Value * 2; };
+	const auto Half = [](const int Value) -> TExpected<int>
+	{
+		if (Value % 2)
+		{
+			return MakeUnexpected(EStatus::DoesNotExist);
+		}
+		return Value / 2;
+	};
+	const auto Recover = [](EStatus) -> TExpected<int> { return 0; };
+
+	ASSERT(ParseDigit('4').AndThen(Half).Transform(Twice).GetValue() == 4,
+		"Expected monadic error");
+	ASSERT(ParseDigit('3').AndThen(Half).Transform(Twice).GetError() ==
+		EStatus::DoesNotExist, "Expected monadic error");
+
+	// first error is kept, other functions are not called
+	ASSERT(ParseDigit('-').AndThen(Half).GetError() == EStatus::OutOfRange,
+		"Expected monadic error");
+	ASSERT(ParseDigit('-').OrElse(Recover).GetValue() == 0 &&
+		ParseDigit('9').OrElse(Recover).GetValue() == 9,
+		"Expected monadic error");
+
+	const TExpected<int> First = 21;
+	const TExpected<double> Second = First.Transform(
+		[](const int Value) { return Value / 2.0; });
+	ASSERT(Second.GetValue() == 10.5, "Expected monadic error");
+}
+
+
+namespace
+{
+	int AliveCount = 0;
+
+	struct CCounted
+	{
+		CCounted(int Value) : Value(Value) { ++AliveCount; }
+		CCounted(const CCounted& Other) : Value(Other.Value) { ++AliveCount; }
+		~CCounted() { --AliveCount; }
+		int Value;
+	};
+
+	// move throws if the value is negative
+	struct CThrowingMove
+	{
+		CThrowingMove(int Value) : Value(Value) { ++AliveCount; }
+		CThrowingMove(const CThrowingMove& Other) : Value(Other.Value)
+		{
+			++AliveCount;
+		}
+		CThrowingMove(CThrowingMove&& Other) : Value(Other.Value)
+		{
+			if (Value < 0)
+			{
+				COMMON_THROW(CBadFormat("Move failed"));
+			}
+			++AliveCount;
+		}
+		~CThrowingMove() { --AliveCount; }
+		int Value;
+	};
+}
+
+
+void ExpectedTestNonTrivial()
+{
+	static_assert(!std::is_trivially_copyable<TExpected<CCounted>>::value,
+		"Expected must copy non-trivial types");
+	{
+		TExpected<CCounted> First = CCounted(1);
+		TExpected<CCounted> Second = First;
+		ASSERT(AliveCount == 2 && Second.GetValue().Value == 1,
+			"Expected non-trivial error");
+
+		Second = MakeUnexpected(EStatus::BadAlloc);
+		ASSERT(AliveCount == 1 && !Second.HasValue(),
+			"Expected non-trivial error");
+
+		Second = Common::Move(First);
+		ASSERT(AliveCount == 2 && Second.GetValue().Value == 1,
+			"Expected non-trivial error");
+
+		const TExpected<int> Third = Common::Move(Second).Transform(
+			[](CCounted Value) { return Value.Value + 1; });
+		ASSERT(Third.GetValue() == 2, "Expected non-trivial error");
+	}
+	ASSERT(AliveCount == 0, "Expected non-trivial error");
+
+#if COMMON_EXCEPTIONS
+	// failed assignment leaves an object that is safe to destroy
+	{
+		TExpected<CThrowingMove> First = CThrowingMove(1);
+		const CThrowingMove Bad(-1);
+		TExpected<CThrowingMove> Second = Bad;
+		bool bThrown = false;
+		COMMON_TRY
+		{
+			First = Common::Move(Second);
+		}
+		COMMON_CATCH_ALL
+		{
+			bThrown = true;
+		}
+		ASSERT(bThrown && AliveCount == 2 && !First.HasValue(),
+			"Expected non-trivial error");
+
+		TExpected<CThrowingMove> Third = CThrowingMove(2);
+		First = Third;
+		ASSERT(AliveCount == 4 && First.GetValue().Value == 2,
+			"Expected non-trivial error");
+	}
+	ASSERT(AliveCount == 0, "Expected non-trivial error");
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,218 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#include "..\FlatMap.h"
+
+#include <map>
+#include <set>
+#include <string>
+
+using namespace Common;
+
+
+typedef TFlatMap<int, std::string> CStringMap;
+
+
+// keys and values of the map equal to reference, keys ascending
+static bool MatchesReference(const CStringMap& Map,
+	const std::map<int, std::string>& Reference)
+{
+	if (Map.GetSize() != Reference.size())
+	{
+		return false;
+	}
+	size_t Index = 0;
+	for (const auto& Entry : Reference)
+	{
+		if (Map.GetKeys()[Index] != Entry.first ||
+			Map.GetValues()[Index] != Entry.second)
+		{
+			return false;
+		}
+		++Index;
+	}
+	return true;
+}
+
+
+void FlatMapTestInsertFind()
+{
+	CStringMap Map;
+	ASSERT(Map.IsEmpty() && !Map.Find(1) && !Map.Contains(0) &&
+		Map.FindIndex(0) == CStringMap::NotFound, "Flat map insert error");
+
+	const int Keys[] = { 5, 1, 9, 3, 7 };
+	for (const int Key : Keys)
+	{
+		ASSERT(Map.Insert(Key, std::to_string(Key)), "Flat map insert error");
+	}
+	ASSERT(!Map.Insert(3, "x") && *Map.Find(3) == "3" && Map.GetSize() == 5,
+		"Flat map insert error");
+	for (size_t i = 0; i < 5; ++i)
+	{
+		ASSERT(Map.GetKeys()[i] == static_cast<int>(i) * 2 + 1,
+			"Flat map insert error");
+	}
+
+	ASSERT(Map.FindIndex(7) == 3 && Map.LowerBound(4) == 2 &&
+		Map.UpperBound(5) == 3 && Map.LowerBound(10) == 5 &&
+		!Map.Find(4), "Flat map find error");
+
+	ASSERT(Map.Upsert(3, "three") == "three" && Map.Upsert(4, "four") ==
+		"four" && Map.GetSize() == 6, "Flat map upsert error");
+	Map[0] += "zero";
+	Map[9] += "!";
+	ASSERT(Map[0] == "zero" && Map[9] == "9!" && Map.GetSize() == 7,
+		"Flat map [] error");
+
+	int Previous = -1;
+	Map.ForEach([&Previous](const int& Key, std::string& Value)
+		{
+			ASSERT(Previous < Key && !Value.empty(), "Flat map for each error");
+			Previous = Key;
+		});
+
+	Map.Reserve(100);
+	ASSERT(Map.GetCapacity() >= 100 && *Map.Find(4) == "four",
+		"Flat map insert error");
+	Map.ShrinkToFit();
+	ASSERT(Map.GetCapacity() == 7 && *Map.Find(4) == "four",
+		"Flat map insert error");
+}
+
+
+void FlatMapTestBulkInsert()
+{
+	std::map<int, std::string> Reference;
+	CStringMap Map;
+	uint64_t State = 99;
+
+	// sorted batch into empty map, then batches into middle and end
+	TVector<CStringMap::CEntry> Batch;
+	for (int i = 0; i < 100; ++i)
+	{
+		Batch.Push(CStringMap::CEntry(i * 10, std::to_string(i)));
+		Reference.emplace(i * 10, std::to_string(i));
+	}
+	ASSERT(Map.Insert(Batch.Begin(), Batch.End()) == 100 &&
+		MatchesReference(Map, Reference), "Flat map bulk insert error");
+
+	for (int Round = 0; Round < 20; ++Round)
+	{
+		Batch.Clear();
+		size_t Expected = 0;
+		for (int i = 0; i < 200; ++i)
+		{
+			State = State * 6364136223846793005ull + 1442695040888963407ull;
+			const int Key = static_cast<int>((State >> 33) % (Round < 10 ?
+				2000 : 100000));
+			Batch.Push(CStringMap::CEntry(Key, "new"));
+			Expected += Reference.emplace(Key, "new").second;
+		}
+		ASSERT(Map.Insert(Batch.Begin(), Batch.End()) == Expected &&
+			MatchesReference(Map, Reference), "Flat map bulk insert error");
+	}
+
+	// reversed batch after all keys: appended without merge
+	Batch.Clear();
+	for (int i = 0; i < 50; ++i)
+	{
+		Batch.Push(CStringMap::CEntry(1000000 - i, "tail"));
+		Reference.emplace(1000000 - i, "tail");
+	}
+	ASSERT(Map.Insert(Batch.Begin(), Batch.End()) == 50 &&
+		Map.Insert(Batch.Begin(), Batch.End()) == 0 &&
+		Map.Insert(Batch.Begin(), Batch.Begin()) == 0 &&
+		MatchesReference(Map, Reference), "Flat map bulk insert error");
+
+	// equal keys in one batch: the first one wins, sorted or not
+	const char* const Names[] = { "a", "b", "c", "d", "e", "f" };
+	for (int Round = 0; Round < 2; ++Round)
+	{
+		CStringMap Duplicates;
+		Duplicates.Insert(4, "old");
+		Batch.Clear();
+		for (int i = 0; i < 60; ++i)
+		{
+			const int Key = Round ? i / 10 : (i * 7) % 6;
+			Batch.Push(CStringMap::CEntry(Key, Names[i / 10]));
+		}
+		ASSERT(Duplicates.Insert(Batch.Begin(), Batch.End()) == 5 &&
+			Duplicates.GetSize() == 6 && *Duplicates.Find(4) == "old",
+			"Flat map bulk insert error");
+		for (int Key = 0; Key < 6; ++Key)
+		{
+			const char* const First = Round ? Names[Key] : "a";
+			ASSERT(Key == 4 || *Duplicates.Find(Key) == First,
+				"Flat map bulk insert error");
+		}
+	}
+}
+
+
+void FlatMapTestErase()
+{
+	CStringMap Map;
+	for (int i = 0; i < 10; ++i)
+	{
+		Map.Insert(i, std::to_string(i));
+	}
+	ASSERT(Map.Erase(0) && Map.Erase(5) && Map.Erase(9) && !Map.Erase(5),
+		"Flat map erase error");
+	ASSERT(Map.GetSize() == 7 && Map.GetKeys()[0] == 1 &&
+		Map.GetKeys()[4] == 6 && *Map.Find(6) == "6" && !Map.Contains(9),
+		"Flat map erase error");
+
+	CStringMap Other;
+	Other.Insert(100, "other");
+	Map.Swap(Other);
+	ASSERT(Map.GetSize() == 1 && Other.GetSize() == 7, "Flat map swap error");
+	Other.Clear();
+	ASSERT(Other.IsEmpty() && !Other.Find(1), "Flat map erase error");
+}
+
+
+void FlatSetTestOperations()
+{
+	TFlatSet<int> Set;
+	std::set<int> Reference;
+	ASSERT(Set.Insert(5) && Set.Insert(1) && !Set.Insert(5) &&
+		Set.GetSize() == 2 && Set.Contains(1) && !Set.Contains(2),
+		"Flat set error");
+	Reference.insert(1);
+	Reference.insert(5);
+
+	TVector<int> Batch;
+	uint64_t State = 5;
+	for (int Round = 0; Round < 10; ++Round)
+	{
+		Batch.Clear();
+		size_t Expected = 0;
+		for (int i = 0; i < 300; ++i)
+		{
+			State = State * 6364136223846793005ull + 1442695040888963407ull;
+			const int Key = static_cast<int>((State >> 33) % 5000);
+			Batch.Push(Key);
+			Expected += Reference.insert(Key).second;
+		}
+		ASSERT(Set.Insert(Batch.Begin(), Batch.End()) == Expected,
+			"Flat set error");
+	}
+
+	ASSERT(Set.GetSize() == Reference.size(), "Flat set error");
+	size_t Index = 0;
+	for (const int Key : Reference)
+	{
+		ASSERT(Set.GetKeys()[Index] == Key && Set.FindIndex(Key) == Index,
+			"Flat set error");
+		++Index;
+	}
+	ASSERT(Set.LowerBound(-1) == 0 && Set.UpperBound(5000) == Set.GetSize(),
+		"Flat set error");
+
+	const int First = *Reference.begin();
+	ASSERT(Set.Erase(First) && !Set.Contains(First) && !Set.Erase(First) &&
+		Set.GetSize() == Reference.size() - 1, "Flat set error");
+	Set.Clear();
+	Set.ShrinkToFit();
+	ASSERT(Set.IsEmpty() && Set.GetCapacity() == 0, "Flat set error");
+}
\ No newline at end of file
@@ -0,0 +1,241 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#include "..\HashMap.h"
+
+#include <string>
+
+using namespace Common;
+
+
+// puts many keys into the same slots: long chains that wrap over the end
+struct CBadHash
+{
+	size_t operator () (const int Key) const noexcept
+	{
+		return static_cast<size_t>(Key % 4) + 5;
+	}
+};
+
+
+struct CStringHash
+{
+	size_t operator () (const std::string& Key) const noexcept
+	{
+		return static_cast<size_t>(HashBytes(Key.data(), Key.size()));
+	}
+};
+
+
+namespace
+{
+	int AliveCount = 0;
+	int CopiesLeft = -1;	// copy throws when it reaches 0
+
+	struct CThrowingCopy
+	{
+		CThrowingCopy() { ++AliveCount; }
+		CThrowingCopy(const CThrowingCopy&)
+		{
+			if (CopiesLeft >= 0 && CopiesLeft-- == 0)
+			{
+				COMMON_THROW(CBadFormat("Copy failed"));
+			}
+			++AliveCount;
+		}
+		CThrowingCopy(CThrowingCopy&&) noexcept { ++AliveCount; }
+		~CThrowingCopy() { --AliveCount; }
+	};
+}
+
+
+void HashMapTestInsertFind()
+{
+	THashMap<int, int> Map;
+	ASSERT(Map.IsEmpty() && !Map.Find(1) && !Map.Contains(0),
+		"Hash map insert error");
+
+	for (int i = 0; i < 10000; ++i)
+	{
+		ASSERT(Map.Insert(i, i * 2), "Hash map insert error");
+	}
+	ASSERT(Map.GetSize() == 10000 && Map.GetCapacity() == 16384,
+		"Hash map insert error");
+	ASSERT(!Map.Insert(5, 0) && *Map.Find(5) == 10,
+		"Hash map insert error");
+
+	for (int i = 0; i < 10000; ++i)
+	{
+		const int* Value = Map.Find(i);
+		ASSERT(Value && *Value == i * 2, "Hash map find error");
+	}
+	ASSERT(!Map.Find(-1) && !Map.Find(10000), "Hash map find error");
+
+	ASSERT(Map.Upsert(5, 7) == 7 && *Map.Find(5) == 7,
+		"Hash map upsert error");
+	Map[20000] += 3;
+	Map[5] += 3;
+	ASSERT(Map[20000] == 3 && Map[5] == 10 && Map.GetSize() == 10001,
+		"Hash map [] error");
+
+	THashMap<int, int> Reserved;
+	Reserved.Reserve(1000);
+	const size_t Capacity = Reserved.GetCapacity();
+	for (int i = 0; i < 1000; ++i)
+	{
+		Reserved.Insert(i, i);
+	}
+	ASSERT(Capacity >= 1000 && Reserved.GetCapacity() == Capacity,
+		"Hash map reserve error");
+
+	Map.Clear();
+	ASSERT(Map.IsEmpty() && Map.GetCapacity() == 0 && !Map.Find(5),
+		"Hash map clear error");
+}
+
+
+void HashMapTestErase()
+{
+	THashMap<int, int> Map;
+	for (int i = 0; i < 1000; ++i)
+	{
+		Map.Insert(i, i);
+	}
+	for (int i = 0; i < 1000; i += 2)
+	{
+		ASSERT(Map.Erase(i), "Hash map erase error");
+	}
+	ASSERT(!Map.Erase(0) && !Map.Erase(5000) && Map.GetSize() == 500,
+		"Hash map erase error");
+	for (int i = 0; i < 1000; ++i)
+	{
+		ASSERT(Map.Contains(i) == (i % 2 == 1), "Hash map erase error");
+	}
+
+	const size_t Removed = Map.EraseIf([](const int Key, int& Value)
+		{
+			++Value;
+			return Key % 3 == 0;
+		});
+	ASSERT(Removed == 167 && Map.GetSize() == 333, "Hash map erase error");
+	size_t Count = 0;
+	Map.ForEach([&Count](const int Key, const int& Value)
+		{
+			ASSERT(Key % 2 == 1 && Key % 3 != 0 && Value > Key,
+				"Hash map erase error");
+			++Count;
+		});
+	ASSERT(Count == 333, "Hash map erase error");
+}
+
+
+void HashMapTestCollisions()
+{
+	THashMap<int, int, CBadHash> Map;
+	for (int i = 0; i < 40; ++i)
+	{
+		Map.Insert(i, -i);
+	}
+	// every erasure shifts the chain back, the rest must stay reachable
+	for (int i = 0; i < 40; i += 3)
+	{
+		ASSERT(Map.Erase(i), "Hash map collisions error");
+		for (int j = 0; j < 40; ++j)
+		{
+			const int* Value = Map.Find(j);
+			const bool bErased = j <= i && j % 3 == 0;
+			ASSERT(bErased ? !Value : Value && *Value == -j,
+				"Hash map collisions error");
+		}
+	}
+
+	const size_t Removed = Map.EraseIf([](const int Key, int&)
+		{
+			return Key % 2 == 0;
+		});
+	ASSERT(Removed == 13 && Map.GetSize() == 13, "Hash map collisions error");
+	for (int i = 0; i < 40; ++i)
+	{
+		const bool bKept = i % 3 != 0 && i % 2 == 1;
+		ASSERT(Map.Contains(i) == bKept, "Hash map collisions error");
+	}
+}
+
+
+void HashMapTestCopyMove()
+{
+	THashMap<int, std::string> Map;
+	for (int i = 0; i < 100; ++i)
+	{
+		Map.Insert(i, std::to_string(i));
+	}
+
+	THashMap<int, std::string> Copy(Map);
+	Copy.Erase(1);
+	Copy[2] = "two";
+	ASSERT(Copy.GetSize() == 99 && Map.GetSize() == 100 &&
+		*Map.Find(2) == "2" && *Copy.Find(2) == "two",
+		"Hash map copy error");
+
+	THashMap<int, std::string> Moved(std::move(Copy));
+	ASSERT(Moved.GetSize() == 99 && Copy.IsEmpty() && !Copy.Find(2),
+		"Hash map move error");
+
+	Copy = Map;
+	Moved = std::move(Map);
+	ASSERT(Copy.GetSize() == 100 && Moved.GetSize() == 100 &&
+		*Moved.Find(99) == "99", "Hash map assignment error");
+
+	Copy.Clear();
+	Copy.Swap(Moved);
+	ASSERT(Copy.GetSize() == 100 && Moved.IsEmpty(), "Hash map swap error");
+
+#if COMMON_EXCEPTIONS
+	// copy that fails in the middle frees the entries copied before
+	{
+		THashMap<int, CThrowingCopy> Source;
+		for (int i = 0; i < 10; ++i)
+		{
+			Source.Insert(i, CThrowingCopy());
+		}
+		const int SourceAlive = AliveCount;
+		CopiesLeft = 2;
+		bool bThrown = false;
+		COMMON_TRY
+		{
+			THashMap<int, CThrowingCopy> Failed(Source);
+		}
+		COMMON_CATCH_ALL
+		{
+			bThrown = true;
+		}
+		CopiesLeft = -1;
+		ASSERT(bThrown && AliveCount == SourceAlive &&
+			Source.GetSize() == 10, "Hash map copy error");
+	}
+	ASSERT(AliveCount == 0, "Hash map copy error");
+#endif
+}
+
+
+void HashMapTestStringKeys()
+{
+	THashMap<std::string, int, CStringHash> Map;
+	for (int i = 0; i < 500; ++i)
+	{
+		Map.Insert("key " + std::to_string(i), i);
+	}
+	ASSERT(*Map.Find("key 123") == 123 && !Map.Find("key"),
+		"Hash map string keys error");
+
+	THashMap<TStringView<char>, int> Views;
+	const char Text[] = "abcabc";
+	Views.Insert(TStringView<char>(Text, 3), 1);
+	ASSERT(!Views.Insert(TStringView<char>(Text + 3, 3), 2) &&
+		*Views.Find(TStringView<char>(Text + 3, 3)) == 1,
+		"Hash map string keys error");
+
+	ASSERT(HashBytes("abc", 3) == HashBytes("abc", 3) &&
+		HashBytes("abc", 3) != HashBytes("abd", 3) &&
+		HashBytes("abc", 3, 1) != HashBytes("abc", 3),
+		"Hash map string keys error");
+}
\ No newline at end of file
@@ -0,0 +1,176 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#include "..\IntrusiveList.h"
+
+#include <string>
+
+using namespace Common;
+
+
+struct CEntry
+{
+	int Key = 0;
+	std::string Name;
+	CIntrusiveListHook OrderHook;
+	CIntrusiveListHook BucketHook;
+};
+
+typedef TIntrusiveList<CEntry, &CEntry::OrderHook> COrder;
+typedef TIntrusiveList<CEntry, &CEntry::BucketHook> CBucket;
+
+
+template <typename ListType>
+static bool AreKeysEqual(const ListType& List, const int* Keys,
+	const size_t Size)
+{
+	size_t Index = 0;
+	for (const CEntry& Entry : List)
+	{
+		if (Index == Size || Entry.Key != Keys[Index])
+		{
+			return false;
+		}
+		++Index;
+	}
+	return Index == Size && List.GetSize() == Size;
+}
+
+
+void IntrusiveListTestLinks()
+{
+	CEntry Entries[5];
+	for (int i = 0; i < 5; ++i)
+	{
+		Entries[i].Key = i;
+	}
+
+	COrder Order;
+	ASSERT(Order.IsEmpty() && !Order.TryFront() && !Order.TryBack(),
+		"Intrusive list links error");
+
+	Order.Push(Entries[1]);
+	Order.Push(Entries[2]);
+	Order.Unshift(Entries[0]);
+	Order.Insert(COrder::IteratorOf(Entries[2]), Entries[3]);
+	Order.Insert(Order.End(), Entries[4]);
+	const int Keys[] = { 0,1,3,2,4 };
+	ASSERT(AreKeysEqual(Order, Keys, 5), "Intrusive list links error");
+	ASSERT(&Order.Front() == &Entries[0] && Order.TryBack() == &Entries[4],
+		"Intrusive list links error");
+
+	Order.Erase(Entries[3]);
+	Entries[1].OrderHook.Unlink();	// without the list
+	Entries[1].OrderHook.Unlink();	// no-op
+	const int Keys2[] = { 0,2,4 };
+	ASSERT(AreKeysEqual(Order, Keys2, 3) && !Entries[1].OrderHook.IsLinked(),
+		"Intrusive list links error");
+
+	Order.MoveToBack(Entries[0]);
+	Order.MoveToBack(Entries[0]);
+	const int Keys3[] = { 2,4,0 };
+	ASSERT(AreKeysEqual(Order, Keys3, 3), "Intrusive list links error");
+
+	Order.Pop();
+	Order.Shift();
+	ASSERT(Order.GetSize() == 1 && &Order.Front() == &Entries[4] &&
+		&Order.Back() == &Entries[4], "Intrusive list links error");
+
+	Order.Clear();
+	ASSERT(Order.IsEmpty() && !Entries[4].OrderHook.IsLinked(),
+		"Intrusive list links error");
+}
+
+
+void IntrusiveListTestIterators()
+{
+	CEntry Entries[4];
+	COrder Order;
+	for (int i = 0; i < 4; ++i)
+	{
+		Entries[i].Key = i;
+		Order.Push(Entries[i]);
+	}
+
+	int Expected = 3;
+	for (auto it = Order.ReverseBegin(); it != Order.ReverseEnd(); ++it)
+	{
+		ASSERT((*it).Key == Expected--, "Intrusive list iterator error");
+	}
+	ASSERT(Expected == -1, "Intrusive list iterator error");
+
+	auto Iterator = Order.Begin() + 3;
+	ASSERT((*Iterator).Key == 3 && (*(Iterator - 2)).Key == 1 &&
+		++Iterator == Order.End() && (*--Iterator).Key == 3,
+		"Intrusive list iterator error");
+
+	for (CEntry& Entry : Order)
+	{
+		Entry.Key *= 10;
+	}
+	const COrder& ConstOrder = Order;
+	const int Keys[] = { 0,10,20,30 };
+	ASSERT(AreKeysEqual(ConstOrder, Keys, 4) &&
+		(*ConstOrder.ConstReverseBegin()).Key == 30,
+		"Intrusive list iterator error");
+}
+
+
+void IntrusiveListTestSeveralLists()
+{
+	CEntry Entries[6];
+	COrder Order;
+	CBucket Even, Odd;
+	for (int i = 0; i < 6; ++i)
+	{
+		Entries[i].Key = i;
+		Order.Push(Entries[i]);
+		(i % 2 ? Odd : Even).Push(Entries[i]);
+	}
+
+	Even.Erase(Entries[2]);
+	const int OrderKeys[] = { 0,1,2,3,4,5 };
+	const int EvenKeys[] = { 0,4 };
+	ASSERT(AreKeysEqual(Order, OrderKeys, 6) &&
+		AreKeysEqual(Even, EvenKeys, 2), "Intrusive list several error");
+
+	Even.Swap(Odd);
+	const int OddKeys[] = { 1,3,5 };
+	ASSERT(AreKeysEqual(Even, OddKeys, 3) && AreKeysEqual(Odd, EvenKeys, 2),
+		"Intrusive list several error");
+
+	CBucket Moved(static_cast<CBucket&&>(Odd));
+	ASSERT(Odd.IsEmpty() && AreKeysEqual(Moved, EvenKeys, 2),
+		"Intrusive list several error");
+	Odd = static_cast<CBucket&&>(Moved);
+	ASSERT(Moved.IsEmpty() && AreKeysEqual(Odd, EvenKeys, 2),
+		"Intrusive list several error");
+}
+
+
+void IntrusiveListTestLifetime()
+{
+	COrder Order;
+	CEntry First;
+	First.Key = 1;
+	Order.Push(First);
+	{
+		CEntry Second;
+		Second.Key = 2;
+		Order.Push(Second);
+
+		CEntry Copy(Second);	// copy does not join the list
+		ASSERT(!Copy.OrderHook.IsLinked() && Order.GetSize() == 2,
+			"Intrusive list lifetime error");
+		Copy = First;
+		ASSERT(!Copy.OrderHook.IsLinked(), "Intrusive list lifetime error");
+	}
+	ASSERT(Order.GetSize() == 1 && &Order.Back() == &First,
+		"Intrusive list lifetime error");
+
+	CEntry Outlives;
+	{
+		COrder Temporary;
+		Temporary.Push(Outlives);
+	}
+	ASSERT(!Outlives.OrderHook.IsLinked(), "Intrusive list lifetime error");
+}
\ No newline at end of file
@@ -4,6 +4,251 @@
 
 using namespace Common;
 
+
+static bool IsListEqual(const TList<int>& List,
+	const std::initializer_list<int>& Values)
+{
+	if (List.GetSize() != Values.size())
+	{
+		return false;
+	}
+	auto Expected = Values.begin();
+	for (const int Value : List)
+	{
+		if (Value != *Expected)
+		{
+			return false;
+		}
+		++Expected;
+	}
+	// links in both directions must agree
+	auto ExpectedBack = Values.end();
+	for (auto it = List.ConstReverseBegin(); it != List.ConstReverseEnd();
+		++it)
+	{
+		if (*it != *--ExpectedBack)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+
+// own type, so other tests do not affect node counters
+struct CSpliceProbe { int Value = 0; };
+
+
 void ListTestConstructors()
 {
+	const TList<int> First = { 1,2,3 };
+	ASSERT(IsListEqual(First, { 1,2,3 }), "List constructors error");
+
+	TList<int> Second(First);
+	ASSERT(IsListEqual(Second, { 1,2,3 }), "List constructors error");
+
+	Second = TList<int>{ 4,5 };
+	TList<int> Third(2, 7);
+	Third = Second;
+	ASSERT(IsListEqual(Third, { 4,5 }), "List constructors error");
+
+	const TList<int> Empty;
+	const TList<int> EmptyCopy(Empty);
+	ASSERT(EmptyCopy.IsEmpty() && Empty.ConstBegin() == Empty.ConstEnd(),
+		"List constructors error");
+}
+
+void ListTestTry()
+{
+	TList<int> First;
+	ASSERT(!First.TryFront() && !First.TryBack(), "List try error");
+	ASSERT(First.TryPop() == EStatus::OutOfRange &&
+		First.TryShift() == EStatus::OutOfRange, "List try error");
+
+	ASSERT(First.TryPush(2) == EStatus::Ok &&
+		First.TryUnshift(1) == EStatus::Ok &&
+		First.TryPush(3) == EStatus::Ok, "List try error");
+	ASSERT(First.GetSize() == 3 && *First.TryFront() == 1 &&
+		*First.TryBack() == 3, "List try error");
+
+	ASSERT(First.TryShift() == EStatus::Ok && First.TryPop() == EStatus::Ok,
+		"List try error");
+	ASSERT(First.GetSize() == 1 && First.TryFront() == First.TryBack(),
+		"List try error");
+
+	First.Clear();
+	ASSERT(!First.TryFront() && First.TryPush(4) == EStatus::Ok &&
+		*First.TryFront() == 4, "List try error");
+}
+
+
+void ListTestCheckedIterators()
+{
+#if COMMONLIBS_CHECKED_ITERATORS
+	TList<int> First;
+	First.Push(1);
+	First.Push(2);
+	auto Iterator = First.Begin();
+	First.Push(3);	// insertion keeps iterators valid
+	ASSERT(*Iterator == 1, "List checked iterator error");
+
+	First.Pop();
+	bool bThrown = false;
+	try
+	{
+		*Iterator;
+	}
+	catch (const CInvalidIterator&)
+	{
+		bThrown = true;
+	}
+	ASSERT(bThrown, "List checked iterator error");
+	ASSERT(*First.Begin() == 1, "List checked iterator error");
+#endif
+}
+
+
+void ListTestInsertErase()
+{
+	TList<int> First = { 1,3 };
+	First.Insert(First.Begin() + 1, 2);
+	First.Insert(First.End(), 4);
+	First.Insert(First.Begin(), 0);
+	ASSERT(IsListEqual(First, { 0,1,2,3,4 }), "List insert/erase error");
+
+	First.Erase(First.Begin() + 2);
+	First.Erase(First.Begin());
+	First.Erase(First.ReverseBegin());
+	ASSERT(IsListEqual(First, { 1,3 }), "List insert/erase error");
+}
+
+
+void ListTestSplice()
+{
+	TList<int> First = { 1,2,3 };
+	TList<int> Second = { 10,20,30,40 };
+
+	First.Splice(First.Begin() + 1, Second);
+	ASSERT(IsListEqual(First, { 1,10,20,30,40,2,3 }) && Second.IsEmpty(),
+		"List splice error");
+
+	Second.Splice(Second.End(), First, First.Begin() + 1,
+		First.Begin() + 5);
+	ASSERT(IsListEqual(First, { 1,2,3 }) &&
+		IsListEqual(Second, { 10,20,30,40 }), "List splice error");
+
+	Second.Splice(Second.Begin(), Second, Second.Begin() + 2,
+		Second.End());
+	ASSERT(IsListEqual(Second, { 30,40,10,20 }), "List splice error");
+
+	First.Splice(First.End(), Second, Second.Begin(), Second.End());
+	Second.Splice(Second.Begin(), First);
+	ASSERT(First.IsEmpty() && IsListEqual(Second, { 1,2,3,30,40,10,20 }),
+		"List splice error");
+
+	// nodes are relinked, not reallocated
+	TList<CSpliceProbe> Third, Fourth;
+	Third.Push(CSpliceProbe());
+	Fourth.Push(CSpliceProbe());
+	const uint64_t Allocations =
+		GetAllocationStats<CSpliceProbe>().NodeAllocations;
+	Third.Splice(Third.End(), Fourth);
+	Fourth.Splice(Fourth.End(), Third, Third.Begin(), Third.End());
+	ASSERT(Fourth.GetSize() == 2 && Third.IsEmpty() &&
+		GetAllocationStats<CSpliceProbe>().NodeAllocations == Allocations,
+		"List splice error");
+}
+
+
+void ListTestMerge()
+{
+	TList<int> First = { 1,4,4,9 };
+	TList<int> Second = { 0,4,5,10,11 };
+	First.Merge(Second);
+	ASSERT(IsListEqual(First, { 0,1,4,4,4,5,9,10,11 }) && Second.IsEmpty(),
+		"List merge error");
+
+	TList<int> Third = { 9,5,1 };
+	TList<int> Fourth = { 8,6 };
+	Third.Merge(Fourth, [](const int First, const int Second)
+		{ return First > Second; });
+	ASSERT(IsListEqual(Third, { 9,8,6,5,1 }), "List merge error");
+
+	TList<int> Empty;
+	Empty.Merge(Third);
+	ASSERT(IsListEqual(Empty, { 9,8,6,5,1 }) && Third.IsEmpty(),
+		"List merge error");
+
+#if COMMON_EXCEPTIONS
+	// comparator throws in the middle: every node has one owner
+	TList<int> Target = { 1,3,5 };
+	TList<int> Source = { 2,4,6 };
+	int Calls = 0;
+	bool bThrown = false;
+	COMMON_TRY
+	{
+		Target.Merge(Source, [&Calls](const int First, const int Second)
+			{
+				if (++Calls == 4)
+				{
+					COMMON_THROW(CDoesNotExist("Comparator failed"));
+				}
+				return First < Second;
+			});
+	}
+	COMMON_CATCH_ALL
+	{
+		bThrown = true;
+	}
+	ASSERT(bThrown && IsListEqual(Target, { 1,2,3,5 }) &&
+		IsListEqual(Source, { 4,6 }), "List merge error");
+	Target.Merge(Source);
+	ASSERT(IsListEqual(Target, { 1,2,3,4,5,6 }) && Source.IsEmpty(),
+		"List merge error");
+#endif
+}
+
+
+void ListTestReverseUnique()
+{
+	TList<int> First = { 1,2,3,4 };
+	First.Reverse();
+	ASSERT(IsListEqual(First, { 4,3,2,1 }), "List reverse/unique error");
+
+	TList<int> Single = { 1 };
+	Single.Reverse();
+	ASSERT(IsListEqual(Single, { 1 }), "List reverse/unique error");
+
+	TList<int> Second = { 1,1,2,3,3,3,1,4,4 };
+	ASSERT(Second.Unique() == 4 && IsListEqual(Second, { 1,2,3,1,4 }),
+		"List reverse/unique error");
+
+	TList<int> Third = { 1,3,4,6,7,9 };	// equal parity
+	ASSERT(Third.Unique([](const int First, const int Second)
+		{ return First % 2 == Second % 2; }) == 3 &&
+		IsListEqual(Third, { 1,4,7 }), "List reverse/unique error");
+
+#if COMMON_EXCEPTIONS
+	// predicate throws after a removal: size still matches the nodes
+	TList<int> Fourth = { 1,1,2,3,4 };
+	int Calls = 0;
+	bool bThrown = false;
+	COMMON_TRY
+	{
+		Fourth.Unique([&Calls](const int First, const int Second)
+			{
+				if (++Calls == 3)
+				{
+					COMMON_THROW(CDoesNotExist("Predicate failed"));
+				}
+				return First == Second;
+			});
+	}
+	COMMON_CATCH_ALL
+	{
+		bThrown = true;
+	}
+	ASSERT(bThrown && IsListEqual(Fourth, { 1,2,3,4 }),
+		"List reverse/unique error");
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,104 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#include "..\MappedArray.h"
+
+#include <cstdio>	// fopen, remove
+
+#include "CommonTypes/Vector.h"
+
+using namespace Common;
+
+
+namespace
+{
+	struct CRecord
+	{
+		int64_t Id;
+		double Weight;
+		char Tag;
+	};
+}
+
+static const char* const MappedArrayTestPath = "MappedArrayTest.bin";
+
+
+void MappedArrayTestRead()
+{
+	TVector<CRecord> Records;
+	for (int i = 0; i < 1000; ++i)
+	{
+		Records.Push({i, i * 0.5, static_cast<char>('a' + i % 26)});
+	}
+	WriteMappedArray(MappedArrayTestPath, Records.RawData(),
+		Records.GetSize());
+
+	TMappedArray<CRecord> Mapped(MappedArrayTestPath);
+	Mapped.Advise(EAccessHint::Sequential);
+	Mapped.Advise(EAccessHint::WillNeed);
+	ASSERT(Mapped.GetSize() == 1000 && !Mapped.IsEmpty() &&
+		Mapped[999].Id == 999 && Mapped[27].Tag == 'b' &&
+		Mapped.RawData() + 1000 == Mapped.end(), "Mapped array read error");
+	ASSERT(Mapped.TryAt(1000) == nullptr && Mapped.TryAt(10)->Weight == 5.0,
+		"Mapped array read error");
+
+	int64_t Sum = 0;
+	for (TMappedArray<CRecord>::CIterator it = Mapped.Begin();
+		it != Mapped.End(); ++it)
+	{
+		Sum += (*it).Id;
+	}
+	const TSpan<const CRecord> Span = Mapped;
+	ASSERT(Sum == 999 * 1000 / 2 && Span.GetSize() == 1000 &&
+		Span[500].Id == 500, "Mapped array iterator error");
+
+	TMappedArray<CRecord> Moved(static_cast<TMappedArray<CRecord>&&>(Mapped));
+	ASSERT(Mapped.IsEmpty() && Moved[1].Id == 1, "Mapped array move error");
+	Moved.Close();
+	ASSERT(Moved.IsEmpty() && !Moved.RawData(), "Mapped array close error");
+
+	WriteMappedArray<CRecord>(MappedArrayTestPath, nullptr, 0);
+	ASSERT(Moved.TryOpen(MappedArrayTestPath) == EStatus::Ok &&
+		Moved.IsEmpty(), "Mapped array read error");
+	Moved.Close();
+
+	std::remove(MappedArrayTestPath);
+}
+
+
+void MappedArrayTestErrors()
+{
+	TMappedArray<int> Array;
+	ASSERT(Array.TryOpen("MappedArrayMissing.bin") == EStatus::IOError,
+		"Mapped array error check error");
+
+	const double Values[] = {1.0, 2.0};
+	WriteMappedArray(MappedArrayTestPath, Values, 2);
+	ASSERT(Array.TryOpen(MappedArrayTestPath) == EStatus::BadFormat &&
+		Array.IsEmpty(), "Mapped array error check error");
+
+	bool bThrown = false;
+	try
+	{
+		TMappedArray<float> Floats(MappedArrayTestPath);
+	}
+	catch (const CBadFormat&)
+	{
+		bThrown = true;
+	}
+	ASSERT(bThrown, "Mapped array error check error");
+
+	// truncated file: header promises more elements than stored
+	CMappedArrayHeader Header;
+	std::FILE* File = std::fopen(MappedArrayTestPath, "rb");
+	std::fread(&Header, sizeof(Header), 1, File);
+	std::fclose(File);
+	Header.Count = 3;
+	File = std::fopen(MappedArrayTestPath, "r+b");
+	std::fwrite(&Header, sizeof(Header), 1, File);
+	std::fclose(File);
+	TMappedArray<double> Doubles;
+	ASSERT(Doubles.TryOpen(MappedArrayTestPath) == EStatus::BadFormat,
+		"Mapped array error check error");
+
+	std::remove(MappedArrayTestPath);
+}
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include "..\Optional.h"
 
+#include <type_traits>
+
 using namespace Common;
 
 
@@ -44,3 +46,146 @@ void OptionalTestAllocation()
 	const TOptional<CTestClass> Third(First);
 	ASSERT(!Third.DoesValueExist(), "Optional alloc error");
 }
+
+
+void OptionalTestTry()
+{
+	TOptional<int> First;
+	ASSERT(!First.TryGetValue(), "Optional try error");
+	First = 5;
+	ASSERT(First.TryGetValue() && *First.TryGetValue() == 5,
+		"Optional try error");
+}
+
+
+void OptionalTestTrivial()
+{
+	static_assert(std::is_trivially_copyable<TOptional<int>>::value &&
+		std::is_trivially_copyable<TOptional<double>>::value,
+		"Optional must be trivially copyable");
+	static_assert(!std::is_trivially_copyable<TOptional<CTestClass>>::value,
+		"Optional must copy non-trivial types");
+
+	TOptional<int> First[4];
+	First[1] = 5;
+	TOptional<int> Second[4];
+	for (int i = 0; i < 4; ++i)
+	{
+		Second[i] = First[i];
+	}
+	ASSERT(!Second[0].DoesValueExist() && Second[1].GetValue() == 5,
+		"Optional trivial error");
+
+	First[1].Clear();
+	ASSERT(!First[1].DoesValueExist() && Second[1].GetValue() == 5,
+		"Optional trivial error");
+}
+
+
+void OptionalTestNiche()
+{
+	typedef TOptional<int*, TSentinelNiche<int*, nullptr>> CNullNiche;
+	static_assert(sizeof(CNullNiche) == sizeof(int*),
+		"Optional pointer must use nullptr niche");
+	static_assert(sizeof(TOptional<int, TSentinelNiche<int, -1>>) ==
+		sizeof(int), "Optional sentinel must use niche");
+
+	int Value = 3;
+	CNullNiche First;
+	ASSERT(!First.DoesValueExist(), "Optional niche error");
+	First = &Value;
+	ASSERT(*First.GetValue() == 3, "Optional niche error");
+	First = nullptr;
+	ASSERT(!First.DoesValueExist(), "Optional niche error");
+
+	// by default null pointer is a value
+	const TOptional<int*> Null = nullptr;
+	ASSERT(Null.DoesValueExist() && Null.GetValue() == nullptr,
+		"Optional niche error");
+
+	TOptional<int, TSentinelNiche<int, -1>> Second = 0;
+	ASSERT(Second.DoesValueExist() && Second.GetValueOr(7) == 0,
+		"Optional niche error");
+	Second.Clear();
+	ASSERT(!Second.TryGetValue() && Second.GetValueOr(7) == 7,
+		"Optional niche error");
+
+	TOptional<int, TNoNiche<int>> Third = -1;
+	ASSERT(Third.DoesValueExist(), "Optional niche error");
+}
+
+
+namespace
+{
+	struct CMoveOnly
+	{
+		CMoveOnly(int First, int Second) : Value(First + Second) {}
+		CMoveOnly(const CMoveOnly&) = delete;
+		CMoveOnly(CMoveOnly&& Other) noexcept : Value(Other.Value)
+		{
+			Other.Value = 0;
+		}
+		CMoveOnly& operator = (CMoveOnly&& Other) noexcept
+		{
+			Value = Other.Value;
+			Other.Value = 0;
+			return *this;
+		}
+		int Value;
+	};
+}
+
+
+void OptionalTestEmplace()
+{
+	TOptional<CMoveOnly> First(InPlace, 1, 2);
+	ASSERT(First.GetValue().Value == 3, "Optional emplace error");
+
+	First.GetValue().Value = 4;
+	ASSERT(First.Emplace(5, 5).Value == 10, "Optional emplace error");
+
+	TOptional<CMoveOnly> Second(Common::Move(First));
+	ASSERT(Second.GetValue().Value == 10, "Optional emplace error");
+
+	const CMoveOnly Taken = Second.TakeValue();
+	ASSERT(Taken.Value == 10 && !Second.DoesValueExist(),
+		"Optional emplace error");
+
+	Second = CMoveOnly(2, 2);
+	Second.SetValue(CMoveOnly(3, 3));
+	ASSERT(Second.TryGetValue()->Value == 6, "Optional emplace error");
+
+	// move may throw only if move of the value may throw
+	ASSERT(std::is_nothrow_move_constructible<TOptional<CMoveOnly>>::value &&
+		!std::is_nothrow_move_constructible<TOptional<CTestClass>>::value &&
+		!std::is_nothrow_move_assignable<TOptional<CTestClass>>::value,
+		"Optional emplace error");
+}
+
+
+void OptionalTestReference()
+{
+	static_assert(sizeof(TOptional<int&>) == sizeof(int*),
+		"Optional reference must store only pointer");
+
+	int Value = 1;
+	int Other = 2;
+	TOptional<int&> First;
+	ASSERT(!First.DoesValueExist() && First.GetValueOr(Other) == 2,
+		"Optional reference error");
+
+	First.SetValue(Value);
+	First.GetValue() = 3;
+	ASSERT(Value == 3 && First.TryGetValue() == &Value,
+		"Optional reference error");
+
+	// rebinds, does not assign
+	First.Emplace(Other);
+	ASSERT(Value == 3 && &First.GetValue() == &Other,
+		"Optional reference error");
+
+	const TOptional<int&> Second = First;
+	First.Clear();
+	ASSERT(!First.DoesValueExist() && Second.GetValue() == 2,
+		"Optional reference error");
+}
\ No newline at end of file
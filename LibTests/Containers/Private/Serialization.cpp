@@ -0,0 +1,281 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#include "..\Serialization.h"
+
+#include <cstdio>	// tmpfile
+#include <string>
+
+#if defined(_WIN32)
+	#include <io.h>	// _fileno, _lseek
+	#define fileno _fileno
+	#define lseek _lseek
+#else
+	#include <unistd.h>	// lseek
+#endif
+
+using namespace Common;
+
+
+namespace
+{
+	enum class EColor : uint16_t
+	{
+		Red = 1,
+		Green = 0x0102
+	};
+
+	struct CPoint
+	{
+		int32_t X;
+		int32_t Y;
+	};
+
+	// counts Write() calls of the sink
+	class CCountingSink
+	{
+
+	public:
+
+		EStatus Write(const void* const Data, const size_t Size) noexcept
+		{
+			++Calls;
+			return Sink.Write(Data, Size);
+		}
+
+		TVector<char> Bytes;
+		CMemorySink Sink = CMemorySink(Bytes);
+		size_t Calls = 0;
+
+	};
+}
+
+namespace Common
+{
+	template <>
+	struct TSerializer<CPoint> : TBitwiseSerializer<CPoint> {};
+}
+
+
+template <typename T>
+static void RoundTrip(const T& Value, T& OutValue)
+{
+	TVector<char> Bytes;
+	CMemorySink Sink(Bytes);
+	{
+		TBufferedWriter<CMemorySink> Writer(Sink, 16);
+		Serialize(Writer, Value);
+		Writer.Flush();
+	}
+
+	CMemorySource Source(Bytes.RawData(), Bytes.GetSize());
+	TBufferedReader<CMemorySource> Reader(Source, 16);
+	Deserialize(Reader, OutValue);
+	ASSERT(Reader.IsEnd(), "Serialization round trip error");
+}
+
+
+void SerializationTestScalars()
+{
+	TVector<char> Bytes;
+	CMemorySink Sink(Bytes);
+	TBufferedWriter<CMemorySink> Writer(Sink);
+	Serialize(Writer, uint32_t(0x01020304));
+	Serialize(Writer, EColor::Green);
+	Serialize(Writer, true);
+	WriteVarUInt(Writer, 300);
+	Writer.Flush();
+
+	// little-endian, enum as underlying type, LEB128 length
+	const unsigned char Expected[] = {4, 3, 2, 1, 2, 1, 1, 0xAC, 0x02};
+	ASSERT(Bytes.GetSize() == sizeof(Expected), "Serialization scalar error");
+	for (size_t i = 0; i < sizeof(Expected); ++i)
+	{
+		ASSERT(static_cast<unsigned char>(Bytes[i]) == Expected[i],
+			"Serialization scalar error");
+	}
+
+	double Double = 0;
+	RoundTrip(-2.5, Double);
+	uint64_t Big = 0;
+	RoundTrip(uint64_t(-1), Big);
+	ASSERT(Double == -2.5 && Big == uint64_t(-1),
+		"Serialization scalar error");
+}
+
+
+void SerializationTestContainers()
+{
+	TVector<TPair<int8_t, double>> Pairs;	// padded: per element
+	Pairs.Push(MakePair(int8_t(-1), 0.5));
+	Pairs.Push(MakePair(int8_t(7), 1e300));
+	TVector<TPair<int8_t, double>> PairsCopy;
+	RoundTrip(Pairs, PairsCopy);
+	ASSERT(PairsCopy.GetSize() == 2 && PairsCopy[0].First == -1 &&
+		PairsCopy[1].Second == 1e300, "Serialization vector error");
+
+	TList<TVector<int>> Nested;
+	Nested.Push(TVector<int>({1, 2, 3}));
+	Nested.Push(TVector<int>());
+	Nested.Push(TVector<int>({4}));
+	TList<TVector<int>> NestedCopy;
+	NestedCopy.Push(TVector<int>({9}));	// overwritten
+	RoundTrip(Nested, NestedCopy);
+	ASSERT(NestedCopy.GetSize() == 3 && NestedCopy.Front().GetSize() == 3 &&
+		NestedCopy.Front()[2] == 3 && NestedCopy.Back()[0] == 4,
+		"Serialization list error");
+
+	TVector<TOptional<int16_t>> Optionals;
+	Optionals.Push(TOptional<int16_t>(5));
+	Optionals.Push(TOptional<int16_t>());
+	TVector<TOptional<int16_t>> OptionalsCopy;
+	RoundTrip(Optionals, OptionalsCopy);
+	ASSERT(OptionalsCopy[0].GetValue() == 5 &&
+		!OptionalsCopy[1].DoesValueExist(), "Serialization optional error");
+
+	TVector<bool> Flags({true, false, true});
+	TVector<bool> FlagsCopy;
+	RoundTrip(Flags, FlagsCopy);
+	ASSERT(FlagsCopy.GetSize() == 3 && FlagsCopy[0] && !FlagsCopy[1],
+		"Serialization bool error");
+}
+
+
+void SerializationTestBulk()
+{
+	static_assert(TSerializer<TPair<int, int>>::bBitwise,
+		"Pair without padding must be bitwise");
+	static_assert(!TSerializer<TPair<char, int>>::bBitwise,
+		"Pair with padding must not be bitwise");
+
+	// 1M ints must be written as one block, not element by element
+	TVector<int> Values;
+	for (int i = 0; i < 1000000; ++i)
+	{
+		Values.Push(i * 3);
+	}
+	CCountingSink Sink;
+	{
+		TBufferedWriter<CCountingSink> Writer(Sink);
+		Serialize(Writer, Values);
+		Writer.Flush();
+	}
+	ASSERT(Sink.Calls <= 2 &&
+		Sink.Bytes.GetSize() == 3 + sizeof(int) * Values.GetSize(),
+		"Serialization bulk write error");
+
+	CMemorySource Source(Sink.Bytes.RawData(), Sink.Bytes.GetSize());
+	TBufferedReader<CMemorySource> Reader(Source);
+	TVector<int> Copy;
+	Deserialize(Reader, Copy);
+	ASSERT(Copy.GetSize() == Values.GetSize() &&
+		Copy.GetCapacity() == Values.GetSize() && Copy[999999] == 2999997,
+		"Serialization bulk read error");
+
+	TVector<CPoint> Points;
+	Points.Push({1, -1});
+	Points.Push({2, -2});
+	TVector<CPoint> PointsCopy;
+	RoundTrip(Points, PointsCopy);
+	ASSERT(PointsCopy.GetSize() == 2 && PointsCopy[1].Y == -2,
+		"Serialization bitwise struct error");
+}
+
+
+void SerializationTestErrors()
+{
+	TVector<char> Bytes;
+	CMemorySink Sink(Bytes);
+	TBufferedWriter<CMemorySink> Writer(Sink);
+	Serialize(Writer, TVector<int>({1, 2, 3}));
+	Writer.Flush();
+
+	// data ends in the middle of the last element
+	CMemorySource Truncated(Bytes.RawData(), Bytes.GetSize() - 1);
+	TBufferedReader<CMemorySource> TruncatedReader(Truncated);
+	TVector<int> Values;
+	bool bThrown = false;
+	try
+	{
+		Deserialize(TruncatedReader, Values);
+	}
+	catch (const CBadFormat&)
+	{
+		bThrown = true;
+	}
+	ASSERT(bThrown, "Serialization error check error");
+
+	const unsigned char BadBool[] = {2};
+	CMemorySource BoolSource(BadBool, 1);
+	TBufferedReader<CMemorySource> BoolReader(BoolSource);
+	bool bValue;
+	bThrown = false;
+	try
+	{
+		Deserialize(BoolReader, bValue);
+	}
+	catch (const CBadFormat&)
+	{
+		bThrown = true;
+	}
+	ASSERT(bThrown, "Serialization error check error");
+
+	unsigned char TooLong[11];
+	for (unsigned char& Byte : TooLong)
+	{
+		Byte = 0xFF;
+	}
+	CMemorySource LengthSource(TooLong, sizeof(TooLong));
+	TBufferedReader<CMemorySource> LengthReader(LengthSource);
+	bThrown = false;
+	try
+	{
+		ReadVarUInt(LengthReader);
+	}
+	catch (const CBadFormat&)
+	{
+		bThrown = true;
+	}
+	ASSERT(bThrown, "Serialization error check error");
+}
+
+
+void SerializationTestFile()
+{
+	std::FILE* const File = std::tmpfile();
+	ASSERT(File, "Serialization file error");
+	const int Descriptor = fileno(File);
+
+	TVector<TPair<int, std::string>> Records;
+	Records.Push(MakePair(1, std::string("one")));
+	Records.Push(MakePair(2, std::string(1000, 'x')));
+	{
+		CFileDescriptorSink Sink(Descriptor);
+		TBufferedWriter<CFileDescriptorSink> Writer(Sink, 64);
+		Serialize(Writer, Records.GetSize());
+		for (const TPair<int, std::string>& Record : Records)
+		{
+			Serialize(Writer, Record.First);
+			WriteVarUInt(Writer, Record.Second.size());
+			Writer.Write(Record.Second.data(), Record.Second.size());
+		}
+		Writer.Flush();
+	}
+
+	lseek(Descriptor, 0, SEEK_SET);
+	CFileDescriptorSource Source(Descriptor);
+	TBufferedReader<CFileDescriptorSource> Reader(Source, 64);
+	size_t Count;
+	Deserialize(Reader, Count);
+	ASSERT(Count == 2, "Serialization file error");
+	for (size_t i = 0; i < Count; ++i)
+	{
+		int Id;
+		Deserialize(Reader, Id);
+		std::string Text(static_cast<size_t>(ReadVarUInt(Reader)), '\0');
+		Reader.Read(&Text[0], Text.size());
+		ASSERT(Id == Records[i].First && Text == Records[i].Second,
+			"Serialization file error");
+	}
+	ASSERT(Reader.IsEnd(), "Serialization file error");
+	std::fclose(File);
+}
\ No newline at end of file
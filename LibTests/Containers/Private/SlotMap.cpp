@@ -0,0 +1,165 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#include "..\SlotMap.h"
+
+#include <string>
+#include <vector>
+
+using namespace Common;
+
+
+void SlotMapTestInsertFind()
+{
+	TSlotMap<std::string> Map;
+	const CSlotHandle Null;
+	ASSERT(Map.IsEmpty() && Null.IsNull() && !Map.Find(Null) &&
+		!Map.Contains(CSlotHandle{ 5, 1 }), "Slot map insert error");
+
+	const CSlotHandle First = Map.Insert("first");
+	const CSlotHandle Second = Map.Insert("second");
+	ASSERT(!First.IsNull() && First != Second && Map.GetSize() == 2 &&
+		Map.GetSlotCount() == 2, "Slot map insert error");
+	ASSERT(*Map.Find(First) == "first" && Map[Second] == "second" &&
+		Map.SafeAt(First) == "first", "Slot map find error");
+
+	Map[First] += "!";
+	ASSERT(Map[First] == "first!", "Slot map find error");
+
+	bool bThrown = false;
+	COMMON_TRY
+	{
+		Map.SafeAt(CSlotHandle{ 7, 1 });
+	}
+	COMMON_CATCH_ALL
+	{
+		bThrown = true;
+	}
+	ASSERT(bThrown, "Slot map find error");
+
+	THashMap<CSlotHandle, int> Index;
+	Index.Insert(First, 1);
+	Index.Insert(Second, 2);
+	ASSERT(*Index.Find(Second) == 2, "Slot map handle hash error");
+}
+
+
+void SlotMapTestErase()
+{
+	TSlotMap<int> Map;
+	CSlotHandle Handles[5];
+	for (int i = 0; i < 5; ++i)
+	{
+		Handles[i] = Map.Insert(i * 10);
+	}
+
+	// last value moves into the gap, its handle still works
+	ASSERT(Map.Erase(Handles[1]) && !Map.Erase(Handles[1]),
+		"Slot map erase error");
+	ASSERT(Map.GetSize() == 4 && Map.GetValues()[1] == 40 &&
+		Map[Handles[4]] == 40 && !Map.Find(Handles[1]),
+		"Slot map erase error");
+
+	// freed slot is reused with new version
+	const CSlotHandle Reused = Map.Insert(50);
+	ASSERT(Reused.Index == Handles[1].Index && Reused != Handles[1] &&
+		!Map.Contains(Handles[1]) && Map[Reused] == 50 &&
+		Map.GetSlotCount() == 5, "Slot map erase error");
+
+	Map.Clear();
+	ASSERT(Map.IsEmpty() && !Map.Contains(Reused) &&
+		!Map.Contains(Handles[0]), "Slot map erase error");
+	const CSlotHandle Next = Map.Insert(60);
+	ASSERT(Map.GetSlotCount() == 5 && Map[Next] == 60 &&
+		!Map.Contains(Handles[0]) && !Map.Contains(Reused),
+		"Slot map erase error");
+	Map.ShrinkToFit();
+	ASSERT(Map[Next] == 60, "Slot map erase error");
+}
+
+
+void SlotMapTestIteration()
+{
+	TSlotMap<int> Map;
+	Map.Reserve(100);
+	for (int i = 0; i < 100; ++i)
+	{
+		Map.Insert(i);
+	}
+	for (size_t i = 0; i < Map.GetSize(); )
+	{
+		const CSlotHandle Handle = Map.GetHandle(i);
+		if (Map[Handle] % 3 == 0)
+		{
+			Map.Erase(Handle);
+		}
+		else
+		{
+			++i;
+		}
+	}
+
+	int Sum = 0;
+	for (const int Value : Map.GetValues())
+	{
+		ASSERT(Value % 3 != 0, "Slot map iteration error");
+		Sum += Value;
+	}
+	ASSERT(Map.GetSize() == 66 && Sum == 4950 - 1683,
+		"Slot map iteration error");
+
+	const TSlotMap<int>& ConstMap = Map;
+	size_t Count = 0;
+	ConstMap.ForEach([&ConstMap, &Count](const CSlotHandle Handle,
+		const int& Value)
+		{
+			ASSERT(&ConstMap[Handle] == &Value, "Slot map iteration error");
+			++Count;
+		});
+	ASSERT(Count == 66, "Slot map iteration error");
+}
+
+
+void SlotMapTestRandomOperations()
+{
+	// compare with plain list of (handle, value) pairs
+	TSlotMap<int> Map;
+	std::vector<CSlotHandle> Live;
+	std::vector<int> LiveValues;
+	std::vector<CSlotHandle> Dead;
+	uint64_t State = 777;
+	for (int Step = 0; Step < 20000; ++Step)
+	{
+		State = State * 6364136223846793005ull + 1442695040888963407ull;
+		const size_t Random = static_cast<size_t>(State >> 33);
+		if (Random % 5 < 3 || Live.empty())
+		{
+			Live.push_back(Map.Insert(Step));
+			LiveValues.push_back(Step);
+		}
+		else
+		{
+			const size_t Victim = Random % Live.size();
+			ASSERT(Map.Erase(Live[Victim]), "Slot map random error");
+			Dead.push_back(Live[Victim]);
+			Live[Victim] = Live.back();
+			LiveValues[Victim] = LiveValues.back();
+			Live.pop_back();
+			LiveValues.pop_back();
+		}
+	}
+
+	ASSERT(Map.GetSize() == Live.size(), "Slot map random error");
+	for (size_t i = 0; i < Live.size(); ++i)
+	{
+		ASSERT(Map[Live[i]] == LiveValues[i], "Slot map random error");
+	}
+	for (const CSlotHandle Handle : Dead)
+	{
+		ASSERT(!Map.Contains(Handle), "Slot map random error");
+	}
+	for (size_t i = 0; i < Map.GetSize(); ++i)
+	{
+		ASSERT(Map[Map.GetHandle(i)] == Map.GetValues()[i],
+			"Slot map random error");
+	}
+}
\ No newline at end of file
@@ -0,0 +1,193 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#include "..\SoAVector.h"
+
+#include <string>
+
+using namespace Common;
+
+
+typedef TSoAVector<int, double, std::string> CRecords;
+
+
+static bool AreColumnsEqual(const CRecords& Records, const int* Ids,
+	const size_t Size)
+{
+	if (Records.GetSize() != Size)
+	{
+		return false;
+	}
+	for (size_t i = 0; i < Size; ++i)
+	{
+		if (Records.At<0>(i) != Ids[i] ||
+			Records.At<1>(i) != Ids[i] * 0.5 ||
+			Records.At<2>(i) != std::to_string(Ids[i]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+
+static void PushRecord(CRecords& Records, const int Id)
+{
+	Records.Push(Id, Id * 0.5, std::to_string(Id));
+}
+
+
+void SoAVectorTestPush()
+{
+	CRecords Records;
+	ASSERT(Records.IsEmpty() && !Records.GetCapacity(),
+		"SoA vector push error");
+
+	for (int i = 0; i < 100; ++i)
+	{
+		PushRecord(Records, i);
+	}
+	ASSERT(Records.GetSize() == 100 && Records.GetCapacity() >= 100,
+		"SoA vector push error");
+	ASSERT(Records.At<0>(42) == 42 && Records.At<1>(42) == 21.0 &&
+		Records.At<2>(99) == "99", "SoA vector push error");
+
+	CRecords Small;
+	PushRecord(Small, 1);
+	PushRecord(Small, 3);
+	Small.Insert(1, 2, 1.0, "2");
+	Small.Insert(0, 0, 0.0, "0");
+	Small.Insert(4, 4, 2.0, "4");
+	const int Expected[] = {0, 1, 2, 3, 4};
+	ASSERT(AreColumnsEqual(Small, Expected, 5), "SoA vector insert error");
+
+	// inserted value refers to the field of the same vector
+	Small.Insert(0, Small.At<0>(4), Small.At<1>(4), Small.At<2>(4));
+	ASSERT(Small.At<2>(0) == "4" && Small.At<2>(5) == "4",
+		"SoA vector insert error");
+}
+
+
+void SoAVectorTestErase()
+{
+	CRecords Records;
+	for (int i = 0; i < 6; ++i)
+	{
+		PushRecord(Records, i);
+	}
+
+	Records.Erase(0);
+	Records.Erase(2);
+	Records.Pop();
+	const int Expected[] = {1, 2, 4};
+	ASSERT(AreColumnsEqual(Records, Expected, 3), "SoA vector erase error");
+
+	Records.Erase(1, CRecords::EShrinkBehavior::Require);
+	ASSERT(Records.GetCapacity() == 2, "SoA vector erase error");
+
+	Records.Pop();
+	Records.Pop();
+	ASSERT(Records.IsEmpty(), "SoA vector erase error");
+}
+
+
+void SoAVectorTestResize()
+{
+	CRecords Records;
+	Records.Resize(10);
+	ASSERT(Records.GetSize() == 10 && Records.At<0>(9) == 0 &&
+		Records.At<1>(9) == 0.0 && Records.At<2>(9).empty(),
+		"SoA vector resize error");
+
+	Records.At<2>(3) = "three";
+	Records.Resize(4, CRecords::EShrinkBehavior::Require);
+	ASSERT(Records.GetSize() == 4 && Records.GetCapacity() == 4 &&
+		Records.At<2>(3) == "three", "SoA vector resize error");
+
+	Records.Reserve(50);
+	ASSERT(Records.GetCapacity() == 50 && Records.At<2>(3) == "three",
+		"SoA vector reserve error");
+	Records.ShrinkToFit();
+	ASSERT(Records.GetCapacity() == 4, "SoA vector reserve error");
+
+	Records.Clear();
+	ASSERT(Records.IsEmpty() && !Records.GetCapacity(),
+		"SoA vector clear error");
+}
+
+
+void SoAVectorTestColumns()
+{
+	TSoAVector<float, char> Points;
+	for (int i = 0; i < 16; ++i)
+	{
+		Points.Push(float(i), char('a' + i));
+	}
+
+	TSpan<float> Values = Points.GetColumn<0>();
+	for (float& Value : Values)
+	{
+		Value *= 2.0f;
+	}
+	ASSERT(Values.GetSize() == 16 && Points.At<0>(15) == 30.0f,
+		"SoA vector column error");
+
+	const TSoAVector<float, char>& Constant = Points;
+	const TSpan<const char> Letters = Constant.GetColumn<1>();
+	ASSERT(Letters[0] == 'a' && Letters.Subspan(2, 3).GetSize() == 3 &&
+		Letters.Subspan(2)[0] == 'c', "SoA vector column error");
+}
+
+
+void SoAVectorTestRows()
+{
+	CRecords Records;
+	for (int i = 0; i < 5; ++i)
+	{
+		PushRecord(Records, i);
+	}
+
+	int Sum = 0;
+	for (const CRecords::CRowReference Row : Records)
+	{
+		Sum += Row.Get<0>();
+		Row.Get<2>() += "!";
+	}
+	ASSERT(Sum == 10 && Records.At<2>(4) == "4!", "SoA vector row error");
+
+	Records[0] = Records[4];
+	ASSERT(Records.At<0>(0) == 4 && Records.At<2>(0) == "4!" &&
+		Records[0].GetIndex() == 0, "SoA vector row error");
+
+	const CRecords& Constant = Records;
+	CRecords::CConstIterator Iterator = Constant.ConstBegin() + 2;
+	ASSERT((*Iterator).Get<0>() == 2 && (*--Iterator).Get<0>() == 1 &&
+		Constant.ConstEnd() - Constant.ConstBegin() == 5,
+		"SoA vector iterator error");
+}
+
+
+void SoAVectorTestCopy()
+{
+	CRecords Records;
+	for (int i = 0; i < 20; ++i)
+	{
+		PushRecord(Records, i);
+	}
+
+	CRecords Copy(Records);
+	Records.At<2>(0) = "changed";
+	ASSERT(Copy.GetSize() == 20 && Copy.At<2>(0) == "0" &&
+		Copy.At<2>(19) == "19", "SoA vector copy error");
+
+	CRecords Moved(static_cast<CRecords&&>(Copy));
+	ASSERT(Copy.IsEmpty() && !Copy.GetCapacity() && Moved.GetSize() == 20,
+		"SoA vector move error");
+
+	Copy = Moved;
+	Moved = CRecords();
+	ASSERT(Copy.At<2>(19) == "19" && Moved.IsEmpty(),
+		"SoA vector copy error");
+
+	Copy.Swap(Moved);
+	ASSERT(Copy.IsEmpty() && Moved.GetSize() == 20, "SoA vector swap error");
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#include "..\Tuple.h"
+
+#include <string>
+#include <type_traits>
+
+#include "CommonTypes/Vector.h"
+
+using namespace Common;
+
+
+namespace
+{
+	struct CEmptyLess
+	{
+		bool operator () (const int First, const int Second) const
+		{
+			return First < Second;
+		}
+	};
+}
+
+
+// pairs and tuples of trivial types take memcpy paths in containers
+static_assert(std::is_trivial<TPair<int, int>>::value,
+	"Pair of trivial types must be trivial");
+static_assert(std::is_trivially_copyable<TCompressedPair<CEmptyLess, int*>>
+	::value, "Compressed pair must be trivially copyable");
+static_assert(std::is_trivial<TTuple<int, double, char>>::value,
+	"Tuple of trivial types must be trivial");
+static_assert(!std::is_trivially_copyable<TTuple<int, std::string>>::value,
+	"Tuple must not be trivially copyable with non-trivial types");
+
+// empty types take no space
+static_assert(sizeof(TCompressedPair<CEmptyLess, int*>) == sizeof(int*),
+	"Compressed pair must not store empty type");
+static_assert(sizeof(TTuple<CEmptyLess, int>) == sizeof(int),
+	"Tuple must not store empty type");
+static_assert(sizeof(TTuple<int, int, int>) == 3 * sizeof(int),
+	"Tuple must not have extra fields");
+
+
+void TupleTestPair()
+{
+	const TPair<int, int> Zero = TPair<int, int>();
+	ASSERT(Zero.First == 0 && Zero.Second == 0, "Pair constructor error");
+
+	TPair<int, std::string> Pair = MakePair(1, std::string("one"));
+	Pair.MakePair(2, "two");
+	ASSERT(Pair.First == 2 && Pair.Second == "two", "Pair assign error");
+
+	TVector<TPair<int, int>> Pairs;
+	for (int i = 0; i < 100; ++i)
+	{
+		Pairs.Push(MakePair(i, -i));
+	}
+	Pairs.Insert(0, MakePair(-1, 1));
+	Pairs.Erase(50);
+	TVector<TPair<int, int>> Copy(Pairs);
+	ASSERT(Copy.GetSize() == 100 && Copy[0].First == -1 &&
+		Copy[50].First == 50 && Copy[99].Second == -99,
+		"Pair in vector error");
+}
+
+
+void TupleTestCompressedPair()
+{
+	int Value = 5;
+	TCompressedPair<CEmptyLess, int*> Pair(CEmptyLess(), &Value);
+	ASSERT(Pair.GetFirst()(1, 2) && *Pair.GetSecond() == 5,
+		"Compressed pair error");
+
+	TCompressedPair<std::string, std::string> Strings("first", "second");
+	TCompressedPair<std::string, std::string> Moved(Move(Strings));
+	ASSERT(Moved.GetFirst() == "first" && Moved.GetSecond() == "second",
+		"Compressed pair move error");
+}
+
+
+void TupleTestTuple()
+{
+	TTuple<int, std::string, double> Tuple(1, "one", 1.5);
+	ASSERT(Tuple.Get<0>() == 1 && Tuple.Get<1>() == "one" &&
+		Tuple.Get<2>() == 1.5, "Tuple constructor error");
+
+	Tuple.Get<1>() += "!";
+	const TTuple<int, std::string, double> Copy = Tuple;
+	ASSERT(Copy.Get<1>() == "one!" && Copy.Size == 3, "Tuple copy error");
+
+	const TTuple<int, int> Zero = TTuple<int, int>();
+	const TTuple<char, int> Made = MakeTuple('a', 2);
+	ASSERT(Zero.Get<0>() == 0 && Zero.Get<1>() == 0 &&
+		Made.Get<0>() == 'a' && Made.Get<1>() == 2, "Tuple make error");
+
+	const TTuple<> Empty = MakeTuple();
+	ASSERT(Empty.Size == 0, "Tuple make error");
+
+	// non-const one-value tuple is copied, not passed as the value
+	TTuple<std::string> Single(std::string("x"));
+	TTuple<std::string> SingleCopy(Single);
+	SingleCopy = Single;
+	TTuple<std::string> SingleMoved(Move(Single));
+	ASSERT(SingleCopy.Get<0>() == "x" && SingleMoved.Get<0>() == "x",
+		"Tuple copy error");
+}
\ No newline at end of file
@@ -200,6 +200,70 @@ void VectorTestInsert()
 }
 
 
+class CMoveCounter
+{
+public:
+	CMoveCounter(int Value = 0) : Value(Value) {}
+	CMoveCounter(const CMoveCounter& Other) : Value(Other.Value)
+	{
+		++Copies;
+	}
+	CMoveCounter(CMoveCounter&& Other) noexcept : Value(Other.Value)
+	{
+		++Moves;
+	}
+	CMoveCounter& operator = (const CMoveCounter& Other) = default;
+	bool operator == (const CMoveCounter& Other) const
+	{
+		return Value == Other.Value;
+	}
+
+	int Value;
+	static size_t Copies;
+	static size_t Moves;
+};
+
+size_t CMoveCounter::Copies = 0;
+size_t CMoveCounter::Moves = 0;
+
+void VectorTestInsertReallocation()
+{
+	TVector<CMoveCounter> First = { 1,2,3,4,5,6 };
+	TVector<CMoveCounter> Second = { 7,8 };
+	First.ShrinkToFit();
+	CMoveCounter::Copies = CMoveCounter::Moves = 0;
+	First.Insert(2, Second.Begin(), Second.End());
+	ASSERT(CMoveCounter::Moves == 6 && CMoveCounter::Copies == 2,
+		"Vector insert reallocation error");
+	ASSERT(First == TVector<CMoveCounter>({ 1,2,7,8,3,4,5,6 }),
+		"Vector insert reallocation error");
+
+	TVector<int> Third = { 1,2,3 };
+	Third.ShrinkToFit();
+	Third.Push(Third[0]);
+	ASSERT(Third == TVector<int>({ 1,2,3,1 }),
+		"Vector insert reallocation error");
+
+	Third.ShrinkToFit();
+	Third += Third;
+	ASSERT(Third == TVector<int>({ 1,2,3,1,1,2,3,1 }),
+		"Vector insert reallocation error");
+
+	Third = { 1,2 };
+	Third.ShrinkToFit();
+	Third.Insert(1, Third.ConstBegin(), Third.ConstEnd());
+	ASSERT(Third == TVector<int>({ 1,1,2,2 }),
+		"Vector insert reallocation error");
+
+	TVector<CMoveCounter> Fourth = { 9 };
+	CMoveCounter::Copies = CMoveCounter::Moves = 0;
+	TVector<CMoveCounter> Fifth = First + Second + Fourth;
+	ASSERT(CMoveCounter::Copies == 11, "Vector insert reallocation error");
+	ASSERT(Fifth == TVector<CMoveCounter>({ 1,2,7,8,3,4,5,6,7,8,9 }),
+		"Vector insert reallocation error");
+}
+
+
 void VectorTestReserve()
 {
 	TVector<int> First;
@@ -258,6 +322,109 @@ void VectorTestReserve()
 }
 
 
+void VectorTestCapacityPolicies()
+{
+	TVector<int, COneAndHalfGrowth> First;
+	First.Push(1);
+	ASSERT(First.GetCapacity() == 4, "Vector capacity policy error");
+	for (int i = 0; i < 4; ++i)
+	{
+		First.Push(i);
+	}
+	ASSERT(First.GetCapacity() == 7, "Vector capacity policy error");
+	First.SetCapacityRule(TVector<int>::EReservedCapacityRule::NeverReserve);
+	First.Push(5);
+	First.Push(6);
+	ASSERT(First.GetCapacity() == 7, "Vector capacity policy error");
+	First.Push(7);
+	ASSERT(First.GetCapacity() == 8, "Vector capacity policy error");
+
+	ASSERT(RoundUpToSizeClass(1, EAllocatorSizeClasses::Jemalloc) == 8 &&
+		RoundUpToSizeClass(17, EAllocatorSizeClasses::Jemalloc) == 32 &&
+		RoundUpToSizeClass(129, EAllocatorSizeClasses::Jemalloc) == 160 &&
+		RoundUpToSizeClass(1000, EAllocatorSizeClasses::Jemalloc) == 1024 &&
+		RoundUpToSizeClass(1025, EAllocatorSizeClasses::Jemalloc) == 1280,
+		"Vector capacity policy error");
+	for (size_t Bytes = 1; Bytes < 300000; Bytes += 997)
+	{
+		ASSERT(RoundUpToSizeClass(Bytes, EAllocatorSizeClasses::Glibc)
+			>= Bytes, "Vector capacity policy error");
+	}
+
+	TVector<char, TSizeClassGrowth<COneAndHalfGrowth,
+		EAllocatorSizeClasses::Jemalloc>> Second;
+	Second.Push('a');
+	ASSERT(Second.GetCapacity() == 16, "Vector capacity policy error");
+	for (int i = 0; i < 16; ++i)
+	{
+		Second.Push('b');
+	}
+	ASSERT(Second.GetCapacity() == 32 && Second.GetSize() == 17,
+		"Vector capacity policy error");
+
+	// Capacity is 2 * Size after shrink, next shrink is at Size / 4
+	TVector<int, CRuleGrowth, THysteresisShrink<4, 2, 16>> Third;
+	Third.Resize(100);
+	Third.ShrinkToFit();
+	Third.Resize(26);
+	ASSERT(Third.GetCapacity() == 100, "Vector capacity policy error");
+	Third.Resize(24);
+	ASSERT(Third.GetCapacity() == 48, "Vector capacity policy error");
+	for (int i = 0; i < 10; ++i)
+	{
+		Third.Push(i);
+		Third.Pop();
+	}
+	ASSERT(Third.GetCapacity() == 48, "Vector capacity policy error");
+	Third.Clear();
+	ASSERT(Third.GetCapacity() == 4, "Vector capacity policy error");
+}
+
+void VectorTestTry()
+{
+	TVector<int> First;
+	ASSERT(!First.TryAt(0) && !First.TryFront() && !First.TryBack(),
+		"Vector try error");
+	ASSERT(First.TryPop() == EStatus::OutOfRange &&
+		First.TryShift() == EStatus::OutOfRange &&
+		First.TryErase(0) == EStatus::OutOfRange, "Vector try error");
+
+	for (int i = 0; i < 10; ++i)
+	{
+		ASSERT(First.TryPush(i) == EStatus::Ok, "Vector try error");
+	}
+	ASSERT(*First.TryAt(3) == 3 && *First.TryFront() == 0 &&
+		*First.TryBack() == 9 && !First.TryAt(10), "Vector try error");
+
+	ASSERT(First.TryInsert(11, 0) == EStatus::OutOfRange &&
+		First.TryInsert(10, 10) == EStatus::Ok &&
+		First.TryInsert(0, -1) == EStatus::Ok, "Vector try error");
+	ASSERT(First.GetSize() == 12 && First[0] == -1 && First[11] == 10,
+		"Vector try error");
+
+	// element of the same vector survives reallocation
+	First.ShrinkToFit();
+	ASSERT(First.TryPush(First[1]) == EStatus::Ok && First.Back() == 0,
+		"Vector try error");
+
+	ASSERT(First.TryShift() == EStatus::Ok && First.TryPop() == EStatus::Ok &&
+		First.TryErase(0) == EStatus::Ok, "Vector try error");
+	ASSERT(First.GetSize() == 10 && First[0] == 1, "Vector try error");
+
+	// size overflow is reported without touching the vector
+	const size_t Capacity = First.GetCapacity();
+	ASSERT(First.TryReserve(static_cast<size_t>(-1)) == EStatus::BadAlloc,
+		"Vector try error");
+	ASSERT(First.GetCapacity() == Capacity && First.GetSize() == 10 &&
+		First[9] == 10, "Vector try error");
+	ASSERT(First.TryReserve(100) == EStatus::Ok &&
+		First.GetCapacity() == 100, "Vector try error");
+
+	const TVector<int>& Second = First;
+	ASSERT(*Second.TryAt(1) == 2 && *Second.TryBack() == 10,
+		"Vector try error");
+}
+
 void VectorTestResize()
 {
 	TVector<int> First = { 1,2,3 };
@@ -289,6 +456,45 @@ void VectorTestResize()
 }
 
 
+void VectorTestResizeUninitialized()
+{
+	TVector<int> First = { 1,2,3 };
+	First.ResizeUninitialized(6);
+	ASSERT(First.GetSize() == 6 && First[2] == 3,
+		"Vector uninitialized resize error");
+	First[3] = 4;
+	First[4] = 5;
+	First[5] = 6;
+	TVector<int> Second = { 1,2,3,4,5,6 };
+	ASSERT(First == Second, "Vector uninitialized resize error");
+
+	int* Tail = First.AppendUninitialized(3);
+	ASSERT(Tail == First.RawData() + 6 && First.GetSize() == 9,
+		"Vector uninitialized resize error");
+	Tail[0] = 7;
+	Tail[1] = 8;
+	Tail[2] = 9;
+	Second = { 1,2,3,4,5,6,7,8,9 };
+	ASSERT(First == Second, "Vector uninitialized resize error");
+
+	First.ResizeUninitialized(2, TVector<int>::EShrinkBehavior::Require);
+	Second = { 1,2 };
+	ASSERT(First == Second && First.GetCapacity() == 2,
+		"Vector uninitialized resize error");
+
+	First.AppendUninitialized(0);
+	ASSERT(First == Second, "Vector uninitialized resize error");
+
+	TVector<TVector<int>> Third(2, { 1 });
+	Third.ResizeDefaultInit(4);
+	ASSERT(Third.GetSize() == 4 && Third[1][0] == 1 && Third[3].IsEmpty(),
+		"Vector uninitialized resize error");
+	Third.ResizeDefaultInit(1);
+	ASSERT(Third.GetSize() == 1 && Third[0].GetSize() == 1,
+		"Vector uninitialized resize error");
+}
+
+
 void VectorTestErase()
 {
 	TVector<int> First = { 1,2,3,4,5 };
@@ -325,6 +531,79 @@ void VectorTestErase()
 }
 
 
+void VectorTestEraseBatch()
+{
+	TVector<int> First = { 1,2,3,4,5 };
+	First.EraseUnordered(1);
+	TVector<int> Second = { 1,5,3,4 };
+	ASSERT(First == Second, "Vector batch erase error");
+
+	First.EraseUnordered(3);
+	First.SafeEraseUnordered(0);
+	Second = { 3,5 };
+	ASSERT(First == Second, "Vector batch erase error");
+
+	bool bThrown = false;
+	try
+	{
+		First.SafeEraseUnordered(2);
+	}
+	catch (const COutOfRange&)
+	{
+		bThrown = true;
+	}
+	ASSERT(bThrown, "Vector batch erase error");
+
+	First = { 1,2,3,4,5,6,7,8,9,10 };
+	ASSERT(First.EraseIf([](int Value) { return Value % 3 == 0; }) == 3,
+		"Vector batch erase error");
+	Second = { 1,2,4,5,7,8,10 };
+	ASSERT(First == Second, "Vector batch erase error");
+
+	ASSERT(First.EraseIf([](int) { return false; }) == 0 &&
+		First == Second, "Vector batch erase error");
+
+	First.EraseIf([](int) { return true; }, 
+		TVector<int>::EShrinkBehavior::Require);
+	ASSERT(First.GetSize() == 0 && First.GetCapacity() == 0,
+		"Vector batch erase error");
+
+	First = { 0,1,2,3,4,5,6,7,8,9 };
+	ASSERT(First.EraseIndices({ 0,3,3,4,9 }) == 4, "Vector batch erase error");
+	Second = { 1,2,5,6,7,8 };
+	ASSERT(First == Second, "Vector batch erase error");
+
+	ASSERT(First.EraseIndices({}) == 0 && First == Second,
+		"Vector batch erase error");
+
+	bThrown = false;
+	try
+	{
+		First.SafeEraseIndices({ 2,1 });
+	}
+	catch (const COutOfRange&)
+	{
+		bThrown = true;
+	}
+	ASSERT(bThrown && First == Second, "Vector batch erase error");
+
+	bThrown = false;
+	try
+	{
+		First.SafeEraseIndices({ 1,6 });
+	}
+	catch (const COutOfRange& Exception)
+	{
+		bThrown = Exception.GetRequestedIndex() == 6;
+	}
+	ASSERT(bThrown && First == Second, "Vector batch erase error");
+
+	First.SafeEraseIndices({ 1,5 });
+	Second = { 1,5,6,7 };
+	ASSERT(First == Second, "Vector batch erase error");
+}
+
+
 void VectorTestIterators()
 {
 	const TVector<int> First = { 1,2,3,4,5 };
@@ -423,6 +702,58 @@ void VectorTestIterators()
 }
 
 
+void VectorTestCheckedIterators()
+{
+	TVector<int> First = { 1,2,3,4,5 };
+	ASSERT(*(First.ReverseBegin() + 1) == 4 &&
+		*(First.ReverseEnd() - 2) == 2, "Vector checked iterator error");
+
+	bool bThrown = false;
+	try
+	{
+		*First.SafeEnd();
+	}
+	catch (const COutOfRange&)
+	{
+		bThrown = true;
+	}
+	ASSERT(bThrown, "Vector checked iterator error");
+
+#if COMMONLIBS_CHECKED_ITERATORS
+	auto Iterator = First.Begin();
+	First.Push(6);
+	bThrown = false;
+	try
+	{
+		++Iterator;
+	}
+	catch (const CInvalidIterator&)
+	{
+		bThrown = true;
+	}
+	ASSERT(bThrown, "Vector checked iterator error");
+
+	auto SafeIterator = First.SafeBegin();
+	First.Erase(0);
+	bThrown = false;
+	try
+	{
+		*SafeIterator;
+	}
+	catch (const CInvalidIterator&)
+	{
+		bThrown = true;
+	}
+	ASSERT(bThrown, "Vector checked iterator error");
+
+	auto ConstIterator = First.ConstBegin();
+	First[0] = 7;	// element access does not invalidate
+	ASSERT(*ConstIterator == 7 && *(First.Begin() + 1) == 3,
+		"Vector checked iterator error");
+#endif
+}
+
+
 void VectorTestConst()
 {
 	const TVector<int> First = { 1,1,3,4,5 };
@@ -0,0 +1,25 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#pragma once
+
+// RUN IN DEBUG MODE!!
+
+#include "CommonTypes/Serialization.h"
+#include "CommonUtils/Assert.h"
+
+
+void SerializationTestScalars();
+void SerializationTestContainers();
+void SerializationTestBulk();
+void SerializationTestErrors();
+void SerializationTestFile();
+
+
+inline void RunSerializationTests()
+{
+	SerializationTestScalars();
+	SerializationTestContainers();
+	SerializationTestBulk();
+	SerializationTestErrors();
+	SerializationTestFile();
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#pragma once
+
+// RUN IN DEBUG MODE!!
+
+#include "CommonTypes/SlotMap.h"
+#include "CommonTypes/HashMap.h"
+#include "CommonUtils/Assert.h"
+
+
+void SlotMapTestInsertFind();
+void SlotMapTestErase();
+void SlotMapTestIteration();
+void SlotMapTestRandomOperations();
+
+
+inline void RunSlotMapTests()
+{
+	SlotMapTestInsertFind();
+	SlotMapTestErase();
+	SlotMapTestIteration();
+	SlotMapTestRandomOperations();
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#pragma once
+
+// RUN IN DEBUG MODE!!
+
+#include "CommonTypes/SoAVector.h"
+#include "CommonUtils/Assert.h"
+
+
+void SoAVectorTestPush();
+void SoAVectorTestErase();
+void SoAVectorTestResize();
+void SoAVectorTestColumns();
+void SoAVectorTestRows();
+void SoAVectorTestCopy();
+
+
+inline void RunSoAVectorTests()
+{
+	SoAVectorTestPush();
+	SoAVectorTestErase();
+	SoAVectorTestResize();
+	SoAVectorTestColumns();
+	SoAVectorTestRows();
+	SoAVectorTestCopy();
+}
\ No newline at end of file
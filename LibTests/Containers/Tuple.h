@@ -0,0 +1,21 @@
+// Yuri Zamyatin, 2020-2021. This file is part of LibTests
+
+#pragma once
+
+// RUN IN DEBUG MODE!!
+
+#include "CommonTypes/Tuple.h"
+#include "CommonUtils/Assert.h"
+
+
+void TupleTestPair();
+void TupleTestCompressedPair();
+void TupleTestTuple();
+
+
+inline void RunTupleTests()
+{
+	TupleTestPair();
+	TupleTestCompressedPair();
+	TupleTestTuple();
+}
\ No newline at end of file
@@ -16,10 +16,16 @@ void VectorTestOperators();
 void VectorTestAssignment();
 void VectorTestPushPopShift();
 void VectorTestInsert();
+void VectorTestInsertReallocation();
 void VectorTestReserve();
+void VectorTestCapacityPolicies();
+void VectorTestTry();
 void VectorTestResize();
+void VectorTestResizeUninitialized();
 void VectorTestErase();
+void VectorTestEraseBatch();
 void VectorTestIterators();
+void VectorTestCheckedIterators();
 void VectorTestConst();
 void VectorTestPlacementNew();
 
@@ -31,10 +37,16 @@ inline void RunVectorTests()
 	VectorTestAssignment();
 	VectorTestPushPopShift();
 	VectorTestInsert();
+	VectorTestInsertReallocation();
 	VectorTestReserve();
+	VectorTestCapacityPolicies();
+	VectorTestTry();
 	VectorTestResize();
+	VectorTestResizeUninitialized();
 	VectorTestErase();
+	VectorTestEraseBatch();
 	VectorTestIterators();
+	VectorTestCheckedIterators();
 	VectorTestConst();
 //	VectorTestPlacementNew();
 }
\ No newline at end of file